@@ -9,7 +9,7 @@ public:
 		big_ = KuEndian::isNativeBig();
 	}
 
-	// 趨ȡĿݵĴС˸ʽ
+	// 设定与获取目标数据的大小端格式
 	void setBigEndian(bool big = true) { big_ = big; }
 	void setLittleEndian(bool little = true) { big_ = !little; }
                 void flipEndian() { big_ = !big_; }
@@ -17,7 +17,7 @@ public:
 	bool isLittleEndian() const { return !big_; }
 
 
-	// ƥĿ뱾ݴС˸ʽ
+	// 匹配目标数据与本地数据大小端格式
 	template<typename T>
 	void matchEndian(T& val) {
 		if (KuEndian::isNativeBig() != big_)
@@ -25,7 +25,7 @@ public:
 	}
 
 
-	// ƥ
+	// 批量匹配
 	template<typename T>
 	void matchEndian(T buf[], unsigned count) {
 		if (KuEndian::isNativeBig() != big_)
@@ -33,6 +33,6 @@ public:
 	}
 
 private:
-	bool big_; // ĿǷ˸ʽ
+	bool big_; // 目标数据是否大端格式？
 };
 
@@ -151,7 +151,7 @@ std::string KuLex::rewriteString(const char *s, char q, bool noNumEscapes)
 				(*p == '\'' || *p == '"')))
 			dst.push_back('\\'), dst.push_back(*p);
 		else if (isPrint(*p) || noNumEscapes) dst.push_back(*p);
-		else { // ɴӡַдΪ3λ˽Ʊʾ. \123
+		else { // 将不可打印字符改写为3位八进制表示. 如\123
 			int n = *p;
 			dst.push_back('\\');
 			dst.push_back(((n / 64) % 8) + '0'); dst.push_back(((n / 8) % 8) + '0'); dst.push_back((n % 8) + '0');
@@ -165,9 +165,9 @@ std::string KuLex::rewriteString(const char *s, char q, bool noNumEscapes)
 
 void KuLex::parseString(char* s)
 {
-	const char* p = s; // pΪָ룬sΪдָ
+	const char* p = s; // p为读指针，s为写指针
 
-	while (*p != '\\' && *p != '\0') ++p; // ٴ
+	while (*p != '\\' && *p != '\0') ++p; // 快速处理
 	if (*p == '\0')
 		return;
 
@@ -178,7 +178,7 @@ void KuLex::parseString(char* s)
 			*s++ = 64 * (p[1] - '0') + 8 * (p[2] - '0') + (p[3] - '0');
 			p += 4; // skip \123
 		}
-		else { // '\'Ϊתַҽ
+		else { // 将'\'作为转移字符，当且仅忽略它
 			*s++ = *++p;
 			++p;
 		}
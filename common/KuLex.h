@@ -86,19 +86,19 @@ public:
 	static int isIsoBasic(char ch) { return isPrint(ch) || isSpaceOrNul(ch); } // _sch_isprint|_sch_iscppsp
 	static int isIsoBasic(wchar_t ch) { return isPrint(ch) || isSpaceOrNul(ch); }
 
-	/// isIdNumı壬˶$֧
+	/// isIdNum的变体，增加了对$的支持
 	static int isIdChar(char ch, bool bDollarOk) { return isIdNum(ch) || (ch == '$' && bDollarOk); }
 	static int isIdChar(wchar_t ch, bool bDollarOk) { return isIdNum(ch) || (ch == L'$' && bDollarOk); }
 
-	/// isIdstı壬˶$֧
+	/// isIdst的变体，增加了对$的支持
 	static int isIdStart(char ch, bool bDollarOk) { return isIdst(ch) || (ch == '$' && bDollarOk); }
 	static int isIdStart(wchar_t ch, bool bDollarOk) { return isIdst(ch) || (ch == L'$' && bDollarOk); }
 
 
-	// Ƿ֣͸naninf
+	// 是否数字，包括整数和浮点数，兼容nan、inf
 	static bool isNumeric(const char *tag);
 
-	// Ƿ
+	// 是否整数
 	static bool isInteger(const char* tag);
 
 
@@ -165,9 +165,9 @@ public:
 	}
 
 
-	// ĿǰtokenΪ3ʽһַ޿հףǱ"'ַмпհַ
-	// idnameͷidname
-	// @forceSpaceΪ棬spacetokenķָ޷ʶ𱻷idnameַָidname
+	// 目前token定义为3种形式：一是连续字符串（无空白），二是被"或'引起来的字符串（中间可有空白字符），
+	// 三是idname和非idname
+	// @forceSpace，若为真，则仅把space当做token的分割符，无法识别被非idname字符分割的idname
 	template<typename CHAR = char>
 	static std::basic_string<CHAR> getToken(std::basic_istream<CHAR>& is, bool forceSpace);
 
@@ -183,11 +183,11 @@ public:
 
 
 	/* Convert string tag to writeable format */
-	/// @quote: ַtagͷβ׷ӵ. quote = '\\'  quote <= 0ʱ׷
+	/// @quote: 拟在字符串tag头尾追加的引号. quote = '\\' 或 quote <= 0时，不追加引号
 	/// @noNumEscapes: if true, prevent writing in \012 format
 	static std::string rewriteString(const char *tag, char quote = '\\', bool noNumEscapes = false);
 
-	/* rewriteString */
+	/* rewriteString的逆操作 */
 	static void parseString(char* tag);
 
 
@@ -4,7 +4,7 @@
 #include <assert.h>
 
 
-// X <-> Y˫ӳ䣬˫򶼱һһ
+// X <-> Y的双向映射，双向都必须是一对一的
 template<typename X, typename Y>
 class bimap
 {
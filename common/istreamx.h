@@ -9,7 +9,7 @@
 namespace stdx 
 {
 
-	/// std::istreamչ
+	/// std::istream的扩展
 
 	class istreamx : public KmEndianed
 	{
@@ -22,7 +22,7 @@ namespace stdx
 			: strm_(strmx.strm_), bin_(strmx.bin_) {}
 
 
-		// ȡ
+		// 读取标量数据
 		template<class T>
 		typename std::enable_if_t<std::is_scalar<T>::value, istreamx&>
 		read(T& val) {
@@ -78,7 +78,7 @@ namespace stdx
 		}
 
 
-		// ȡ
+		// 读取数组
 		template<typename T>
 		typename std::enable_if_t<std::is_scalar<T>::value, istreamx&>
 		read(T* val, unsigned count) {
@@ -119,7 +119,7 @@ namespace stdx
 		}
 
 
-		// ȡԳȿͷַ'\0'β
+		// 读取以长度开头的字符串，无'\0'结尾
 		template<typename CHAR, typename SIZE_TYPE = std::uint32_t>
 		istreamx& readBinString(std::basic_string<CHAR>& retString) {
 			SIZE_TYPE len = 0;
@@ -156,7 +156,7 @@ namespace stdx
 
 	private:
 		std::istream& strm_;
-		bool bin_; // Ƿƶдģʽ
+		bool bin_; // 是否二进制读写模式
 	};
 
 
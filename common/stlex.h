@@ -222,7 +222,7 @@ namespace stdx
 	}
 
 
-	// ȡϵĲs1 + s2
+	// 取两个集合的并集，即s1 + s2
 	template<typename T1, typename T2 = T1, typename T3 = T2>
 	T3 unite(const T1& s1, const T2& s2)
 	{
@@ -234,7 +234,7 @@ namespace stdx
 	}
 
 
-	// ȡϵĽs1 & s2
+	// 取两个集合的交集，即s1 & s2
 	template<typename T1, typename T2 = T1, typename T3 = T2>
 	T3 intersect(const T1& s1, const T2& s2)
 	{
@@ -247,7 +247,7 @@ namespace stdx
 	}
 
 
-	// ȡϵĲs1s2Ԫؼϣs1 - s2
+	// 取两个集合的差集：在s1但不在s2的元素集合，即s1 - s2
 	template<typename T1, typename T2 = T1, typename T3 = T2>
 	T3 diff(const T1& s1, const T2& s2)
 	{
@@ -262,7 +262,7 @@ namespace stdx
 	}
 
 
-	// жs1Ƿڻs2s1 <= s2
+	// 判断s1是否包含于或等于s2，即s1 <= s2
 	template<typename T1, typename T2 = T1>
 	bool is_sub_of(const T1& s1, const T2& s2)
 	{
@@ -13,7 +13,7 @@ KcGaussPdf::KcGaussPdf(unsigned dim)
 
 
 // p(x) = 1/A * exp(-B/2)
-//  A = (sqrt(2*pi))^n * sigma[0] * sigma[1] * ... * sigma[n-1]
+// 其中 A = (sqrt(2*pi))^n * sigma[0] * sigma[1] * ... * sigma[n-1]
 //      B = ((x[0]-u[0])/sigma[0])^2 + ((x[1]-u[1])/sigma[1])^2 + ...
 double KcGaussPdf::prob(const double* obs) const
 {
@@ -24,7 +24,7 @@ double KcGaussPdf::prob(const double* obs) const
 		prob = gconst_;
 		for (unsigned i = 0; i < dim; i++) {
 			double d = obs[i] - mean_[i];
-			prob += d * d * invCov_[i]; // TODO: cov[i] == 0
+			prob += d * d * invCov_[i]; // TODO: 处理cov[i] == 0的情况
 		}
 
 		prob *= -0.5;
@@ -69,20 +69,20 @@ bool KcGaussPdf::setCovar(const double* cov, bool bDiag)
 
 		for (unsigned i = 0; i < dim; i++) {
 			inv_cov[i] = 1.0 / cov[i];
-			factor += log(cov[i]); // TODO: cov[i] == 0
+			factor += log(cov[i]); // TODO: 处理cov[i] == 0的情况
 		}
 	}
 	else {
 		using MatrixRxd = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
 
-		// ЭCholeskiֽ c = L * LT
+		// 对协方差阵进行Choleski分解 c = L * LT
 		Eigen::Map<const MatrixRxd> c(cov, dim, dim);
 		auto llt = c.selfadjointView<Eigen::Lower>().llt();
 		if (llt.info() != Eigen::Success)
 			return false;
 
-		// Эc-1.
-		// תΪ cx = I, L*LT*x = I
+		// 计算协方差阵的逆矩阵c-1.
+		// 转换为求解 cx = I, 即L*LT*x = I
 		invCov_.resize(dim, dim);
 		double* inv_cov = invCov_.data();
 		Eigen::Map<MatrixRxd> inv(inv_cov, dim, dim);
@@ -90,7 +90,7 @@ bool KcGaussPdf::setCovar(const double* cov, bool bDiag)
 		llt.solveInPlace(inv);
 
 		// det(c) = det(L*LT) = det(L) * det(L)
-		double LDet = llt.matrixL().determinant(); // // ʽΪԽԪ֮
+		double LDet = llt.matrixL().determinant(); // // 三角阵的行列式为对角线元素之积
 		factor += 2 * log(LDet); // += log(det(c))
 	}
 
@@ -111,14 +111,14 @@ std::vector<double> KcGaussPdf::covar() const
 	else {
 		using MatrixRxd = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
 
-		// ЭCholeskiֽ c = L * LT
+		// 对协方差阵进行Choleski分解 c = L * LT
 		auto dim = this->dim();
 		Eigen::Map<const MatrixRxd> c(invCov_.data(), dim, dim);
 		auto llt = c.selfadjointView<Eigen::Lower>().llt();
 		assert(llt.info() == Eigen::Success);
 
-		// Эc-1.
-		// תΪ cx = I, L*LT*x = I
+		// 计算协方差阵的逆矩阵c-1.
+		// 转换为求解 cx = I, 即L*LT*x = I
 		cov.resize(dim, dim);
 		Eigen::Map<MatrixRxd> covM(cov.data(), dim, dim);
 		covM.setIdentity();
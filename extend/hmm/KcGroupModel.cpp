@@ -6,7 +6,7 @@ KcGroupModel::KcGroupModel(unsigned numGroups, const unsigned* subDims)
 {
 	subDims_.assign(subDims, subDims + numGroups);
 	
-	weights_.assign(numGroups, 0); // ʼȨֵlog(1) 
+	weights_.assign(numGroups, 0); // 初始权值置log(1) 
 
 	models_.resize(numGroups);
 
@@ -42,7 +42,7 @@ double KcGroupModel::prob(const double* obs) const
 	double prob(0.0);
 	for (unsigned i = 0; i < weights_.size(); i++) {
 		assert(models_[i] && models_[i]->dim() == subDims_[i]);
-		prob += weights_[i] * models_[i]->prob(obs); // ȷ˴log
+		prob += weights_[i] * models_[i]->prob(obs); // 确保此处返回log概率
 		obs += subDims_[i];
 	}
 
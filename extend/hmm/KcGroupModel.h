@@ -4,7 +4,7 @@
 #include "KvProbModel.h"
 
 
-// οhtkʵֵķģͣ൱htkеstream
+// 参考htk实现的分组模型，各分组相当于htk中的stream
 // P(x) = P(x[0])^w[0] * ... * P(x[n-1])^w[n-1]
 // ==> log(P(x)) = w[0]*log(P(x[0])) + ... + w[n-1]*log(P(x[n-1]))
 class KcGroupModel : public KvProbModel
@@ -14,18 +14,18 @@ public:
 	KcGroupModel(const std::vector<unsigned>& subDims);
 
 
-	// Ŀ
+	// 分组数目
 	unsigned numGroups() const { 
 		return static_cast<unsigned>(subDims_.size()); 
 	}
 
-	// ά
+	// 输入特征的总维度
 	unsigned dim() const { return totalDim_; }
 
-	// idxά
+	// 第idx个分组的维度
 	unsigned subDim(unsigned idx) const { return subDims_[idx]; }
 
-	// ȡidx
+	// 获取第idx个分组分量
 	std::shared_ptr<KvProbModel> modelAt(unsigned idx) const {
 		return models_[idx];
 	}
@@ -46,7 +46,7 @@ public:
 	double prob(const double* obs_seq[], unsigned len, unsigned pos) const override;
 
 private:
-	std::vector<unsigned> subDims_; // ά
+	std::vector<unsigned> subDims_; // 各分组的维度
 	std::vector<double> weights_;
 	std::vector<std::shared_ptr<KvProbModel>> models_;
 	unsigned totalDim_; // = SUM(subDims_[i])
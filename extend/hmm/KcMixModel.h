@@ -4,18 +4,18 @@
 #include "KvProbModel.h"
 
 
-// ͨûģͣP(x) = w[0]*P(x[0]) + ... + w[n-1]*P(x[n-1])
-// Աmodels_Ԫؾʹgaussʱ˻Ϊgmm
+// 通用混合模型：P(x) = w[0]*P(x[0]) + ... + w[n-1]*P(x[n-1])
+// 当成员models_的元素均使用gauss时，退化为gmm
 class KcMixModel : public KvProbModel
 {
 public:
 	KcMixModel() = default;
 
-	void resize(unsigned numMix); // ʼKvProbModelΪnullptr
+	void resize(unsigned numMix); // 初始化KvProbModel对象为nullptr
 
 	unsigned dim() const override;
 
-	// (logֵ)
+	// 输入概率(log值)
 	double prob(const double* obs) const override;
 
 	unsigned numMix() const { 
@@ -23,7 +23,7 @@ public:
 	}
 
 
-	// ȡidxϷ
+	// 获取第idx个混合分量
 	std::shared_ptr<KvProbModel> modelAt(unsigned idx) const {
 		return models_[idx];
 	}
@@ -32,7 +32,7 @@ public:
 		return models_[idx];
 	}
 
-	// wlogΪ棬ʾwΪlogֵ
+	// 若wlog为真，表示w为log值
 	void setWeight(unsigned idx, double w, bool wlog = false);
 	void setWeights(const double w[/*numMix*/], bool wlog = false);
 
@@ -13,7 +13,7 @@ namespace kPrivate
 
 KgHmm::KgHmm(unsigned numStates)
 {
-	dptr_ = new kPrivate::kHmm(numStates + 2); // ϳ̬̬
+	dptr_ = new kPrivate::kHmm(numStates + 2); // 加上初态和终态
 }
 
 
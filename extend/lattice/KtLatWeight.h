@@ -3,7 +3,7 @@
 #include <vector>
 
 
-// lattice-weight2ɣֱgraph costacoustic cost
+// lattice-weight由2个浮点数构成，分别代表graph cost和acoustic cost
 
 template<typename T>
 class KtLatWeight : public KtPairSemiring<KtTropicalSemiring<T>, KtTropicalSemiring<T>>
@@ -12,7 +12,7 @@ public:
 	using super_ = KtPairSemiring<KtTropicalSemiring<T>, KtTropicalSemiring<T>>;
 	using super_::super_;
 
-	constexpr static bool isCompact() { return false; } // TODO: õʵַ
+	constexpr static bool isCompact() { return false; } // TODO: 其他更好的实现方法？
 
 	static const KtLatWeight& one() {
 		return (const KtLatWeight&)super_::one();
@@ -23,7 +23,7 @@ public:
 	}
 
 
-	// ʵ+
+	// 重实现+操作符
 	KtLatWeight operator+(const KtLatWeight& rhs) const {
 		T cost0 = T(super_::value0()) + T(super_::value1());
 		T cost1 = T(rhs.value0()) + T(rhs.value1());
@@ -50,8 +50,8 @@ public:
 
 
 
-// οkaldiʵֵcompact-lattic-weight
-// ҪKtLatWeightϣһУtransition-ids
+// 参考kaldi实现的compact-lattic-weight
+// 主要在KtLatWeight基础上，增加了一个整数序列，代表transition-ids
 
 template<typename WT_TYPE, typename INT_TYPE>
 class KtCompactLatWeight : public KtPairSemiring<WT_TYPE, std::vector<INT_TYPE>>
@@ -5,11 +5,11 @@
 #include "../../graph/core/KtAdjIter.h"
 
 
-// LatticeͨΪƵ
+// Lattice通常作为音频解码的输出。
 // 
-// Latticeһ޻WFSAhmm״̬hmmأʣתƸ.
-// ÿڵһƵĳʱĶ롣
-// ת¼ĽǱLatticõߵ÷ִС
+// Lattice是一个无环WFSA，结点可以是hmm状态、hmm（音素）、词，边是转移概率.
+// 每个节点是一段音频在某个时间的对齐。
+// 转录的结果是遍历Lattic后得到的最高得分词序列。
 //
 // for detail see https://www.danielpovey.com/files/2012_icassp_lattices.pdf
 //
@@ -28,21 +28,21 @@ public:
 	}
 
     
-    // ظ֡acousticȨֵӦlat-weightvalue1Ԫظthis-latisymeps״̬
-    // isymeps״̬acousticȨֵۼƵǰ״̬ǰ״̬ۼƵһ״̬
-    // NOTEnbest-latticelatticeoutdegree1
+    // 返回各帧的acoustic权值（对应lat-weight的value1），其元素个数等于this-lat中isym不等于eps的状态数量
+    // 对于isym等于eps的状态，其acoustic权值累计到前序状态；若无前序状态，则累计到下一个状态。
+    // NOTE：仅适用于nbest-lattice，即线性lattice，最大outdegree等于1
     std::vector<double> acousticCostsPerFrame() const;
 
 
-    // ظڵʱֵ֡ʾ
-    // non-compact-latticeص鳤ȵlatticeĽڵ㣨״̬
-    // compact-latticeص鳤ȵlatticeĽڵ㣨״̬ + 1һԪۼ̬ʱ
-    // NOTEھtopolattice.
+    // 返回各节点的时间值（以帧数表示）。
+    // 对于non-compact-lattice，返回的数组长度等于lattice的节点（状态）数
+    // 对于compact-lattice，返回的数组长度等于lattice的节点（状态）数 + 1，最后一个元素累加了终态的时间
+    // NOTE：仅适用于经过topo排序的lattice.
     std::vector<int> stateTimes() const;
     
 
-    // ·Уosymеߴ
-    // NOTEھtopolattice.
+    // 返回所有路径中，osym序列的最长尺寸
+    // NOTE：仅适用于经过topo排序的lattice.
     int longestSentenceLength() const;
 
 private:
@@ -60,7 +60,7 @@ std::vector<double> KtLattice<WEIGHT_TYPE>::acousticCostsPerFrame() const
     loglikes.reserve(super_::size());
 
     auto cur_state = super_::initials().begin()->first;
-    double eps_acwt = 0.0; // ʼepsתƵۼacȨֵ
+    double eps_acwt = 0.0; // 最开始的eps转移的累计ac权值
     while (true) {
         auto w = super_::weight_type::zero();
         if (super_::isFinal(cur_state))
@@ -86,14 +86,14 @@ std::vector<double> KtLattice<WEIGHT_TYPE>::acousticCostsPerFrame() const
                     acwt += eps_acwt; 
                     eps_acwt = 0.0;
                 }
-                loglikes.push_back(acwt); // ѹacwt
+                loglikes.push_back(acwt); // 压入acwt
             }
-            else if (acwt == acwt) { // isym == epsacwt != nan
-                if (loglikes.empty()) { // Ƿǰ׺epsת
-                    eps_acwt += acwt; // ۼacȨֵʱeps_acwt
+            else if (acwt == acwt) { // isym == eps，且acwt != nan
+                if (loglikes.empty()) { // 是否前缀的eps转移
+                    eps_acwt += acwt; // 累加ac权值到临时变量eps_acwt
                 }
                 else { 
-                    loglikes.back() += acwt; // ۼacȨֵǰ֡
+                    loglikes.back() += acwt; // 累加ac权值到前序帧
                 }
             }
             cur_state = iter.to();
@@ -116,7 +116,7 @@ std::vector<int> KtLattice<WEIGHT_TYPE>::stateTimes() const
 
     std::vector<int> times(super_::numStates(), -1);
     if constexpr (isCompact())
-        times.push_back(-1); // ̬Ȩֵstring
+        times.push_back(-1); // 添加终态权值的string长度
 
     times.front() = 0;
 
@@ -143,7 +143,7 @@ std::vector<int> KtLattice<WEIGHT_TYPE>::stateTimes() const
                 if (times.back() == -1)
                     times.back() = utt_len;
                 else
-                    assert(times.back() == utt_len); // TODO: Ƿһ£
+                    assert(times.back() == utt_len); // TODO: 是否允许不一致？
             }
         }
     }
@@ -165,7 +165,7 @@ int KtLattice<WEIGHT_TYPE>::longestSentenceLength() const
             bool arc_has_word = trans_traits_::isym(trans) != trans_traits_::eps;
             auto nextstate = trans.to();
             if (arc_has_word) {
-                assert(nextstate > s); // ȷ޻topo-sorted
+                assert(nextstate > s); // 确保无环，即topo-sorted
                 maxlen[nextstate] = std::max(maxlen[nextstate], maxlen[s] + 1);
             }
             else {
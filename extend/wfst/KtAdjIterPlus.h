@@ -2,9 +2,9 @@
 #include <vector>
 
 
-// adj_vertex_iterĶηװ
-// ҪڽӶϣṩһplusΪڽӶ
-// øùΪÿģһԻ
+// 对adj_vertex_iter的二次封装
+// 主要在正常的邻接顶点迭代基础上，提供一个额外的plus对象作为虚拟邻接顶点
+// 可用该功能为每个顶点模拟一个虚拟的自环
 template<typename GRAPH>
 class KtAdjIterPlus
 {
@@ -8,25 +8,25 @@
 
 
 /* 
- * KtNavieCompositeļǿ棬ʵֻ˲compositeͨ㷨
- * οgoogleоA Filter-based Algorithm for Efficient Composition of Finite-State Transducers.
+ * KtNavieComposite的加强版，实现基于滤波的composite通用算法
+ * 具体参考google研究论文A Filter-based Algorithm for Efficient Composition of Finite-State Transducers.
  *
- * 㷨(filter汾)
- * Weighted-Composition(T1, T2, )
- * 1  Q  I  S  I1I2{i3}
- * 2  for each q = (q1, q2, i3)  I do (q)  (q1)*2(q2)
+ * 算法(filter版本)：
+ * Weighted-Composition(T1, T2, Φ)
+ * 1  Q ← I ← S ← I1×I2×{i3}
+ * 2  for each q = (q1, q2, i3) ∈ I do λ(q) ← λ(q1)*λ2(q2)
  * 3  while !S.empty() do
- * 4      q = (q1, q2, q3)  Head(S)
+ * 4      q = (q1, q2, q3) ← Head(S)
  * 5      Dequeue(S)
- * 6      if q  F1F2Q3 and 3(q3) != 0 then
- * 7          F  F{q}
- * 8          (q)  1(q1)*2(q2)*3(q3)
- * 9      M  {(e1',e2',q3') = (e1,e2,q3) | e1E^L[q1], e2E^L[q2], q3'!=}
- * 10     for each (e1',e2',q3')M do
- * 11         if (q' = (n[e1'], n[e2'], q3') ! Q) then
- * 12             Q  Q{q'}
+ * 6      if q ∈ F1×F2×Q3 and ρ3(q3) != 0 then
+ * 7          F ← F∪{q}
+ * 8          ρ(q) ← ρ1(q1)*ρ2(q2)*ρ3(q3)
+ * 9      M ← {(e1',e2',q3') = ψ(e1,e2,q3) | e1∈E^L[q1], e2∈E^L[q2], q3'!=⊥}
+ * 10     for each (e1',e2',q3')∈M do
+ * 11         if (q' = (n[e1'], n[e2'], q3') !∈ Q) then
+ * 12             Q ← Q∪{q'}
  * 13             Enqueue(S, q')
- * 14         E  E{(q, i[e1'], o[e2'], w[e1']*w[e2'], q')}
+ * 14         E ← E∪{(q, i[e1'], o[e2'], w[e1']*w[e2'], q')}
  * 15 return T
  *
  */
@@ -56,7 +56,7 @@ public:
 
 		for (auto& I1 : I1s)
 			for (auto& I2 : I2s)
-				// ӳʼ״̬{ I1, I2, i3 }
+				// 增加初始状态{ I1, I2, i3 }
 				factory_.addInitial({ I1.first, I2.first, i3 }, I1.second * I2.second);
 			
 
@@ -70,13 +70,13 @@ public:
 
 			typename FST1::trans_type loop1{ FST1::eps, FILTER::epsL, FST1::weight_type::one() };
 
-			KtAdjIterPlus<const FST1> iter1(fst1, q1, { q1, loop1 }); // Իĵ
+			KtAdjIterPlus<const FST1> iter1(fst1, q1, { q1, loop1 }); // 构建带虚拟自环的迭代器
 			for (; !iter1.isEnd(); ++iter1) {
 				auto& t1 = iter1.edge();
 
 				typename FST2::trans_type loop2{ FILTER::epsL, FST2::eps, FST2::weight_type::one() };
 
-				KtAdjIterPlus<const FST2>  iter2(fst2, q2, { q2, loop2 }); // Իĵ
+				KtAdjIterPlus<const FST2>  iter2(fst2, q2, { q2, loop2 }); // 构建带虚拟自环的迭代器
 				for (; !iter2.isEnd(); ++iter2) {
 					auto& t2 = iter2.edge();
 
@@ -85,8 +85,8 @@ public:
 					if (!filter.blocking(q3N)) {
 						auto toIdx = factory_.addTrans(q.second, { *iter1, *iter2, q3N }, t1.isym, t2.osym, t1.wt * t2.wt);
 
-						// жǷΪfinal״̬
-						if (toIdx == factory_->order() - 1) { // ֻܵ״̬
+						// 判断是否为final状态
+						if (toIdx == factory_->order() - 1) { // 只检测可能的新增状态
 							auto& s = factory_.state(toIdx);
 							auto q1 = std::get<0>(s);
 							auto q2 = std::get<1>(s);
@@ -105,7 +105,7 @@ public:
 	}
 
 
-	// Ƿɹ
+	// 组合是否成功？
 	bool ok() const { return factory_.wfst().hasFinal(); }
 
 	decltype(auto) wfst() { return factory_.wfst(); }
@@ -2,16 +2,16 @@
 #include <assert.h>
 
 
-/* "A Filter-based Algorithm for Efficient Composition of Finite-State Transducers"ʵֵcompositionϵ˲.
+/* 根据"A Filter-based Algorithm for Efficient Composition of Finite-State Transducers"实现的composition系列滤波器.
  *
- * ˲ = (T1, T2, Q3, i3, , , 3)
- *   Q3 -- ˲״̬
- *   i3 -- ˲ʼ״̬, Q3
- *    -- ˲blocking״̬, Q3
- *    -- ת˲E1^LE2^LQ3 -> E1'E2'Q3. У
- *         E1^L = E1[q]{(q,,^L,1,q)} for each q  Q1. 
- *         E2^L = E2[q]{(q,^L,,1,q)} for each q  Q2.
- *   3 -- ̬Ȩֵ˲Q3 ->
+ * 滤波器Φ = (T1, T2, Q3, i3, ⊥, ψ, ρ3)
+ *   Q3 -- 滤波器状态集
+ *   i3 -- 滤波器初始状态, ∈Q3
+ *   ⊥ -- 滤波器blocking状态, ∈Q3
+ *   ψ -- 转移滤波：E1^L×E2^L×Q3 -> E1'×E2'×Q3. 其中：
+ *         E1^L = E1[q]∪{(q,ε,ε^L,1,q)} for each q ∈ Q1. 
+ *         E2^L = E2[q]∪{(q,ε^L,ε,1,q)} for each q ∈ Q2.
+ *   ρ3 -- 终态权值滤波：Q3 ->Κ
  */
 
 
@@ -19,15 +19,15 @@
 /* Implementation of Epsilon-Matching Filter.
  *
  * This filter handles epsilon labels, but disallows redundant epsilon paths,
- * preferring those that match actual  lebel. It leaves transitions and
+ * preferring those that match actual ε lebel. It leaves transitions and
  * final weights unmodified.
  *
- * Q3 = { 0, 1, 2,  }; i3 = 0; (q3) = 1, for any q3  Q3; (e1, e2, q3)=(e1, e2, q3'). У
- *          - 0 if(o[e1], i[e2) = (x, x) with x  B
- *          - 0 if(o[e1], i[e2) = (, ) and q3 = 0
- *    q3' = - 1 if(o[e1], i[e2) = (^L, ) and q3 != 2
- *          - 2 if(o[e1], i[e2) = (, ^L) and q3 != 1
- *          -  otherwise
+ * Q3 = { 0, 1, 2, ⊥ }; i3 = 0; ρ(q3) = 1, for any q3 ∈ Q3; ψ(e1, e2, q3)=(e1, e2, q3'). 其中：
+ *          - 0 if(o[e1], i[e2) = (x, x) with x ∈ B
+ *          - 0 if(o[e1], i[e2) = (ε, ε) and q3 = 0
+ *    q3' = - 1 if(o[e1], i[e2) = (ε^L, ε) and q3 != 2
+ *          - 2 if(o[e1], i[e2) = (ε, ε^L) and q3 != 1
+ *          - ⊥ otherwise
  */
 
 template<typename FST1, typename FST2, typename FST1::alpha_type epsL>
@@ -48,12 +48,12 @@ public:
 	state_index_t operator()(state_index_t q3, const trans1_type& t1, const trans2_type& t2) {
 		if (t1.osym == t2.isym) {
 			if (t1.osym != FST1::eps && t1.osym != epsL || // (x, x)
-				t1.osym == FST1::eps && q3 == 0) // (, ) and q3 = 0
+				t1.osym == FST1::eps && q3 == 0) // (ε, ε) and q3 = 0
 				return 0;
 		}
-		else if (t1.osym == epsL && t2.isym == FST2::eps && q3 != 2) // (^L, ) and q3 != 2
+		else if (t1.osym == epsL && t2.isym == FST2::eps && q3 != 2) // (ε^L, ε) and q3 != 2
 			return 1;
-		else if (t1.osym == FST1::eps && t2.isym == epsL && q3 != 1) // (, ^L) and q3 != 1
+		else if (t1.osym == FST1::eps && t2.isym == epsL && q3 != 1) // (ε, ε^L) and q3 != 1
 			return 2;
 
 		return blocking_state; // otherwise
@@ -83,15 +83,15 @@ public:
 
 /* Implementation of Epsilon-Seqencing Filter.
 *
-* This filter favors epsilon paths consiting of (output) -transitions in T1
+* This filter favors epsilon paths consiting of (output) ε-transitions in T1
 * (matched with staying at the same state in T2) followed by (input) 
-* -transitions in T2(matched with staying at the same state in T1).
+* ε-transitions in T2(matched with staying at the same state in T1).
 *
-* Q3 = { 0, 1,  }, i3 = 0, (q3) = 1, (e1, e2, q3)=(e1, e2, q3'), У
-*          - 0 if(o[e1], i[e2) = (x, x) with x  B,
-*          - 0 if(o[e1], i[e2) = (, ^L) and q3 == 0,
-*    q3' = - 1 if(o[e1], i[e2) = (^L, ),
-*          -  otherwise.
+* Q3 = { 0, 1, ⊥ }, i3 = 0, ρ(q3) = 1, ψ(e1, e2, q3)=(e1, e2, q3'), 其中：
+*          - 0 if(o[e1], i[e2) = (x, x) with x ∈ B,
+*          - 0 if(o[e1], i[e2) = (ε, ε^L) and q3 == 0,
+*    q3' = - 1 if(o[e1], i[e2) = (ε^L, ε),
+*          - ⊥ otherwise.
 */
 
 template<typename FST1, typename FST2, typename FST1::alpha_type epsL>
@@ -113,9 +113,9 @@ public:
 
 		if (t1.osym == t2.isym && t1.osym != FST1::eps && t1.osym != epsL) // (x, x)
 			return 0;
-		else if (t1.osym == FST1::eps && t2.isym == epsL && q3 == 0) // (, ^L) and q3 == 1
+		else if (t1.osym == FST1::eps && t2.isym == epsL && q3 == 0) // (ε, ε^L) and q3 == 1
 			return 0;		
-		else if (t1.osym == epsL && t2.isym == FST2::eps) // (^L, )
+		else if (t1.osym == epsL && t2.isym == FST2::eps) // (ε^L, ε)
 			return 1;
 
 
@@ -6,7 +6,7 @@
 #include "KtSpSingleSource.h"
 
 
-// ݵԴ·㷨WFSTepsilonհ
+// 根据单源最短路径算法，计算WFST的epsilon闭包
 
 template<typename WFST, typename CLS_GRAPH = DigraphSx<typename WFST::weight_type>>
 class KtEpsClosure : public KtHolder<CLS_GRAPH>
@@ -18,9 +18,9 @@ public:
 
 
 	KtEpsClosure(const WFST& fst) : super_(fst.order()) {
-		std::vector<bool> flags(fst.order(), false); // ڱǶvǷeps
+		std::vector<bool> flags(fst.order(), false); // 用于标记顶点v是否有eps出边
 
-		// fstеepsߵcg_
+		// 复制fst中的eps边到cg_
 		auto iter = fst.transIter();
 		for (; !iter.isEnd(); ++iter) {
 			auto& e = iter.edge();
@@ -31,9 +31,9 @@ public:
 			}
 		}
 
-		auto epsg = inside(); // ֻepsߵͼ
+		auto epsg = inside(); // 只含有eps边的图
 
-		// ͨԴ·㷨հ
+		// 通过单源最短路径算法计算闭包
 		for (unsigned v = 0; v < flags.size(); v++) {
 			if (!flags[v]) continue;
 
@@ -9,17 +9,17 @@
  *
  * WFST-EpsilonRemoval(T)
  * 1   for each p in Q 
- * 2     E' <- { e in E[p] | (i(e), o(e)) != (eps, eps) } ;E'ʼΪз(eps, eps)߼
+ * 2     E' <- { e in E[p] | (i(e), o(e)) != (eps, eps) } ;E'初始化为所有非(eps, eps)边集
  * 3     for each (q, w') in EpsilonClosure(p)
  * 4       E' <- E' + { (p, x, y, w'*w, r) | (p, x, y, w, r) in E[q], (x, y) != (eps, eps) }
  * 5       if p in F 
  * 6         F' <- F' + { p }
- * 7         '(p) <- (p)
+ * 7         ρ'(p) <- ρ(p)
  * 8       if q in F
  * 9         if p not in F
  * 10          F <- F + { p }
- * 11        '(p) <- '(p) + (w' * (q))
- * 12  return T' = (F', E', ')
+ * 11        ρ'(p) <- ρ'(p) + (w' * ρ(q))
+ * 12  return T' = (F', E', ρ')
  *
  */
 
@@ -30,8 +30,8 @@ public:
 
 	KtEpsRemoval(const FST& fst) : kPrivate::KtWfstHolder<FST>(fst.order()) {
 
-		KtEpsClosure<FST> ec(fst); // ǰfstepsilonհ
-		std::vector<bool> visited(fst.order(), false); // ڱѷʵĽڵ
+		KtEpsClosure<FST> ec(fst); // 提前计算fst的epsilon闭包
+		std::vector<bool> visited(fst.order(), false); // 用于标记已访问的节点
 
 		for (unsigned p = 0; p < fst.order(); p++) { // for each p in Q
 			
@@ -55,9 +55,9 @@ public:
 				for (; !eci.isEnd(); ++eci) { // for each q in EpsilonClosure(p)
 					auto q = *eci;
 
-					assert(q != p); // TODO: δepsԻ,ڳӵ
+					assert(q != p); // TODO: 如何处理eps自环,存在出边两次添加的问题
 
-					if (visited[q]) continue; // ֤ÿֻһ
+					if (visited[q]) continue; // 保证每条边只处理一次
 					visited[q] = true;
 
 					if (fst.isFinal(q)) {
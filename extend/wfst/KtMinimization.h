@@ -34,15 +34,15 @@
  *
  * WFST-Minimization(T)
  * 1   P <- W <- empty ; P is parition, W is a queue containing the blocks used to split each block in P 
- * 2   for each  in { (f) | f in F }
- * 3     F' <- { f | (f) = , f in F } ;F'ʾȨֵ̬ͬ  
- * 4     P <- P + { F' } ;F'Ϊ»
- * 5     Enqueue(W, F') ;F'ѹ
- * 6   P <- P + { Q-F } ;ӷ̬Ϊ»
+ * 2   for each ρ in { ρ(f) | f in F }
+ * 3     F' <- { f | ρ(f) = ρ, f in F } ;F'表示权值相同的终态集  
+ * 4     P <- P + { F' } ;添加F'为新划分
+ * 5     Enqueue(W, F') ;将F'压入待处理队列
+ * 6   P <- P + { Q-F } ;添加非终态集为新划分
  * 7   while W not empty
  * 8     S <- Head(W), Dequeue(W)
- * 9     for each (i, o, w) in { (i[e], o[e], w[e]) | e in E^-1[S] } ;E^-1[S]S״̬ߵļ
- * 10      R(i, o, w) <- { p(e) | i[e] = i, o[e] = o, w[e] = w, e in E^-1[S] } ;(i, o, w)ԪͬıߵۺΪR(i, o, w), ˵R(i,o,w)ӳ䵽{p[e]}
+ * 9     for each (i, o, w) in { (i[e], o[e], w[e]) | e in E^-1[S] } ;E^-1[S]代表S状态集入边的集合
+ * 10      R(i, o, w) <- { p(e) | i[e] = i, o[e] = o, w[e] = w, e in E^-1[S] } ;将(i, o, w)三元组相同的边的起点聚合为R(i, o, w), 说白了R由(i,o,w)映射到{p[e]}
  * 11      for each B in P such that B & R(i, o, w) != empty and B !include in R(i, o, w) 
  * 12        B1 <- B & R(i, o, w)
  * 13        B2 <- B - B1 
@@ -55,11 +55,11 @@
  * 20          else
  * 21            Enqueue(W, B2)
  * 22  for each e in E
- * 23    E' <- E' + {(B(p[e]), i[e], o[e], w[e], B(n[e]))} ;µı߼
+ * 23    E' <- E' + {(B(p[e]), i[e], o[e], w[e], B(n[e]))} ;构造新的边集
  * 24  for each S in Q' such that S include in F
- * 25    F' <- F' + {S} ;µ̬
- * 26    '(S) <- (q) for some q in S
- * 27  return T' = (Q', F', E', ')
+ * 25    F' <- F' + {S} ;构造新的终态集
+ * 26    ρ'(S) <- ρ(q) for some q in S
+ * 27  return T' = (Q', F', E', ρ')
  *
  */
 
@@ -72,13 +72,13 @@ public:
 
 	KtMinimization(const FST& fst) : infst_(fst) {
 
-		/// Ȼֹ״̬
+		/// 先划分终止状态
 		decltype(auto) F = fst.finals();
-		std::map<weight_type, state_type> Fp; // Ȩֵֹ״̬
+		std::map<weight_type, state_type> Fp; // 按权值划分终止状态
 		for (auto& f : F)
-			Fp[f.second].insert(f.first); // F' <- { f | (f) = , f in F }
+			Fp[f.second].insert(f.first); // F' <- { f | ρ(f) = ρ, f in F }
 
-		P_.reserve(fst.order()); // ȷP_㹻
+		P_.reserve(fst.order()); // 确保P_足够大
 		std::set<state_type> W;
 		for (auto& fp : Fp)
 			P_.push_back(fp.second); // P <- P + { F' }
@@ -95,7 +95,7 @@ public:
 			auto S = *W.begin();  W.erase(W.begin());
 			std::map<edge_type, state_type> R; // R(i, o, w)
 			for (auto& s : S) {
-					auto iter = KtAdjIter(gR, s); // E^-1[S]
+					auto iter = KtAdjIter(gR, s); // 遍历E^-1[S]
 					for (; !iter.isEnd(); ++iter) {
 						auto& iow = iter.edge();
 						auto pe = *iter;
@@ -119,7 +119,7 @@ public:
 			}
 		}
 
-		/// 춥ӳ:state[infst_] -> state[wfst_]
+		/// 构造顶点的映射:state[infst_] -> state[wfst_]
 		std::vector<unsigned> idxMap(infst_.order(), 0);
 		for (unsigned i = 0; i < infst_.order(); i++)
 			for (unsigned j = 0; j < P_.size(); j++)
@@ -128,7 +128,7 @@ public:
 					idxMap[i] = j;
 				}
 
-		/// wfst_
+		/// 构造wfst_
 		wfst().reset(static_cast<unsigned>(P_.size()));
 
 		// E' <- E' + { (B(p[e]), i[e], o[e], w[e], B(n[e])) }
@@ -141,7 +141,7 @@ public:
 				wfst().addTrans(from, to, val);
 		}
 
-		// óʼ״ֹ̬״̬
+		// 设置初始状态和终止状态
 		for (unsigned i = 0; i < P_.size(); i++) {
 			auto& S = P_[i];
 			auto iter = S.begin();
@@ -2,7 +2,7 @@
 #include "KtEpsRemoval.h"
 
 
-/* TODO: ͨ
+/* TODO: 测试通不过
  *
  *
  */
@@ -5,7 +5,7 @@
 #include "../../graph/base/KtHolder.h"
 
 
-// 뻷ģ
+// 半环的模板抽象类
 
 template<typename T>
 class KtSemiring : public KtHolder<T>
@@ -19,7 +19,7 @@ public:
 	value_type value() const { return inside(); }
 
 
-	// ֵһֵĶ
+	// 零值和一值的定义
 	static const KtSemiring& zero() { 
 		static const KtSemiring z(0);
 		return z; 
@@ -30,7 +30,7 @@ public:
 		return o;
 	}
 
-	// ӷͳ˷Ķ
+	// 加法和乘法的定义
 	KtSemiring operator+(const KtSemiring& rhs) const { return inside() + rhs.inside(); }
 	KtSemiring operator*(const KtSemiring& rhs) const { return inside() * rhs.inside(); }
 };
@@ -53,10 +53,10 @@ struct is_kind_of_semiring
 
 
 
-// ΪһЩ뻷ʵ
+// 以下为一些基本半环的实现
 
 
-// bool͵ػ
+// 对bool类型的特化
 template<>
 class KtSemiring<bool> : public KtHolder<bool>
 {
@@ -68,7 +68,7 @@ public:
 	value_type value() const { return inside(); }
 
 
-	// ֵһֵĶ
+	// 零值和一值的定义
 	static const KtSemiring& zero() {
 		static const KtSemiring<bool> z(false);
 		return z;
@@ -79,14 +79,14 @@ public:
 		return o;
 	}
 
-	// ӷͳ˷Ķ
+	// 加法和乘法的定义
 	KtSemiring operator+(const KtSemiring& rhs) const { return inside() + rhs.inside(); }
 	KtSemiring operator*(const KtSemiring& rhs) const { return inside() * rhs.inside(); }
 };
 
 
 
-// ԭļӷ㶨壺x + y = -log(e^-x + e^-y), ֵΪinf.
+// 原版论文加法运算定义：x + y = -log(e^-x + e^-y), 零值为inf.
 template<typename T>
 class KtLogSemiring : public KtSemiring<T>
 {
@@ -125,8 +125,8 @@ public:
 
 
 
-// ֵlog뻷ڸlogֵ
-// x + y = log(e^x + e^y), ֵΪ-inf.
+// 负值区间的log半环，适用于概率log值运算
+// x + y = log(e^x + e^y), 零值为-inf.
 template<typename T>
 class KtNegLogSemiring : public KtSemiring<T>
 {
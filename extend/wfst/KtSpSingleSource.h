@@ -4,12 +4,12 @@
 #include "core/KtAdjIter.h"
 
 
-// WFSTʵ·㷨
-// οWeighted Automata Algorithms, Mehryar Mohri, 2009
+// 对WFST重新实现最短路径算法
+// 参考：Weighted Automata Algorithms, Mehryar Mohri, 2009
 
 
 /*
- * Դ·㷨
+ * 单源最短路径算法
  *
  * GEN-SINGLE-SOURCE(G, s)
  * 1  for each q in Q
@@ -42,7 +42,7 @@ public:
 		: dist_(g.order(), weight_type::zero())
 	    , s_(s) {
 
-		dist_[s] = weight_type::one(); // TODO: dist_[s]бҪ1
+		dist_[s] = weight_type::one(); // TODO: dist_[s]有必要置1吗
 		std::vector<weight_type> r(dist_);
 
 		std::unordered_set<vertex_index_t> S;
@@ -75,7 +75,7 @@ public:
 	}
 
 
-	// Ƿڴst·
+	// 是否存在从s到t的路径
 	bool reachable(vertex_index_t t) const {
 		return dist_[t] != weight_type::zero() && (dist_[t] != weight_type::one() || t != s_);
 	}
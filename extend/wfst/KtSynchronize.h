@@ -5,8 +5,8 @@
 
 
 /*
- * ͬWFSTŻΪepsתƣ
- * ʣµתУҪô롢ŶΪepsҪôeps
+ * 同步操作：消除WFST中输入符号或者输出符号为eps的转移，
+ * 剩下的转移中，要么输入、输出符号都为eps，要么都不是eps
  *
  * Synchronize(T)
  * 1   F' <- Q' <- E' <- empty
@@ -14,12 +14,12 @@
  * 3   while S not empty
  * 4     p' = (q, x, y) <- HEAD(S)
  * 5     DEQUEUE(S)
- * 6     if( q in F && |x| + |y| = 0 ) ;|x|ַxĳ
+ * 6     if( q in F && |x| + |y| = 0 ) ;|x|代表字符串x的长度
  * 7       F' <- F' + {p'}; 
- * 8       '(p') <- (q)
+ * 8       ρ'(p') <- ρ(q)
  * 9     else if( q in F && |x| + |y| > 0 )
- * 10      q' <- (f, cdr(x), cdr(y))  ;cdr(x)ַxȥַµĲ
- * 11      E' <- E' + { p', car(x), car(y), (q), q' } ;car(x)ַxַ
+ * 10      q' <- (f, cdr(x), cdr(y))  ;cdr(x)代表字符串x除去首字符余下的部分
+ * 11      E' <- E' + { p', car(x), car(y), ρ(q), q' } ;car(x)代表字符串x的首字符
  * 12      if( q' not in Q' )
  * 13        Q' <- Q' + {q'}; 
  * 14        ENQUEUE(S, q');
@@ -104,7 +104,7 @@ private:
 	}
 
 
-	// ºٶalpha_typeΪַ
+	// 以下函数假定alpha_type为单字符
 
 	// |a|
 	static unsigned length_(const alpha_type& a) {
@@ -8,16 +8,16 @@
 #include <assert.h>
 
 
-// wfstviterbi
+// wfst的viterbi集束搜索
 // single-WFST-ViterbiBeamSearch(N, X)
 //   @N: WFST = (X, Z, Q, I, F, E, r, p)
-//   @X: /ʶ
+//   @X: 待解码/识别的特征序列
 
-// 㷨ο:
+// 算法参考:
 // 1. Speech Recognition Algorithms Using Weighted Finite-State Transducers, Takaaki Hori, Atsushi Nakamura, 2013
 // 2. Token Passing: a Simple Conceptual Model for Connected Speech Rcognition Systems, S.J. Young, 1989
 
-/* 㷨ܣ1
+/* 算法框架（文献1）
  * 1  S <- initialize(I, r)
  * 2  A <- {}
  * 3  for t = 1 to T do
@@ -30,11 +30,11 @@
  * 10 return Y
  */
 
-/* ʵϸڣ
-   1. 1ʹ2εǰһwfst״̬Σhmm״̬Ρ
-   ʵмٶhmm״̬ȫչΪwfst״̬תhmm״̬
-   2. 2ʹtokenǰ
-   3. ʵ־ʹstd⣬δ㷨Ż
+/* 实现细节：
+   1. 文献1使用2个层次的前向后向矩阵，一是wfst状态层次，二是hmm状态层次。
+   代码实现中假定hmm状态完全展开为wfst状态，不跳转到hmm状态
+   2. 参照文献2，使用token替代前后向矩阵
+   3. 实现尽量使用std库，未进行算法优化
  */
 
 template<typename WFST>
@@ -59,12 +59,12 @@ public:
 	double beam() const { return beam_; }
 	void setBeam(double beam) { beam_ = decltype(beam_)(beam); }
 
-	// @pdf: ѧģͣ൱Acoustic matching transducer,
-	//       Ҫģid÷֣score = AC_MODEL(X[i], transId)
+	// @pdf: 声学模型，相当于Acoustic matching transducer,
+	//       主要根据特征和模型id计算得分，score = AC_MODEL(X[i], transId)
 	template<typename FEAT_TYPE>
 	using pdf = std::function<double(unsigned transId, const FEAT_TYPE& xi)>;
 
-	// trueʾҵһֹ״̬·
+	// 返回true表示找到一条具终止状态的最优路径
 	template<typename FEAT_TYPE>
 	bool search(const FEAT_TYPE X[], frame_index_t T, pdf<FEAT_TYPE> ac);
 
@@ -82,10 +82,10 @@ private:
 		return &trans;
 	}
 
-	// ʼatl
+	// 初始化atl
 	void initialize_();
 
-    // atlǰƸ״̬epsתƣatl
+    // 处理atl，依次前推各状态的eps转移，更新atl
 	void transEps_(frame_index_t t, bool finalTrans = false);
 
 	template<typename FEAT_TYPE>
@@ -95,9 +95,9 @@ private:
 	
 	void finalTrans_(frame_index_t t);
 
-	// ȽweightĴС
+	// 比较两个weight的大小
 	static bool comp_(const weight_type& w1, const weight_type& w2) {
-		//return w1 != w2 && w1 == w1 + w2; // TODO: ʱ޷ͨ
+		//return w1 != w2 && w1 == w1 + w2; // TODO: 这个暂时无法做到通用
 		return w1.value() < w2.value();
 	}
 
@@ -111,24 +111,24 @@ private:
 		std::shared_ptr<KpToken> prev_;
 
 
-		// ʼ״̬token
+		// 初始状态的token构造
 		KpToken(weight_type initWeight) : trans_{}, prev_(nullptr), t_(0) {
 			weight_ = initWeight;
 		}
 
-		// epsתƵtoken
+		// eps转移的token构造
 		KpToken(frame_index_t t, trans_id trans, std::shared_ptr<KpToken> prev)
 			: t_(t), trans_(trans), prev_(prev) {
 			weight_ = traits_type::weight(*trans) * prev->weight_;
 		}
 
-		// non-epsתƵtoken
+		// non-eps转移的token构造
 		KpToken(frame_index_t t, trans_id trans, weight_type ac_cost, std::shared_ptr<KpToken> prev)
 			: t_(t), trans_(trans), prev_(prev) {
 			weight_ = traits_type::weight(*trans) * ac_cost * prev->weight_;
 		}
 
-		// ֹ״̬token
+		// 终止状态的token构造
 		KpToken(frame_index_t t, weight_type fianlWeight, std::shared_ptr<KpToken> prev)
 			: t_(t), trans_{}, prev_(prev) {
 			weight_ = fianlWeight * prev->weight_;
@@ -143,13 +143,13 @@ private:
 		}
 
 		~KpToken() {
-			// ƶйʱ800+ݴͷprev_ܻɶջ
-			// ڴʵһֶͷŵĴ
+			// 当令牌队列过长时，如800+，梯次释放prev_可能会造成堆栈溢出
+			// 在此实现一个手动释放的代码
 			if (prev_ && prev_.use_count() == 1) {
-				auto tok = prev_; prev_.reset(); // ӹprev_
+				auto tok = prev_; prev_.reset(); // 接管prev_
 				while (tok->prev_ && tok->prev_.use_count() == 1) {
 					auto prev = tok->prev_; tok->prev_.reset();
-					tok = prev; // ӹǰprev_, ͬʱͷtok
+					tok = prev; // 接管前序prev_, 同时释放tok
 				}
 			}
 		}
@@ -161,11 +161,11 @@ private:
 	};
 
 	std::map<state_index_t, std::shared_ptr<KpToken>> atl0_, atl1_; // active token list
-	std::shared_ptr<KpToken> best_; // finalTrans_Ľ
+	std::shared_ptr<KpToken> best_; // finalTrans_的结果
 
 private:
 
-	/// ֦ز
+	/// 剪枝相关参数
 	double beam_; // Decoding beam.  Larger->slower, more accurate
 	int maxActive_; // Decoder max active states.  Larger->slower; more accurate
 	int minActive_; // Decoder min active states (don't prune if #active less than this)
@@ -188,7 +188,7 @@ bool KtViterbiBeam<WFST>::search(const FEAT_TYPE X[], frame_index_t T, pdf<FEAT_
 }
 
 
-/* initialize(I, r)  # rΪwfstĳʼ״̬Ȩֵ
+/* initialize(I, r)  # r为wfst的初始状态权值函数
  * 1  for each i : I do
  * 2    a(0, i) <- r(i)
  * 3    B(0, i) <- <0, 0>
@@ -213,7 +213,7 @@ void KtViterbiBeam<WFST>::initialize_()
  * 4    Dequeue(S)
  * 5    for each e in E(s, eps) do
  * 6      a' <- a(t,s)*w[e]
- * 7      if a(t,n[e])+a' != a' then  # a'
+ * 7      if a(t,n[e])+a' != a' then  # a'更优
  * 8        a(t,n[e]) <- a'
  * 9        B(t,n[e]) <- <t,e>
  * 10       if n[e] !in S then
@@ -238,7 +238,7 @@ void KtViterbiBeam<WFST>::transEps_(frame_index_t t, bool finalTrans)
 		atl0_.erase(atl0_.begin());
 
 		auto iter = wfst_.adjIter(cur.first);
-		bool hasNonEps(false); // s״̬Ƿзepsת
+		bool hasNonEps(false); // 标记s状态是否具有非eps的转移
 		for (; !iter.isEnd(); ++iter) {
 			auto& trans = iter.edge();
 			if (traits_type::isym(trans) == WFST::eps) { // for each e in E(s, eps)
@@ -246,14 +246,14 @@ void KtViterbiBeam<WFST>::transEps_(frame_index_t t, bool finalTrans)
 				auto tok = std::make_shared<KpToken>(cur.second->t_, transId(trans), cur.second);
 				auto pos = atl0_.find(to);
 				if (pos == atl0_.end()) {
-					pos = atl1_.find(to); // atl1_
+					pos = atl1_.find(to); // 尝试atl1_
 					if (pos == atl1_.end()) {
 						atl0_.insert({ to, tok });
 						continue;
 					}
 				}
 
-				if (*tok < *pos->second) // tok
+				if (*tok < *pos->second) // tok更优
 					*pos->second = *tok;
 			}
 			else {
@@ -270,7 +270,7 @@ void KtViterbiBeam<WFST>::transEps_(frame_index_t t, bool finalTrans)
 /* transition_with_input(E, S, A, x, t)
  * 1  for each s in S do
  * 2    for each e in E(s) such that i[e] != eps do
- * 3      a(t-1, e, ie) <- alpha(t - 1, s) * w[e]  # ieeӦhmmĳʼ״̬
+ * 3      a(t-1, e, ie) <- alpha(t - 1, s) * w[e]  # ie代表e对应hmm的初始状态
  * 4      b(t-1, e, ie) <- t - 1
  * 5      if <e, ie> !in A then
  * 6        A <- A + {<e, ie>}
@@ -281,8 +281,8 @@ void KtViterbiBeam<WFST>::transEps_(frame_index_t t, bool finalTrans)
  * 11 while A != {} do
  * 12   <e, j> <- Head(A)
  * 13   Dequeue(A)
- * 14   for each k in Adj(j) such that k != fe do  # feeӦhmmֹ״̬
- * 15     a' <- a(t-1, e, j) * w(x, k | i[e], j)  # wʾhmmģ͵ת=a[jk]*b[k](x)aΪ״̬תƸʣbΪ
+ * 14   for each k in Adj(j) such that k != fe do  # fe代表e对应hmm的终止状态
+ * 15     a' <- a(t-1, e, j) * w(x, k | i[e], j)  # w表示hmm模型的转换概率=a[jk]*b[k](x)，a为状态转移概率，b为发射概率
  * 16     if a(t, e, k) * a' != a' then
  * 17       a(t, e, k) <- a'
  * 18       b(t, e, k) <- b(t-1, e, j)
@@ -293,7 +293,7 @@ void KtViterbiBeam<WFST>::transEps_(frame_index_t t, bool finalTrans)
  * 23   end for
  * 24 end while
  * 25 for each <e, k> in A' such that fe in Adj(k) do
- * 26   a' <- a(t, e, k) * w(eps, fe | i[e], k)  # ˴x=epsӦw=a[jk]
+ * 26   a' <- a(t, e, k) * w(eps, fe | i[e], k)  # 此处x=eps，相应w=a[jk]
  * 27   if alpha(t, n[e]) + a' != a' then
  * 28     alpha(t, n[e]) <- a'
  * 29     beta(t, n[e]) <- <b(t, e, k), e>
@@ -320,7 +320,7 @@ void KtViterbiBeam<WFST>::transInput_(const FEAT_TYPE& x, frame_index_t t, pdf<F
 			if (isym != WFST::eps) { // for each e in E(s, eps)	
 				auto tok = std::make_shared<KpToken>(t, transId(trans), 
 					static_cast<typename weight_type::value_type>(-ac(isym, x)), cur.second);
-				if (cur.second->trans_ == transId(trans)) { // תͬʹԭtokentֵprevֵ
+				if (cur.second->trans_ == transId(trans)) { // 如果转移相同，使用原token的t值和prev值
 					tok->t_ = cur.second->t_;
 					tok->prev_ = cur.second->prev_;
 				}
@@ -339,7 +339,7 @@ void KtViterbiBeam<WFST>::transInput_(const FEAT_TYPE& x, frame_index_t t, pdf<F
 
 /* prune(S, A, t)
  * 1   w(t, best) = { +alpha(t, s) for each s in S} + { +a(t, e, j) for <e, j> in A }
- * 2   w(t, th) = beam * w(t, best)  # ൱ڼϼ
+ * 2   w(t, th) = beam * w(t, best)  # 相当于加上集束宽度
  * 3   for each s in S do
  * 4     if alpha(t, s) + w(t, th) = w(t, th) then
  * 5       erase(S, s)
@@ -356,13 +356,13 @@ void KtViterbiBeam<WFST>::transInput_(const FEAT_TYPE& x, frame_index_t t, pdf<F
 template<typename WFST>
 void KtViterbiBeam<WFST>::prune_()
 {
-	// ȷalt0_м֦
+	// 确保对alt0_进行剪枝
 	assert(!atl0_.empty() && atl1_.empty());
 
 	if (atl0_.size() < static_cast<decltype(atl0_.size())>(minActive_))
 		return;
 
-	// wbest
+	// 计算wbest
 	weight_type wbest = 0; // TODO:  weight_type::zero();
 	for (auto& i : atl0_)
 		if(comp_(i.second->weight_, wbest))
@@ -23,7 +23,7 @@
  * WFST-Potential(T)
  * 1   for each q in Q
  * 2     if q in F
- * 3       V[q] <- r[q] <- (q)
+ * 3       V[q] <- r[q] <- ρ(q)
  * 4     else
  * 5       V[q] <- r[q] <- 0
  * 6   S <- F
@@ -45,11 +45,11 @@
  * 1  V <- WFST-Potential(T)
  * 2  for each q in Q
  * 3    if q in I
- * 4      (q) <- (q) * V[q]
+ * 4      λ(q) <- λ(q) * V[q]
  * 5    for each e in E[q] 
  * 6      w[e] <- V[q]^-1 * w[e] * V[n[e]]
  * 7    if q in F 
- * 8      (q) <- V[q]^-1 * (q)
+ * 8      ρ(q) <- V[q]^-1 * ρ(q)
  *
  *
  */
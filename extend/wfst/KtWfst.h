@@ -9,17 +9,17 @@
 #include "trans_traits.h"
 
 
-// ʵ㷨οMehryar Mohriϵ
-
-// WFSTڰ뻷(semiring)Ҫ8Ҫعɣ
-//    -- ĸ
-//    -- ĸ
-//    -- ״̬
-//    -- ʼ״̬ڣ
-//    -- ֹ״̬ڣ
-//    -- תƼڣѡ(ơ{})( {})
-//    -- ʼȨ->
-//    -- ֹȨ->
+// 基本定义和实现算法参考Mehryar Mohri的系列论文
+
+// WFST基于半环(semiring)Κ，主要由8要素构成：
+//   ∑ -- 输入字母表
+//   Ω -- 输出字母表
+//   Ｑ -- 状态集
+//   Ｉ -- 初始状态集，包含于Ｑ
+//   Ｆ -- 终止状态集，包含于Ｑ
+//   Ｅ -- 转移集，包含于Ｑ×(∑∪{ε})×(Ω ∪{ε})×Κ×Ｑ
+//   λ -- 初始加权函数，Ｉ->Κ
+//   ρ -- 终止加权函数，Ｆ->Κ
 
 // weights are assumed to be cumulated by multiplication along each path and 
 // addition over different paths.
@@ -59,21 +59,21 @@ class KtWfst : public GRAPH_TYPE
 public:
 	using super_ = GRAPH_TYPE;
 	using graph_type = GRAPH_TYPE;
-	using trans_type = TRANS_TYPE; // ת
+	using trans_type = TRANS_TYPE; // 转移类型
 	using traits_type = TRANS_TRAITS;
-	using weight_type = std::decay_t<decltype(traits_type::weight(std::declval<trans_type>()))>; // 뻷൱Ȩ
-	using alpha_type = std::decay_t<decltype(traits_type::isym(std::declval<trans_type>()))>; // ĸ
+	using weight_type = std::decay_t<decltype(traits_type::weight(std::declval<trans_type>()))>; // 半环，相当于权重
+	using alpha_type = std::decay_t<decltype(traits_type::isym(std::declval<trans_type>()))>; // 字母类型
 	using typename super_::vertex_index_t;
 	using typename super_::vertex_type;
 	using typename super_::edge_type;
 
 
-	// wfst
+	// 声明wfst特有名称
 	using state_index_t = vertex_index_t;
 	using trans_iter = typename graph_type::edge_iter;
 	using const_trans_iter = typename graph_type::const_edge_iter;
-	using initial_set_type = std::unordered_map<state_index_t, weight_type>; // ʼ״̬ϵ
-	using final_set_type = std::conditional_t<has_weight_v<vertex_type>, void*, initial_set_type>; // ֹ״̬ϵ
+	using initial_set_type = std::unordered_map<state_index_t, weight_type>; // 初始状态集合的类型
+	using final_set_type = std::conditional_t<has_weight_v<vertex_type>, void*, initial_set_type>; // 终止状态集合的类型
 	
 
 	constexpr static const auto eps = traits_type::eps;
@@ -82,7 +82,7 @@ public:
 	using super_::super_;
 	using super_::order;
 
-	// ״̬ǷȨֵԣ
+	// 状态是否具有权值属性？
 	constexpr static bool hasStateWeight() {
 		return has_weight_v<vertex_type>;
 	}
@@ -96,7 +96,7 @@ public:
 	void eraseState(state_index_t s) {
 		super_::eraseVertex(s);
 
-		// ³ʼ/ֹ״̬
+		// 更新初始/终止状态序号
 		updateStateIdx_(initials_, s);
 
 		if constexpr (hasStateWeight())
@@ -104,17 +104,17 @@ public:
 	}
 
 
-	// 1ת
+	// 新增1个转移
 	void addTrans(state_index_t s1, state_index_t s2,
 		const alpha_type& isym, const alpha_type& osym, const weight_type& wt, bool merge = false) {
 
 		if (merge) {
-			// Ƿ<isym, osym>תƣҪϲ
+			// 查找是否存在<isym, osym>的转移，若存在则需要合并，否则新增
 			auto iter = KtAdjIter<graph_type>(*this, s1);
 			for (; !iter.isEnd(); ++iter) {
 				if (*iter == s2) {
 					auto& trans = iter.edge();
-					if (traits_type::isym(trans) == isym && traits_type::osym(trans) == osym) { // ϲ
+					if (traits_type::isym(trans) == isym && traits_type::osym(trans) == osym) { // 合并
 						iter.reedge(traits_type::construct(isym, osym, traits_type::weight(trans) + wt));
 						return;
 					}
@@ -122,7 +122,7 @@ public:
 			}
 		}
 
-		// 
+		// 新增
 		super_::addEdge(s1, s2, traits_type::construct(isym, osym, wt));
 	}
 
@@ -131,7 +131,7 @@ public:
 	}
 
 
-	// ɾs1s2ת
+	// 删除s1到s2的转移
 	void eraseTrans(state_index_t s1, state_index_t s2) {
 		super_::eraseEdge(s1, s2);
 	}
@@ -148,26 +148,26 @@ public:
 
 	auto numInitials() const { return initials_.size(); }
 
-	// سʼ״̬
+	// 返回初始状态集
 	const initial_set_type& initials() const { return initials_; }
 
-	// Ƿóʼ״̬
+	// 是否设置初始状态
 	bool hasInitial() const { return !initials_.empty(); }
 
 
-	// ״̬iǷΪʼ״̬
+	// 状态i是否为初始状态
 	bool isInitial(state_index_t i) const { 
 		return initials_.find(i) != initials_.end(); 
 	}
 
-	// سʼ״̬iȨֵ÷iضΪʼ״̬
+	// 返回初始状态i的权值，该方法断言i必定为初始状态
 	const weight_type& initialWeight(state_index_t i) const {
 		assert(isInitial(i));
 		return initials_.at(i);
 	}
 
 
-	// ״̬iΪʼ״̬ĳʼ״̬iȨֵΪwt
+	// 设置已有状态i为初始状态，或更改初始状态i的权值为wt
 	void setInitial(state_index_t i, const weight_type& wt = weight_type::one()) {
 		assert(i < order());
 		initials_.insert_or_assign(i, wt);
@@ -178,14 +178,14 @@ public:
 		initials_.erase(i);
 	}
 
-	// һ״̬Ϊʼ״̬ȨֵΪwt
+	// 增加一个新状态，并将其置为初始状态，权值为wt。
 	state_index_t addInitial(const weight_type& wt = weight_type::one()) {
 		state_index_t i = addState();
 		initials_.insert({ i, wt });
 		return i;
 	}
 
-	// سʼ״̬ţʧ򷵻null_state
+	// 返回超级初始状态的序号，若失败则返回null_state
 	state_index_t makeSuperInitial() {
 		if (!hasInitial())
 			return null_state;
@@ -203,7 +203,7 @@ public:
 		}
 	}
 
-	// ֹ״̬
+	// 返回终止状态集
 	decltype(auto) finals() const { 
 		if constexpr (hasStateWeight()) {
 			std::vector<std::pair<state_index_t, weight_type>> fs;
@@ -226,7 +226,7 @@ public:
 		return vertex_traits<T>::weight(super_::vertexAt(f));
 	}
 
-	// ״̬fǷΪֹ״̬
+	// 状态f是否为终止状态
 	bool isFinal(state_index_t f) const {
 		if constexpr (hasStateWeight()) {
 			if constexpr (std::is_scalar_v<std::decay_t<decltype(stateWeight(f))>>)
@@ -250,7 +250,7 @@ public:
 	}
 
 
-	// Ƿֹ״̬
+	// 是否设置终止状态
 	bool hasFinal() const { 
 		if constexpr (hasStateWeight()) {
 			state_index_t num(0);
@@ -264,7 +264,7 @@ public:
 	}
 
 	
-	// ֹ״̬fȨֵ÷fضΪֹ״̬
+	// 返回终止状态f的权值，该方法断言f必定为终止状态
 	decltype(auto) finalWeight(state_index_t f) const {
 		assert(isFinal(f));
 		if constexpr (hasStateWeight())
@@ -274,7 +274,7 @@ public:
 	}
 
 
-	// ״̬fΪֹ״ֹ̬״̬fȨֵΪwt
+	// 设置已有状态f为终止状态，或更改终止状态f的权值为wt
 	void setFinal(state_index_t f, const weight_type& wt = weight_type::one()) {
 		assert(f < order());
 		if constexpr (hasStateWeight())
@@ -291,7 +291,7 @@ public:
 			finals_.erase(f);
 	}
 
-	// һ״̬Ϊֹ״̬ȨֵΪwt
+	// 增加一个新状态，并将其置为终止状态，权值为wt。
 	state_index_t addFinal(const weight_type& wt = weight_type::one()) {
 		state_index_t f = addState();
 		if constexpr (hasStateWeight())
@@ -302,7 +302,7 @@ public:
 	}
 
 	/*
-	// سֹ״̬ţʧ򷵻null_state
+	// 返回超级终止状态的序号，若失败则返回null_state
 	state_index_t makeSuperFinal() {
 		if (!hasFinal())
 			return null_state;
@@ -322,7 +322,7 @@ public:
 
 
 	/*
-    // бߣ״̬תƣתÿתƵ״̬״̬ͬʱʼ״ֹ̬״̬
+    // 将所有边（状态转移）反转，即交换每个转移的输入状态与输出状态。同时交换初始状态与终止状态。
 	KtWfst reverse() const {
 		KtWfst rwfst;
 		rwfst.inside() = inverse<graph_type>();
@@ -332,12 +332,12 @@ public:
 	}
 
 
-	// ת
+	// 将输入输出反转
 	KtWfst invert() const {
 		struct Weightor_ {
 			auto operator()(const trans_type& trans) {
 				trans_traits traits;
-				return traits.construct(traits.osym(trans), traits.isym(trans), traits.weight(trans)); // ת
+				return traits.construct(traits.osym(trans), traits.isym(trans), traits.weight(trans)); // 反转
 			}
 		};
 
@@ -347,26 +347,26 @@ public:
 		rwfst.finals_ = finals_;
 	}*/
 
-	/// Ż㷨
+	/// 几个优化算法
 
 
-	// ɾڳʼ״ֹ̬״̬·ϵĶ
+	// 删除不在初始状态到终止状态路径上的顶点
 	void eraseDeadStates() {
 		std::vector<bool> dead(order(), true);
 
-		// TODO: һ򵥵ʵ֣걸
+		// TODO: 一个简单的实现，不完备
 		for (auto& i : initials()) {
 			auto bfs = KtBfsIter(*this, i.first);
 			for (; !bfs.isEnd(); ++bfs)
 				dead[*bfs] = false;
 		}
 
-		for (state_index_t s = order() - 1; s != -1; s--) // ɾԱ㱣ͼĶ˳
+		for (state_index_t s = order() - 1; s != -1; s--) // 逆向遍历删除，以便保持图的顶点编号顺序
 			if (dead[s]) eraseState(s);
 	}
 
 
-	// ϲر/ͬת
+	// 合并重边中输入/输出相同的转移
 	void mergeSameTrans() {
 
 		for (state_index_t s = 0; s < order(); s++) {
@@ -388,7 +388,7 @@ public:
 				auto& edge = iter.edge();
 				KpTrans t{ *iter, traits_type::isym(edge), traits_type::osym(edge) };
 				auto miter = trans.find(t);
-				if (miter != trans.end()) { // Ҫϲ
+				if (miter != trans.end()) { // 需要合并
 					miter->second.reedge(traits_type::construct(traits_type::isym(edge), traits_type::osym(edge),
 						traits_type::weight(edge) + traits_type::weight(miter->second.edge())));
 					iter.erase();
@@ -404,7 +404,7 @@ public:
 
 private:
 
-	// ɾstatesмֵΪsԪأstatesдsļֵΪs-1
+	// 删除states中键值为s的元素，并调整states中所有大于s的键值为s-1
 	static void updateStateIdx_(initial_set_type& states, state_index_t s) {
 		initial_set_type newStates;
 		newStates.reserve(states.size());
@@ -418,6 +418,6 @@ private:
 	}
 
 private:
-	initial_set_type initials_; // ʼ״̬Ȩֵ
-	final_set_type finals_; // ֹ״̬Ȩֵ
+	initial_set_type initials_; // 初始状态集及其权值
+	final_set_type finals_; // 终止状态集及其权值
 };
@@ -4,7 +4,7 @@
 
 namespace kPrivate {
 
-	// KtWfstڵķװ
+	// 将KtWfst对象置内的封装
 
 	template<typename WFST>
 	class KtWfstHolder : public KtHolder<WFST>
@@ -20,7 +20,7 @@ namespace kPrivate {
 		using alpha_type = typename wfst_type::alpha_type;
 
 
-		// 빹캯
+		// 导入构造函数
 		using super_::super_;
 
 		WFST& wfst() { return super_::inside(); }
@@ -6,16 +6,16 @@
 
 namespace kPrivate
 {
-	// fstת
+	// fst的转移类型
 	template<typename SEMIRING, typename ALPHA_TYPE>
 	struct KpStdTrans_
 	{
 		using weight_type = SEMIRING;
 		using alpha_type = ALPHA_TYPE;
 
-		ALPHA_TYPE isym; // 
-		ALPHA_TYPE osym; // 
-		SEMIRING wt; // Ȩ
+		ALPHA_TYPE isym; // 输入符号
+		ALPHA_TYPE osym; // 输出符号
+		SEMIRING wt; // 权重
 
 		KpStdTrans_() = default;
 		KpStdTrans_(const KpStdTrans_&) = default;
@@ -45,7 +45,7 @@ namespace kPrivate
 
 
 
-// ʹϡͼʵֵı׼wfst
+// 使用稀疏图实现的标准wfst
 template<typename SEMIRING, typename ALPHA_TYPE = int>
 using StdWfst = KtWfst<kPrivate::KpStdTrans_<SEMIRING, ALPHA_TYPE>>;
 
@@ -56,7 +56,7 @@ template<typename WEIGHT, typename ALPHA_TYPE = int>
 using StdWfstTrop = StdWfst<KtTropicalSemiring<WEIGHT>, ALPHA_TYPE>;
 
 
-// ʹñƽͼʵֵı׼wfst
+// 使用扁平图实现的标准wfst
 template<typename SEMIRING, typename ALPHA_TYPE = int>
 using StdFlatWfst = KtWfst<kPrivate::KpStdTrans_<SEMIRING, ALPHA_TYPE>, 
 	trans_traits<kPrivate::KpStdTrans_<SEMIRING, ALPHA_TYPE>>,
@@ -1,7 +1,7 @@
 #pragma once
 
 
-// wfstתƵtraits. ûԶ壬Աtrans_traitsһ
+// wfst转移的traits. 用户可自定义，但成员须与trans_traits保持一致
 template<typename TRANS_TYPE>
 struct trans_traits
 {
@@ -10,7 +10,7 @@ struct trans_traits
 	using alpha_type = typename TRANS_TYPE::alpha_type;
 	constexpr static alpha_type eps = alpha_type{};
 
-	//  롢Ȩعתƶ
+	//  根据输入、输出和权重构造转移对象
 	static trans_type construct(const alpha_type& isym, const alpha_type& osym, const weight_type& wt) {
 		return trans_type(isym, osym, wt);
 	};
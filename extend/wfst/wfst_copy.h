@@ -2,8 +2,8 @@
 #include "../../graph/util/copy.h"
 
 
-// wfstĿҪgraphĻϣinitialsfinalsĿ
-// @WTOR: Ҫweight_typeתtrans_type
+// wfst的拷贝，主要在graph拷贝的基础上，增加initials和finals的拷贝
+// @WTOR: 主要负责weight_type的转换，而非trans_type
 template<typename SRC, typename DST, typename WTOR = KtWeightSelf<typename SRC::edge_type>>
 DST wfst_copy(const SRC& src)
 {
@@ -9,7 +9,7 @@
 #include "core/KtPfsIter.h"
 
 
-// һЩõķװ
+// 对一些常用迭代器的封装
 template<typename GRAPH>
 class KtGraphX : public GRAPH
 {
@@ -78,7 +78,7 @@ public:
 };
 
 
-/// ͼ
+/// 稠密无向图
 template<typename EDGE_TYPE, typename VERTEX_TYPE = void>
 using GraphDx = KtGraphX<KtGraph<KtAdjGraphDenseImpl<EDGE_TYPE, VERTEX_TYPE>, false, false, false>>;
 
@@ -87,7 +87,7 @@ using GraphDd = GraphDx<double>;
 using GraphDf = GraphDx<float>;
 
 
-/// ͼ
+/// 稠密有向图
 template<typename EDGE_TYPE, typename VERTEX_TYPE = void>
 using DigraphDx = KtGraphX<KtGraph<KtAdjGraphDenseImpl<EDGE_TYPE, VERTEX_TYPE>, true, false, false>>;
 
@@ -96,7 +96,7 @@ using DigraphDd = DigraphDx<double>;
 using DigraphDf = DigraphDx<float>;
 
 
-/// ϡͼ
+/// 稀疏无向图
 template<typename EDGE_TYPE, typename VERTEX_TYPE = void, bool alwaysSorted = false>
 using GraphSx = KtGraphX<KtGraph<KtAdjGraphSparseImpl<EDGE_TYPE, VERTEX_TYPE>, false, false, alwaysSorted>>;
 
@@ -110,7 +110,7 @@ template<bool alwaysSorted = false>
 using GraphSf = GraphSx<float, void, alwaysSorted>;
 
 
-/// ϡͼ
+/// 稀疏有向图
 template<typename EDGE_TYPE, typename VERTEX_TYPE = void, bool alwaysSorted = false>
 using DigraphSx = KtGraphX<KtGraph<KtAdjGraphSparseImpl<EDGE_TYPE, VERTEX_TYPE>, true, false, alwaysSorted>>;
 
@@ -124,7 +124,7 @@ template<bool alwaysSorted = false>
 using DigraphSf = DigraphSx<float, void, alwaysSorted>;
 
 
-/// ƽͼر/ƽбߣ
+/// 平行无向图（允许重边/平行边）
 template<typename EDGE_TYPE, typename VERTEX_TYPE = void, bool alwaysSorted = false>
 using GraphPx = KtGraphX<KtGraph<KtAdjGraphSparseImpl<EDGE_TYPE, VERTEX_TYPE>, false, true, alwaysSorted>>;
 
@@ -138,7 +138,7 @@ template<bool alwaysSorted = false>
 using GraphPf = GraphPx<float, void, alwaysSorted>;
 
 
-/// ƽͼر/ƽбߣ
+/// 平行有向图（允许重边/平行边）
 template<typename EDGE_TYPE, typename VERTEX_TYPE = void, bool alwaysSorted = false>
 using DigraphPx = KtGraphX<KtGraph<KtAdjGraphSparseImpl<EDGE_TYPE, VERTEX_TYPE>, true, true, alwaysSorted>>;
 
@@ -152,7 +152,7 @@ template<bool alwaysSorted = false>
 using DigraphPf = DigraphPx<float, void, alwaysSorted>;
 
 
-/// ƽͼر/ƽбߣ
+/// 扁平无向图（允许重边/平行边）
 template<typename EDGE_TYPE, typename VERTEX_TYPE = void, bool alwaysSorted = false>
 using GraphFx = KtGraphX<KtGraph<KtFlatGraphVectorImpl<EDGE_TYPE, VERTEX_TYPE>, false, true, alwaysSorted>>;
 
@@ -166,7 +166,7 @@ template<bool alwaysSorted = false>
 using GraphFf = GraphFx<float, void, alwaysSorted>;
 
 
-/// ƽͼر/ƽбߣ
+/// 扁平有向图（允许重边/平行边）
 template<typename EDGE_TYPE, typename VERTEX_TYPE = void, bool alwaysSorted = false>
 using DigraphFx = KtGraphX<KtGraph<KtFlatGraphVectorImpl<EDGE_TYPE, VERTEX_TYPE>, true, true, alwaysSorted>>;
 
@@ -178,3 +178,31 @@ using DigraphFd = DigraphFx<double, void, alwaysSorted>;
 
 template<bool alwaysSorted = false>
 using DigraphFf = DigraphFx<float, void, alwaysSorted>;
+
+
+/// 列存扁平无向图（允许重边/平行边），to顶点与边值分列存储
+template<typename EDGE_TYPE, typename VERTEX_TYPE = void, bool alwaysSorted = false>
+using GraphCx = KtGraphX<KtGraph<KtFlatGraphVectorImpl<EDGE_TYPE, VERTEX_TYPE, unsigned, unsigned, true>, false, true, alwaysSorted>>;
+
+template<bool alwaysSorted = false>
+using GraphCi = GraphCx<int, void, alwaysSorted>;
+
+template<bool alwaysSorted = false>
+using GraphCd = GraphCx<double, void, alwaysSorted>;
+
+template<bool alwaysSorted = false>
+using GraphCf = GraphCx<float, void, alwaysSorted>;
+
+
+/// 列存扁平有向图（允许重边/平行边），to顶点与边值分列存储
+template<typename EDGE_TYPE, typename VERTEX_TYPE = void, bool alwaysSorted = false>
+using DigraphCx = KtGraphX<KtGraph<KtFlatGraphVectorImpl<EDGE_TYPE, VERTEX_TYPE, unsigned, unsigned, true>, true, true, alwaysSorted>>;
+
+template<bool alwaysSorted = false>
+using DigraphCi = DigraphCx<int, void, alwaysSorted>;
+
+template<bool alwaysSorted = false>
+using DigraphCd = DigraphCx<double, void, alwaysSorted>;
+
+template<bool alwaysSorted = false>
+using DigraphCf = DigraphCx<float, void, alwaysSorted>;
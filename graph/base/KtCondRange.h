@@ -2,7 +2,7 @@
 #include <type_traits>
 
 
-/// νʵKtRangeչ
+/// 带谓词的KtRange拓展
 
 template<typename ITER_TYPE, typename PRED>
 class KtCondRange
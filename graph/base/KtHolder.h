@@ -3,8 +3,8 @@
 #include <tuple>
 
 
-// Tķװ
-// ʵֻĹ졢ֵȡֵȽϡȡַת͵ȷ
+// 对类型T的封装类
+// 实现基本的构造、赋值、取值、比较、取址、转型等方法
 
 namespace kPrivate
 {
@@ -134,19 +134,19 @@ namespace kPrivate
 }
 
 
-// Ԫ
+// 单个内置元素
 template<typename T>
-using KtHolder = kPrivate::KtHolderImpl_<T, std::is_trivial_v<T>>; // TODO: ʹtrivial copyable
+using KtHolder = kPrivate::KtHolderImpl_<T, std::is_trivial_v<T>>; // TODO: 使用trivial copyable
 
 
-// ֶ֧Ԫ
+// 支持多个内置元素
 template<typename... T>
 class KtTupleHolder : public KtHolder<std::tuple<T...>>
 {
 public:
 	using super_ = KtHolder<std::tuple<T...>>;
 
-	// չ캯
+	// 拓展构造函数
 	using super_::super_;
 	KtTupleHolder(T&&... t) : super_(std::make_tuple(std::forward<T>(t)...)) {}
 
@@ -156,7 +156,7 @@ public:
 	}
 
 
-	// չinsideԱ
+	// 拓展inside成员方法
 	using super_::inside;
 
 	template<int I>
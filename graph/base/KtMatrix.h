@@ -4,7 +4,7 @@
 #include "KtRange.h"
 
 
-// һ򵥵ľģʵ
+// 一个简单的矩阵模板实现
 template<typename T>
 class KtMatrix
 {
@@ -39,8 +39,8 @@ public:
 
     void reserve(unsigned rows, unsigned cols) { data_.reserve(rows * cols); }
 
-    unsigned rows() const { return rows_; } // 
-    unsigned cols() const { return cols_; } // 
+    unsigned rows() const { return rows_; } // 行数
+    unsigned cols() const { return cols_; } // 列数
 
 
     void insert(unsigned row, unsigned col, const_reference val) {
@@ -48,7 +48,7 @@ public:
     }
 
 
-    // صidxеĵΧ
+    // 返回第idx行的迭代范围
     auto row(unsigned idx) {
         row_element_iter start = std::next(data_.begin(), idx * cols_);
         return KtRange<row_element_iter>(start, cols_);
@@ -78,26 +78,26 @@ public:
     }
 
 
-    // @val: еĳʼֵ
+    // @val: 新增行的初始值
     void appendRow(const_reference val) {
         data_.resize(data_.size() + cols_, val);
         ++rows_;
     }
 
 
-    // @val: еĳʼֵ
+    // @val: 新增列的初始值
     void appendCol(const_reference val) {
         data_.resize(data_.size() + rows_);
         auto src = data_.begin() + (rows_ - 1) * cols_;
         auto dst = data_.end() - 1;
-        for (unsigned r = 1; r < rows_; r++) { // вƶr1
+        for (unsigned r = 1; r < rows_; r++) { // 首行不移动，所以r从1起
             std::copy_backward(src, src + cols_, dst);
-            *dst = val; // иֵ
+            *dst = val; // 新增列赋值
             src -= cols_;
             dst -= cols_ + 1;
         }
 
-        *(src + cols_) = val; // еиֵ
+        *(src + cols_) = val; // 首行的新增列赋值
 
         ++cols_;
     }
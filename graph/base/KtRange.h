@@ -39,7 +39,7 @@ public:
         return first_ != rhs.first_ || last_ != rhs.last_;
     }
 
-    // Ϊʹ
+    // 作为容器使用
 
 	iterator begin() { return first_; }
 	iterator end() { return last_; }
@@ -75,7 +75,7 @@ public:
     }
 
 
-    // Ϊʹ
+    // 作为迭代器使用
 
 	iterator& operator++() { return ++first_; }
 
@@ -94,7 +94,7 @@ public:
     }
 
 
-    // һЩstd㷨ķװ
+    // 对一些常用std算法的封装
 
     void sort() { std::sort(first_, last_); }
     template<class Compare> void sort(Compare comp) { std::sort(first_, last_, comp); }
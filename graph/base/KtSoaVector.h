@@ -0,0 +1,192 @@
+#pragma once
+#include <vector>
+#include <iterator>
+#include <type_traits>
+#include <assert.h>
+
+
+// 双列的SoA（struct-of-arrays）容器：第0列（键）与第1列（值）分别连续存储
+// 迭代器解引用返回代理对象KtSoaRef，而非真实引用，因此：
+//   一是auto x = *iter得到的是代理（引用语义），需要值语义时应显式转换为值类型
+//   二是不支持std::sort, std::rotate等需要构造value_type临时对象的算法
+// 主要用于图的边存储，使仅访问to顶点的遍历算法不必加载边值
+
+template<typename T0, typename T1>
+class KtSoaRef
+{
+public:
+    using key_type = T0;
+    using value_type = T1;
+    using mutable_value_type = std::remove_const_t<T1>;
+
+    KtSoaRef(T0* p0, T1* p1) : p0_(p0), p1_(p1) {}
+    KtSoaRef(const KtSoaRef&) = default;
+
+    // 允许从非const代理构造const代理
+    template<typename U0, typename U1, typename = std::enable_if_t<
+        std::is_convertible_v<U0*, T0*> && std::is_convertible_v<U1*, T1*>>>
+    KtSoaRef(const KtSoaRef<U0, U1>& rhs) : p0_(&rhs.key()), p1_(&rhs.value()) {}
+
+
+    // 代理为浅const：const代理亦可修改所指数据
+    T0& key() const { return *p0_; }
+    T1& value() const { return *p1_; }
+
+    operator T1& () const { return *p1_; }
+
+
+    // 赋值操作作用于所指数据，而非代理本身
+
+    template<typename T = T1, typename = std::enable_if_t<!std::is_const_v<T>>>
+    const KtSoaRef& operator=(const mutable_value_type& val) const {
+        *p1_ = val;
+        return *this;
+    }
+
+    const KtSoaRef& operator=(const KtSoaRef& rhs) const {
+        *p0_ = *rhs.p0_, *p1_ = *rhs.p1_;
+        return *this;
+    }
+
+    friend void swap(const KtSoaRef& lhs, const KtSoaRef& rhs) {
+        std::swap(*lhs.p0_, *rhs.p0_);
+        std::swap(*lhs.p1_, *rhs.p1_);
+    }
+
+private:
+    T0* p0_;
+    T1* p1_;
+};
+
+
+template<typename T0, typename T1>
+class KtSoaIter
+{
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::remove_const_t<T1>;
+    using difference_type = std::ptrdiff_t;
+    using reference = KtSoaRef<T0, T1>;
+    using pointer = void;
+
+    KtSoaIter() : p0_(nullptr), p1_(nullptr) {}
+    KtSoaIter(T0* p0, T1* p1) : p0_(p0), p1_(p1) {}
+
+    // 允许iterator向const_iterator转换
+    template<typename U0, typename U1, typename = std::enable_if_t<
+        std::is_convertible_v<U0*, T0*> && std::is_convertible_v<U1*, T1*>>>
+    KtSoaIter(const KtSoaIter<U0, U1>& rhs) : p0_(rhs.keyPtr()), p1_(rhs.valuePtr()) {}
+
+
+    reference operator*() const { return reference(p0_, p1_); }
+    reference operator[](difference_type n) const { return reference(p0_ + n, p1_ + n); }
+
+    KtSoaIter& operator++() { ++p0_, ++p1_; return *this; }
+    KtSoaIter& operator--() { --p0_, --p1_; return *this; }
+    KtSoaIter operator++(int) { auto tmp = *this; ++(*this); return tmp; }
+    KtSoaIter operator--(int) { auto tmp = *this; --(*this); return tmp; }
+
+    KtSoaIter& operator+=(difference_type n) { p0_ += n, p1_ += n; return *this; }
+    KtSoaIter& operator-=(difference_type n) { p0_ -= n, p1_ -= n; return *this; }
+    KtSoaIter operator+(difference_type n) const { return KtSoaIter(p0_ + n, p1_ + n); }
+    KtSoaIter operator-(difference_type n) const { return KtSoaIter(p0_ - n, p1_ - n); }
+    friend KtSoaIter operator+(difference_type n, const KtSoaIter& iter) { return iter + n; }
+
+    difference_type operator-(const KtSoaIter& rhs) const { return p0_ - rhs.p0_; }
+
+    bool operator==(const KtSoaIter& rhs) const { return p0_ == rhs.p0_; }
+    bool operator!=(const KtSoaIter& rhs) const { return p0_ != rhs.p0_; }
+    bool operator<(const KtSoaIter& rhs) const { return p0_ < rhs.p0_; }
+    bool operator>(const KtSoaIter& rhs) const { return p0_ > rhs.p0_; }
+    bool operator<=(const KtSoaIter& rhs) const { return p0_ <= rhs.p0_; }
+    bool operator>=(const KtSoaIter& rhs) const { return p0_ >= rhs.p0_; }
+
+    T0* keyPtr() const { return p0_; }
+    T1* valuePtr() const { return p1_; }
+
+private:
+    T0* p0_;
+    T1* p1_;
+};
+
+
+template<typename T0, typename T1>
+class KtSoaVector
+{
+public:
+    using key_type = T0;
+    using value_type = T1;
+    using iterator = KtSoaIter<T0, T1>;
+    using const_iterator = KtSoaIter<const T0, const T1>;
+    using reference = KtSoaRef<T0, T1>;
+    using const_reference = KtSoaRef<const T0, const T1>;
+
+
+    auto size() const { return keys_.size(); }
+    bool empty() const { return keys_.empty(); }
+
+    void clear() { keys_.clear(), vals_.clear(); }
+
+    void reserve(std::size_t n) { keys_.reserve(n), vals_.reserve(n); }
+
+    void resize(std::size_t n) { keys_.resize(n), vals_.resize(n); }
+
+
+    iterator begin() { return iterator(keys_.data(), vals_.data()); }
+    iterator end() { return begin() + size(); }
+    const_iterator begin() const { return const_iterator(keys_.data(), vals_.data()); }
+    const_iterator end() const { return begin() + size(); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    reference operator[](std::size_t idx) { return begin()[idx]; }
+    const_reference operator[](std::size_t idx) const { return begin()[idx]; }
+
+    reference at(std::size_t idx) { assert(idx < size()); return begin()[idx]; }
+    const_reference at(std::size_t idx) const { assert(idx < size()); return begin()[idx]; }
+
+
+    void push_back(const T1& val) { keys_.push_back(T0{}), vals_.push_back(val); }
+
+    void push_back(const T0& key, const T1& val) { keys_.push_back(key), vals_.push_back(val); }
+
+    // 在pos处插入值val，对应的键值初始化为T0{}
+    iterator insert(const_iterator pos, const T1& val) {
+        auto idx = offset_(pos);
+        keys_.insert(keys_.begin() + idx, T0{});
+        vals_.insert(vals_.begin() + idx, val);
+        return begin() + idx;
+    }
+
+    iterator erase(const_iterator pos) {
+        auto idx = offset_(pos);
+        keys_.erase(keys_.begin() + idx);
+        vals_.erase(vals_.begin() + idx);
+        return begin() + idx;
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        auto idx = offset_(first), n = last - first;
+        keys_.erase(keys_.begin() + idx, keys_.begin() + idx + n);
+        vals_.erase(vals_.begin() + idx, vals_.begin() + idx + n);
+        return begin() + idx;
+    }
+
+
+    // 直接访问各列的连续存储
+    std::vector<T0>& keys() { return keys_; }
+    const std::vector<T0>& keys() const { return keys_; }
+    std::vector<T1>& values() { return vals_; }
+    const std::vector<T1>& values() const { return vals_; }
+
+private:
+    std::ptrdiff_t offset_(const_iterator pos) const {
+        auto idx = pos - cbegin();
+        assert(idx >= 0 && idx <= static_cast<std::ptrdiff_t>(size()));
+        return idx;
+    }
+
+private:
+    std::vector<T0> keys_;
+    std::vector<T1> vals_;
+};
@@ -0,0 +1,130 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+
+// 带时间戳的定长数组，可以O(1)代价将全部元素复位为缺省值
+// 每BLOCK个连续元素共用一个时间戳，仅当其等于当前时间戳（epoch）时，块内元素值有效，否则视为缺省值
+// reset()只需递增epoch，时间戳溢出时才需要O(n / BLOCK)的清零操作
+// @BLOCK: 为1时每个元素独立记录是否写过（支持isMarked），内存开销为每元素sizeof(STAMP)；
+//   大于1时时间戳的开销分摊为每元素sizeof(STAMP) / BLOCK，块在复位后首次写入时整体填充为缺省值
+template<typename T, typename STAMP = std::uint32_t, unsigned BLOCK = 1>
+class KtStampedVector
+{
+public:
+    using value_type = T;
+    using stamp_type = STAMP;
+
+    explicit KtStampedVector(std::size_t n = 0, const T& dflt = T{})
+        : values_(n, dflt), stamps_(blocks_(n), 0), epoch_(1), dflt_(dflt) {}
+
+    std::size_t size() const { return values_.size(); }
+
+    // 新增元素的值为缺省值
+    void resize(std::size_t n) {
+        values_.resize(n, dflt_);
+        stamps_.resize(blocks_(n), 0);
+    }
+
+    // 将全部元素复位为缺省值
+    void reset() {
+        if (++epoch_ == 0) {
+            std::fill(stamps_.begin(), stamps_.end(), 0);
+            epoch_ = 1;
+        }
+    }
+
+    void reset(const T& dflt) {
+        dflt_ = dflt;
+        reset();
+    }
+
+    const T& dflt() const { return dflt_; }
+
+    // 元素i自上次复位以来是否被写过
+    bool isMarked(std::size_t i) const {
+        static_assert(BLOCK == 1, "isMarked requires per-element stamps");
+        return stamps_[i] == epoch_;
+    }
+
+    void mark(std::size_t i) { set(i, dflt_); }
+
+    const T& operator[](std::size_t i) const {
+        return stamps_[i / BLOCK] == epoch_ ? values_[i] : dflt_;
+    }
+
+    void set(std::size_t i, const T& val) {
+        auto b = i / BLOCK;
+        if constexpr (BLOCK > 1) {
+            if (stamps_[b] != epoch_) {
+                auto first = values_.begin() + b * BLOCK;
+                std::fill(first, first + std::min<std::size_t>(BLOCK, values_.size() - b * BLOCK), dflt_);
+            }
+        }
+        values_[i] = val;
+        stamps_[b] = epoch_;
+    }
+
+private:
+    static std::size_t blocks_(std::size_t n) { return (n + BLOCK - 1) / BLOCK; }
+
+private:
+    std::vector<T> values_;
+    std::vector<STAMP> stamps_;
+    STAMP epoch_;
+    T dflt_;
+};
+
+
+// 带时间戳的位集，可以O(1)代价清除全部标记
+// 每64位共用一个时间戳，每元素的内存开销为(64 + 8 * sizeof(STAMP)) / 64位，缺省为1.5位
+template<typename STAMP = std::uint32_t>
+class KtStampedBitset
+{
+public:
+    using stamp_type = STAMP;
+
+    explicit KtStampedBitset(std::size_t n = 0)
+        : words_(words_of_(n), 0), stamps_(words_of_(n), 0), size_(n), epoch_(1) {}
+
+    std::size_t size() const { return size_; }
+
+    // 新增元素均未标记
+    void resize(std::size_t n) {
+        words_.resize(words_of_(n), 0);
+        stamps_.resize(words_of_(n), 0);
+        size_ = n;
+    }
+
+    // 清除全部标记
+    void reset() {
+        if (++epoch_ == 0) {
+            std::fill(stamps_.begin(), stamps_.end(), 0);
+            epoch_ = 1;
+        }
+    }
+
+    bool isMarked(std::size_t i) const {
+        auto w = i / 64;
+        return stamps_[w] == epoch_ && (words_[w] >> (i % 64) & 1);
+    }
+
+    void mark(std::size_t i) {
+        auto w = i / 64;
+        if (stamps_[w] != epoch_) {
+            words_[w] = 0;
+            stamps_[w] = epoch_;
+        }
+        words_[w] |= std::uint64_t(1) << (i % 64);
+    }
+
+private:
+    static std::size_t words_of_(std::size_t n) { return (n + 63) / 64; }
+
+private:
+    std::vector<std::uint64_t> words_;
+    std::vector<STAMP> stamps_;
+    std::size_t size_;
+    STAMP epoch_;
+};
@@ -0,0 +1,83 @@
+#pragma once
+#include <vector>
+#include <atomic>
+#include <memory>
+
+
+// 无锁并查集，find/unite/connected均可由多个线程并发调用
+// 以CAS实现链接操作：总是将较大的根链接到较小的根，因此集合的根为集合中的最小元素
+// find时以CAS进行路径减半（path halving），压缩失败不影响正确性
+template<typename INDEX = unsigned>
+class concurrent_union_find_set
+{
+public:
+    using index_type = INDEX;
+
+    explicit concurrent_union_find_set(INDEX size)
+        : size_(size), id_(new std::atomic<INDEX>[size]) {
+        for (INDEX i = 0; i < size; i++)
+            id_[i].store(i, std::memory_order_relaxed);
+    }
+
+    INDEX size() const { return size_; }
+
+
+    // 查找元素i所属集合的id
+    INDEX find(INDEX i) {
+        while (true) {
+            INDEX p = id_[i].load(std::memory_order_relaxed);
+            if (p == i) return i;
+
+            INDEX gp = id_[p].load(std::memory_order_relaxed);
+            if (p != gp) // 路径减半：i指向祖父
+                id_[i].compare_exchange_weak(p, gp, std::memory_order_relaxed);
+            i = gp;
+        }
+    }
+
+
+    // 将元素i所属集合与元素j所属集合合并
+    // 返回false表示i和j本来就属同一集合，未执行合并操作
+    bool unite(INDEX i, INDEX j) {
+        while (true) {
+            i = find(i), j = find(j);
+            if (i == j) return false;
+            if (i < j) std::swap(i, j);
+
+            // 只有当i仍是根时才能链接成功，否则重新查找
+            INDEX expected = i;
+            if (id_[i].compare_exchange_strong(expected, j, std::memory_order_acq_rel))
+                return true;
+        }
+    }
+
+
+    // 元素i和元素j是否属于同一集合
+    // 与unite并发调用时，返回结果与某一时刻的集合状态一致
+    bool connected(INDEX i, INDEX j) {
+        while (true) {
+            i = find(i), j = find(j);
+            if (i == j) return true;
+
+            // 若i仍是根，则i和j在该时刻属于不同集合，否则重新查找
+            if (id_[i].load(std::memory_order_acquire) == i)
+                return false;
+        }
+    }
+
+
+    // 将每个元素直接指向其根，须在没有并发unite时调用
+    // 由于父元素总是小于子元素，按升序处理一遍即可
+    void compress() {
+        for (INDEX i = 0; i < size_; i++)
+            id_[i].store(id_[id_[i].load(std::memory_order_relaxed)].load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+    }
+
+    // 元素i的父元素，compress之后即为i所属集合的id
+    INDEX parent(INDEX i) const { return id_[i].load(std::memory_order_relaxed); }
+
+private:
+    INDEX size_;
+    std::unique_ptr<std::atomic<INDEX>[]> id_;
+};
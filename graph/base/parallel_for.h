@@ -0,0 +1,86 @@
+#pragma once
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <algorithm>
+
+
+// 基于std::thread的简易并行循环
+
+// 可用的硬件线程数，至少为1
+inline unsigned hardware_threads()
+{
+    auto n = std::thread::hardware_concurrency();
+    return n ? n : 1;
+}
+
+
+// 以nthreads个线程（含调用线程）并行执行func(i), i∈[first, last)
+// 各线程以grain为单位动态领取任务，以平衡负载
+// @nthreads: 为0时取hardware_threads()
+// @grain: 为0时自动确定
+template<typename INDEX, typename FUNC>
+void parallel_for(INDEX first, INDEX last, FUNC&& func, unsigned nthreads = 0, INDEX grain = 0)
+{
+    if (first >= last) return;
+
+    // 任务计数以相对first的std::uint64_t偏移量记录，避免窄INDEX类型在fetch_add越过last时回绕
+    const std::uint64_t n = static_cast<std::uint64_t>(last - first);
+    if (nthreads == 0) nthreads = hardware_threads();
+    std::uint64_t chunk = grain > 0 ? static_cast<std::uint64_t>(grain)
+        : std::max<std::uint64_t>(1, n / (std::uint64_t(nthreads) * 8));
+    nthreads = static_cast<unsigned>(std::min<std::uint64_t>(nthreads, (n + chunk - 1) / chunk));
+
+    if (nthreads <= 1) {
+        for (auto i = first; i < last; ++i)
+            func(i);
+        return;
+    }
+
+    std::atomic<std::uint64_t> next(0);
+    auto worker = [&]() {
+        while (true) {
+            auto start = next.fetch_add(chunk);
+            if (start >= n) break;
+            auto stop = std::min(start + chunk, n);
+            for (auto i = start; i < stop; ++i)
+                func(static_cast<INDEX>(first + static_cast<INDEX>(i)));
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(nthreads - 1);
+    for (unsigned t = 1; t < nthreads; t++)
+        threads.emplace_back(worker);
+    worker();
+
+    for (auto& t : threads)
+        t.join();
+}
+
+
+// 将[first, last)静态划分为nthreads个连续区间，并行执行func(tid, begin, end)
+// 适用于各线程需要维护局部状态（如局部缓冲区）的场合
+template<typename INDEX, typename FUNC>
+void parallel_blocks(INDEX first, INDEX last, FUNC&& func, unsigned nthreads = 0)
+{
+    if (first >= last) return;
+
+    const std::uint64_t n = static_cast<std::uint64_t>(last - first);
+    if (nthreads == 0) nthreads = hardware_threads();
+    nthreads = static_cast<unsigned>(std::min<std::uint64_t>(nthreads, n));
+
+    auto bound = [&](unsigned t) {
+        return static_cast<INDEX>(first + static_cast<INDEX>(n / nthreads * t + std::min<std::uint64_t>(t, n % nthreads)));
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(nthreads - 1);
+    for (unsigned t = 1; t < nthreads; t++)
+        threads.emplace_back([&func, t, b = bound(t), e = bound(t + 1)]() { func(t, b, e); });
+    func(0u, bound(0), bound(1));
+
+    for (auto& t : threads)
+        t.join();
+}
@@ -1,7 +1,7 @@
 #pragma once
 
 
-// жĳǷйxxxԱ
+// 用于判定某个类是否具有公开的xxx成员函数
 #define HAS_MEMBER(xxx) \
     template<typename T, typename... Args> \
     struct has_member_##xxx \
@@ -14,7 +14,7 @@
     };
 
 
-// жĳǷйxxx̬Ա
+// 用于判定某个类是否具有公开的xxx静态成员函数
 #define HAS_STATIC_MEMBER(xxx) \
     template<typename T, typename... Args> \
     struct has_static_member_##xxx \
@@ -27,7 +27,7 @@
     };
 
 
-// жǷصop
+// 用于判定两个类型是否具有重载的op操作符
 #define HAS_OVERLOADED_BIOP(op, name) \
 template<typename T1, typename T2> \
 struct has_operator_##name \
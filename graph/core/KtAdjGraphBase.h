@@ -3,9 +3,12 @@
 #include <vector>
 
 
-/// ڽӾͼ
+/// 邻接矩阵图
 
-template<typename ADJ_MATRIX, typename VERTEX_TYPE>
+// @VERTEX_INDEX: 顶点索引类型
+// @EDGE_INDEX: 边计数类型
+template<typename ADJ_MATRIX, typename VERTEX_TYPE, 
+	typename VERTEX_INDEX = unsigned, typename EDGE_INDEX = unsigned>
 class KtAdjGraphBase
 {
 	using vertex_container = std::vector<VERTEX_TYPE>;
@@ -13,44 +16,48 @@ class KtAdjGraphBase
 public:
 	using vertex_type = VERTEX_TYPE;
 	using edge_type = std::decay_t<decltype(*std::declval<ADJ_MATRIX>().row(0).begin())>;
+	using vertex_index_t = VERTEX_INDEX;
+	using edge_index_t = EDGE_INDEX;
 
 
-	// ͼĽף
-	unsigned order() const { return static_cast<unsigned>(adjMat_.rows()); }
+	// 图的阶，即顶点数量
+	vertex_index_t order() const { return static_cast<vertex_index_t>(adjMat_.rows()); }
 
-	// ߵ
-	unsigned size() const { return E_; }
+	// 边的数量
+	edge_index_t size() const { return E_; }
 
-	decltype(auto) vertexAt(unsigned v) { return vertexes_.at(v); }
-	decltype(auto) vertexAt(unsigned v) const { return vertexes_.at(v); }
+	decltype(auto) vertexAt(vertex_index_t v) { return vertexes_.at(v); }
+	decltype(auto) vertexAt(vertex_index_t v) const { return vertexes_.at(v); }
 
 
-	// vĳ
-	auto outedges(unsigned v) { return adjMat_.row(v); }
-	auto outedges(unsigned v) const { return adjMat_.row(v); }
+	// 顶点v的出边
+	auto outedges(vertex_index_t v) { return adjMat_.row(v); }
+	auto outedges(vertex_index_t v) const { return adjMat_.row(v); }
 
 protected:
-	ADJ_MATRIX adjMat_; // ڽӾ
-	unsigned E_{ 0 }; // ʵʱ׷ٱߵĿ
+	ADJ_MATRIX adjMat_; // 邻接矩阵
+	edge_index_t E_{ 0 }; // 实时追踪边的数目
 	vertex_container vertexes_;
 };
 
 
-template<typename ADJ_MATRIX>
-class KtAdjGraphBase<ADJ_MATRIX, void>
+template<typename ADJ_MATRIX, typename VERTEX_INDEX, typename EDGE_INDEX>
+class KtAdjGraphBase<ADJ_MATRIX, void, VERTEX_INDEX, EDGE_INDEX>
 {
 public:
 	using vertex_type = void;
 	using edge_type = std::decay_t<decltype(*std::declval<ADJ_MATRIX>().row(0).begin())>;
+	using vertex_index_t = VERTEX_INDEX;
+	using edge_index_t = EDGE_INDEX;
 
-	unsigned order() const { return static_cast<unsigned>(adjMat_.rows()); }
+	vertex_index_t order() const { return static_cast<vertex_index_t>(adjMat_.rows()); }
 
-	unsigned size() const { return E_; }
+	edge_index_t size() const { return E_; }
 
-	auto outedges(unsigned v) { return adjMat_.row(v); }
-	auto outedges(unsigned v) const { return adjMat_.row(v); }
+	auto outedges(vertex_index_t v) { return adjMat_.row(v); }
+	auto outedges(vertex_index_t v) const { return adjMat_.row(v); }
 
 protected:
 	ADJ_MATRIX adjMat_;
-	unsigned E_{ 0 };
+	edge_index_t E_{ 0 };
 };
@@ -6,13 +6,17 @@
 #include <assert.h>
 
 
-// ڳڽӾͼʵ
+// 基于稠密阵的邻接矩阵图实现
 
-template<typename EDGE_TYPE, typename VERTEX_TYPE = void>
-class KtAdjGraphDenseImpl : public KtAdjGraphBase<KtMatrix<EDGE_TYPE>, VERTEX_TYPE>
+// @VERTEX_INDEX, @EDGE_INDEX: 顶点索引和边计数的整数类型，大图可选用64位，小图可选用16位以节省存储
+template<typename EDGE_TYPE, typename VERTEX_TYPE = void, 
+    typename VERTEX_INDEX = unsigned, typename EDGE_INDEX = unsigned>
+class KtAdjGraphDenseImpl : public KtAdjGraphBase<KtMatrix<EDGE_TYPE>, VERTEX_TYPE, VERTEX_INDEX, EDGE_INDEX>
 {
 public:
-    using super_ = KtAdjGraphBase<KtMatrix<EDGE_TYPE>, VERTEX_TYPE>;
+    using super_ = KtAdjGraphBase<KtMatrix<EDGE_TYPE>, VERTEX_TYPE, VERTEX_INDEX, EDGE_INDEX>;
+    using typename super_::vertex_index_t;
+    using typename super_::edge_index_t;
     using edge_type = EDGE_TYPE;
     using vertex_type = VERTEX_TYPE;
     using edge_iter = typename graph_traits<super_>::edge_iter;
@@ -26,55 +30,55 @@ public:
 
     KtAdjGraphDenseImpl() = default;
 
-    // ͼΪnv㣬б
-    void reset(unsigned nv) {
+    // 重置图为nv顶点，并清空所有边
+    void reset(vertex_index_t nv) {
         E_ = 0;
         adjMat_.resize(nv, nv, null_edge);
         if constexpr (!std::is_void_v<vertex_type>)
             super_::vertexes_.resize(nv);
     }
 
-    // ԤnvneߵĴ洢.
-    void reserve(unsigned nv, unsigned ne) { 
+    // 预留nv个顶点和ne条边的存储.
+    void reserve(vertex_index_t nv, edge_index_t ne) { 
         adjMat_.reserve(nv, ne);
         if constexpr (!std::is_void_v<vertex_type>)
             super_::vertexes_.reserve(nv);
     }
 
-    // ԶvԤneߵĴ洢.
-    void reserveEdges(unsigned v, unsigned ne) {}
+    // 对顶点v预留ne条边的存储.
+    void reserveEdges(vertex_index_t v, edge_index_t ne) {}
 
     template<typename T = vertex_type, std::enable_if_t<std::is_void_v<T>, bool> = true>
-    unsigned addVertex() {
+    vertex_index_t addVertex() {
         adjMat_.appendRow(null_edge);
         adjMat_.appendCol(null_edge);
-        return static_cast<unsigned>(adjMat_.rows() - 1);
+        return static_cast<vertex_index_t>(adjMat_.rows() - 1);
     }
 
     template<typename T, std::enable_if_t<!std::is_void_v<T>
         && std::is_convertible_v<T, vertex_type>, bool> = false>
-    unsigned addVertex(const T& v) {
+    vertex_index_t addVertex(const T& v) {
         adjMat_.appendRow(null_edge);
         adjMat_.appendCol(null_edge);
         super_::vertexes_.push_back(vertex_type(v));
 
-        return static_cast<unsigned>(super_::vertexes_.size());
+        return static_cast<vertex_index_t>(super_::vertexes_.size());
     }
 
     template<typename T, std::enable_if_t<!std::is_void_v<T>
         && std::is_same_v<T, vertex_type>, bool> = false>
-    unsigned addVertex(T&& v) {
+    vertex_index_t addVertex(T&& v) {
         adjMat_.appendRow(null_edge);
         adjMat_.appendCol(null_edge);
         super_::vertexes_.push_back(std::move(v));
 
-        return static_cast<unsigned>(super_::vertexes_.size());
+        return static_cast<vertex_index_t>(super_::vertexes_.size());
     }
 
         
-    // @dummy: ΪtrueʾӵͼıߣβE_ֲ
+    // @dummy: 若为true，则表示添加的是无向图的边，本次不计数，即E_保持不变
     template<bool dummy = false>
-    edge_iter addEdge(unsigned from, edge_iter pos, const edge_type& edge) {
+    edge_iter addEdge(vertex_index_t from, edge_iter pos, const edge_type& edge) {
         assert(from < order());
         assert(pos >= outedges(from).begin() && pos <= outedges(from).end());
         assert(*pos == null_edge);
@@ -85,9 +89,9 @@ public:
     }
 
 
-    // ɾv
-    // øúǰȷɾvӵб
-    void eraseVertex(unsigned v) {
+    // 删除顶点v
+    // 调用该函数前，确保已删除v相接的所有边
+    void eraseVertex(vertex_index_t v) {
         assert(v < order());
         assert(outedges(v).count(null_edge) == order());
 
@@ -97,9 +101,9 @@ public:
             super_::vertexes_.erase(std::next(super_::vertexes_.begin(), v));
     }
 
-    // ɾvĳe
+    // 删除顶点v的出边e
     template<bool dummy = false>
-    edge_iter eraseEdge(unsigned v, edge_iter pos) {
+    edge_iter eraseEdge(vertex_index_t v, edge_iter pos) {
         assert(pos >= outedges(v).begin() && pos < outedges(v).end());
         assert(*pos != null_edge);
         *pos = null_edge;
@@ -109,7 +113,7 @@ public:
 
 
     template<bool dummy = false>
-    edge_iter eraseEdges(unsigned v, edge_iter first, edge_iter last) {
+    edge_iter eraseEdges(vertex_index_t v, edge_iter first, edge_iter last) {
         assert(first >= outedges(v).begin() && last <= outedges(v).end());
 
         for (; first != last; ++first)
@@ -123,9 +127,9 @@ public:
 };
 
 
-template<typename EDGE_TYPE, typename VERTEX_TYPE>
-struct graph_traits<KtAdjGraphDenseImpl<EDGE_TYPE, VERTEX_TYPE>>
-    : public graph_traits<KtAdjGraphBase<KtMatrix<EDGE_TYPE>, VERTEX_TYPE>>
+template<typename EDGE_TYPE, typename VERTEX_TYPE, typename VERTEX_INDEX, typename EDGE_INDEX>
+struct graph_traits<KtAdjGraphDenseImpl<EDGE_TYPE, VERTEX_TYPE, VERTEX_INDEX, EDGE_INDEX>>
+    : public graph_traits<KtAdjGraphBase<KtMatrix<EDGE_TYPE>, VERTEX_TYPE, VERTEX_INDEX, EDGE_INDEX>>
 {
     constexpr static bool reshapable = true;
     constexpr static bool immutable = false;
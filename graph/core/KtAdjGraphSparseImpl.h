@@ -5,31 +5,31 @@
 #include <assert.h>
 
 
-// ϡڽӾͼʵ
+// 基于稀疏阵的邻接矩阵图实现
 
 namespace kPrivate
 {
-    // vectorϡ
-    template<typename EDGE_TYPE>
-    using underly_edge_t = edge_has_to_t<EDGE_TYPE>;
+    // 基于vector的稀疏矩阵
+    template<typename EDGE_TYPE, typename VERTEX_INDEX = unsigned>
+    using underly_edge_t = edge_has_to_t<EDGE_TYPE, VERTEX_INDEX>;
 
-    template<typename EDGE_TYPE>
-    using row_type = std::vector<underly_edge_t<EDGE_TYPE>>;
+    template<typename EDGE_TYPE, typename VERTEX_INDEX = unsigned>
+    using row_type = std::vector<underly_edge_t<EDGE_TYPE, VERTEX_INDEX>>;
 
-    template<typename EDGE_TYPE>
-    class KtSpMatrix : public std::vector<row_type<EDGE_TYPE>>
+    template<typename EDGE_TYPE, typename VERTEX_INDEX = unsigned>
+    class KtSpMatrix : public std::vector<row_type<EDGE_TYPE, VERTEX_INDEX>>
     {
     public:
-        using super_ = std::vector<row_type<EDGE_TYPE>>;
+        using super_ = std::vector<row_type<EDGE_TYPE, VERTEX_INDEX>>;
 
         auto rows() const { return super_::size(); }
 
-        decltype(auto) row(unsigned v) { 
+        decltype(auto) row(VERTEX_INDEX v) { 
             return KtRange(super_::at(v).begin(), 
             static_cast<unsigned>(super_::at(v).size())); 
         }
 
-        decltype(auto) row(unsigned v) const { 
+        decltype(auto) row(VERTEX_INDEX v) const { 
             return KtRange(super_::at(v).cbegin(), 
             static_cast<unsigned>(super_::at(v).size())); 
         }
@@ -37,11 +37,15 @@ namespace kPrivate
 }
 
 
-template<typename EDGE_TYPE, typename VERTEX_TYPE = void>
-class KtAdjGraphSparseImpl : public KtAdjGraphBase<kPrivate::KtSpMatrix<EDGE_TYPE>, VERTEX_TYPE>
+// @VERTEX_INDEX, @EDGE_INDEX: 顶点索引和边计数的整数类型，大图可选用64位，小图可选用16位以节省存储
+template<typename EDGE_TYPE, typename VERTEX_TYPE = void, 
+    typename VERTEX_INDEX = unsigned, typename EDGE_INDEX = unsigned>
+class KtAdjGraphSparseImpl : public KtAdjGraphBase<kPrivate::KtSpMatrix<EDGE_TYPE, VERTEX_INDEX>, VERTEX_TYPE, VERTEX_INDEX, EDGE_INDEX>
 {
 public:
-    using super_ = KtAdjGraphBase<kPrivate::KtSpMatrix<EDGE_TYPE>, VERTEX_TYPE>;
+    using super_ = KtAdjGraphBase<kPrivate::KtSpMatrix<EDGE_TYPE, VERTEX_INDEX>, VERTEX_TYPE, VERTEX_INDEX, EDGE_INDEX>;
+    using typename super_::vertex_index_t;
+    using typename super_::edge_index_t;
     using edge_type = EDGE_TYPE;
     using vertex_type = VERTEX_TYPE;
     using edge_iter = typename graph_traits<super_>::edge_iter;
@@ -49,7 +53,7 @@ public:
     using underly_edge_t = typename graph_traits<super_>::underly_edge_t;
     constexpr static const edge_type& null_edge = edge_traits<edge_type>::null_edge;
 
-    static_assert(std::is_same_v<kPrivate::underly_edge_t<EDGE_TYPE>, underly_edge_t>, "edge type mismatch");
+    static_assert(std::is_same_v<kPrivate::underly_edge_t<EDGE_TYPE, VERTEX_INDEX>, underly_edge_t>, "edge type mismatch");
     static_assert(edge_traits_helper<edge_traits<underly_edge_t>>::has_to, "edge type construct error");
 
     using super_::E_;
@@ -60,52 +64,52 @@ public:
 
     KtAdjGraphSparseImpl() = default;
 
-    // ͼΪnv.
-    void reset(unsigned nv) {
+    // 重置图为nv顶点.
+    void reset(vertex_index_t nv) {
         E_ = 0;
         adjMat_.clear(); adjMat_.resize(nv);
         if constexpr (!std::is_void_v<vertex_type>)
             super_::vertexes_.resize(nv);
     }
 
-    // ԤnvneߵĴ洢.
-    void reserve(unsigned nv, unsigned ne) {
+    // 预留nv个顶点和ne条边的存储.
+    void reserve(vertex_index_t nv, edge_index_t ne) {
         adjMat_.reserve(nv);
         if constexpr (!std::is_void_v<vertex_type>)
             super_::vertexes_.reserve(nv);
     }
 
-    // ԶvԤneߵĴ洢.
-    void reserveEdges(unsigned v, unsigned ne) {
+    // 对顶点v预留ne条边的存储.
+    void reserveEdges(vertex_index_t v, edge_index_t ne) {
         adjMat_[v].reserve(ne);
     }
 
 
     template<typename T = vertex_type, std::enable_if_t<std::is_void_v<T>, bool> = true>
-    unsigned addVertex() {
-        adjMat_.push_back(kPrivate::row_type<edge_type>());
-        return static_cast<unsigned>(adjMat_.rows()) - 1;
+    vertex_index_t addVertex() {
+        adjMat_.push_back(kPrivate::row_type<edge_type, VERTEX_INDEX>());
+        return static_cast<vertex_index_t>(adjMat_.rows()) - 1;
     }
 
     template<typename T, std::enable_if_t<!std::is_void_v<T>
         && std::is_convertible_v<T, vertex_type>, bool> = false>
-    unsigned addVertex(const T& v) {
-        adjMat_.push_back(kPrivate::row_type<edge_type>());
+    vertex_index_t addVertex(const T& v) {
+        adjMat_.push_back(kPrivate::row_type<edge_type, VERTEX_INDEX>());
         super_::vertexes_.push_back(vertex_type(v));
-        return super_::vertexes_.size();
+        return static_cast<vertex_index_t>(super_::vertexes_.size());
     }
 
     template<typename T, std::enable_if_t<!std::is_void_v<T>
         && std::is_same_v<T, vertex_type>, bool> = false>
-    unsigned addVertex(T&& v) {
-        adjMat_.push_back(kPrivate::row_type<edge_type>());
+    vertex_index_t addVertex(T&& v) {
+        adjMat_.push_back(kPrivate::row_type<edge_type, VERTEX_INDEX>());
         super_::vertexes_.push_back(std::move(v));
-        return static_cast<unsigned>(super_::vertexes_.size());
+        return static_cast<vertex_index_t>(super_::vertexes_.size());
     }
 
 
     template<bool dummy = false>
-    edge_iter addEdge(unsigned from, edge_iter pos, const edge_type& edge) {
+    edge_iter addEdge(vertex_index_t from, edge_iter pos, const edge_type& edge) {
         assert(from < order());
 
         if constexpr (!dummy) ++E_;
@@ -114,9 +118,9 @@ public:
     }
 
 
-    // ɾv
-    // øúǰȷɾvӵб
-    void eraseVertex(unsigned v) {
+    // 删除顶点v
+    // 调用该函数前，确保已删除v相接的所有边
+    void eraseVertex(vertex_index_t v) {
         assert(v < order() && adjMat_[v].empty());
 
         adjMat_.erase(std::next(adjMat_.begin(), v));
@@ -125,18 +129,18 @@ public:
             super_::vertexes_.erase(std::next(super_::vertexes_.begin(), v));
     }
 
-    // ɾvĳe
+    // 删除顶点v的出边e
     template<bool dummy = false>
-    edge_iter eraseEdge(unsigned v, edge_iter e) {
+    edge_iter eraseEdge(vertex_index_t v, edge_iter e) {
         assert(e >= outedges(v).begin() && e < outedges(v).end());
         if constexpr (!dummy) --E_;
 
         return adjMat_[v].erase(e);
     }
 
-    // const_edge_iter汾
+    // const_edge_iter版本
     template<bool dummy = false>
-    edge_iter eraseEdge(unsigned v, const_edge_iter e) {
+    edge_iter eraseEdge(vertex_index_t v, const_edge_iter e) {
         assert(e >= outedges(v).cbegin() && e < outedges(v).cend());
         if constexpr (!dummy) --E_;
 
@@ -144,9 +148,9 @@ public:
     }
 
 
-    // ɾfirstlast֮ı
+    // 删除first到last之间的边
     template<bool dummy = false>
-    edge_iter eraseEdges(unsigned v, edge_iter first, edge_iter last) {
+    edge_iter eraseEdges(vertex_index_t v, edge_iter first, edge_iter last) {
         assert(first >= outedges(v).begin() && last <= outedges(v).end());
 
         if constexpr (!dummy) 
@@ -157,9 +161,9 @@ public:
 };
 
 
-template<typename EDGE_TYPE, typename VERTEX_TYPE>
-struct graph_traits<KtAdjGraphSparseImpl<EDGE_TYPE, VERTEX_TYPE>>
-    : public graph_traits<KtAdjGraphBase<kPrivate::KtSpMatrix<EDGE_TYPE>, VERTEX_TYPE>>
+template<typename EDGE_TYPE, typename VERTEX_TYPE, typename VERTEX_INDEX, typename EDGE_INDEX>
+struct graph_traits<KtAdjGraphSparseImpl<EDGE_TYPE, VERTEX_TYPE, VERTEX_INDEX, EDGE_INDEX>>
+    : public graph_traits<KtAdjGraphBase<kPrivate::KtSpMatrix<EDGE_TYPE, VERTEX_INDEX>, VERTEX_TYPE, VERTEX_INDEX, EDGE_INDEX>>
 {
     constexpr static bool reshapable = true;
     constexpr static bool immutable = false;
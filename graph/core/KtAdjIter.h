@@ -5,10 +5,10 @@
 #include <assert.h>
 
 
-// ڽӶʵ
+// 邻接顶点迭代器实现
 
 
-// ģʵsparseͼadj_iter
+// 主模板实现sparse图的adj_iter
 template<typename GRAPH>
 class KtAdjIter
 {
@@ -19,13 +19,14 @@ public:
     using edge_range = typename graph_traits<GRAPH>::outedges_result_t;
     using underly_edge_t = typename graph_traits<GRAPH>::underly_edge_t;
     using underly_vertex_t = typename graph_traits<GRAPH>::underly_vertex_t;
+    using vertex_index_t = typename graph_traits<GRAPH>::vertex_index_t;
 
 
-    // һյadj_iter
-    KtAdjIter(GRAPH& g) : graph_(g), from_(-1) {}
+    // 构造一个空的adj_iter
+    KtAdjIter(GRAPH& g) : graph_(g), from_(static_cast<vertex_index_t>(-1)) {}
 
 
-    KtAdjIter(GRAPH& g, unsigned v)
+    KtAdjIter(GRAPH& g, vertex_index_t v)
         : graph_(g), range_(g.outedges(v)), from_(v) {
         if constexpr (GRAPH::isDense()) {
             // skip null edge
@@ -35,15 +36,15 @@ public:
     }
 
 
-    unsigned from() const { return from_; }
-    unsigned to() const { 
+    vertex_index_t from() const { return from_; }
+    vertex_index_t to() const { 
         if constexpr (GRAPH::isDense())
-            return static_cast<unsigned>(std::distance(graph_.outedges(from_).begin(), range_.begin()));
+            return static_cast<vertex_index_t>(std::distance(graph_.outedges(from_).begin(), range_.begin()));
         else
             return edge_traits<underly_edge_t>::to(*range_);
     }
 
-    unsigned operator*() const { return to(); }
+    vertex_index_t operator*() const { return to(); }
 
 
     void operator++() {
@@ -64,7 +65,7 @@ public:
 
     // reset the value of current edge
     void reedge(const edge_type& val) {
-        if constexpr (GRAPH::isDigraph()) { // ͼṩһٲ
+        if constexpr (GRAPH::isDigraph()) { // 对有向图提供一个快速操作
             *range_ = val;
         }
         else if constexpr (GRAPH::isMultiEdges()) {
@@ -82,7 +83,7 @@ public:
             ++(*this);
         }
         else {
-            if constexpr (!GRAPH::isDigraph()) { // ɾͼ(to, from)
+            if constexpr (!GRAPH::isDigraph()) { // 先删除无向图的(to, from)边
                 if (from() != to()) {
                     auto edges = graph_.edges(to(), from());
                     assert(!edges.empty());
@@ -97,7 +98,7 @@ public:
                 }
             }
 
-            // ɾ(from, to)
+            // 删除(from, to)边
             auto pos = graph_.eraseEdge(from(), range_.begin());
             auto end = graph_.outedges(from()).end();
             range_.reset(pos, end);
@@ -110,5 +111,5 @@ public:
 protected:
     GRAPH& graph_;
     edge_range range_;
-    unsigned from_;
+    vertex_index_t from_;
 };
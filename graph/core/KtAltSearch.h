@@ -0,0 +1,552 @@
+#pragma once
+#include <vector>
+#include <queue>
+#include <random>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <assert.h>
+#include "KtWeightor.h"
+#include "KtAdjIter.h"
+#include "../base/KtStampedVector.h"
+
+
+// 基于ALT（A*, Landmarks, Triangle inequality）的点对点最短路径查询，适用于非负权值
+// 预处理阶段选取k个地标顶点L，计算各地标到全部顶点的距离d(L, v)及全部顶点到各地标的距离d(v, L)，
+// 查询时由三角不等式得到v到t的距离下界：
+//     d(v, t) >= max{ d(L, t) - d(L, v), d(v, L) - d(t, L) }
+// 以该下界作为A*的启发函数，可显著减少需要处理的顶点数
+// 由于下界函数是一致的（consistent），每个顶点最多出栈一次，A*等价于约化权值图上的Dijkstra算法
+//
+// 预处理的时间为O(k*E*lgV)，空间为O(k*V)。地标数据可以save/load，以便随图保存，避免重复预处理
+// NOTE: WEIGHTOR须为最小化的加法权值，即default_wtor或unit_min_wtor一类
+template<typename GRAPH, class WEIGHTOR = default_wtor<GRAPH>>
+class KtAltSearch
+{
+public:
+    using weight_type = typename WEIGHTOR::weight_type;
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+    constexpr static vertex_index_t null_vertex = GRAPH::null_vertex;
+
+    // 地标的选取策略
+    enum landmark_select
+    {
+        k_random, // 随机选取
+        k_farthest, // 依次选取距离已有地标最远的顶点
+        k_avoid // Goldberg & Werneck的avoid方法，优先覆盖下界估计较差的区域
+    };
+
+
+    // @numLandmarks: 地标数量k，为0时不进行预处理，退化为（双向）Dijkstra，此后可调用load载入地标数据
+    // @select: 地标的选取策略
+    // @seed: 随机选取的种子
+    KtAltSearch(const GRAPH& g, unsigned numLandmarks = 16, landmark_select select = k_avoid, unsigned seed = 0)
+        : order_(g.order()), k_(0), inf_(WEIGHTOR{}.worst_weight) {
+
+        // 构建正向和反向的CSR
+        fwdAdj_.offset.assign(std::size_t(order_) + 1, 0);
+        bwdAdj_.offset.assign(std::size_t(order_) + 1, 0);
+        for (vertex_index_t v = 0; v < order_; v++)
+            for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter) {
+                ++fwdAdj_.offset[v + 1];
+                ++bwdAdj_.offset[*iter + 1];
+            }
+        for (vertex_index_t v = 0; v < order_; v++) {
+            fwdAdj_.offset[v + 1] += fwdAdj_.offset[v];
+            bwdAdj_.offset[v + 1] += bwdAdj_.offset[v];
+        }
+
+        fwdAdj_.arcs.resize(fwdAdj_.offset[order_]);
+        bwdAdj_.arcs.resize(bwdAdj_.offset[order_]);
+        std::vector<std::size_t> pos(bwdAdj_.offset.begin(), bwdAdj_.offset.end() - 1);
+        std::size_t i(0);
+        for (vertex_index_t v = 0; v < order_; v++)
+            for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter) {
+                weight_type wt = WEIGHTOR{}(iter.edge());
+                assert(!(wt < 0));
+                fwdAdj_.arcs[i++] = { *iter, wt };
+                bwdAdj_.arcs[pos[*iter]++] = { v, wt };
+            }
+
+        selectLandmarks_(std::min<unsigned>(numLandmarks, order_), select, seed);
+    }
+
+
+    // 单向A*查询s到t的最短距离，s不可达t时返回worst_weight
+    // s == t时返回0，而非最短环路的长度
+    weight_type search(vertex_index_t s, vertex_index_t t);
+
+    // 双向A*查询s到t的最短距离，正反两个方向使用平均化的下界函数以保证一致性
+    // 平均化的势能及反向键值可为负，要求weight_type为有符号类型
+    weight_type searchBi(vertex_index_t s, vertex_index_t t);
+
+
+    // 返回最近一次查询的最短距离
+    weight_type distance() const { return dist_; }
+
+    // 返回最近一次查询的最短路径(逆序)，不可达时返回空
+    const std::vector<vertex_index_t>& pathR() const { return pathR_; }
+
+    // 最近一次查询出栈（确定最短距离）的顶点数
+    std::size_t settled() const { return settled_; }
+
+
+    unsigned numLandmarks() const { return k_; }
+
+    const std::vector<vertex_index_t>& landmarks() const { return landmarks_; }
+
+
+    // 以二进制格式保存地标数据
+    void save(std::ostream& os) const {
+        write_(os, std::uint64_t(order_));
+        write_(os, std::uint64_t(k_));
+        os.write(reinterpret_cast<const char*>(landmarks_.data()), sizeof(vertex_index_t) * landmarks_.size());
+        os.write(reinterpret_cast<const char*>(fromL_.data()), sizeof(weight_type) * fromL_.size());
+        os.write(reinterpret_cast<const char*>(toL_.data()), sizeof(weight_type) * toL_.size());
+    }
+
+    // 载入由save保存的地标数据，数据与当前图的顶点数不符、不合法或读取失败时返回false，且不改变现有数据
+    // 分配内存前先以流的剩余长度检查k，并检查各地标为互不相同的有效顶点
+    bool load(std::istream& is) {
+        std::uint64_t V, k;
+        if (!read_(is, V) || !read_(is, k) || V != order_ || k > order_)
+            return false;
+        if (k > 0 && k > remaining_(is) / (sizeof(vertex_index_t) + 2 * sizeof(weight_type) * V))
+            return false;
+
+        std::vector<vertex_index_t> landmarks(k);
+        std::vector<bool> used(V, false);
+        for (auto& L : landmarks) {
+            if (!read_(is, L) || L >= V || used[L])
+                return false;
+            used[L] = true;
+        }
+
+        std::vector<weight_type> fromL(V * k), toL(V * k);
+        is.read(reinterpret_cast<char*>(fromL.data()), sizeof(weight_type) * fromL.size());
+        is.read(reinterpret_cast<char*>(toL.data()), sizeof(weight_type) * toL.size());
+        if (!is)
+            return false;
+
+        k_ = unsigned(k);
+        landmarks_.swap(landmarks);
+        fromL_.swap(fromL);
+        toL_.swap(toL);
+        return true;
+    }
+
+
+private:
+
+    struct KpCsr_
+    {
+        std::vector<std::size_t> offset;
+        std::vector<std::pair<vertex_index_t, weight_type>> arcs;
+    };
+
+    // 单向查询及双向查询一个方向的工作空间
+    struct KpSpace_
+    {
+        KtStampedVector<weight_type> dist;
+        KtStampedVector<vertex_index_t> parent;
+        KtStampedVector<std::uint8_t> settled;
+
+        void prepare(vertex_index_t V, weight_type inf) {
+            if (dist.size() < V) {
+                dist.resize(V);
+                parent.resize(V);
+                settled.resize(V);
+            }
+            dist.reset(inf);
+            parent.reset(null_vertex);
+            settled.reset();
+        }
+    };
+
+    using element_type = std::pair<weight_type, vertex_index_t>;
+    using priority_queue = std::priority_queue<element_type, std::vector<element_type>, std::greater<element_type>>;
+
+
+    // 由三角不等式估计v到t的距离下界lb，返回false表示v不可达t
+    bool lowerBound_(vertex_index_t v, vertex_index_t t, weight_type& lb) const {
+        lb = weight_type(0);
+        auto fv = &fromL_[std::size_t(v) * k_], ft = &fromL_[std::size_t(t) * k_];
+        auto tv = &toL_[std::size_t(v) * k_], tt = &toL_[std::size_t(t) * k_];
+        // 先比较再相减，无符号权值下亦不会回绕
+        for (unsigned l = 0; l < k_; l++) {
+            if (fv[l] != inf_) { // L可达v，若L不可达t，则v不可达t
+                if (ft[l] == inf_) return false;
+                if (ft[l] > fv[l] && ft[l] - fv[l] > lb) lb = ft[l] - fv[l];
+            }
+            if (tt[l] != inf_) { // t可达L，若v不可达L，则v不可达t
+                if (tv[l] == inf_) return false;
+                if (tv[l] > tt[l] && tv[l] - tt[l] > lb) lb = tv[l] - tt[l];
+            }
+        }
+        return true;
+    }
+
+
+    // 在adj上以s为源点运行Dijkstra算法，计算结果写入dist，并返回顶点的出栈次序
+    std::vector<vertex_index_t> dijkstra_(const KpCsr_& adj, vertex_index_t s,
+        std::vector<weight_type>& dist, std::vector<vertex_index_t>* parent = nullptr) const {
+        dist.assign(order_, inf_);
+        if (parent) parent->assign(order_, null_vertex);
+        std::vector<vertex_index_t> order;
+        std::vector<bool> vis(order_, false);
+        priority_queue pq;
+        dist[s] = weight_type(0); pq.emplace(dist[s], s);
+        while (!pq.empty()) {
+            auto v = pq.top().second; pq.pop();
+            if (vis[v]) continue;
+            vis[v] = true;
+            order.push_back(v);
+            for (auto i = adj.offset[v]; i < adj.offset[v + 1]; i++) {
+                auto w = adj.arcs[i].first;
+                auto d = dist[v] + adj.arcs[i].second;
+                if (!vis[w] && d < dist[w]) {
+                    dist[w] = d, pq.emplace(d, w);
+                    if (parent) (*parent)[w] = v;
+                }
+            }
+        }
+        return order;
+    }
+
+
+    // 计算地标L的正反向距离，存入第k_个位置
+    void addLandmark_(vertex_index_t L) {
+        std::vector<weight_type> dist;
+        auto k = k_ + 1;
+        std::vector<weight_type> fromL(std::size_t(order_) * k), toL(std::size_t(order_) * k);
+        for (vertex_index_t v = 0; v < order_; v++)
+            for (unsigned l = 0; l < k_; l++) {
+                fromL[std::size_t(v) * k + l] = fromL_[std::size_t(v) * k_ + l];
+                toL[std::size_t(v) * k + l] = toL_[std::size_t(v) * k_ + l];
+            }
+
+        dijkstra_(fwdAdj_, L, dist);
+        for (vertex_index_t v = 0; v < order_; v++)
+            fromL[std::size_t(v) * k + k_] = dist[v];
+        dijkstra_(bwdAdj_, L, dist);
+        for (vertex_index_t v = 0; v < order_; v++)
+            toL[std::size_t(v) * k + k_] = dist[v];
+
+        fromL_.swap(fromL);
+        toL_.swap(toL);
+        landmarks_.push_back(L);
+        k_ = k;
+    }
+
+
+    void selectLandmarks_(unsigned numLandmarks, landmark_select select, unsigned seed);
+
+    // 选取距离现有地标最远的顶点，不可达顶点优先。全部顶点均为地标时返回null_vertex
+    vertex_index_t farthest_() const;
+
+    // avoid方法：以随机顶点r为根构造最短路径树，顶点v的权重为d(r, v)与其下界估计之差，
+    // 子树的大小为子树顶点的权重之和，包含地标的子树大小为0。
+    // 从r出发，不断进入大小最大的子树，直至叶顶点，即为新的地标
+    vertex_index_t avoid_(std::mt19937& rng) const;
+
+
+    // 流的剩余字节数，不支持定位的流返回最大值
+    static std::uint64_t remaining_(std::istream& is) {
+        auto pos = is.tellg();
+        if (pos == std::istream::pos_type(-1))
+            return std::uint64_t(-1);
+        is.seekg(0, std::ios::end);
+        auto end = is.tellg();
+        is.seekg(pos);
+        return end == std::istream::pos_type(-1) || end < pos ? 0 : std::uint64_t(end - pos);
+    }
+
+    template<typename T>
+    static void write_(std::ostream& os, const T& val) {
+        os.write(reinterpret_cast<const char*>(&val), sizeof(T));
+    }
+
+    template<typename T>
+    static bool read_(std::istream& is, T& val) {
+        return bool(is.read(reinterpret_cast<char*>(&val), sizeof(T)));
+    }
+
+
+private:
+    vertex_index_t order_;
+    unsigned k_; // 地标数量
+    const weight_type inf_;
+    KpCsr_ fwdAdj_, bwdAdj_; // 正向图和反向图
+    std::vector<vertex_index_t> landmarks_;
+    std::vector<weight_type> fromL_; // fromL_[v * k_ + l]为第l个地标到v的距离，同一顶点的数据连续存放
+    std::vector<weight_type> toL_; // toL_[v * k_ + l]为v到第l个地标的距离
+
+    // 查询状态
+    KpSpace_ fwd_, bwd_;
+    KtStampedVector<weight_type> pot_; // 当前查询中各顶点的势能缓存
+    KtStampedVector<std::uint8_t> potOk_; // pot_是否有效（顶点未被剪枝）
+    weight_type dist_;
+    std::vector<vertex_index_t> pathR_;
+    std::size_t settled_;
+};
+
+
+template<typename GRAPH, class WEIGHTOR>
+void KtAltSearch<GRAPH, WEIGHTOR>::selectLandmarks_(unsigned numLandmarks, landmark_select select, unsigned seed)
+{
+    if (numLandmarks == 0)
+        return;
+
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<vertex_index_t> rand(0, order_ - 1);
+
+    if (select == k_random) {
+        std::vector<vertex_index_t> vs(order_);
+        for (vertex_index_t v = 0; v < order_; v++) vs[v] = v;
+        std::shuffle(vs.begin(), vs.end(), rng);
+        for (unsigned i = 0; i < numLandmarks; i++)
+            addLandmark_(vs[i]);
+        return;
+    }
+
+    // 首个地标取距离随机顶点最远的顶点
+    std::vector<weight_type> dist;
+    auto order = dijkstra_(fwdAdj_, rand(rng), dist);
+    addLandmark_(order.back());
+
+    while (k_ < numLandmarks) {
+        auto L = select == k_avoid ? avoid_(rng) : null_vertex;
+        if (L == null_vertex)
+            L = farthest_();
+        if (L == null_vertex)
+            break;
+        addLandmark_(L);
+    }
+}
+
+
+template<typename GRAPH, class WEIGHTOR>
+typename KtAltSearch<GRAPH, WEIGHTOR>::vertex_index_t KtAltSearch<GRAPH, WEIGHTOR>::farthest_() const
+{
+    vertex_index_t best(null_vertex);
+    bool bestUnreached(false);
+    weight_type bestDist(0);
+    for (vertex_index_t v = 0; v < order_; v++) {
+        // 以往返距离的最小值作为v与地标集的距离
+        bool unreached(true);
+        weight_type d(inf_);
+        for (unsigned l = 0; l < k_; l++) {
+            auto f = fromL_[std::size_t(v) * k_ + l], t = toL_[std::size_t(v) * k_ + l];
+            if (f == inf_ && t == inf_)
+                continue;
+            unreached = false;
+            auto x = f == inf_ ? t : t == inf_ ? f : f + t;
+            if (x < d) d = x;
+        }
+
+        if (unreached) {
+            if (!bestUnreached)
+                best = v, bestUnreached = true;
+        }
+        else if (!bestUnreached && d > bestDist)
+            best = v, bestDist = d;
+    }
+
+    return best;
+}
+
+
+template<typename GRAPH, class WEIGHTOR>
+typename KtAltSearch<GRAPH, WEIGHTOR>::vertex_index_t KtAltSearch<GRAPH, WEIGHTOR>::avoid_(std::mt19937& rng) const
+{
+    std::uniform_int_distribution<vertex_index_t> rand(0, order_ - 1);
+    auto r = rand(rng);
+
+    std::vector<weight_type> dist;
+    std::vector<vertex_index_t> parent;
+    auto order = dijkstra_(fwdAdj_, r, dist, &parent);
+
+    std::vector<bool> isLandmark(order_, false);
+    for (auto L : landmarks_) isLandmark[L] = true;
+
+    // 以出栈的逆序累加子树大小，子顶点总是在父顶点之后出栈
+    std::vector<weight_type> size(order_, weight_type(0));
+    std::vector<bool> hasLandmark(order_, false);
+    std::vector<vertex_index_t> heavy(order_, null_vertex); // 大小最大的孩子
+    for (auto iter = order.rbegin(); iter != order.rend(); ++iter) {
+        auto v = *iter;
+        if (isLandmark[v])
+            hasLandmark[v] = true;
+
+        if (hasLandmark[v])
+            size[v] = weight_type(0);
+        else {
+            weight_type lb;
+            lowerBound_(r, v, lb); // v由r可达，下界总是有效的
+            size[v] += dist[v] - lb;
+        }
+
+        auto p = parent[v];
+        if (p != null_vertex) {
+            if (hasLandmark[v]) hasLandmark[p] = true;
+            size[p] += size[v];
+            if (heavy[p] == null_vertex || size[heavy[p]] < size[v])
+                heavy[p] = v;
+        }
+    }
+
+    if (hasLandmark[r] && size[r] == weight_type(0))
+        return null_vertex; // 全部子树均已被地标覆盖
+
+    auto v = r;
+    while (heavy[v] != null_vertex && size[heavy[v]] > weight_type(0))
+        v = heavy[v];
+
+    return isLandmark[v] ? null_vertex : v;
+}
+
+
+template<typename GRAPH, class WEIGHTOR>
+typename KtAltSearch<GRAPH, WEIGHTOR>::weight_type KtAltSearch<GRAPH, WEIGHTOR>::search(vertex_index_t s, vertex_index_t t)
+{
+    fwd_.prepare(order_, inf_);
+    pathR_.clear();
+    settled_ = 0;
+    dist_ = inf_;
+
+    if (s == t) {
+        pathR_.push_back(s);
+        return dist_ = weight_type(0);
+    }
+
+    weight_type lb;
+    if (!lowerBound_(s, t, lb))
+        return dist_;
+
+    priority_queue pq;
+    fwd_.dist.set(s, weight_type(0));
+    pq.emplace(lb, s);
+    while (!pq.empty()) {
+        auto v = pq.top().second; pq.pop();
+        if (fwd_.settled.isMarked(v)) continue;
+        fwd_.settled.mark(v);
+        ++settled_;
+        if (v == t) break;
+
+        for (auto i = fwdAdj_.offset[v]; i < fwdAdj_.offset[v + 1]; i++) {
+            auto w = fwdAdj_.arcs[i].first;
+            auto d = fwd_.dist[v] + fwdAdj_.arcs[i].second;
+            if (!fwd_.settled.isMarked(w) && d < fwd_.dist[w] && lowerBound_(w, t, lb)) {
+                fwd_.dist.set(w, d);
+                fwd_.parent.set(w, v);
+                pq.emplace(d + lb, w);
+            }
+        }
+    }
+
+    if (fwd_.settled.isMarked(t)) {
+        dist_ = fwd_.dist[t];
+        for (auto v = t; v != null_vertex; v = fwd_.parent[v])
+            pathR_.push_back(v);
+    }
+
+    return dist_;
+}
+
+
+template<typename GRAPH, class WEIGHTOR>
+typename KtAltSearch<GRAPH, WEIGHTOR>::weight_type KtAltSearch<GRAPH, WEIGHTOR>::searchBi(vertex_index_t s, vertex_index_t t)
+{
+    static_assert(std::is_signed_v<weight_type>, "searchBi requires a signed weight_type.");
+
+    fwd_.prepare(order_, inf_);
+    bwd_.prepare(order_, inf_);
+    if (pot_.size() < order_) {
+        pot_.resize(order_);
+        potOk_.resize(order_);
+    }
+    pot_.reset();
+    potOk_.reset();
+    pathR_.clear();
+    settled_ = 0;
+    dist_ = inf_;
+
+    if (s == t) {
+        pathR_.push_back(s);
+        return dist_ = weight_type(0);
+    }
+
+    // 平均化势能的2倍：P(v) = pi_t(v) - pi_s(v)，其中pi_t(v)为v到t的距离下界，pi_s(v)为s到v的距离下界
+    // 正向键值为2d(s, v) + P(v)，反向键值为2d(v, t) - P(v)，约化权值2w(v, w) - P(v) + P(w)总是非负的
+    // 取2倍是为了整数权值下也能精确计算
+    auto potential = [this, s, t](vertex_index_t v, weight_type& p) {
+        if (!pot_.isMarked(v)) {
+            weight_type lt, ls;
+            bool ok = lowerBound_(v, t, lt) && lowerBound_(s, v, ls);
+            pot_.set(v, ok ? lt - ls : weight_type(0));
+            potOk_.set(v, ok);
+        }
+        p = pot_[v];
+        return potOk_[v] != 0;
+    };
+
+    weight_type p;
+    if (!potential(s, p))
+        return dist_;
+
+    priority_queue pqF, pqR;
+    fwd_.dist.set(s, weight_type(0));
+    pqF.emplace(p, s);
+    if (!potential(t, p))
+        return dist_;
+    bwd_.dist.set(t, weight_type(0));
+    pqR.emplace(-p, t);
+
+    weight_type mu(inf_); // 当前已知的最短距离
+    vertex_index_t meet(null_vertex);
+
+    while (!pqF.empty() && !pqR.empty()) {
+        if (mu != inf_ && !(pqF.top().first + pqR.top().first < mu + mu))
+            break;
+
+        // 扩展键值较小的一侧
+        bool forward = !(pqR.top().first < pqF.top().first);
+        auto& pq = forward ? pqF : pqR;
+        auto& me = forward ? fwd_ : bwd_;
+        auto& other = forward ? bwd_ : fwd_;
+        auto& adj = forward ? fwdAdj_ : bwdAdj_;
+
+        auto v = pq.top().second; pq.pop();
+        if (me.settled.isMarked(v)) continue;
+        me.settled.mark(v);
+        ++settled_;
+
+        for (auto i = adj.offset[v]; i < adj.offset[v + 1]; i++) {
+            auto w = adj.arcs[i].first;
+            auto d = me.dist[v] + adj.arcs[i].second;
+            if (me.settled.isMarked(w) || !(d < me.dist[w]) || !potential(w, p))
+                continue;
+
+            me.dist.set(w, d);
+            me.parent.set(w, v);
+            pq.emplace(d + d + (forward ? p : -p), w);
+
+            if (other.dist[w] != inf_ && d + other.dist[w] < mu)
+                mu = d + other.dist[w], meet = w;
+        }
+    }
+
+    if (meet != null_vertex) {
+        dist_ = mu;
+        for (auto v = meet; v != null_vertex; v = bwd_.parent[v])
+            pathR_.push_back(v); // meet -> t
+        std::reverse(pathR_.begin(), pathR_.end());
+        for (auto v = fwd_.parent[meet]; v != null_vertex; v = fwd_.parent[v])
+            pathR_.push_back(v); // meet -> s
+    }
+
+    return dist_;
+}
@@ -0,0 +1,441 @@
+#pragma once
+#include <vector>
+#include <limits>
+#include <cmath>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+#include <assert.h>
+#include "KtWeightor.h"
+#include "KtAdjIter.h"
+#include "../base/KtMatrix.h"
+#include "../base/parallel_for.h"
+
+
+// 带权二部匹配（指派问题）：为一侧的每个顶点指派另一侧的互不相同的顶点，使总权值最优
+// 由WEIGHTOR的comp决定优化方向：KtWeightorMin时总权值最小，KtWeightorMax时总权值最大
+
+namespace kPrivate
+{
+    // WEIGHTOR是否以小值为优
+    template<typename WEIGHTOR>
+    bool is_minimum_wtor()
+    {
+        using weight_type = typename WEIGHTOR::weight_type;
+        return WEIGHTOR{}.comp(weight_type(0), weight_type(1));
+    }
+}
+
+
+// 稠密指派问题的匈牙利算法（Kuhn-Munkres），采用行逐一加入、以顶点势维护最短增广路的O(n^2*m)实现
+// 权值矩阵为rows*cols的KtMatrix，矩阵元经WEIGHTOR转换为权值，须为完全二部图
+// rows <= cols时每行均被指派，否则转置求解，每列均被指派
+template<typename T, class WEIGHTOR = KtWeightorMin<KtWeightSelf<T>, KtAdder<typename KtWeightSelf<T>::weight_type>>>
+class KtHungarian
+{
+public:
+    using weight_type = typename WEIGHTOR::weight_type;
+    using total_weight_type = std::conditional_t<std::is_integral_v<weight_type>, long long, weight_type>;
+    constexpr static unsigned null_index = unsigned(-1);
+
+    static_assert(std::is_signed_v<weight_type>, "KtHungarian requires signed weight type");
+
+
+    explicit KtHungarian(const KtMatrix<T>& m) : rowMate_(m.rows(), null_index), colMate_(m.cols(), null_index) {
+        const bool transpose = m.rows() > m.cols();
+        const unsigned n = transpose ? m.cols() : m.rows();
+        const unsigned k = transpose ? m.rows() : m.cols();
+        const bool minimum = kPrivate::is_minimum_wtor<WEIGHTOR>();
+
+        // 统一为最小化问题，a(i, j)为第i行（转置时为列）指派第j列的费用
+        std::vector<total_weight_type> a(std::size_t(n) * k);
+        for (unsigned r = 0; r < m.rows(); r++) {
+            auto row = m.row(r);
+            unsigned c(0);
+            for (auto x : row) {
+                total_weight_type w = WEIGHTOR{}(x);
+                a[transpose ? std::size_t(c) * k + r : std::size_t(r) * k + c] = minimum ? w : -w;
+                ++c;
+            }
+        }
+
+        // 下标从1起，u、v为行、列的势，p[j]为指派到第j列的行，way为最短增广路上的前驱列
+        const auto inf = std::numeric_limits<total_weight_type>::max();
+        std::vector<total_weight_type> u(n + 1, 0), v(k + 1, 0), minv(k + 1);
+        std::vector<unsigned> p(k + 1, 0), way(k + 1, 0);
+        std::vector<bool> used(k + 1);
+        for (unsigned i = 1; i <= n; i++) {
+            p[0] = i;
+            unsigned j0(0);
+            std::fill(minv.begin(), minv.end(), inf);
+            std::fill(used.begin(), used.end(), false);
+            do {
+                used[j0] = true;
+                unsigned i0 = p[j0], j1(0);
+                auto delta = inf;
+                for (unsigned j = 1; j <= k; j++)
+                    if (!used[j]) {
+                        auto cur = a[std::size_t(i0 - 1) * k + j - 1] - u[i0] - v[j];
+                        if (cur < minv[j])
+                            minv[j] = cur, way[j] = j0;
+                        if (minv[j] < delta)
+                            delta = minv[j], j1 = j;
+                    }
+                for (unsigned j = 0; j <= k; j++)
+                    if (used[j])
+                        u[p[j]] += delta, v[j] -= delta;
+                    else
+                        minv[j] -= delta;
+                j0 = j1;
+            } while (p[j0] != 0);
+
+            do { // 沿增广路翻转
+                auto j1 = way[j0];
+                p[j0] = p[j1];
+                j0 = j1;
+            } while (j0 != 0);
+        }
+
+        total_ = 0;
+        for (unsigned j = 1; j <= k; j++)
+            if (p[j] != 0) {
+                unsigned r = transpose ? j - 1 : p[j] - 1;
+                unsigned c = transpose ? p[j] - 1 : j - 1;
+                rowMate_[r] = c, colMate_[c] = r;
+                total_ += WEIGHTOR{}(m.row(r).at(c));
+            }
+    }
+
+
+    // 第r行指派的列，未指派时返回null_index
+    unsigned colOf(unsigned r) const { return rowMate_[r]; }
+
+    // 指派到第c列的行，未指派时返回null_index
+    unsigned rowOf(unsigned c) const { return colMate_[c]; }
+
+    // 最优的总权值
+    total_weight_type totalWeight() const { return total_; }
+
+    // 匹配的(行, 列)对
+    std::vector<std::pair<unsigned, unsigned>> pairs() const {
+        std::vector<std::pair<unsigned, unsigned>> res;
+        for (unsigned r = 0; r < rowMate_.size(); r++)
+            if (rowMate_[r] != null_index)
+                res.push_back({ r, rowMate_[r] });
+        return res;
+    }
+
+
+private:
+    std::vector<unsigned> rowMate_, colMate_;
+    total_weight_type total_;
+};
+
+
+// 大规模稀疏二部图的ε-scaling拍卖算法（Bertsekas）
+// 顶点[0, numLeft)为左侧，[numLeft, V)为右侧，只考虑左侧顶点指向右侧顶点的边（无向图中即两侧之间的边）
+// 顶点数较少的一侧为出价者，须全部被指派（不存在这样的匹配时ok()返回false），较多一侧的顶点可以落空
+//
+// 每个阶段以ε-互补松弛为不变量：出价者所得对象的净收益（收益减价格）不低于其他任一对象的净收益减ε。
+// 各阶段开始时撤销全部指派，保留价格，ε按scaling_factor递减：
+//   各轮中所有未指派的出价者并行地计算出价（最优与次优净收益之差加ε），出价只读取价格，与线程数无关；
+//   随后按出价队列的次序串行裁决，各对象由最高出价者获得，价格升至该出价，原得主重新加入出价队列
+// 整数权值时收益放大N + 1倍（N为对称化后的出价者数），末阶段ε = 1，所得为最优解；
+// 浮点权值时末阶段ε = C * 1e-9 / N（C为最大收益绝对值），总权值与最优值之差不超过C * 1e-9；
+//   ε不低于4 * C * DBL_EPSILON，以保证出价能抬高价格，此时（N很大）误差上界为4 * N * C * DBL_EPSILON
+//
+// 出价者少于对象时，为使ε-scaling保持正确，将问题变换为对称的完美匹配问题：
+// 为每个对象o增加虚出价者q_o，为每个出价者p增加虚对象d_p，增加零收益边q_o-o（o落空），
+// 并对每条实边p-o增加零收益边q_o-d_p（p得到o时由q_o占用d_p），规模仍为O(V + E)
+template<typename GRAPH, class WEIGHTOR = default_wtor<GRAPH>>
+class KtAuction
+{
+public:
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+    using weight_type = typename WEIGHTOR::weight_type;
+    using total_weight_type = std::conditional_t<std::is_integral_v<weight_type>, long long, weight_type>;
+    constexpr static vertex_index_t null_vertex = GRAPH::null_vertex;
+    constexpr static double scaling_factor = 8;
+
+
+    // @numLeft: 左侧顶点数
+    // @nthreads: 出价的线程数，为0时取hardware_threads()
+    KtAuction(const GRAPH& g, vertex_index_t numLeft, unsigned nthreads = 0)
+        : mate_(g.order(), null_vertex), total_(0), phases_(0), rounds_(0) {
+        if (nthreads == 0) nthreads = hardware_threads();
+
+        const vertex_index_t V = g.order();
+        const vertex_index_t nR = V - numLeft;
+        const bool swapped = numLeft > nR; // 右侧作为出价者
+        nP_ = swapped ? nR : numLeft;
+        nO_ = swapped ? numLeft : nR;
+        auto personOf = [=](vertex_index_t v) { return vertex_index_t(swapped ? v - numLeft : v); };
+        auto objectOf = [=](vertex_index_t v) { return vertex_index_t(swapped ? v : v - numLeft); };
+
+        // 出价者的邻接表（CSR）
+        const bool minimum = kPrivate::is_minimum_wtor<WEIGHTOR>();
+        first_.assign(std::size_t(nP_) + 1, 0);
+        for (vertex_index_t v = 0; v < numLeft; v++)
+            for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter)
+                if (*iter >= numLeft)
+                    ++first_[(swapped ? personOf(*iter) : personOf(v)) + 1];
+        for (vertex_index_t p = 0; p < nP_; p++)
+            first_[p + 1] += first_[p];
+        obj_.resize(first_[nP_]), weight_.resize(first_[nP_]);
+        std::vector<std::size_t> pos(first_.begin(), first_.end() - 1);
+        for (vertex_index_t v = 0; v < numLeft; v++)
+            for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter)
+                if (*iter >= numLeft) {
+                    auto p = swapped ? personOf(*iter) : personOf(v);
+                    auto i = pos[p]++;
+                    obj_[i] = swapped ? objectOf(v) : objectOf(*iter);
+                    weight_[i] = WEIGHTOR{}(iter.edge());
+                }
+
+        ok_ = feasible_();
+        if (!ok_)
+            return;
+
+        auto assigned = auction_(minimum, nthreads);
+
+        for (vertex_index_t p = 0; p < nP_; p++) {
+            auto o = assigned[p];
+            assert(o < nO_);
+            vertex_index_t pv = swapped ? p + numLeft : p;
+            vertex_index_t ov = swapped ? o : o + numLeft;
+            mate_[pv] = ov, mate_[ov] = pv;
+
+            // 平行边取权值最优的一条
+            bool found(false);
+            weight_type w{};
+            for (auto i = first_[p]; i < first_[p + 1]; i++)
+                if (obj_[i] == o && (!found || WEIGHTOR{}.comp(weight_[i], w)))
+                    w = weight_[i], found = true;
+            total_ += w;
+        }
+    }
+
+
+    // 是否存在使出价者全部被指派的匹配
+    bool ok() const { return ok_; }
+
+    // 顶点v的匹配顶点，未匹配时返回null_vertex
+    vertex_index_t mate(vertex_index_t v) const { return mate_[v]; }
+
+    // 最优的总权值
+    total_weight_type totalWeight() const { return total_; }
+
+    // 匹配的(左侧顶点, 右侧顶点)对
+    std::vector<std::pair<vertex_index_t, vertex_index_t>> pairs() const {
+        std::vector<std::pair<vertex_index_t, vertex_index_t>> res;
+        for (vertex_index_t v = 0; v < mate_.size(); v++)
+            if (mate_[v] != null_vertex && v < mate_[v])
+                res.push_back({ v, mate_[v] });
+        return res;
+    }
+
+    // ε-scaling的阶段数和出价的总轮数
+    unsigned phases() const { return phases_; }
+    unsigned rounds() const { return rounds_; }
+
+
+private:
+
+    // Hopcroft-Karp算法判定是否存在饱和全部出价者的匹配
+    bool feasible_() const {
+        constexpr vertex_index_t none = null_vertex;
+        std::vector<vertex_index_t> matchP(nP_, none), matchO(nO_, none), dist(nP_);
+        std::vector<vertex_index_t> queue, stack;
+        std::vector<std::size_t> cursor(nP_);
+        vertex_index_t matched(0);
+
+        while (true) {
+            // BFS按交错路长度分层，found表示已到达自由对象
+            queue.clear();
+            for (vertex_index_t p = 0; p < nP_; p++)
+                if (matchP[p] == none)
+                    dist[p] = 0, queue.push_back(p);
+                else
+                    dist[p] = none;
+            bool found(false);
+            for (std::size_t h = 0; h < queue.size(); h++) {
+                auto p = queue[h];
+                for (auto i = first_[p]; i < first_[p + 1]; i++) {
+                    auto q = matchO[obj_[i]];
+                    if (q == none)
+                        found = true;
+                    else if (dist[q] == none)
+                        dist[q] = dist[p] + 1, queue.push_back(q);
+                }
+            }
+            if (!found) break;
+
+            // 沿分层图以非递归DFS寻找互不相交的最短增广路
+            for (vertex_index_t p = 0; p < nP_; p++)
+                cursor[p] = first_[p];
+            for (vertex_index_t s = 0; s < nP_; s++) {
+                if (matchP[s] != none) continue;
+                stack.assign(1, s);
+                while (!stack.empty()) {
+                    auto p = stack.back();
+                    if (cursor[p] == first_[p + 1]) {
+                        dist[p] = none; // 死路
+                        stack.pop_back();
+                        continue;
+                    }
+                    auto o = obj_[cursor[p]];
+                    auto q = matchO[o];
+                    if (q == none) { // 增广
+                        for (auto i = stack.size(); i-- > 0; ) {
+                            auto x = stack[i], y = obj_[cursor[x]];
+                            matchP[x] = y, matchO[y] = x;
+                        }
+                        ++matched;
+                        break;
+                    }
+                    if (dist[q] == dist[p] + 1)
+                        stack.push_back(q);
+                    else
+                        ++cursor[p];
+                }
+            }
+        }
+
+        return matched == nP_;
+    }
+
+
+    // 返回各实出价者得到的对象
+    std::vector<vertex_index_t> auction_(bool minimum, unsigned nthreads) {
+        constexpr vertex_index_t none = null_vertex;
+        constexpr double neg_inf = -std::numeric_limits<double>::infinity();
+
+        // 构造对称问题：出价者[0, nP_)为实出价者，[nP_, N)为虚出价者q_o；对象[0, nO_)为实对象，[nO_, N)为虚对象d_p
+        const vertex_index_t N = nP_ == nO_ ? nP_ : nP_ + nO_;
+        std::vector<std::size_t> first(std::size_t(N) + 1, 0);
+        std::vector<vertex_index_t> obj;
+        std::vector<double> benefit;
+        double C(0);
+        for (vertex_index_t p = 0; p < nP_; p++)
+            for (auto i = first_[p]; i < first_[p + 1]; i++)
+                C = std::max(C, std::abs(double(weight_[i])));
+        const double scale = std::is_integral_v<weight_type> ? N + 1 : 1;
+
+        if (nP_ == nO_) {
+            first.assign(first_.begin(), first_.end());
+            obj.assign(obj_.begin(), obj_.end());
+            benefit.resize(weight_.size());
+            for (std::size_t i = 0; i < weight_.size(); i++)
+                benefit[i] = (minimum ? -double(weight_[i]) : double(weight_[i])) * scale;
+        }
+        else {
+            for (vertex_index_t p = 0; p < nP_; p++)
+                for (auto i = first_[p]; i < first_[p + 1]; i++)
+                    ++first[nP_ + obj_[i] + 1]; // q_o-d_p
+            for (vertex_index_t p = 0; p < nP_; p++)
+                first[p + 1] = first_[p + 1] - first_[p];
+            for (vertex_index_t o = 0; o < nO_; o++)
+                ++first[nP_ + o + 1]; // q_o-o
+            for (vertex_index_t x = 0; x < N; x++)
+                first[x + 1] += first[x];
+
+            obj.resize(first[N]), benefit.resize(first[N]);
+            std::vector<std::size_t> pos(first.begin(), first.end() - 1);
+            for (vertex_index_t p = 0; p < nP_; p++)
+                for (auto i = first_[p]; i < first_[p + 1]; i++) {
+                    auto j = pos[p]++;
+                    obj[j] = obj_[i];
+                    benefit[j] = (minimum ? -double(weight_[i]) : double(weight_[i])) * scale;
+                    auto k = pos[nP_ + obj_[i]]++;
+                    obj[k] = vertex_index_t(nO_ + p), benefit[k] = 0;
+                }
+            for (vertex_index_t o = 0; o < nO_; o++) {
+                auto k = pos[nP_ + o]++;
+                obj[k] = o, benefit[k] = 0;
+            }
+        }
+
+        C *= scale;
+        // 浮点权值时，finalEps不能低于价格量级的若干ulp，否则N很大（约450万以上）时出价无法抬高价格，竞价会循环
+        const double priceScale = std::max(C, 1.0);
+        const double finalEps = std::is_integral_v<weight_type> ? 1
+            : std::max(priceScale * 1e-9 / N, priceScale * 4 * std::numeric_limits<double>::epsilon());
+        double eps = std::max(finalEps, C / scaling_factor);
+
+        std::vector<double> price(N, 0), bestBid(N);
+        std::vector<vertex_index_t> owner(N), assigned(N), winner(N), work, next, touched;
+        std::vector<std::pair<vertex_index_t, double>> bids; // 与work对应的(对象, 出价)
+        while (true) {
+            ++phases_;
+            std::fill(owner.begin(), owner.end(), none);
+            std::fill(assigned.begin(), assigned.end(), none);
+            std::fill(bestBid.begin(), bestBid.end(), neg_inf);
+            work.resize(N);
+            for (vertex_index_t x = 0; x < N; x++)
+                work[x] = x;
+
+            while (!work.empty()) {
+                ++rounds_;
+                bids.resize(work.size());
+                parallel_for(std::size_t(0), work.size(), [&](std::size_t idx) {
+                    auto x = work[idx];
+                    vertex_index_t best(none);
+                    double v1(neg_inf), v2(neg_inf);
+                    for (auto i = first[x]; i < first[x + 1]; i++) {
+                        auto val = benefit[i] - price[obj[i]];
+                        if (val > v1)
+                            v2 = v1, v1 = val, best = obj[i];
+                        else if (val > v2)
+                            v2 = val;
+                    }
+                    assert(best != none);
+                    // 只有一个可选对象时，出价只需维持ε-互补松弛
+                    bids[idx] = { best, price[best] + (v2 == neg_inf ? 0 : v1 - v2) + eps };
+                }, nthreads, std::size_t(256));
+
+                // 裁决：出价相同时以队列中靠前者为准
+                touched.clear();
+                for (std::size_t idx = 0; idx < work.size(); idx++) {
+                    auto o = bids[idx].first;
+                    if (bestBid[o] == neg_inf)
+                        touched.push_back(o);
+                    if (bids[idx].second > bestBid[o])
+                        bestBid[o] = bids[idx].second, winner[o] = work[idx];
+                }
+
+                next.clear();
+                for (std::size_t idx = 0; idx < work.size(); idx++)
+                    if (winner[bids[idx].first] != work[idx])
+                        next.push_back(work[idx]);
+                for (auto o : touched) {
+                    if (owner[o] != none) {
+                        assigned[owner[o]] = none;
+                        next.push_back(owner[o]);
+                    }
+                    owner[o] = winner[o], assigned[winner[o]] = o;
+                    price[o] = bestBid[o], bestBid[o] = neg_inf;
+                }
+                work.swap(next);
+            }
+
+            if (eps <= finalEps)
+                break;
+            eps = std::max(finalEps, eps / scaling_factor);
+        }
+
+        assigned.resize(nP_);
+        return assigned;
+    }
+
+
+private:
+    vertex_index_t nP_, nO_; // 出价者数，对象数
+    std::vector<std::size_t> first_; // 出价者p的边为[first_[p], first_[p + 1])
+    std::vector<vertex_index_t> obj_;
+    std::vector<weight_type> weight_;
+
+    bool ok_;
+    std::vector<vertex_index_t> mate_;
+    total_weight_type total_;
+    unsigned phases_, rounds_;
+};
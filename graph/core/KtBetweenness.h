@@ -0,0 +1,242 @@
+#pragma once
+#include <vector>
+#include <atomic>
+#include <random>
+#include <cmath>
+#include <numeric>
+#include <algorithm>
+#include <type_traits>
+#include "KtWeightor.h"
+#include "KtAdjIter.h"
+#include "../base/parallel_for.h"
+
+
+// 介数中心性（betweenness centrality）：bc(v) = Σσ(s, t | v) / σ(s, t)，s != v != t
+// 其中σ(s, t)为s到t的最短路径数，σ(s, t | v)为其中经过v的最短路径数
+// 采用Brandes算法：对每个源点s，先以BFS（无权）或Dijkstra（有权）求出各顶点的最短距离和最短路径数，
+// 再按距离递减的次序累加依赖值δ(v) = Σσ(v)/σ(w) * (1 + δ(w))，w为v在最短路径DAG中的后继，bc(v) += δ(v)
+// 时间复杂度为O(V*E)（无权）或O(V*E*lgV)（有权）
+//
+// 各源点相互独立，以多个线程并行处理，每个线程维护独立的工作区和bc累加器，最后依次合并
+// 对于规模过大的图，可只处理随机抽样的k个源点，并将结果放大V/k倍作为估计
+// 无向图的每条最短路径被两个端点各计算一次，结果除以2
+//
+// @WEIGHTOR: 为unit_min_wtor（默认）时按边数计算最短路径，否则按WEIGHTOR取得的权值，权值须为正数
+// 内部将图复制为CSR格式，因此适用于任意KtGraph的实现
+template<typename GRAPH, class WEIGHTOR = unit_min_wtor<GRAPH>>
+class KtBetweenness
+{
+public:
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+    using weight_type = typename WEIGHTOR::weight_type;
+    constexpr static bool weighted = !std::is_base_of_v<KtWeightUnit<typename GRAPH::edge_type>, WEIGHTOR>;
+
+
+    // 精确计算：以全部顶点为源点
+    // @nthreads: 线程数，为0时取hardware_threads()
+    explicit KtBetweenness(const GRAPH& g, unsigned nthreads = 0) : V_(g.order()) {
+        std::vector<vertex_index_t> sources(V_);
+        std::iota(sources.begin(), sources.end(), vertex_index_t(0));
+        run_(g, sources, nthreads);
+    }
+
+
+    // 近似计算：只以sources为源点，结果放大V/|sources|倍
+    // sources通常由sample函数生成
+    KtBetweenness(const GRAPH& g, const std::vector<vertex_index_t>& sources, unsigned nthreads = 0) : V_(g.order()) {
+        run_(g, sources, nthreads);
+    }
+
+
+    // 从V个顶点中无放回地随机抽取k个源点
+    static std::vector<vertex_index_t> sample(vertex_index_t V, vertex_index_t k, unsigned seed = 0) {
+        std::vector<vertex_index_t> vs(V);
+        std::iota(vs.begin(), vs.end(), vertex_index_t(0));
+        std::mt19937 eng(seed);
+        k = std::min(k, V);
+        for (vertex_index_t i = 0; i < k; i++) // 部分Fisher-Yates洗牌
+            std::swap(vs[i], vs[std::uniform_int_distribution<vertex_index_t>(i, V - 1)(eng)]);
+        vs.resize(k);
+        return vs;
+    }
+
+
+    // 使所有顶点的归一化误差（见errorBound）以不低于1-delta的概率不超过eps所需的样本数
+    static vertex_index_t samplesFor(vertex_index_t V, double eps, double delta) {
+        auto k = std::ceil(std::log(2.0 * V / delta) / (2 * eps * eps));
+        return vertex_index_t(std::min<double>(k, V));
+    }
+
+
+    double centrality(vertex_index_t v) const { return bc_[v]; }
+
+    const std::vector<double>& centralities() const { return bc_; }
+
+    // 归一化的介数：除以不含v的顶点对数(V-1)(V-2)（无向图为(V-1)(V-2)/2），取值为[0, 1]
+    double normalized(vertex_index_t v) const {
+        double pairs = double(V_ - 1) * (V_ - 2);
+        if constexpr (!GRAPH::isDigraph()) pairs /= 2;
+        return pairs > 0 ? bc_[v] / pairs : 0;
+    }
+
+
+    // 参与计算的源点数
+    vertex_index_t samples() const { return k_; }
+
+    // 估计误差的上界：以不低于1-delta的概率，所有顶点的|估计值 - 精确值|均不超过返回值
+    // 每个源点的依赖值δ(v)位于[0, V-2]，由Hoeffding不等式（对无放回抽样同样成立）及对V个顶点的联合界得到
+    // 精确计算时返回0
+    double errorBound(double delta) const {
+        if (k_ >= V_) return 0;
+        double range = double(V_) * (V_ - 2);
+        if constexpr (!GRAPH::isDigraph()) range /= 2;
+        return range * std::sqrt(std::log(2.0 * V_ / delta) / (2.0 * k_));
+    }
+
+
+private:
+
+    // 线程局部的工作区
+    struct KpLocal_
+    {
+        std::vector<weight_type> dist;
+        std::vector<double> sigma, delta;
+        std::vector<vertex_index_t> order; // 按距离非递减的次序记录已确定的顶点
+        std::vector<std::pair<weight_type, vertex_index_t>> heap;
+        std::vector<double> bc;
+    };
+
+
+    void run_(const GRAPH& g, const std::vector<vertex_index_t>& sources, unsigned nthreads) {
+        k_ = vertex_index_t(sources.size());
+        bc_.assign(V_, 0);
+        if (V_ == 0 || sources.empty())
+            return;
+
+        // 复制为CSR
+        first_.assign(V_ + 1, 0);
+        for (vertex_index_t v = 0; v < V_; v++) {
+            for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter) {
+                adj_.push_back(*iter);
+                if constexpr (weighted)
+                    wt_.push_back(WEIGHTOR{}(iter.edge()));
+            }
+            first_[v + 1] = adj_.size();
+        }
+
+        if (nthreads == 0) nthreads = hardware_threads();
+        nthreads = unsigned(std::min<std::size_t>(nthreads, sources.size()));
+        std::vector<KpLocal_> locals(nthreads);
+        std::atomic<std::size_t> next(0);
+        parallel_blocks(0u, nthreads, [&](unsigned tid, unsigned, unsigned) {
+            auto& local = locals[tid];
+            local.dist.assign(V_, WEIGHTOR{}.worst_weight);
+            local.sigma.assign(V_, 0);
+            local.delta.assign(V_, 0);
+            local.bc.assign(V_, 0);
+            for (auto i = next++; i < sources.size(); i = next++)
+                accumulate_(local, sources[i]);
+        }, nthreads);
+
+        // 合并各线程的累加器，并按抽样比例和图的类型缩放
+        double scale = double(V_) / k_;
+        if constexpr (!GRAPH::isDigraph()) scale /= 2;
+        for (auto& local : locals)
+            for (vertex_index_t v = 0; v < V_; v++)
+                bc_[v] += local.bc[v];
+        for (auto& x : bc_)
+            x *= scale;
+
+        std::vector<std::size_t>().swap(first_);
+        std::vector<vertex_index_t>().swap(adj_);
+        std::vector<weight_type>().swap(wt_);
+    }
+
+
+    weight_type weight_(std::size_t e) const {
+        if constexpr (weighted)
+            return wt_[e];
+        else
+            return weight_type(1);
+    }
+
+
+    // 以s为源点，计算各顶点的依赖值并累加到local.bc
+    void accumulate_(KpLocal_& local, vertex_index_t s) const {
+        auto& dist = local.dist;
+        auto& sigma = local.sigma;
+        auto& delta = local.delta;
+        auto& order = local.order;
+        const WEIGHTOR wtor{};
+
+        order.clear();
+        dist[s] = weight_type(0), sigma[s] = 1;
+
+        if constexpr (!weighted) { // BFS，order即为队列
+            order.push_back(s);
+            for (std::size_t i = 0; i < order.size(); i++) {
+                auto v = order[i];
+                for (auto e = first_[v]; e < first_[v + 1]; e++) {
+                    auto w = adj_[e];
+                    if (dist[w] == wtor.worst_weight) {
+                        dist[w] = dist[v] + 1;
+                        order.push_back(w);
+                    }
+                    if (dist[w] == dist[v] + 1)
+                        sigma[w] += sigma[v];
+                }
+            }
+        }
+        else { // Dijkstra，以最小堆管理待确定的顶点，过期的堆项在出堆时跳过
+            auto& heap = local.heap;
+            auto greater = [&wtor](const auto& a, const auto& b) { return wtor.comp(b.first, a.first); };
+            heap.clear();
+            heap.emplace_back(dist[s], s);
+            while (!heap.empty()) {
+                std::pop_heap(heap.begin(), heap.end(), greater);
+                auto [d, v] = heap.back();
+                heap.pop_back();
+                if (wtor.comp(dist[v], d) || delta[v] != 0) // 过期的堆项，或v已确定（以delta[v]临时标记）
+                    continue;
+                delta[v] = 1, order.push_back(v);
+
+                for (auto e = first_[v]; e < first_[v + 1]; e++) {
+                    auto w = adj_[e];
+                    auto nd = wtor.acc(d, weight_(e));
+                    if (wtor.comp(nd, dist[w])) {
+                        dist[w] = nd, sigma[w] = sigma[v];
+                        heap.emplace_back(nd, w);
+                        std::push_heap(heap.begin(), heap.end(), greater);
+                    }
+                    else if (nd == dist[w] && delta[w] == 0)
+                        sigma[w] += sigma[v];
+                }
+            }
+            for (auto v : order) delta[v] = 0;
+        }
+
+        // 按距离递减的次序累加依赖值
+        for (auto i = order.size(); i-- > 0; ) {
+            auto v = order[i];
+            for (auto e = first_[v]; e < first_[v + 1]; e++) {
+                auto w = adj_[e];
+                if (dist[w] != wtor.worst_weight && dist[w] == wtor.acc(dist[v], weight_(e)) && w != s)
+                    delta[v] += sigma[v] / sigma[w] * (1 + delta[w]);
+            }
+            if (v != s)
+                local.bc[v] += delta[v];
+        }
+
+        // 复位工作区，只涉及本次访问的顶点
+        for (auto v : order)
+            dist[v] = wtor.worst_weight, sigma[v] = 0, delta[v] = 0;
+    }
+
+
+private:
+    vertex_index_t V_, k_;
+    std::vector<double> bc_;
+    std::vector<std::size_t> first_; // CSR：顶点v的出边为adj_[first_[v], first_[v + 1])
+    std::vector<vertex_index_t> adj_;
+    std::vector<weight_type> wt_; // 边的权值，仅用于有权图
+};
@@ -2,15 +2,16 @@
 #include <queue>
 #include <assert.h>
 #include "KtAdjIter.h"
+#include "KtTraversalSpace.h"
 
 
-// ȱ
-// ģ
-//    -- fullGraphΪtrueȫͼvͨĽڵߡ
-//    -- modeEdgeΪtrueԱ߽йȱʱܻظÿֻһΡ
-//                 ΪfalseԶйȱʱܱ֤ÿ߶ֻһΡ
-// modeEdgeģʽµĳʼ״̬operator*()startVertexfrom()-1
-// modeEdgeģʽµĳʼ״̬operator*()startVertexĵһڽӶ㣬from()startVertex
+// 广度优先遍历
+// 模板参数：
+//    -- fullGraph，若为true，则进行全图迭代，否则仅迭代与v相联通的节点或边。
+//    -- modeEdge，若为true，则对边进行广度优先遍历，这时顶点可能会多次重复，但每条边只会遍历一次。
+//                 若为false，则对顶点进行广度优先遍历，这时不能保证每条边都会遍历到或只遍历一次。
+// 非modeEdge模式下的初始状态，operator*()返回startVertex，from()方法返回-1
+// modeEdge模式下的初始状态，operator*()返回startVertex的第一个邻接顶点，from()方法返回startVertex
 template <typename GRAPH, bool fullGraph = false, bool modeEdge = false>
 class KtBfsIter 
 {
@@ -20,33 +21,33 @@ public:
     using vertex_index_t = typename graph_type::vertex_index_t;
     using adj_vertex_iter = KtAdjIter<graph_type>;
     using const_edge_ref = decltype(std::declval<adj_vertex_iter>().edge());
-    constexpr static vertex_index_t null_vertex = -1;
+    constexpr static vertex_index_t null_vertex = graph_type::null_vertex;
+    using space_type = KtTraversalSpace<vertex_index_t>;
 
 
-    // graph -- ͼ
-    // startVertex -- ʼ㣬-1ʾֻҪstartʼ
+    // graph -- 待遍历的图
+    // startVertex -- 遍历的起始顶点，-1表示只构建迭代器，需要另外调用start方法开始遍历
     KtBfsIter(graph_type& graph, vertex_index_t startVertex)
-        : graph_(graph),
-          v0_(null_vertex),
-          isPushed_(graph.order(), false),
-          isPopped_(graph.order(), false) {
-        if (startVertex != null_vertex) 
-            start(startVertex);
-    }
+        : KtBfsIter(graph, startVertex, nullptr) {}
+
+    // space -- 外部提供的工作空间，迭代器构造时复位其标记，代价为O(1)
+    // 适用于在大图上反复进行局部遍历的场合。复制迭代器时，副本与原迭代器共享该工作空间
+    KtBfsIter(graph_type& graph, vertex_index_t startVertex, space_type& space)
+        : KtBfsIter(graph, startVertex, &space) {}
 
     void operator++() {
         assert(!isEnd());
 
-        if (!isPushed_[v0_]) {
+        if (!pushed_().isMarked(v0_)) {
             assert(todo_.empty());
-            isPushed_[v0_] = true;
+            pushed_().mark(v0_);
             todo_.push(adj_vertex_iter(graph_, v0_));
         } else {
             assert(!todo_.empty());
             auto& iter = todo_.front();
             vertex_index_t v = *iter;
-            if (!isPushed_[v]) {
-                isPushed_[v] = true;
+            if (!pushed_().isMarked(v)) {
+                pushed_().mark(v);
                 todo_.push(adj_vertex_iter(graph_, v));
             }
             ++iter;
@@ -55,22 +56,22 @@ public:
         while (!todo_.empty()) {
             auto& iter = todo_.front();
 
-            // Ƴѵĩβĵ
+            // 移出已到末尾的迭代器
             if (iter.isEnd()) {
-                isPopped_[from()] = true;
+                popped_().mark(from());
                 todo_.pop();
                 continue;
             }
 
-            // ѱĶ
+            // 跳过已遍历的顶点或边
             if (modeEdge) {
-                if (!graph_type::isDigraph() && isPopped_[*iter]) { // ͼĳѳջ֮ڽӵı߱Ȼѱ
+                if (!graph_type::isDigraph() && popped_().isMarked(*iter)) { // 对于无向图，若某顶点已出栈，则与之邻接的边必然已遍历
                     ++iter;
                     continue;
                 }
             } 
             else {
-                if (isPushed_[*iter]) { // ѱĶ㣬ȷÿֻһ
+                if (pushed_().isMarked(*iter)) { // 跳过已遍历的顶点，确保每个顶点只遍历一次
                     ++iter;
                     continue;
                 }
@@ -80,24 +81,27 @@ public:
         }
 
         if (todo_.empty()) {
-            isPopped_[v0_] = true;
-            v0_ = null_vertex;  // ֹ
+            popped_().mark(v0_);
+            v0_ = null_vertex;  // 设置终止标记
         }
 
         if (fullGraph && isEnd()) {
-            auto pos = std::find(isPushed_.begin(), isPushed_.end(), false);
-            if (pos != isPushed_.end()) 
-                start(static_cast<vertex_index_t>(std::distance(isPushed_.begin(), pos)));
+            // scan_之前的顶点均已遍历，因此全图遍历的总扫描代价为O(V)
+            for (; scan_ < graph_.order(); scan_++)
+                if (!pushed_().isMarked(scan_)) {
+                    start(scan_);
+                    break;
+                }
         }
     }
 
-    // صǰĶ
+    // 返回当前正在游历的顶点
     vertex_index_t operator*() const {
         return todo_.empty() ? v0_ : *(todo_.front());
     }
 
 
-    // 뵱ǰ㣨to㣩ɱߵfrom
+    // 与当前顶点（to顶点）构成边的from顶点
     vertex_index_t from() const {
         assert(!isEnd());
         return todo_.empty() ? null_vertex : todo_.front().from();
@@ -109,24 +113,39 @@ public:
     bool isEnd() const { return v0_ == null_vertex; }
 
 
-    // Ӷvʼйȱ
+    // 从顶点v开始接续进行广度优先遍历
     void start(vertex_index_t v) {
-        assert(isEnd() && !isPushed_[v]);
+        assert(isEnd() && !pushed_().isMarked(v));
         v0_ = v;
 
         if (modeEdge) ++(*this); // skip v0
     }
 
 
-    bool isPushed(vertex_index_t v) const { return isPushed_[v]; }
-    bool isPopped(vertex_index_t v) const { return isPopped_[v]; }
+    bool isPushed(vertex_index_t v) const { return pushed_().isMarked(v); }
+    bool isPopped(vertex_index_t v) const { return popped_().isMarked(v); }
+
+private:
+    // 用于标记顶点是否已压栈/出栈
+    auto& pushed_() const { return space_.flags(0); }
+    auto& popped_() const { return space_.flags(1); }
+
+    KtBfsIter(graph_type& graph, vertex_index_t startVertex, space_type* space)
+        : graph_(graph),
+          v0_(null_vertex),
+          scan_(0),
+          space_(space, graph.order(), 0, 2) {
+        if (startVertex != null_vertex)
+            start(startVertex);
+    }
 
 private:
     graph_type& graph_;
 
-    // ڽӶ
+    // 待处理的邻接顶点迭代器
     std::queue<adj_vertex_iter> todo_;
 
-    vertex_index_t v0_; // ʼ
-    std::vector<bool> isPushed_, isPopped_;  // ڱǶǷѹջ/ջ
+    vertex_index_t v0_; // 起始顶点
+    vertex_index_t scan_; // 全图遍历时，搜寻未遍历顶点的起始位置
+    KtTraversalSpaceRef<space_type> space_; // 外部提供的工作空间，未提供时自建
 };
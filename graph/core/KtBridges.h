@@ -1,12 +1,13 @@
 #pragma once
 #include <vector>
-#include "KtDfsIterX.h"
+#include <algorithm>
+#include "KtDfsKernel.h"
 
 
-// Ѱͼ
-// Ҳƹؽڱ(articulation edge)ɾ߽һͨͼֽΪཻͼ
-// ûŵͼΪͨ
-// κDFSУһv-wһţǵҽڻر߽wһwһ
+// 寻找图的桥
+// 桥也称关节边(articulation edge)，如果删除这条边将把一个连通图分解为不相交的两个子图。
+// 没有桥的图称为边连通。
+// 在任何DFS树中，一条树边v-w是一个桥，条件是当且仅当不存在回边将w的一个子孙与w的一个祖先相连接
 template<typename GRAPH>
 class KtBridges
 {
@@ -16,26 +17,46 @@ public:
     using bridges_t = std::vector<vertex_pair_t>;
 
     KtBridges(const GRAPH& g) {
-        KtDfsIterX<const GRAPH, true> iter(g, 0);
-        while (!iter.isEnd()) {
-            if (iter.isBridge()) {
-                if (iter.from() != -1)
-                    bridges_.push_back({ iter.from(), *iter });
-            }
-
-            ++iter;
-        }
+        KtDfsKernel<GRAPH> dfs(g);
+        KpVisitor_ vis{ {}, dfs, std::vector<vertex_index_t>(g.order()), bridges_ };
+        dfs.runAll(vis);
     }
 
-
     auto size() const { return bridges_.size(); }
     auto begin() const { return bridges_.cbegin(); }
     auto end() const { return bridges_.cend(); }
 
-    const vertex_pair_t& operator[](unsigned idx) const {
+    const vertex_pair_t& operator[](std::size_t idx) const {
         return bridges_[idx];
     }
 
+private:
+
+    // low[v]为以v为根的子树中任何回边所引用的最小前序编号
+    struct KpVisitor_ : public KtDfsVisitor
+    {
+        const KtDfsKernel<GRAPH>& dfs;
+        std::vector<vertex_index_t> low;
+        bridges_t& bridges;
+
+        void discover(vertex_index_t v) { 
+            low[v] = dfs.pushIndex(v); 
+        }
+
+        template<typename E>
+        void backEdge(vertex_index_t v, vertex_index_t w, const E&) {
+            low[v] = std::min(low[v], dfs.pushIndex(w));
+        }
+
+        void finish(vertex_index_t v, vertex_index_t p) {
+            if (p != GRAPH::null_vertex) {
+                low[p] = std::min(low[p], low[v]);
+                if (low[v] == dfs.pushIndex(v))
+                    bridges.push_back({ p, v });
+            }
+        }
+    };
+
 private:
     bridges_t bridges_;
 };
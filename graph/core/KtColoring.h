@@ -0,0 +1,401 @@
+#pragma once
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <algorithm>
+#include "../util/simple_csr.h"
+
+
+// 无向图的顶点着色：相邻顶点着不同的颜色，颜色以0, 1, 2, ...表示，忽略自环和平行边
+// 顺序贪心着色：按给定的顶点次序，为每个顶点着其邻接点未使用的最小颜色，颜色数不超过最大度 + 1
+//   k_natural: 按顶点序号
+//   k_largest_first: 按度递减
+//   k_smallest_last: 反复移除度最小的顶点，按移除的逆序着色，颜色数不超过退化度（最大核数）+ 1
+//   k_incidence: 每次选取已着色邻接点最多的顶点
+//   各次序均以桶排序实现，时间复杂度为O(V + E)
+// 并行着色：
+//   k_jones_plassmann: 以(度, 随机数)为顶点的优先级，顶点的所有高优先级邻接点着色后即可着色，
+//     按层并行推进，总工作量为O(V + E)。结果等价于按优先级递减的顺序贪心着色，与线程数无关
+//   k_speculative: 各轮并行地对待着色顶点进行试探性贪心着色，然后并行检测冲突，
+//     冲突边的序号较大的端点进入下一轮重新着色，每轮工作量为O(V + E)，结果与线程调度有关
+template<typename GRAPH>
+class KtColoring
+{
+    static_assert(!GRAPH::isDigraph(), "KtColoring must be instantiated with undirected Graph.");
+
+public:
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+    constexpr static vertex_index_t null_vertex = GRAPH::null_vertex; // 颜色数不超过顶点数，故颜色亦以vertex_index_t表示，null_vertex为未着色
+
+    // 顺序贪心着色的顶点次序
+    enum color_order
+    {
+        k_natural,
+        k_largest_first,
+        k_smallest_last,
+        k_incidence
+    };
+
+    // 并行着色的方法
+    enum color_parallel
+    {
+        k_jones_plassmann,
+        k_speculative
+    };
+
+
+    explicit KtColoring(const GRAPH& g, color_order order = k_smallest_last) : rounds_(1) {
+        simple_csr(g, first_, adj_, 1);
+        V_ = vertex_index_t(first_.size() - 1);
+
+        std::vector<vertex_index_t> seq;
+        switch (order) {
+        case k_natural:
+            seq.resize(V_);
+            for (vertex_index_t v = 0; v < V_; v++)
+                seq[v] = v;
+            break;
+
+        case k_largest_first:
+            seq = largestFirst_();
+            break;
+
+        case k_smallest_last:
+            seq = smallestLast_();
+            break;
+
+        case k_incidence:
+            seq = incidence_();
+            break;
+        }
+
+        color_.assign(V_, null_vertex); // 未着色
+        std::vector<char> used(maxDegree_() + 2, 0);
+        for (auto v : seq)
+            color_[v] = firstFit_(v, used, [this](vertex_index_t u) { return color_[u]; });
+        countColors_();
+    }
+
+
+    // @nthreads: 线程数，为0时取hardware_threads()
+    // @seed: k_jones_plassmann中随机优先级的种子
+    KtColoring(const GRAPH& g, color_parallel method, unsigned nthreads = 0, std::uint64_t seed = 0) : rounds_(0) {
+        if (nthreads == 0) nthreads = hardware_threads();
+        simple_csr(g, first_, adj_, nthreads);
+        V_ = vertex_index_t(first_.size() - 1);
+
+        if (method == k_jones_plassmann)
+            jonesPlassmann_(nthreads, seed);
+        else
+            speculative_(nthreads);
+        countColors_();
+    }
+
+
+    // 顶点v的颜色
+    vertex_index_t color(vertex_index_t v) const { return color_[v]; }
+
+    const std::vector<vertex_index_t>& colors() const { return color_; }
+
+    // 使用的颜色数
+    vertex_index_t numColors() const { return numColors_; }
+
+    // 着各颜色的顶点数
+    const std::vector<std::size_t>& colorCounts() const { return counts_; }
+
+    // 并行着色的轮数（k_jones_plassmann为层数），顺序着色时为1
+    unsigned rounds() const { return rounds_; }
+
+
+    // 检查着色的合法性
+    bool check() const {
+        for (vertex_index_t v = 0; v < V_; v++)
+            for (auto i = first_[v]; i < first_[v + 1]; i++)
+                if (color_[adj_[i]] == color_[v])
+                    return false;
+        return true;
+    }
+
+
+private:
+
+    vertex_index_t degree_(vertex_index_t v) const { return vertex_index_t(first_[v + 1] - first_[v]); }
+
+    vertex_index_t maxDegree_() const {
+        vertex_index_t md(0);
+        for (vertex_index_t v = 0; v < V_; v++)
+            md = std::max(md, degree_(v));
+        return md;
+    }
+
+
+    // 返回v的邻接点未使用的最小颜色，colorOf(u)返回邻接点u的颜色，null_vertex表示尚未着色
+    // used为按颜色索引的临时标记数组，长度须大于v的度 + 1，返回时恢复为全0
+    template<typename COLOR_OF>
+    vertex_index_t firstFit_(vertex_index_t v, std::vector<char>& used, COLOR_OF colorOf) const {
+        auto deg = degree_(v);
+        for (auto i = first_[v]; i < first_[v + 1]; i++) {
+            vertex_index_t c = colorOf(adj_[i]);
+            if (c <= deg) // 大于度的颜色不影响结果
+                used[c] = 1;
+        }
+
+        vertex_index_t c(0);
+        while (used[c])
+            ++c;
+
+        std::fill(used.begin(), used.begin() + deg + 1, 0);
+        return c;
+    }
+
+
+    // 按度递减排列顶点，度相同时按序号
+    std::vector<vertex_index_t> largestFirst_() const {
+        auto md = maxDegree_();
+        std::vector<std::size_t> bin(md + 2, 0);
+        for (vertex_index_t v = 0; v < V_; v++)
+            ++bin[md - degree_(v) + 1];
+        for (vertex_index_t d = 0; d <= md; d++)
+            bin[d + 1] += bin[d];
+
+        std::vector<vertex_index_t> seq(V_);
+        for (vertex_index_t v = 0; v < V_; v++)
+            seq[bin[md - degree_(v)]++] = v;
+        return seq;
+    }
+
+
+    // 与KtCoreDecomposition相同的桶排序剥离，着色次序为剥离的逆序
+    std::vector<vertex_index_t> smallestLast_() const {
+        auto md = maxDegree_();
+        std::vector<vertex_index_t> deg(V_);
+        std::vector<std::size_t> bin(md + 2, 0);
+        for (vertex_index_t v = 0; v < V_; v++)
+            ++bin[(deg[v] = degree_(v)) + 1];
+        for (vertex_index_t d = 0; d <= md; d++)
+            bin[d + 1] += bin[d];
+
+        std::vector<vertex_index_t> vert(V_);
+        std::vector<std::size_t> pos(V_);
+        for (vertex_index_t v = 0; v < V_; v++) {
+            pos[v] = bin[deg[v]]++;
+            vert[pos[v]] = v;
+        }
+        for (vertex_index_t d = md; d > 0; d--)
+            bin[d] = bin[d - 1];
+        bin[0] = 0;
+
+        for (std::size_t i = 0; i < V_; i++) {
+            auto v = vert[i];
+            for (auto j = first_[v]; j < first_[v + 1]; j++) {
+                auto u = adj_[j];
+                if (deg[u] > deg[v]) {
+                    auto du = deg[u];
+                    auto pu = pos[u], pw = bin[du];
+                    auto w = vert[pw];
+                    if (u != w) {
+                        pos[u] = pw, vert[pu] = w;
+                        pos[w] = pu, vert[pw] = u;
+                    }
+                    ++bin[du];
+                    --deg[u];
+                }
+            }
+        }
+
+        std::reverse(vert.begin(), vert.end());
+        return vert;
+    }
+
+
+    // 以按已着色邻接点数分组的双向链表桶，每次取出计数最大的顶点
+    std::vector<vertex_index_t> incidence_() const {
+        std::vector<vertex_index_t> cnt(V_, 0);
+        std::vector<vertex_index_t> head(maxDegree_() + 1, null_vertex), prev(V_, null_vertex), next(V_, null_vertex);
+        auto link = [&](vertex_index_t v) {
+            auto& h = head[cnt[v]];
+            prev[v] = null_vertex, next[v] = h;
+            if (h != null_vertex) prev[h] = v;
+            h = v;
+        };
+        auto unlink = [&](vertex_index_t v) {
+            if (prev[v] != null_vertex) next[prev[v]] = next[v];
+            else head[cnt[v]] = next[v];
+            if (next[v] != null_vertex) prev[next[v]] = prev[v];
+        };
+
+        for (vertex_index_t v = V_; v-- > 0; )
+            link(v); // 逆序插入，使计数相同的顶点按序号取出
+
+        std::vector<vertex_index_t> seq;
+        seq.reserve(V_);
+        std::vector<bool> done(V_, false);
+        vertex_index_t top(0);
+        while (seq.size() < V_) {
+            while (head[top] == null_vertex)
+                --top;
+            auto v = head[top];
+            unlink(v);
+            done[v] = true;
+            seq.push_back(v);
+
+            for (auto i = first_[v]; i < first_[v + 1]; i++) {
+                auto u = adj_[i];
+                if (!done[u]) {
+                    unlink(u);
+                    ++cnt[u];
+                    link(u);
+                    top = std::max(top, cnt[u]);
+                }
+            }
+        }
+
+        return seq;
+    }
+
+
+    // 由种子和顶点序号生成的伪随机数（splitmix64的混合函数）
+    static std::uint64_t hash_(std::uint64_t seed, std::uint64_t v) {
+        std::uint64_t z = seed + (v + 1) * 0x9e3779b97f4a7c15ull;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+
+    void jonesPlassmann_(unsigned nthreads, std::uint64_t seed) {
+        std::vector<std::uint64_t> rnd(V_);
+        parallel_for(vertex_index_t(0), V_, [&](vertex_index_t v) { rnd[v] = hash_(seed, v); }, nthreads);
+        auto higher = [this, &rnd](vertex_index_t a, vertex_index_t b) { // a的优先级是否高于b
+            auto da = degree_(a), db = degree_(b);
+            return da > db || (da == db && (rnd[a] > rnd[b] || (rnd[a] == rnd[b] && a < b)));
+        };
+
+        // wait[v]为v尚未着色的高优先级邻接点数
+        std::unique_ptr<std::atomic<vertex_index_t>[]> wait(new std::atomic<vertex_index_t>[V_]);
+        color_.assign(V_, 0);
+        std::vector<std::vector<vertex_index_t>> locals(nthreads);
+        parallel_blocks(vertex_index_t(0), V_, [&](unsigned tid, vertex_index_t b, vertex_index_t e) {
+            for (auto v = b; v < e; v++) {
+                vertex_index_t n(0);
+                for (auto i = first_[v]; i < first_[v + 1]; i++)
+                    n += higher(adj_[i], v);
+                wait[v].store(n, std::memory_order_relaxed);
+                if (n == 0)
+                    locals[tid].push_back(v);
+            }
+        }, nthreads);
+
+        auto md = maxDegree_();
+        std::vector<std::vector<char>> useds(nthreads, std::vector<char>(md + 2, 0));
+        std::vector<vertex_index_t> frontier;
+        gather_(locals, frontier);
+        while (!frontier.empty()) {
+            ++rounds_;
+
+            // 同层顶点互不相邻，其高优先级邻接点均已在之前各层着色
+            parallel_blocks(std::size_t(0), frontier.size(), [&](unsigned tid, std::size_t b, std::size_t e) {
+                auto& used = useds[tid];
+                for (auto i = b; i < e; i++) {
+                    auto v = frontier[i];
+                    color_[v] = firstFit_(v, used, [&](vertex_index_t u) {
+                        return higher(u, v) ? color_[u] : null_vertex;
+                    });
+                }
+            }, nthreads);
+
+            parallel_blocks(std::size_t(0), frontier.size(), [&](unsigned tid, std::size_t b, std::size_t e) {
+                for (auto i = b; i < e; i++) {
+                    auto v = frontier[i];
+                    for (auto j = first_[v]; j < first_[v + 1]; j++) {
+                        auto u = adj_[j];
+                        if (higher(v, u) && wait[u].fetch_sub(1, std::memory_order_relaxed) == 1)
+                            locals[tid].push_back(u);
+                    }
+                }
+            }, nthreads);
+
+            gather_(locals, frontier);
+        }
+    }
+
+
+    void speculative_(unsigned nthreads) {
+        std::unique_ptr<std::atomic<vertex_index_t>[]> color(new std::atomic<vertex_index_t>[V_]);
+        for (vertex_index_t v = 0; v < V_; v++)
+            color[v].store(null_vertex, std::memory_order_relaxed);
+
+        auto md = maxDegree_();
+        std::vector<std::vector<char>> useds(nthreads, std::vector<char>(md + 2, 0));
+        std::vector<std::vector<vertex_index_t>> locals(nthreads);
+        std::vector<vertex_index_t> work(V_);
+        for (vertex_index_t v = 0; v < V_; v++)
+            work[v] = v;
+
+        while (!work.empty()) {
+            ++rounds_;
+
+            // 试探性着色：邻接点的颜色可能正被其他线程修改，由下一步检测冲突
+            parallel_blocks(std::size_t(0), work.size(), [&](unsigned tid, std::size_t b, std::size_t e) {
+                auto& used = useds[tid];
+                for (auto i = b; i < e; i++) {
+                    auto v = work[i];
+                    color[v].store(firstFit_(v, used, [&color](vertex_index_t u) {
+                        return color[u].load(std::memory_order_relaxed);
+                    }), std::memory_order_relaxed);
+                }
+            }, nthreads);
+
+            // 冲突检测：与较小序号的邻接点同色的顶点重新着色
+            parallel_blocks(std::size_t(0), work.size(), [&](unsigned tid, std::size_t b, std::size_t e) {
+                for (auto i = b; i < e; i++) {
+                    auto v = work[i];
+                    auto c = color[v].load(std::memory_order_relaxed);
+                    for (auto j = first_[v]; j < first_[v + 1]; j++) {
+                        auto u = adj_[j];
+                        if (u < v && color[u].load(std::memory_order_relaxed) == c) {
+                            locals[tid].push_back(v);
+                            break;
+                        }
+                    }
+                }
+            }, nthreads);
+
+            gather_(locals, work);
+        }
+
+        color_.resize(V_);
+        for (vertex_index_t v = 0; v < V_; v++)
+            color_[v] = color[v].load(std::memory_order_relaxed);
+    }
+
+
+    static void gather_(std::vector<std::vector<vertex_index_t>>& locals, std::vector<vertex_index_t>& out) {
+        out.clear();
+        for (auto& l : locals) {
+            out.insert(out.end(), l.begin(), l.end());
+            l.clear();
+        }
+    }
+
+
+    void countColors_() {
+        numColors_ = 0;
+        for (auto c : color_)
+            numColors_ = std::max(numColors_, vertex_index_t(c + 1));
+        counts_.assign(numColors_, 0);
+        for (auto c : color_)
+            ++counts_[c];
+    }
+
+
+private:
+    vertex_index_t V_;
+    std::vector<std::size_t> first_; // 简单图的CSR，顶点v的邻接点为adj_[first_[v], first_[v + 1])
+    std::vector<vertex_index_t> adj_;
+    std::vector<vertex_index_t> color_;
+    std::vector<std::size_t> counts_;
+    vertex_index_t numColors_;
+    unsigned rounds_;
+};
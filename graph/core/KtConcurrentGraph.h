@@ -0,0 +1,232 @@
+#pragma once
+#include <vector>
+#include <tuple>
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <algorithm>
+#include <assert.h>
+#include "KtGraph.h"
+#include "KtFlatGraphVectorImpl.h"
+#include "../base/parallel_for.h"
+
+
+// 支持多线程并发构建的稀疏图，用于多个解析线程同时导入顶点和边
+// addVertex、addVertices、addEdge均可由多个线程并发调用：
+//   顶点行分段存储，各段的长度依次倍增，新增顶点时已有的行不会移动，段按需以CAS分配；
+//   各行的出边为独立的vector，写入时持有该行所在分条（stripe）的互斥锁，不同行的写入基本不会相互阻塞；
+//   顶点数和边数为原子计数
+// 构建完成后，调用freeze将其转换为不可变的图（缺省为flat图，即CSR存储）以供查询，
+// 此后仍可继续添加，再次freeze得到新的快照
+// 无向图的每条边在两端各存储一次（自环只存储一次），size()按一次计
+// 注意：freeze、outdegree、outedges等读操作不能与写操作并发进行；同一顶点的出边次序取决于各线程写入的先后
+template<typename EDGE_TYPE, bool digraph = false, typename VERTEX_INDEX = unsigned, typename EDGE_INDEX = std::size_t>
+class KtConcurrentGraph
+{
+public:
+    using edge_type = EDGE_TYPE;
+    using vertex_index_t = VERTEX_INDEX;
+    using edge_index_t = EDGE_INDEX;
+    using adj_entry = std::pair<vertex_index_t, edge_type>; // (to, edge)
+    using row_type = std::vector<adj_entry>;
+
+    // freeze缺省生成的图类型：方向一致、允许平行边的flat图
+    using frozen_type = KtGraph<KtFlatGraphVectorImpl<EDGE_TYPE, void, VERTEX_INDEX, EDGE_INDEX>, digraph, true, false>;
+
+    constexpr static bool isDigraph() { return digraph; }
+
+
+    // @nv: 初始顶点数
+    // @stripes: 行锁的分条数，取为2的幂
+    explicit KtConcurrentGraph(vertex_index_t nv = 0, unsigned stripes = 4096)
+        : stripeMask_(roundup_(std::max(stripes, 1u)) - 1), locks_(new std::mutex[stripeMask_ + 1]) {
+        for (auto& s : segs_)
+            s.store(nullptr, std::memory_order_relaxed);
+        addVertices(nv);
+    }
+
+    ~KtConcurrentGraph() {
+        for (auto& s : segs_)
+            delete[] s.load(std::memory_order_relaxed);
+    }
+
+    KtConcurrentGraph(const KtConcurrentGraph&) = delete;
+    KtConcurrentGraph& operator=(const KtConcurrentGraph&) = delete;
+
+
+    // 图的阶，即已分配的顶点数量
+    vertex_index_t order() const { return V_.load(std::memory_order_acquire); }
+
+    // 边的数量
+    edge_index_t size() const { return E_.load(std::memory_order_acquire); }
+
+
+    // 新增1个顶点，返回其序号。线程安全
+    vertex_index_t addVertex() {
+        return addVertices(1);
+    }
+
+    // 新增n个序号连续的顶点，返回首个顶点的序号。线程安全
+    vertex_index_t addVertices(vertex_index_t n) {
+        auto first = V_.fetch_add(n, std::memory_order_acq_rel);
+        if (n > 0) { // 预先分配所涉及的段，之后对这些顶点的写入无需再分配
+            auto last = locate_(first + n - 1).first;
+            for (auto s = locate_(first).first; s <= last; s++)
+                segment_(s);
+        }
+        return first;
+    }
+
+
+    // 添加边(from, to)，from和to须为已分配的顶点。线程安全
+    void addEdge(vertex_index_t from, vertex_index_t to, const edge_type& edge) {
+        assert(from < order() && to < order());
+
+        append_(from, to, edge);
+        if (!digraph && from != to)
+            append_(to, from, edge);
+
+        E_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+
+    // 预留顶点v的出边存储。线程安全
+    void reserveEdges(vertex_index_t v, std::size_t ne) {
+        std::lock_guard<std::mutex> lock(locks_[v & stripeMask_]);
+        row_(v).reserve(ne);
+    }
+
+
+    // 以下读操作不能与写操作并发
+
+    edge_index_t outdegree(vertex_index_t v) const {
+        return static_cast<edge_index_t>(row_(v).size());
+    }
+
+    const row_type& outedges(vertex_index_t v) const {
+        return row_(v);
+    }
+
+
+    // 转换为GRAPH类型的图，GRAPH须支持assign批量赋值（flat图的时间复杂度为O(V+E)）
+    // 对于frozen_type，由各行长度直接分配CSR存储，再按行并行原位写入；其他类型则按行并行收集边后assign
+    // @nthreads: 线程数，为0时取hardware_threads()
+    template<typename GRAPH = frozen_type>
+    GRAPH freeze(unsigned nthreads = 0) const {
+        static_assert(GRAPH::isDigraph() == digraph, "direction mismatch");
+
+        if constexpr (std::is_same_v<GRAPH, frozen_type>) {
+            using csr_index_t = typename GRAPH::edge_index_t;
+            const vertex_index_t nv = order();
+
+            // 行内容与CSR一致：无向图的每条边在两端各存一次，多出的一份即为反边
+            std::vector<csr_index_t> offset(std::size_t(nv) + 1, 0);
+            for (vertex_index_t v = 0; v < nv; v++)
+                offset[v + 1] = offset[v] + static_cast<csr_index_t>(row_(v).size());
+            GRAPH g;
+            g.bulkAllocate(nv, offset, offset[nv] - static_cast<csr_index_t>(size()));
+
+            parallel_for(vertex_index_t(0), nv, [&](vertex_index_t v) {
+                auto iter = g.outedges(v).begin();
+                for (auto& e : row_(v)) {
+                    auto&& x = *iter++;
+                    x = e.second;
+                    edge_traits<std::decay_t<decltype(x)>>::to(x) = e.first;
+                }
+            }, nthreads, vertex_index_t(1024));
+
+            return g;
+        }
+        else {
+            return freezeByAssign_<GRAPH>(nthreads);
+        }
+    }
+
+
+private:
+
+    // 收集各行的边为三元组(from, to, edge)，再由GRAPH::assign构建
+    template<typename GRAPH>
+    GRAPH freezeByAssign_(unsigned nthreads) const {
+        using triple_t = std::tuple<vertex_index_t, vertex_index_t, edge_type>;
+
+        const vertex_index_t nv = order();
+
+        // 无向图的每条边只取一次：取to >= from的那一份
+        auto keep = [](vertex_index_t from, vertex_index_t to) { return digraph || to >= from; };
+
+        std::vector<std::size_t> offset(std::size_t(nv) + 1, 0);
+        parallel_for(vertex_index_t(0), nv, [&](vertex_index_t v) {
+            std::size_t n(0);
+            for (auto& e : row_(v))
+                if (keep(v, e.first))
+                    ++n;
+            offset[v + 1] = n;
+        }, nthreads, vertex_index_t(1024));
+        for (vertex_index_t v = 0; v < nv; v++)
+            offset[v + 1] += offset[v];
+
+        std::vector<triple_t> es(offset[nv]);
+        parallel_for(vertex_index_t(0), nv, [&](vertex_index_t v) {
+            auto pos = offset[v];
+            for (auto& e : row_(v))
+                if (keep(v, e.first))
+                    es[pos++] = triple_t(v, e.first, e.second);
+        }, nthreads, vertex_index_t(1024));
+
+        GRAPH g;
+        g.assign(nv, es.begin(), es.end());
+        return g;
+    }
+
+
+    constexpr static unsigned base_ = 1024; // 首段的行数
+    constexpr static unsigned maxSegs_ = 48;
+
+    static unsigned roundup_(unsigned x) {
+        unsigned p(1);
+        while (p < x) p <<= 1;
+        return p;
+    }
+
+    // 顶点v所在的段及其在段内的偏移：第s段包含base_ * 2^s行，起始于base_ * (2^s - 1)
+    static std::pair<unsigned, std::size_t> locate_(vertex_index_t v) {
+        std::size_t x = std::size_t(v) / base_ + 1;
+        unsigned s(0);
+        while (x >>= 1) ++s;
+        return { s, std::size_t(v) - base_ * ((std::size_t(1) << s) - 1) };
+    }
+
+    // 返回第s段，若尚未分配则分配之；多个线程同时分配时，仅一个线程的结果被采用
+    row_type* segment_(unsigned s) const {
+        assert(s < maxSegs_);
+        auto seg = segs_[s].load(std::memory_order_acquire);
+        if (seg == nullptr) {
+            auto fresh = new row_type[std::size_t(base_) << s];
+            if (segs_[s].compare_exchange_strong(seg, fresh, std::memory_order_acq_rel))
+                seg = fresh;
+            else
+                delete[] fresh;
+        }
+        return seg;
+    }
+
+    row_type& row_(vertex_index_t v) const {
+        auto loc = locate_(v);
+        return segment_(loc.first)[loc.second];
+    }
+
+    void append_(vertex_index_t from, vertex_index_t to, const edge_type& edge) {
+        auto& row = row_(from);
+        std::lock_guard<std::mutex> lock(locks_[from & stripeMask_]);
+        row.emplace_back(to, edge);
+    }
+
+
+private:
+    mutable std::atomic<row_type*> segs_[maxSegs_];
+    std::atomic<vertex_index_t> V_{ 0 };
+    std::atomic<edge_index_t> E_{ 0 };
+    const unsigned stripeMask_;
+    std::unique_ptr<std::mutex[]> locks_;
+};
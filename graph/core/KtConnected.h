@@ -1,7 +1,7 @@
 #pragma once
 #include "KtBfsIter.h"
 
-// ͼͨ
+// 无向图的连通分量
 
 template<typename GRAPH>
 class KtConnected
@@ -9,37 +9,40 @@ class KtConnected
     static_assert(!GRAPH::isDigraph(), "KtConnected cannot work for digraph.");
 
 public:
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+    constexpr static vertex_index_t null_vertex = GRAPH::null_vertex;
+
     KtConnected(const GRAPH& g) 
         : count_(0),
-          cc_(g.order(), -1) {
+          cc_(g.order(), null_vertex) {
 
         KtBfsIter<const GRAPH, true> bfs(g, 0);
-        unsigned id(-1);
+        vertex_index_t id(null_vertex);
         for (; !bfs.isEnd(); ++bfs) {
-            if (bfs.from() == -1)
+            if (bfs.from() == null_vertex)
                 ++id;
             cc_[*bfs] = id;
         }
 
-        count_ = id + 1;
+        count_ = static_cast<vertex_index_t>(id + 1);
     }
 
 
-    // ͨ
+    // 返回连通分量数量
     auto count() const { return count_; }
 
-    // vͶwǷͨ
-    bool reachable(unsigned v, unsigned w) const {
+    // 顶点v和顶点w是否连通
+    bool reachable(vertex_index_t v, vertex_index_t w) const {
         return cc_[v] == cc_[w];;
     }
 
-    // ؽڵvͨid, 0 <= id < count().
-    unsigned operator[](unsigned v) const {
+    // 返回节点v所在连通分量的id, 0 <= id < count().
+    vertex_index_t operator[](vertex_index_t v) const {
         return cc_[v];
     }
 
 
 private:
-    unsigned count_; // ͨ
-    std::vector<unsigned> cc_; // cc_[i]ʾiӦͨ
+    vertex_index_t count_; // 连通分量的数量
+    std::vector<vertex_index_t> cc_; // cc_[i]表示顶点i对应的连通分量序号
 };
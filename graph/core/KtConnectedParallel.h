@@ -0,0 +1,143 @@
+#pragma once
+#include <vector>
+#include <random>
+#include <unordered_map>
+#include "KtAdjIter.h"
+#include "../base/parallel_for.h"
+#include "../base/concurrent_union_find_set.h"
+
+
+// 基于Afforest算法的并行连通分量计算，接口与KtConnected相同
+// 算法分为3个阶段：
+//   1.邻居采样：各顶点只与其前rounds个邻接顶点合并，以很小的代价得到大部分连通关系
+//   2.估计最大分量：随机抽样若干顶点，取出现最多的集合作为最大分量（通常是巨型分量）
+//   3.收尾：对不属于最大分量的顶点，处理其余下的邻接边
+// 由于无向图的每条边在两端顶点都有记录，跳过最大分量内部顶点的邻接边不会丢失连通关系
+// 连通分量的编号与KtConnected一致，即按各分量最小顶点的次序编号
+template<typename GRAPH>
+class KtConnectedAfforest
+{
+    static_assert(!GRAPH::isDigraph(), "KtConnectedAfforest cannot work for digraph.");
+
+public:
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+    constexpr static vertex_index_t null_vertex = GRAPH::null_vertex;
+
+    // @nthreads: 线程数，为0时取hardware_threads()
+    // @rounds: 邻居采样的轮数
+    KtConnectedAfforest(const GRAPH& g, unsigned nthreads = 0, unsigned rounds = 2)
+        : count_(0), cc_(g.order()) {
+        const vertex_index_t V = g.order();
+        concurrent_union_find_set<vertex_index_t> uf(V);
+
+        // 邻居采样
+        for (unsigned r = 0; r < rounds; r++) {
+            parallel_for(vertex_index_t(0), V, [&g, &uf, r](vertex_index_t v) {
+                auto iter = KtAdjIter(g, v);
+                for (unsigned i = 0; i < r && !iter.isEnd(); i++)
+                    ++iter;
+                if (!iter.isEnd())
+                    uf.unite(v, *iter);
+            }, nthreads);
+        }
+
+        // 估计最大分量
+        auto c = sampleFrequent_(uf);
+
+        // 收尾
+        parallel_for(vertex_index_t(0), V, [&g, &uf, rounds, c](vertex_index_t v) {
+            if (uf.find(v) == c)
+                return;
+
+            auto iter = KtAdjIter(g, v);
+            for (unsigned i = 0; i < rounds && !iter.isEnd(); i++)
+                ++iter;
+            for (; !iter.isEnd(); ++iter)
+                uf.unite(v, *iter);
+        }, nthreads);
+
+        // 按最小顶点的次序编号，各集合的根即为其最小顶点
+        uf.compress();
+        for (vertex_index_t v = 0; v < V; v++) {
+            auto root = uf.parent(v);
+            cc_[v] = root == v ? count_++ : cc_[root];
+        }
+    }
+
+
+    // 返回连通分量数量
+    auto count() const { return count_; }
+
+    // 顶点v和顶点w是否连通
+    bool reachable(vertex_index_t v, vertex_index_t w) const {
+        return cc_[v] == cc_[w];
+    }
+
+    // 返回节点v所在连通分量的id, 0 <= id < count().
+    vertex_index_t operator[](vertex_index_t v) const {
+        return cc_[v];
+    }
+
+private:
+
+    // 随机抽样，返回出现次数最多的集合id
+    static vertex_index_t sampleFrequent_(concurrent_union_find_set<vertex_index_t>& uf) {
+        if (uf.size() == 0) return null_vertex;
+
+        constexpr unsigned num_samples = 1024;
+        std::mt19937 rng(13);
+        std::uniform_int_distribution<vertex_index_t> dist(0, uf.size() - 1);
+        std::unordered_map<vertex_index_t, unsigned> freq;
+        vertex_index_t c(null_vertex);
+        unsigned maxFreq(0);
+        for (unsigned i = 0; i < num_samples; i++) {
+            auto root = uf.find(dist(rng));
+            if (++freq[root] > maxFreq)
+                maxFreq = freq[root], c = root;
+        }
+
+        return c;
+    }
+
+private:
+    vertex_index_t count_; // 连通分量的数量
+    std::vector<vertex_index_t> cc_; // cc_[i]表示顶点i对应的连通分量序号
+};
+
+
+// 增量连通性：不断插入边，并随时查询两顶点是否连通
+// addEdge和connected均可由多个线程并发调用
+template<typename VERTEX_INDEX = unsigned>
+class KtConnectedIncremental
+{
+public:
+    using vertex_index_t = VERTEX_INDEX;
+
+    explicit KtConnectedIncremental(vertex_index_t order)
+        : uf_(order), count_(order) {}
+
+    vertex_index_t order() const { return uf_.size(); }
+
+    // 插入边(v, w)，返回true表示合并了2个连通分量
+    bool addEdge(vertex_index_t v, vertex_index_t w) {
+        if (!uf_.unite(v, w))
+            return false;
+        count_.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // 顶点v和顶点w是否连通
+    bool connected(vertex_index_t v, vertex_index_t w) {
+        return uf_.connected(v, w);
+    }
+
+    // 返回连通分量数量
+    vertex_index_t count() const { return count_.load(std::memory_order_relaxed); }
+
+    // 返回顶点v所在连通分量的代表顶点（分量中的最小顶点）
+    vertex_index_t find(vertex_index_t v) { return uf_.find(v); }
+
+private:
+    concurrent_union_find_set<vertex_index_t> uf_;
+    std::atomic<vertex_index_t> count_;
+};
@@ -0,0 +1,556 @@
+#pragma once
+#include <vector>
+#include <queue>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <algorithm>
+#include <functional>
+#include <assert.h>
+#include "KtWeightor.h"
+#include "KtAdjIter.h"
+#include "../base/KtStampedVector.h"
+
+
+// 收缩层次（Contraction Hierarchies），适用于非负权值静态图的点对点最短路径查询
+// 预处理阶段按重要性由低到高依次收缩顶点v：对于v的每对邻居u->v->w，
+// 若不存在绕开v且不长于w(u, v) + w(v, w)的见证路径（witness），则插入捷径u->w。
+// 收缩顺序即顶点的层级（rank），由边差（插入的捷径数 - 删除的边数）与已删除邻居数决定，并惰性更新
+// 收缩完成后，每条边（含捷径）只保存在层级较低的端点：
+//   up_为向上图，保存v->w（rank(v) < rank(w)），供正向搜索使用
+//   dn_为向下图的逆，保存u->v（rank(u) > rank(v)）于v处，供反向搜索使用
+// 查询时在两个图上分别由s和t进行只向上的双向Dijkstra，搜索空间通常仅有数百个顶点
+// 捷径记录了被收缩的中间顶点，可递归展开得到原图路径
+//
+// NOTE: WEIGHTOR须为最小化的加法权值，即default_wtor或unit_min_wtor一类
+template<typename GRAPH, class WEIGHTOR = default_wtor<GRAPH>>
+class KtContractionHierarchy
+{
+public:
+    using weight_type = typename WEIGHTOR::weight_type;
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+    constexpr static vertex_index_t null_vertex = GRAPH::null_vertex;
+
+
+    // 构造空的层次，须调用load载入预处理数据
+    KtContractionHierarchy()
+        : order_(0), inf_(WEIGHTOR{}.worst_weight), dist_(inf_), meet_(null_vertex), settled_(0) {}
+
+    // @witnessLimit: 见证搜索最多出栈的顶点数。搜索不完全时将插入多余的捷径，不影响正确性
+    explicit KtContractionHierarchy(const GRAPH& g, unsigned witnessLimit = 100)
+        : order_(g.order()), inf_(WEIGHTOR{}.worst_weight), dist_(inf_), meet_(null_vertex), settled_(0) {
+        contract_(g, witnessLimit);
+    }
+
+
+    vertex_index_t order() const { return order_; }
+
+    // 顶点v的层级，即其收缩次序
+    vertex_index_t rank(vertex_index_t v) const { return rank_[v]; }
+
+    // 向上图和向下图的边数（含捷径）
+    std::size_t size() const { return up_.arcs.size() + dn_.arcs.size(); }
+
+
+    // 查询s到t的最短距离，s不可达t时返回worst_weight，s == t时返回0
+    weight_type search(vertex_index_t s, vertex_index_t t);
+
+    // 返回最近一次查询的最短距离
+    weight_type distance() const { return dist_; }
+
+    // 返回最近一次查询的最短路径(逆序)，捷径已展开为原图的边，不可达时返回空
+    std::vector<vertex_index_t> pathR() const;
+
+    // 最近一次查询出栈的顶点数（两个方向之和）
+    std::size_t settled() const { return settled_; }
+
+
+    // 多对多距离表，返回结果的第i行第j列为sources[i]到targets[j]的最短距离
+    // 先由各目标顶点进行反向搜索，将距离存入所经顶点的桶，再由各源顶点进行正向搜索并扫描桶
+    std::vector<std::vector<weight_type>> table(const std::vector<vertex_index_t>& sources,
+        const std::vector<vertex_index_t>& targets);
+
+
+    // 以二进制格式保存预处理数据，各字段逐一以本机字节序写出：
+    //   头部：顶点数V(uint64)、vertex_index_t的字节数(uint32)、weight_type的字节数(uint32)
+    //   rank：V个vertex_index_t
+    //   向上图、向下图：边数E(uint64)，V + 1个偏移(uint64)，E条边的(to, wt, mid)
+    void save(std::ostream& os) const {
+        write_(os, std::uint64_t(order_));
+        write_(os, std::uint32_t(sizeof(vertex_index_t)));
+        write_(os, std::uint32_t(sizeof(weight_type)));
+        for (auto r : rank_)
+            write_(os, r);
+        saveCsr_(os, up_);
+        saveCsr_(os, dn_);
+    }
+
+    // 载入由save保存的预处理数据，数据不合法或读取失败时返回false，且不改变现有数据
+    // 分配内存前先以流的剩余长度检查V和E，并检查rank为排列、偏移单调、各边的端点和中间顶点有效
+    bool load(std::istream& is) {
+        std::uint64_t V;
+        std::uint32_t indexBytes, weightBytes;
+        if (!read_(is, V) || !read_(is, indexBytes) || !read_(is, weightBytes))
+            return false;
+        if (indexBytes != sizeof(vertex_index_t) || weightBytes != sizeof(weight_type))
+            return false;
+        if (V > null_vertex || V > remaining_(is) / sizeof(vertex_index_t))
+            return false;
+
+        std::vector<vertex_index_t> rank(V);
+        std::vector<bool> used(V, false);
+        for (auto& r : rank) {
+            if (!read_(is, r) || r >= V || used[r])
+                return false;
+            used[r] = true;
+        }
+
+        KpCsr_ up, dn;
+        if (!loadCsr_(is, up, V) || !loadCsr_(is, dn, V))
+            return false;
+
+        order_ = vertex_index_t(V);
+        rank_.swap(rank);
+        std::swap(up_, up);
+        std::swap(dn_, dn);
+
+        // 复位查询状态，旧的搜索空间按原图的阶分配，一并释放
+        fwd_ = KpSpace_(), bwd_ = KpSpace_();
+        dist_ = inf_, meet_ = null_vertex, settled_ = 0;
+        return true;
+    }
+
+
+private:
+
+    struct KpArc_
+    {
+        vertex_index_t to;
+        weight_type wt;
+        vertex_index_t mid; // 捷径的中间顶点，原图的边为null_vertex
+    };
+
+    struct KpCsr_
+    {
+        std::vector<std::size_t> offset;
+        std::vector<KpArc_> arcs;
+    };
+
+    // 单个方向的搜索空间
+    struct KpSpace_
+    {
+        KtStampedVector<weight_type> dist;
+        KtStampedVector<vertex_index_t> parent;
+        KtStampedVector<std::uint8_t> settled;
+
+        void prepare(vertex_index_t V, weight_type inf) {
+            if (dist.size() < V) {
+                dist.resize(V);
+                parent.resize(V);
+                settled.resize(V);
+            }
+            dist.reset(inf);
+            parent.reset(null_vertex);
+            settled.reset();
+        }
+    };
+
+    using element_type = std::pair<weight_type, vertex_index_t>;
+    using priority_queue = std::priority_queue<element_type, std::vector<element_type>, std::greater<element_type>>;
+
+
+    void contract_(const GRAPH& g, unsigned witnessLimit);
+
+    // 在adj上由s进行只向上的Dijkstra，对每个出栈顶点v调用visit(v, d)
+    template<typename VISIT>
+    void upwardSearch_(const KpCsr_& adj, vertex_index_t s, KpSpace_& space, VISIT visit) const {
+        space.prepare(order_, inf_);
+        priority_queue pq;
+        space.dist.set(s, weight_type(0));
+        pq.emplace(weight_type(0), s);
+        while (!pq.empty()) {
+            auto v = pq.top().second; pq.pop();
+            if (space.settled.isMarked(v)) continue;
+            space.settled.mark(v);
+            visit(v, space.dist[v]);
+            for (auto i = adj.offset[v]; i < adj.offset[v + 1]; i++) {
+                auto& a = adj.arcs[i];
+                auto d = space.dist[v] + a.wt;
+                if (d < space.dist[a.to]) {
+                    space.dist.set(a.to, d);
+                    pq.emplace(d, a.to);
+                }
+            }
+        }
+    }
+
+    // 在adj[v]中查找到w的边
+    static const KpArc_* findArc_(const KpCsr_& adj, vertex_index_t v, vertex_index_t w) {
+        for (auto i = adj.offset[v]; i < adj.offset[v + 1]; i++)
+            if (adj.arcs[i].to == w)
+                return &adj.arcs[i];
+        return nullptr;
+    }
+
+    // 将边u->w（可能是捷径）展开为原图路径，追加到path（不含u）
+    void unpack_(vertex_index_t u, vertex_index_t w, std::vector<vertex_index_t>& path) const;
+
+
+    constexpr static std::size_t arc_bytes = 2 * sizeof(vertex_index_t) + sizeof(weight_type); // 每条边在文件中的字节数
+
+    static void saveCsr_(std::ostream& os, const KpCsr_& csr) {
+        write_(os, std::uint64_t(csr.arcs.size()));
+        for (auto off : csr.offset)
+            write_(os, std::uint64_t(off));
+        for (auto& a : csr.arcs) {
+            write_(os, a.to);
+            write_(os, a.wt);
+            write_(os, a.mid);
+        }
+    }
+
+    static bool loadCsr_(std::istream& is, KpCsr_& csr, std::uint64_t V) {
+        std::uint64_t E;
+        if (!read_(is, E))
+            return false;
+
+        auto avail = remaining_(is);
+        if (V + 1 > avail / sizeof(std::uint64_t) || E > (avail - (V + 1) * sizeof(std::uint64_t)) / arc_bytes)
+            return false;
+
+        csr.offset.resize(V + 1);
+        for (std::size_t v = 0; v <= V; v++) {
+            std::uint64_t off;
+            if (!read_(is, off) || off > E || (v == 0 ? off != 0 : off < csr.offset[v - 1]))
+                return false;
+            csr.offset[v] = std::size_t(off);
+        }
+        if (csr.offset.back() != E)
+            return false;
+
+        csr.arcs.resize(E);
+        for (auto& a : csr.arcs) {
+            if (!read_(is, a.to) || !read_(is, a.wt) || !read_(is, a.mid))
+                return false;
+            if (a.to >= V || (a.mid != null_vertex && a.mid >= V))
+                return false;
+        }
+
+        return true;
+    }
+
+    // 流中尚未读取的字节数，流不支持定位时返回最大值（此时仅靠读取失败来发现截断）
+    static std::uint64_t remaining_(std::istream& is) {
+        auto pos = is.tellg();
+        if (pos == std::istream::pos_type(-1))
+            return std::uint64_t(-1);
+        is.seekg(0, std::ios::end);
+        auto end = is.tellg();
+        is.seekg(pos);
+        return end == std::istream::pos_type(-1) || end < pos ? 0 : std::uint64_t(end - pos);
+    }
+
+    template<typename T>
+    static void write_(std::ostream& os, const T& val) {
+        os.write(reinterpret_cast<const char*>(&val), sizeof(T));
+    }
+
+    template<typename T>
+    static bool read_(std::istream& is, T& val) {
+        return bool(is.read(reinterpret_cast<char*>(&val), sizeof(T)));
+    }
+
+
+private:
+    vertex_index_t order_;
+    const weight_type inf_;
+    std::vector<vertex_index_t> rank_;
+    KpCsr_ up_, dn_;
+
+    // 查询状态
+    KpSpace_ fwd_, bwd_;
+    weight_type dist_;
+    vertex_index_t meet_;
+    std::size_t settled_;
+};
+
+
+template<typename GRAPH, class WEIGHTOR>
+void KtContractionHierarchy<GRAPH, WEIGHTOR>::contract_(const GRAPH& g, unsigned witnessLimit)
+{
+    const vertex_index_t V = order_;
+
+    // 动态邻接表，忽略自环，平行边只保留最短的
+    std::vector<std::vector<KpArc_>> out(V), in(V);
+    auto addArc = [&out, &in](vertex_index_t u, vertex_index_t w, weight_type wt, vertex_index_t mid) {
+        for (auto& a : out[u])
+            if (a.to == w) {
+                if (wt < a.wt) {
+                    a.wt = wt, a.mid = mid;
+                    for (auto& b : in[w])
+                        if (b.to == u) b.wt = wt, b.mid = mid;
+                }
+                return false;
+            }
+        out[u].push_back({ w, wt, mid });
+        in[w].push_back({ u, wt, mid });
+        return true;
+    };
+
+    for (vertex_index_t v = 0; v < V; v++)
+        for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter)
+            if (*iter != v) {
+                weight_type wt = WEIGHTOR{}(iter.edge());
+                assert(!(wt < 0));
+                addArc(v, *iter, wt, null_vertex);
+            }
+
+    // 见证搜索：由u出发，绕开顶点x，在未收缩的顶点中进行受限的Dijkstra
+    // 全部目标顶点（x的出邻居）出栈或距离超过maxDist时即可停止
+    KtStampedVector<weight_type> wdist(V, inf_);
+    KtStampedVector<std::uint8_t> isTarget(V);
+    std::vector<element_type> heap; // 以堆算法操作，避免每次搜索重新分配
+    auto witness = [&out, &wdist, &isTarget, &heap](vertex_index_t u, vertex_index_t x,
+        weight_type maxDist, std::size_t targets, unsigned limit) {
+        wdist.reset();
+        heap.clear();
+        wdist.set(u, weight_type(0));
+        heap.emplace_back(weight_type(0), u);
+        unsigned settled(0);
+        while (!heap.empty() && settled < limit) {
+            std::pop_heap(heap.begin(), heap.end(), std::greater<element_type>());
+            auto d = heap.back().first, v = heap.back().second;
+            heap.pop_back();
+            if (wdist[v] < d) continue;
+            if (maxDist < d) break;
+            ++settled;
+            if (isTarget[v] && --targets == 0) break;
+            for (auto& a : out[v])
+                if (a.to != x && d + a.wt < wdist[a.to]) {
+                    wdist.set(a.to, d + a.wt);
+                    heap.emplace_back(d + a.wt, a.to);
+                    std::push_heap(heap.begin(), heap.end(), std::greater<element_type>());
+                }
+        }
+    };
+
+    // 收缩顶点v需要插入的捷径，结果存入shortcuts
+    std::vector<std::pair<vertex_index_t, KpArc_>> shortcuts;
+    auto findShortcuts = [&](vertex_index_t v, unsigned limit) {
+        shortcuts.clear();
+        weight_type maxOut(0);
+        isTarget.reset(0);
+        for (auto& b : out[v]) {
+            if (maxOut < b.wt) maxOut = b.wt;
+            isTarget.set(b.to, 1);
+        }
+        for (auto& a : in[v]) {
+            witness(a.to, v, a.wt + maxOut, out[v].size(), limit);
+            for (auto& b : out[v])
+                if (b.to != a.to && a.wt + b.wt < wdist[b.to])
+                    shortcuts.push_back({ a.to, { b.to, a.wt + b.wt, v } });
+        }
+    };
+
+    // 优先级：边差 + 已删除邻居数
+    // 估计优先级时以较小的搜索上限模拟收缩，真正收缩时再进行完整的见证搜索
+    const unsigned simLimit = std::max(witnessLimit / 5, 1u);
+    std::vector<int> deleted(V, 0);
+    auto priority = [&](vertex_index_t v) {
+        findShortcuts(v, simLimit);
+        return int(shortcuts.size()) - int(in[v].size() + out[v].size()) + deleted[v];
+    };
+
+    using pri_element = std::pair<int, vertex_index_t>;
+    std::priority_queue<pri_element, std::vector<pri_element>, std::greater<pri_element>> pq;
+    std::vector<int> pri(V); // 各顶点的当前优先级，与之不符的队列元素已过时
+    for (vertex_index_t v = 0; v < V; v++)
+        pq.emplace(pri[v] = priority(v), v);
+
+    rank_.assign(V, null_vertex);
+    std::vector<std::vector<KpArc_>> up(V), dn(V);
+    vertex_index_t next(0);
+    std::vector<vertex_index_t> neighbors;
+    while (!pq.empty()) {
+        auto v = pq.top().second;
+        bool stale = rank_[v] != null_vertex || pq.top().first != pri[v];
+        pq.pop();
+        if (stale) continue;
+
+        // 惰性更新：重新计算优先级，若不再是最小的，则重新入队
+        auto p = priority(v);
+        if (!pq.empty() && p > pq.top().first) {
+            pq.emplace(pri[v] = p, v);
+            continue;
+        }
+
+        // 收缩v：冻结其现有的边，插入捷径，并从邻居处删除v
+        if (simLimit < witnessLimit)
+            findShortcuts(v, witnessLimit);
+        rank_[v] = next++;
+        up[v] = out[v];
+        dn[v] = in[v];
+        for (auto& s : shortcuts)
+            addArc(s.first, s.second.to, s.second.wt, s.second.mid);
+
+        neighbors.clear();
+        for (auto& a : in[v]) {
+            auto& adj = out[a.to];
+            adj.erase(std::find_if(adj.begin(), adj.end(), [v](const KpArc_& x) { return x.to == v; }));
+            neighbors.push_back(a.to);
+        }
+        for (auto& b : out[v]) {
+            auto& adj = in[b.to];
+            adj.erase(std::find_if(adj.begin(), adj.end(), [v](const KpArc_& x) { return x.to == v; }));
+            neighbors.push_back(b.to);
+        }
+        std::vector<KpArc_>().swap(out[v]);
+        std::vector<KpArc_>().swap(in[v]);
+
+        std::sort(neighbors.begin(), neighbors.end());
+        neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+        for (auto w : neighbors) {
+            ++deleted[w];
+            auto p = priority(w);
+            if (p != pri[w])
+                pq.emplace(pri[w] = p, w);
+        }
+    }
+
+    // 转换为CSR
+    auto toCsr = [V](std::vector<std::vector<KpArc_>>& adj, KpCsr_& csr) {
+        csr.offset.assign(std::size_t(V) + 1, 0);
+        for (vertex_index_t v = 0; v < V; v++)
+            csr.offset[v + 1] = csr.offset[v] + adj[v].size();
+        csr.arcs.reserve(csr.offset[V]);
+        for (vertex_index_t v = 0; v < V; v++) {
+            csr.arcs.insert(csr.arcs.end(), adj[v].begin(), adj[v].end());
+            std::vector<KpArc_>().swap(adj[v]);
+        }
+    };
+    toCsr(up, up_);
+    toCsr(dn, dn_);
+}
+
+
+template<typename GRAPH, class WEIGHTOR>
+typename KtContractionHierarchy<GRAPH, WEIGHTOR>::weight_type
+KtContractionHierarchy<GRAPH, WEIGHTOR>::search(vertex_index_t s, vertex_index_t t)
+{
+    fwd_.prepare(order_, inf_);
+    bwd_.prepare(order_, inf_);
+    settled_ = 0;
+    dist_ = inf_;
+    meet_ = null_vertex;
+
+    priority_queue pqF, pqR;
+    fwd_.dist.set(s, weight_type(0)); pqF.emplace(weight_type(0), s);
+    bwd_.dist.set(t, weight_type(0)); pqR.emplace(weight_type(0), t);
+
+    while (!pqF.empty() || !pqR.empty()) {
+        // 扩展键值较小的一侧，较小键值不小于当前最优值时，两侧均无法再改进
+        bool forward = pqR.empty() || (!pqF.empty() && !(pqR.top().first < pqF.top().first));
+        auto& pq = forward ? pqF : pqR;
+        if (!(pq.top().first < dist_))
+            break;
+
+        auto& me = forward ? fwd_ : bwd_;
+        auto& other = forward ? bwd_ : fwd_;
+        auto& adj = forward ? up_ : dn_;
+
+        auto v = pq.top().second; pq.pop();
+        if (me.settled.isMarked(v)) continue;
+        me.settled.mark(v);
+        ++settled_;
+
+        if (other.dist[v] != inf_ && me.dist[v] + other.dist[v] < dist_)
+            dist_ = me.dist[v] + other.dist[v], meet_ = v;
+
+        for (auto i = adj.offset[v]; i < adj.offset[v + 1]; i++) {
+            auto& a = adj.arcs[i];
+            auto d = me.dist[v] + a.wt;
+            if (d < me.dist[a.to]) {
+                me.dist.set(a.to, d);
+                me.parent.set(a.to, v);
+                pq.emplace(d, a.to);
+            }
+        }
+    }
+
+    return dist_;
+}
+
+
+template<typename GRAPH, class WEIGHTOR>
+std::vector<typename GRAPH::vertex_index_t> KtContractionHierarchy<GRAPH, WEIGHTOR>::pathR() const
+{
+    std::vector<vertex_index_t> p;
+    if (meet_ == null_vertex)
+        return p;
+
+    // s -> meet的部分：沿正向搜索树回溯得到各段
+    std::vector<vertex_index_t> chain;
+    for (auto v = meet_; v != null_vertex; v = fwd_.parent[v])
+        chain.push_back(v);
+    p.push_back(chain.back());
+    for (auto i = chain.size() - 1; i > 0; i--)
+        unpack_(chain[i], chain[i - 1], p);
+
+    // meet -> t的部分：沿反向搜索树前进
+    for (auto v = meet_; bwd_.parent[v] != null_vertex; v = bwd_.parent[v])
+        unpack_(v, bwd_.parent[v], p);
+
+    std::reverse(p.begin(), p.end());
+    return p;
+}
+
+
+template<typename GRAPH, class WEIGHTOR>
+void KtContractionHierarchy<GRAPH, WEIGHTOR>::unpack_(vertex_index_t u, vertex_index_t w, std::vector<vertex_index_t>& path) const
+{
+    // 以显式栈展开，避免层次较深时递归过深
+    std::vector<std::pair<vertex_index_t, vertex_index_t>> stack;
+    stack.emplace_back(u, w);
+    while (!stack.empty()) {
+        auto a = stack.back().first, b = stack.back().second;
+        stack.pop_back();
+
+        // 边a->b保存在层级较低的端点处
+        auto arc = rank_[a] < rank_[b] ? findArc_(up_, a, b) : findArc_(dn_, b, a);
+        assert(arc);
+        if (arc->mid == null_vertex)
+            path.push_back(b);
+        else {
+            stack.emplace_back(arc->mid, b);
+            stack.emplace_back(a, arc->mid);
+        }
+    }
+}
+
+
+template<typename GRAPH, class WEIGHTOR>
+std::vector<std::vector<typename KtContractionHierarchy<GRAPH, WEIGHTOR>::weight_type>>
+KtContractionHierarchy<GRAPH, WEIGHTOR>::table(const std::vector<vertex_index_t>& sources,
+    const std::vector<vertex_index_t>& targets)
+{
+    std::vector<std::vector<weight_type>> res(sources.size(), std::vector<weight_type>(targets.size(), inf_));
+
+    // buckets[v]保存(j, d)，表示v到targets[j]的向上距离为d
+    std::vector<std::vector<std::pair<std::size_t, weight_type>>> buckets(order_);
+    for (std::size_t j = 0; j < targets.size(); j++)
+        upwardSearch_(dn_, targets[j], bwd_, [&buckets, j](vertex_index_t v, weight_type d) {
+            buckets[v].emplace_back(j, d);
+        });
+
+    for (std::size_t i = 0; i < sources.size(); i++) {
+        auto& row = res[i];
+        upwardSearch_(up_, sources[i], fwd_, [&buckets, &row](vertex_index_t v, weight_type d) {
+            for (auto& b : buckets[v])
+                if (d + b.second < row[b.first])
+                    row[b.first] = d + b.second;
+        });
+    }
+
+    meet_ = null_vertex; // 表查询破坏了最近一次点对点查询的状态
+    return res;
+}
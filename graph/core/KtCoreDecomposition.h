@@ -0,0 +1,174 @@
+#pragma once
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <algorithm>
+#include "../util/simple_csr.h"
+
+
+// 无向图的k-core分解，忽略自环和平行边
+// 顶点v的核数core(v)为包含v的、各顶点度均不小于k的极大子图（k-core）中最大的k
+// 单线程时采用Batagelj-Zaversnik的桶排序剥离算法：顶点按度置于各桶中，
+// 每次取出度最小的顶点，其邻接点的度减1并移入相邻的桶，时间复杂度为O(V + E)
+// 多线程时采用按层同步的并行剥离（PKC）：第k层反复并行移除度为k的顶点，
+// 邻接点的度以原子操作递减，恰好降至k的顶点进入下一轮，直至该层没有度为k的顶点
+// 两种方式的结果完全一致
+template<typename GRAPH>
+class KtCoreDecomposition
+{
+    static_assert(!GRAPH::isDigraph(), "KtCoreDecomposition must be instantiated with undirected Graph.");
+
+public:
+    using vertex_index_t = typename GRAPH::vertex_index_t; // 核数不超过最大度，亦以vertex_index_t表示
+    constexpr static vertex_index_t null_vertex = GRAPH::null_vertex;
+
+
+    // @nthreads: 线程数，为0时取hardware_threads()，为1时执行桶排序剥离
+    explicit KtCoreDecomposition(const GRAPH& g, unsigned nthreads = 0) : V_(g.order()) {
+        if (nthreads == 0) nthreads = hardware_threads();
+
+        std::vector<std::size_t> first;
+        std::vector<vertex_index_t> adj;
+        simple_csr(g, first, adj, nthreads);
+
+        core_.resize(V_);
+        if (nthreads == 1)
+            peel_(first, adj);
+        else
+            peelParallel_(first, adj, nthreads);
+    }
+
+
+    // 顶点v的核数
+    vertex_index_t coreNumber(vertex_index_t v) const { return core_[v]; }
+
+    const std::vector<vertex_index_t>& cores() const { return core_; }
+
+    // 图的退化度（degeneracy），即最大的核数
+    vertex_index_t maxCore() const {
+        return core_.empty() ? 0 : *std::max_element(core_.cbegin(), core_.cend());
+    }
+
+    // k-core的顶点集合
+    std::vector<vertex_index_t> kcore(vertex_index_t k) const {
+        std::vector<vertex_index_t> vs;
+        for (vertex_index_t v = 0; v < V_; v++)
+            if (core_[v] >= k)
+                vs.push_back(v);
+        return vs;
+    }
+
+
+private:
+
+    void peel_(const std::vector<std::size_t>& first, const std::vector<vertex_index_t>& adj) {
+        auto& deg = core_; // 剥离过程中deg即收敛为核数
+        vertex_index_t md(0);
+        for (vertex_index_t v = 0; v < V_; v++) {
+            deg[v] = vertex_index_t(first[v + 1] - first[v]);
+            md = std::max(md, deg[v]);
+        }
+
+        // bin[d]为度为d的顶点在vert中的起始位置，vert按度递增排列，pos为顶点在vert中的位置
+        std::vector<std::size_t> bin(md + 2, 0);
+        for (vertex_index_t v = 0; v < V_; v++)
+            ++bin[deg[v] + 1];
+        for (vertex_index_t d = 0; d <= md; d++)
+            bin[d + 1] += bin[d];
+
+        std::vector<vertex_index_t> vert(V_);
+        std::vector<std::size_t> pos(V_);
+        for (vertex_index_t v = 0; v < V_; v++) {
+            pos[v] = bin[deg[v]]++;
+            vert[pos[v]] = v;
+        }
+        for (vertex_index_t d = md; d > 0; d--)
+            bin[d] = bin[d - 1];
+        bin[0] = 0;
+
+        for (std::size_t i = 0; i < V_; i++) {
+            auto v = vert[i];
+            for (auto j = first[v]; j < first[v + 1]; j++) {
+                auto u = adj[j];
+                if (deg[u] > deg[v]) {
+                    // 将u与其所在桶的首个顶点交换，然后该桶的起始位置后移，u即落入前一个桶
+                    auto du = deg[u];
+                    auto pu = pos[u], pw = bin[du];
+                    auto w = vert[pw];
+                    if (u != w) {
+                        pos[u] = pw, vert[pu] = w;
+                        pos[w] = pu, vert[pw] = u;
+                    }
+                    ++bin[du];
+                    --deg[u];
+                }
+            }
+        }
+    }
+
+
+    void peelParallel_(const std::vector<std::size_t>& first, const std::vector<vertex_index_t>& adj, unsigned nthreads) {
+        std::unique_ptr<std::atomic<vertex_index_t>[]> deg(new std::atomic<vertex_index_t>[V_]);
+        for (vertex_index_t v = 0; v < V_; v++)
+            deg[v].store(vertex_index_t(first[v + 1] - first[v]), std::memory_order_relaxed);
+
+        std::vector<std::vector<vertex_index_t>> locals(nthreads);
+        auto gather = [&locals](std::vector<vertex_index_t>& out) {
+            out.clear();
+            for (auto& l : locals) {
+                out.insert(out.end(), l.begin(), l.end());
+                l.clear();
+            }
+        };
+
+        // remain为尚未剥离的顶点，每层开始时从中分离出度最小的顶点作为该层的初始前沿
+        std::vector<vertex_index_t> remain(V_), frontier, rest;
+        for (vertex_index_t v = 0; v < V_; v++)
+            remain[v] = v;
+
+        while (!remain.empty()) {
+            vertex_index_t k(null_vertex);
+            for (auto v : remain)
+                k = std::min(k, deg[v].load(std::memory_order_relaxed));
+
+            frontier.clear(), rest.clear();
+            for (auto v : remain)
+                (deg[v].load(std::memory_order_relaxed) == k ? frontier : rest).push_back(v);
+            remain.swap(rest);
+
+            while (!frontier.empty()) {
+                parallel_blocks(std::size_t(0), frontier.size(), [&](unsigned tid, std::size_t b, std::size_t e) {
+                    auto& next = locals[tid];
+                    for (auto i = b; i < e; i++) {
+                        auto v = frontier[i];
+                        core_[v] = k;
+                        for (auto j = first[v]; j < first[v + 1]; j++) {
+                            auto u = adj[j];
+                            if (deg[u].load(std::memory_order_relaxed) > k) {
+                                auto d = deg[u].fetch_sub(1, std::memory_order_relaxed);
+                                if (d == k + 1)
+                                    next.push_back(u); // 恰好由本线程降至k，且只会发生一次
+                                else if (d <= k)
+                                    deg[u].fetch_add(1, std::memory_order_relaxed); // 与其他线程竞争时减过了头，复原
+                            }
+                        }
+                    }
+                }, nthreads);
+
+                gather(frontier);
+            }
+
+            // 在本层降至k的顶点已从remain移入前沿，将其剔除
+            rest.clear();
+            for (auto v : remain)
+                if (deg[v].load(std::memory_order_relaxed) > k)
+                    rest.push_back(v);
+            remain.swap(rest);
+        }
+    }
+
+
+private:
+    vertex_index_t V_;
+    std::vector<vertex_index_t> core_;
+};
@@ -1,13 +1,14 @@
 #pragma once
 #include <vector>
 #include <algorithm>
-#include "KtDfsIterX.h"
+#include "KtDfsKernel.h"
 
 
-// Ѱͼĸ
-// (cut-point)Ҳƹؽڵ(articulation point)ɾö㣬һͨͼֽΪཻͼ
-// ûиͼΪͨ(Biconnected)򶥵ͨ
-// ͨͼеÿһԶ㣬ཻ·
+// 寻找图的割点
+// 割点(cut-point)也称关节点(articulation point)，如果删除该顶点，将把一个连通图分解为至少两个不相交的子图
+// 没有割点的图称为重连通(Biconnected)或顶点连通
+// 重连通图中的每一对顶点，都由两条不相交的路径相连
+// 对于非连通图，返回各连通分量的割点
 template<typename GRAPH>
 class KtCutPoints
 {
@@ -15,38 +16,60 @@ public:
     using vertex_index_t = typename GRAPH::vertex_index_t;
 
     KtCutPoints(const GRAPH& g) {
-        vertex_index_t root(0);
-        unsigned sons_of_root(0); // ڵ
-
-        KtDfsIterX<const GRAPH, false> iter(g, root);
-        while (!iter.isEnd()) {
-            vertex_index_t p = iter.from();
-            if (p == root && iter.isTree()) // popping״̬ 
-                ++sons_of_root;
-
-            if (p != -1 && p != root/*ڵں洦*/ && iter.isPopping()) {
-                vertex_index_t w = *iter;
-                if (iter.lowIndex(w) >= iter.pushIndex(p))
-                    cutpoints_.push_back(p);
-            }
-
-            ++iter;
-        }
+        KtDfsKernel<GRAPH> dfs(g);
+        KpVisitor_ vis{ {}, dfs, std::vector<vertex_index_t>(g.order()), cutpoints_ };
+        dfs.runAll(vis);
 
-        if (sons_of_root > 1) cutpoints_.push_back(root);  // ڵжڵΪ
         std::sort(cutpoints_.begin(), cutpoints_.end());
         cutpoints_.erase(std::unique(cutpoints_.begin(), cutpoints_.end()), cutpoints_.end());
     }
 
-
     auto size() const { return cutpoints_.size(); }
     auto begin() const { return cutpoints_.cbegin(); }
     auto end() const { return cutpoints_.cend(); }
 
-    vertex_index_t operator[](unsigned idx) const {
+    vertex_index_t operator[](std::size_t idx) const {
         return cutpoints_[idx];
     }
 
+private:
+
+    struct KpVisitor_ : public KtDfsVisitor
+    {
+        const KtDfsKernel<GRAPH>& dfs;
+        std::vector<vertex_index_t> low;
+        std::vector<vertex_index_t>& cutpoints;
+        vertex_index_t root{ GRAPH::null_vertex };
+        vertex_index_t sonsOfRoot{ 0 }; // 根节点的子树数量
+
+        void start(vertex_index_t v) {
+            root = v, sonsOfRoot = 0;
+        }
+
+        void discover(vertex_index_t v) {
+            low[v] = dfs.pushIndex(v);
+        }
+
+        template<typename E>
+        void backEdge(vertex_index_t v, vertex_index_t w, const E&) {
+            low[v] = std::min(low[v], dfs.pushIndex(w));
+        }
+
+        void finish(vertex_index_t v, vertex_index_t p) {
+            if (p == GRAPH::null_vertex) { 
+                if (sonsOfRoot > 1) // 如果根节点有多个子树，根节点为割点
+                    cutpoints.push_back(v); 
+            }
+            else {
+                low[p] = std::min(low[p], low[v]);
+                if (p == root)
+                    ++sonsOfRoot;
+                else if (low[v] >= dfs.pushIndex(p))
+                    cutpoints.push_back(p);
+            }
+        }
+    };
+
 private:
     std::vector<vertex_index_t> cutpoints_;
 };
@@ -2,16 +2,17 @@
 #include <vector>
 #include <set>
 #include <assert.h>
+#include "KtTraversalSpace.h"
 
 
-// ͳһͼͼȱģܣͨģֱֶ֧ʽ
-// ģ
-//    -- stopAtPoppingΪtrueÿջʱͣûлᴦջ.
-//    -- fullGraphμKtBfsIter.
-//    -- modeEdgeģʽfalseΪģʽtrueΪߵģʽ
-//    -- stopAtPoppingǷջ
-// ģʽ£stopAtPoppingΪfalseʼ״̬ΪЧߣ ʱfrom()ʼ
-// ģʽ£stopAtPoppingΪtrueʼ״̬Էʼ㣬ʱfrom()-1*ʼ.
+// 统一有向图与无向图的深度优先遍历模板框架，通过模板参数可支持多种遍历范式。
+// 模板参数：
+//    -- stopAtPopping，若为true，则每个顶点出栈时迭代器暂停，用户有机会处理出栈顶点.
+//    -- fullGraph，参见KtBfsIter.
+//    -- modeEdge，迭代模式，false为顶点迭代模式，true为边迭代模式
+//    -- stopAtPopping，是否处理出栈情况
+// 边模式下，若stopAtPopping为false，初始状态即为有效边， 此时from()返回起始顶点
+// 边模式下，若stopAtPopping为true，初始状态仍返回起始顶点，此时from()返回-1，*操作符返回起始顶点.
 template<typename GRAPH, bool fullGraph = false, bool modeEdge = false, bool stopAtPopping = false>
 class KtDfsIter
 {
@@ -21,35 +22,29 @@ public:
     using edge_type = typename GRAPH::edge_type;
     using adj_vertex_iter = KtAdjIter<graph_type>;
     using const_edge_ref = decltype(std::declval<adj_vertex_iter>().edge());
-    constexpr static vertex_index_t null_vertex = -1;
+    constexpr static vertex_index_t null_vertex = graph_type::null_vertex;
 
-    constexpr static bool trace_multi_edges = !GRAPH::isDigraph() && GRAPH::isMultiEdges(); // ƽͼdfs׷ƽб
+    constexpr static bool trace_multi_edges = !GRAPH::isDigraph() && GRAPH::isMultiEdges(); // 对于无向平行图，dfs须追踪平行边
     using tracing_element_t = std::tuple<vertex_index_t, vertex_index_t, const_edge_ref>;
     using tracing_container_t = std::multiset<tracing_element_t>;
+    using space_type = KtTraversalSpace<vertex_index_t>;
 
 
-    // graph -- ͼ
-    // startVertex -- ʼ㣬-1ʾֻҪstartʼ
+    // graph -- 待遍历的图
+    // startVertex -- 遍历的起始顶点，-1表示只构建迭代器，需要另外调用start方法开始遍历
     KtDfsIter(GRAPH& graph, vertex_index_t startVertex)
-        : graph_(graph)
-        , v_(null_vertex)
-        , pushOrd_(graph.order(), -1)
-        , popOrd_(graph.order(), -1)
-        , pushIdx_(0)
-        , popIdx_(0) {
-        if (startVertex != null_vertex) 
-            start(startVertex);
+        : KtDfsIter(graph, startVertex, nullptr) {}
 
-        if constexpr (trace_multi_edges)
-            collectMultiEdges_();
-    }
+    // space -- 外部提供的工作空间，参见KtBfsIter
+    KtDfsIter(GRAPH& graph, vertex_index_t startVertex, space_type& space)
+        : KtDfsIter(graph, startVertex, &space) {}
 
     void operator++() {
         assert(!isEnd());
 
-        if (isPopping()) { // ջ
-            assert(popOrd_[v_] == -1);
-            popOrd_[v_] = popIdx_++;
+        if (isPopping()) { // 处理出栈顶点
+            assert(popOrd_()[v_] == null_vertex);
+            popOrd_().set(v_, popIdx_++);
             todo_.pop_back();
         }
         else {
@@ -61,7 +56,7 @@ public:
             }
 
             if (isPushing()) {
-                pushOrd_[v_] = pushIdx_++;
+                pushOrd_().set(v_, pushIdx_++);
                 todo_.push_back(adj_vertex_iter(graph_, v_));
             }
         }
@@ -69,11 +64,11 @@ public:
         fixStack_();
     }
 
-    // صǰĶ
+    // 返回当前正在游历的顶点
     vertex_index_t operator*() const { return v_; }
 
 
-    // 뵱ǰ㣨to㣩ɱߵfrom
+    // 与当前顶点（to顶点）构成边的from顶点
     vertex_index_t from() const {
         assert(!isEnd());
         return isPopping() ? grandpa_() :
@@ -81,8 +76,8 @@ public:
     }
 
 
-    // ر(from, to)ֵ
-    // TODO: ݲ֧޸Ȩֵ֧֣ͬpedges_
+    // 返回边(from, to)的值
+    // TODO: 暂不支持修改权值。若支持，须同步更新pedges_
     const_edge_ref edge() const {
         assert(!isEnd() && from() != null_vertex);
         return todo_.back().edge();
@@ -92,9 +87,9 @@ public:
     bool isEnd() const { return v_ == null_vertex; }
 
 
-    // Ӷvʼйȱ
+    // 从顶点v开始接续进行广度优先遍历
     void start(vertex_index_t v) {
-        assert(isEnd() && pushOrd_[v] == -1);
+        assert(isEnd() && pushOrd_()[v] == null_vertex);
         todo_.clear();
         todo_.push_back(adj_vertex_iter(graph_));
         v_ = v;
@@ -106,9 +101,9 @@ public:
     void erase() {
         assert(!isEnd() && from() != null_vertex);
 
-        if (isPopping()) { // ջ
-            assert(popOrd_[v_] == -1);
-            popOrd_[v_] = popIdx_++;
+        if (isPopping()) { // 处理出栈顶点
+            assert(popOrd_()[v_] == null_vertex);
+            popOrd_().set(v_, popIdx_++);
             todo_.pop_back();
         }
         else {
@@ -123,7 +118,7 @@ public:
 
 
     /*
-    BGLйߡرߡ±ߡߵĶ壺
+    BGL中关于树边、回边、下边、跨边的定义：
     - Tree edges are edges in the search tree(or forest) constructed by running a graph search algorithm over a graph. 
       An edge(u, v) is a tree edge if v was first discovered while exploring edge(u, v).
     - Back edges connect vertices to their ancestors in a search tree. 
@@ -133,83 +128,111 @@ public:
     - Cross edges are edges that do not fall into the above three categories.
     */
 
-    // ߣʾݹãһηʸýڵ㣩
+    // 树边，表示递归调用（即第一次访问该节点）
     bool isTree() const {
-        return pushOrd_[v_] == -1;
+        return pushOrd_()[v_] == null_vertex;
     }
 
 
-    // رߣʾǰڵǰڵ
+    // 回边，表示当前节点是前序节点的祖先
     bool isBack() const {
-        return !isTree() && !isPopping() && popOrd_[v_] == -1;
+        return !isTree() && !isPopping() && popOrd_()[v_] == null_vertex;
     }
 
 
-    // ±/ǰߣʾǰڵǰڵ
+    // 下边/前边，表示当前节点是前序节点的子孙
     bool isDown() const {
         //return !isTree() && !isBack() && pushOrd_[**this] > pushOrd_[from()];
-        assert(pushOrd_[from()] != -1);
-        return static_cast<int>(pushOrd_[v_]) > static_cast<int>(pushOrd_[from()]);
+        assert(pushOrd_()[from()] != null_vertex);
+        return pushOrd_()[v_] != null_vertex && pushOrd_()[v_] > pushOrd_()[from()];
     }
 
 
-    // ߣʾǰڵȲǰڵȣҲ
+    // 跨边，表示当前节点既不是前序节点的祖先，也不是子孙
     bool isCross() const {
         //return !isTree() && !isBack() && !isDown();
-        return GRAPH::isDigraph() && popOrd_[v_] != -1; // ֻͼп
+        return GRAPH::isDigraph() && popOrd_()[v_] != null_vertex; // 只有有向图才有跨边
     }
 
-    // ǰڵǷջӦڵݹ
+    // 当前节点是否正在入栈，对应于递归的入口
     bool isPushing() const { return isTree(); }
 
-    // ǰڵǷڳջӦڵݹĳ
+    // 当前节点是否正在出栈，对应于递归的出口
     bool isPopping() const { 
         return stopAtPopping && !isPushing() && todo_.back().isEnd(); 
     }
 
-    // ȡvջ/ջº
-    unsigned pushIndex(vertex_index_t v) const { return pushOrd_[v]; }
-    unsigned popIndex(vertex_index_t v) const { return popOrd_[v]; }
+    // 获取顶点v的入栈/出栈次序，用于事后检测
+    // 未入栈/出栈的顶点返回null_vertex
+    vertex_index_t pushIndex(vertex_index_t v) const { return pushOrd_()[v]; }
+    vertex_index_t popIndex(vertex_index_t v) const { return popOrd_()[v]; }
 
-    // ȡǰջ/ջ
-    unsigned pushingIndex() const { return pushIdx_; }
-    unsigned poppingIndex() const { return popIdx_; }
+    // 获取当前的入栈/出栈序号
+    vertex_index_t pushingIndex() const { return pushIdx_; }
+    vertex_index_t poppingIndex() const { return popIdx_; }
 
 
+    // 返回第一个未遍历的顶点，已遍历顶点不会再变为未遍历，因此多次调用的总扫描代价为O(V)
     vertex_index_t firstUnvisited() const {
-        auto pos = std::find(pushOrd_.begin(), pushOrd_.end(), -1);
-        return pos == pushOrd_.end() ? null_vertex
-            : static_cast<vertex_index_t>(std::distance(pushOrd_.begin(), pos));
+        for (; scan_ < graph_.order(); scan_++)
+            if (pushOrd_()[scan_] == null_vertex)
+                return scan_;
+        return null_vertex;
     }
 
 
+protected:
+
+    // @nmarks: 迭代器所用工作空间顶点数组的数量，派生类可使用第2个之后的数组
+    KtDfsIter(GRAPH& graph, vertex_index_t startVertex, space_type* space, unsigned nmarks = 2)
+        : graph_(graph)
+        , v_(null_vertex)
+        , space_(space, graph.order(), nmarks, 0)
+        , pushIdx_(0)
+        , popIdx_(0)
+        , scan_(0) {
+        if (startVertex != null_vertex)
+            start(startVertex);
+
+        if constexpr (trace_multi_edges)
+            collectMultiEdges_();
+    }
+
+
+    // 返回第i个顶点数组，第0、1个分别记录各顶点的压栈/出栈顺序
+    auto& marks_(unsigned i) const { return space_.marks(i); }
+
+
 private:
 
-    // صǰ游㣬from֮from
+    auto& pushOrd_() const { return space_.marks(0); }
+    auto& popOrd_() const { return space_.marks(1); }
+
+    // 返回当前顶点的祖父顶点，即from之from
     vertex_index_t grandpa_() const {
         return todo_.size() > 2 ? todo_[todo_.size() - 2].from() : null_vertex;
     }
 
 
-    // ɾĺ
+    // 步进或删除的后处理
     void fixStack_();
 
-    // ǷҪǰ/
+    // 测试是否需要跳过当前顶点/边
     bool testSkip_() const;
 
-    // Ѽgraph_еƽб
+    // 搜集graph_中的所有平行边
     template<bool dummy = trace_multi_edges, typename = std::enable_if_t<dummy>>
     void collectMultiEdges_();
       
-    // ƽб<from, to, wt>ѱ
+    // 标记平行边<from, to, wt>已遍历
     template<bool dummy = trace_multi_edges, typename = std::enable_if_t<dummy>>
     void markMultiEdge_();
 
-    // ƽб<from, to, wt>״̬trueʾѱ
+    // 测试平行边<from, to, wt>遍历状态，返回true表示已遍历
     template<bool dummy = trace_multi_edges, typename = std::enable_if_t<dummy>>
     bool testMultiEdge_() const;
 
-    // λǰgraph_еλ
+    // 辅助函数：定位当前边在graph_中的位置
     template<bool dummy = trace_multi_edges, typename = std::enable_if_t<dummy>>
     typename tracing_container_t::const_iterator findMultiEdges_() const {
 
@@ -223,33 +246,34 @@ private:
 private:
     graph_type& graph_;
 
-    // ڽӶ
+    // 待处理的邻接顶点迭代器
     std::vector<adj_vertex_iter> todo_;
 
-    vertex_index_t v_; // ڱĶ
+    vertex_index_t v_; // 正在遍历的顶点
 
-    std::vector<unsigned> pushOrd_, popOrd_; // ڼ¼ѹջ/ջ˳
-    unsigned pushIdx_, popIdx_; // ǰѹջ/ջ
+    KtTraversalSpaceRef<space_type> space_; // 外部提供的工作空间，未提供时自建
+    vertex_index_t pushIdx_, popIdx_; // 当前压栈/出栈序号
+    mutable vertex_index_t scan_; // firstUnvisited的搜寻起始位置
 
-    tracing_container_t pedges_; // 洢graph_δƽб
+    tracing_container_t pedges_; // 存储graph_所有未遍历的平行边
 };
 
 
 template<typename GRAPH, bool fullGraph, bool modeEdge, bool stopAtPopping>
 void KtDfsIter<GRAPH, fullGraph, modeEdge, stopAtPopping>::fixStack_()
 {
-    // ⵱ǰǷҪ
+    // 检测当前顶点是否需要跳过
     while (todo_.size() > 1) {
         auto& iter = todo_.back();
 
-        // Ƴѽĵ
+        // 移除已结束的迭代器
         if (iter.isEnd()) {
             if constexpr (stopAtPopping) {
                 v_ = iter.from();
                 return; // stop at popping
             }
  
-            popOrd_[iter.from()] = popIdx_++;
+            popOrd_().set(iter.from(), popIdx_++);
             todo_.pop_back();
             continue;
         }
@@ -264,14 +288,14 @@ void KtDfsIter<GRAPH, fullGraph, modeEdge, stopAtPopping>::fixStack_()
         break;
     }
 
-    // v_ͽ
+    // 更新v_和接续遍历
     if (todo_.size() <= 1) {
-        v_ = null_vertex; // ֹ
+        v_ = null_vertex; // 设置终止标记
 
         if constexpr (fullGraph) {
-            unsigned unvisted = firstUnvisited();
+            vertex_index_t unvisted = firstUnvisited();
             if (unvisted != null_vertex)
-                start(unvisted); // 
+                start(unvisted); // 接续遍历
         }
     }
     else {
@@ -286,16 +310,16 @@ bool KtDfsIter<GRAPH, fullGraph, modeEdge, stopAtPopping>::testSkip_() const
 {
     auto v = *todo_.back();
 
-    if constexpr (!modeEdge) // ڶģʽÿֻһ
-        return pushOrd_[v] != -1;
+    if constexpr (!modeEdge) // 对于顶点模式，每个顶点只遍历一次
+        return pushOrd_()[v] != null_vertex;
 
-    // ͼıߵģʽ
+    // 处理无向图的边迭代模式
     if constexpr (!GRAPH::isDigraph()) {
 
-        if (popOrd_[v] != -1) // ͼĳѳջ֮ڽӵı߱Ȼѱ
+        if (popOrd_()[v] != null_vertex) // 对于无向图，若某顶点已出栈，则与之邻接的边必然已遍历
             return true;
 
-        if (v == grandpa_()) { // ֹͼĶݣֹѱ(v, w)ٴͨ(w, v)
+        if (v == grandpa_()) { // 防止无向图的顶点回溯，即防止已遍历的无向边(v, w)再次通过(w, v)遍历
             if constexpr (trace_multi_edges)
                 if (!testMultiEdge_())
                     return false;
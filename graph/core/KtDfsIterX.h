@@ -2,20 +2,29 @@
 #include "KtDfsIter.h"
 
 
-// KtDfsIterļǿ棬stopAtPoppingҪ2¹֧֣
-//   һСǰ֧֣lowֵʾöΪκλرõСǰţorderֵ
-//   жϵǰ丸ǷΪŵ֧
-// lowֵ壺 low(v) = min(pushOrder[v], low[w], pushOrder[k])  
-//   ʽУwǶvĺӽڵ㣬kǶvĻرȽڵ
+// KtDfsIter的加强版，总是stopAtPopping，主要新增2项新功能支持：
+//   一是新增顶点的最小前序编号支持（low值），表示该顶点为根的子树中任何回边所引用的最小前序编号（order值）
+//   二是新增判断当前顶点与其父顶点是否为桥的支持
+// low值定义： low(v) = min(pushOrder[v], low[w], pushOrder[k])  
+//   式中：w是顶点v的孩子节点，k是顶点v的回边祖先节点
 template<typename GRAPH, bool fullGraph = false>
 class KtDfsIterX : public KtDfsIter<GRAPH, false, true, true>
 {
     using super_ = KtDfsIter<GRAPH, false, true, true>;
 
 public:
+    using typename super_::vertex_index_t;
+    using typename super_::space_type;
+    using super_::null_vertex;
 
-    KtDfsIterX(GRAPH& graph, unsigned v = 0) : super_(graph, v), low_(graph.order(), -1) {
-        low_[v] = pushingIndex(); 
+    KtDfsIterX(GRAPH& graph, vertex_index_t v = 0) 
+        : super_(graph, v, nullptr, 3) {
+        low_().set(v, pushingIndex());
+    }
+
+    KtDfsIterX(GRAPH& graph, vertex_index_t v, space_type& space)
+        : super_(graph, v, &space, 3) {
+        low_().set(v, pushingIndex());
     }
 
     using super_::pushingIndex;
@@ -28,59 +37,60 @@ public:
     using super_::firstUnvisited;
 
 
-    // д++
+    // 重写父类的++操作符重载
     void operator++() { 
         super_::operator++();
 
         if(!isEnd()) {
-            unsigned w = **this;
+            vertex_index_t w = **this;
             
             if(isPushing()) {
-                assert(pushIndex(w) == -1);
-                low_[w] = pushingIndex(); // ʼlow(v) = pushOrder[v]
+                assert(pushIndex(w) == null_vertex);
+                low_().set(w, pushingIndex()); // 初始化low(v) = pushOrder[v]
             }
             else {
-                unsigned v = from();
-                if (v != -1) {
+                vertex_index_t v = from();
+                if (v != null_vertex) {
                     if (isBack()) {
-                        if (low_[v] > pushIndex(w))
-                            low_[v] = pushIndex(w); // low(v) = min(low[v], pushOrder[k])   
+                        if (low_()[v] > pushIndex(w))
+                            low_().set(v, pushIndex(w)); // low(v) = min(low[v], pushOrder[k])   
                     }
-                    else if (low_[v] > low_[w])
-                        low_[v] = low_[w]; // low(v) = min(low[v], low[w]) 
+                    else if (low_()[v] > low_()[w])
+                        low_().set(v, low_()[w]); // low(v) = min(low[v], low[w]) 
                 }
             }  
         }
         else if (fullGraph) {
-            unsigned unvisted = firstUnvisited();
-            if (unvisted != -1)
+            vertex_index_t unvisted = firstUnvisited();
+            if (unvisted != null_vertex)
                 start(unvisted);
         }
     }
 
 
-    // дstartͬlowֵ
-    void start(unsigned v) {
+    // 重写父类的start方法，以同步更新low值
+    void start(vertex_index_t v) {
         super_::start(v);
-        low_[v] = pushingIndex();
+        low_().set(v, pushingIndex());
     }
 
 
-    unsigned lowIndex(unsigned v) const {
-        return low_[v];
+    vertex_index_t lowIndex(vertex_index_t v) const {
+        return low_()[v];
     }
 
-    void resetLowIndex(unsigned v) {
-        low_[v] = -1;
+    void resetLowIndex(vertex_index_t v) {
+        low_().set(v, null_vertex);
     }
 
 
     bool isBridge() const {
-        unsigned v = **this;
+        vertex_index_t v = **this;
         return /*from() != -1 && */isPopping() && lowIndex(v) == pushIndex(v);
     }
 
 
 private:
-    std::vector<unsigned> low_; // 洢ڵչڵӽڵС
+    // 存储各节点展开子孙节点所连接节点的最小序号
+    auto& low_() const { return super_::marks_(2); }
 };
\ No newline at end of file
@@ -0,0 +1,148 @@
+#pragma once
+#include <vector>
+#include <assert.h>
+#include "KtAdjIter.h"
+#include "KtTraversalSpace.h"
+
+
+// 基于显式栈的深度优先遍历内核，以回调方式通知遍历事件，不使用递归，因此遍历深度不受调用栈的限制
+// 与KtDfsIter相比，内核没有迭代器的状态机开销，适合用于实现基于dfs的各类算法
+// 对于无向图，内核通过跳过回到父顶点的第一条边来防止树边被重复遍历，
+// 其余平行边视为回边，因此无须像KtDfsIter那样追踪平行边
+//
+// VISITOR须提供以下回调（可从KtDfsVisitor派生，仅覆盖需要的方法）：
+//   start(v) -- 以顶点v为根开始一棵新的dfs树
+//   discover(v) -- 首次访问顶点v（入栈）
+//   treeEdge(v, w, e) -- 树边(v, w)，随后将discover(w)
+//   backEdge(v, w, e) -- 回边(v, w)，w为v的祖先（或w == v的自环）
+//   crossEdge(v, w, e) -- 仅对有向图，下边或跨边(v, w)，w已出栈
+//   finish(v, p) -- 顶点v出栈，p为v在dfs树中的父顶点，根顶点的p为null_vertex
+template<typename GRAPH>
+class KtDfsKernel
+{
+public:
+    using graph_type = GRAPH;
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+    using space_type = KtTraversalSpace<vertex_index_t>;
+    constexpr static vertex_index_t null_vertex = GRAPH::null_vertex;
+
+    explicit KtDfsKernel(const GRAPH& g) : KtDfsKernel(g, nullptr) {}
+
+    // space -- 外部提供的工作空间，参见KtBfsIter
+    KtDfsKernel(const GRAPH& g, space_type& space) : KtDfsKernel(g, &space) {}
+
+
+    // 清除全部顶点的访问标记，代价为O(1)
+    void reset() {
+        space_.space().prepare(graph_.order());
+        pushIdx_ = popIdx_ = 0;
+    }
+
+
+    // 以顶点s为根进行深度优先遍历，若s已访问，则直接返回
+    template<typename VISITOR>
+    void run(vertex_index_t s, VISITOR& vis);
+
+    // 对全图进行深度优先遍历，依次以未访问的顶点为根
+    template<typename VISITOR>
+    void runAll(VISITOR& vis) {
+        for (vertex_index_t v = 0; v < graph_.order(); v++)
+            if (!isDiscovered(v))
+                run(v, vis);
+    }
+
+
+    bool isDiscovered(vertex_index_t v) const { return pushOrd_()[v] != null_vertex; }
+    bool isFinished(vertex_index_t v) const { return popOrd_()[v] != null_vertex; }
+
+    // 顶点v的入栈/出栈次序，未入栈/出栈的顶点返回null_vertex
+    vertex_index_t pushIndex(vertex_index_t v) const { return pushOrd_()[v]; }
+    vertex_index_t popIndex(vertex_index_t v) const { return popOrd_()[v]; }
+
+private:
+    KtDfsKernel(const GRAPH& g, space_type* space)
+        : graph_(g)
+        , space_(space, g.order(), 2, 0)
+        , pushIdx_(0)
+        , popIdx_(0) {}
+
+    auto& pushOrd_() const { return space_.marks(0); }
+    auto& popOrd_() const { return space_.marks(1); }
+
+    template<typename VISITOR>
+    void discover_(vertex_index_t v, vertex_index_t parent, VISITOR& vis) {
+        pushOrd_().set(v, pushIdx_++);
+        vis.discover(v);
+        stack_.push_back({ KtAdjIter<const GRAPH>(graph_, v), parent,
+            !GRAPH::isDigraph() && parent != null_vertex });
+    }
+
+private:
+
+    struct KpFrame_
+    {
+        KtAdjIter<const GRAPH> iter;
+        vertex_index_t parent;
+        bool skipParent; // 是否尚未跳过回到父顶点的边（仅无向图）
+    };
+
+    const GRAPH& graph_;
+    KtTraversalSpaceRef<space_type> space_; // 外部提供的工作空间，未提供时自建
+    vertex_index_t pushIdx_, popIdx_;
+    std::vector<KpFrame_> stack_;
+};
+
+
+template<typename GRAPH>
+template<typename VISITOR>
+void KtDfsKernel<GRAPH>::run(vertex_index_t s, VISITOR& vis)
+{
+    if (isDiscovered(s))
+        return;
+
+    assert(stack_.empty());
+    vis.start(s);
+    discover_(s, null_vertex, vis);
+
+    while (!stack_.empty()) {
+        auto& f = stack_.back();
+        if (f.iter.isEnd()) {
+            auto v = f.iter.from(), p = f.parent;
+            popOrd_().set(v, popIdx_++);
+            stack_.pop_back();
+            vis.finish(v, p);
+            continue;
+        }
+
+        auto v = f.iter.from(), w = *f.iter;
+        if (f.skipParent && w == f.parent) {
+            f.skipParent = false;
+            ++f.iter;
+        }
+        else if (!isDiscovered(w)) {
+            vis.treeEdge(v, w, f.iter.edge());
+            ++f.iter; // 须在discover_之前步进，因为stack_扩容后f将失效
+            discover_(w, v, vis);
+        }
+        else {
+            if (!isFinished(w))
+                vis.backEdge(v, w, f.iter.edge());
+            else if constexpr (GRAPH::isDigraph())
+                vis.crossEdge(v, w, f.iter.edge());
+            // 对于无向图，w已出栈表示该边已作为回边(w, v)遍历过
+            ++f.iter;
+        }
+    }
+}
+
+
+// KtDfsKernel的缺省回调，均为空操作
+struct KtDfsVisitor
+{
+    template<typename V> void start(V) {}
+    template<typename V> void discover(V) {}
+    template<typename V, typename E> void treeEdge(V, V, const E&) {}
+    template<typename V, typename E> void backEdge(V, V, const E&) {}
+    template<typename V, typename E> void crossEdge(V, V, const E&) {}
+    template<typename V> void finish(V, V) {}
+};
@@ -6,10 +6,10 @@
 #include "../util/underlying_graph.h"
 
 
-// ŷͼж⣬ʵ
-// ο'Graph Algorithms', 2nd Edition, Shimon Even, 2012
+// 欧拉图判定和求解，实现
+// 参考'Graph Algorithms', 2nd Edition, Shimon Even, 2012
 /* 
- * жԭ
+ * 判定原则：
  * 
  * A finite(undirected) connected graph is an Euler graph if and
  * only if exactly two vertices are of odd degree or all vertices are of even degree.
@@ -28,17 +28,17 @@
  */
 
  /*
-  * 㷨Hierholzer㷨(·)ӶO(V+E).
+  * 求解算法：Hierholzer算法(插入回路法)，复杂度O(V+E).
   *
-  * 㷨̣ջcurPathcycle
-  *  1ѡһΪ㣬ջcurPathʶ㣬ı߶ɾĶջcurPath
-  *  2ǰûڱߣ򽫸öcurPathջcycle
-  *  3cycleջеĶջ˳򣬾Ǵŷ·
+  * 算法过程（设置两个栈，curPath和cycle）：
+  *  （1）选择任一顶点为起点，入栈curPath，深度搜索访问顶点，将经过的边都删除，经过的顶点入栈curPath。
+  *  （2）如果当前顶点没有相邻边，则将该顶点从curPath出栈到cycle。
+  *  （3）cycle栈中的顶点出栈顺序，就是从起点出发的欧拉回路。
   *
   */
 
 
-// ʹKtGreedyIterģʵHierholzer㷨
+// 使用KtGreedyIter模拟实现Hierholzer算法
 // TODO: more test
 
 template<typename GRAPH>
@@ -48,8 +48,8 @@ public:
 	KtEuler(const GRAPH& g) : g_(g) {}
 
 	// test iff has euler-cycle or euler-path
-	// 0ʾŷͼ1ʾŷ2ʾŷ·
-	// @oddVertex: nullptr򷵻صһȶ
+	// 返回0表示非欧拉图，返回1表示有欧拉环，返回2表示有欧拉路径
+	// @oddVertex: 若非nullptr，则返回第一个奇度顶点
 	int test(unsigned* oddVertex = nullptr) const {
 
 		if constexpr (GRAPH::isDigraph()) {
@@ -58,8 +58,8 @@ public:
 			if (!is_connected(g))
 				return 0;
 
-			bool odd[2] = { false }; // odd[0]Ϊtrueʾ⵽outdegree(a) = indegree(a)+1
-			                         // odd[1]Ϊtrueʾ⵽outdegree(b) = indegree(b)-1
+			bool odd[2] = { false }; // odd[0]为true，表示检测到outdegree(a) = indegree(a)+1
+			                         // odd[1]为true，表示检测到outdegree(b) = indegree(b)-1
 
 			for (unsigned v = 0; v < g_.order(); v++) {
 				auto ideg = g_.indegree(v);
@@ -91,7 +91,7 @@ public:
 			if (!is_connected(g_))
 				return 0;
 
-			int odd(0); // ȶ
+			int odd(0); // 奇度顶点数
 			for (unsigned v = 0; v < g_.order(); v++) {
 				if (degree(g_, v) % 2) {
 					++odd;
@@ -103,7 +103,7 @@ public:
 				if (odd > 2) return 0;
 			}
 
-			assert(odd != 1); // ͼֻ1ȶ
+			assert(odd != 1); // 无向图不可能只有1个奇度顶点
 
 			return odd == 0 ? 1 : 2;
 		}
@@ -126,7 +126,7 @@ public:
 
 
 	std::vector<unsigned> getPath(unsigned startVertex) const {
-		assert(degree(g_, startVertex) % 2); // startVertexΪȶ
+		assert(degree(g_, startVertex) % 2); // startVertex为奇度顶点
 		return getCycle(startVertex);
 	}
 
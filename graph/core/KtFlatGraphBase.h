@@ -4,15 +4,16 @@
 #include "../base/KtRange.h"
 
 
-// ƽͼͱ߷ֱ˳洢ÿ㱣ߵƫϢͬһĳ洢
-// @EDGE_CONTAINER: 
-// @VERTEX_CONTAINER: 
-// 2»ԣ
-//     һbegin(), end()Ա
-//     size()Ա
-//     at(int)Ա
-//     iterator, const_iteratorԱ
-template<typename EDGE_CONTAINER, typename VERTEX_CONTAINER>
+// 扁平图：顶点和边分别按顺序存储，每个顶点保存边的偏移信息，同一顶点的出边连续存储
+// @EDGE_CONTAINER: 边容器
+// @VERTEX_CONTAINER: 顶点容器
+// 2个容器须具以下基本属性：
+//     一是begin(), end()成员方法
+//     二是size()成员方法
+//     三是at(int)成员方法
+//     四是iterator, const_iterator成员类型
+// @VERTEX_INDEX: 顶点索引类型，边索引类型由顶点的edgeindex属性推导
+template<typename EDGE_CONTAINER, typename VERTEX_CONTAINER, typename VERTEX_INDEX = unsigned>
 class KtFlatGraphBase
 {
 	using vertex_container = VERTEX_CONTAINER; 
@@ -35,20 +36,23 @@ public:
 	using edge_deref_t = decltype(*std::declval<edge_iter>());
 	using edge_type = typename std::remove_reference_t<edge_deref_t>;
 
+	using vertex_index_t = VERTEX_INDEX;
+	using edge_index_t = std::decay_t<decltype(vertex_traits_t::edgeindex(std::declval<const_vertex_deref_t>()))>;
+
 	using edge_range = KtRange<edge_iter>;
 	using const_edge_range = KtRange<const_edge_iter>;
 
 
-	unsigned order() const { return static_cast<unsigned>(vertexes_.size()); }
-	unsigned size() const { return static_cast<unsigned>(edges_.size()); }
+	vertex_index_t order() const { return static_cast<vertex_index_t>(vertexes_.size()); }
+	edge_index_t size() const { return static_cast<edge_index_t>(edges_.size()); }
 
-	decltype(auto) edgeAt(unsigned idx) { return edges_.at(idx); }
-	decltype(auto) edgeAt(unsigned idx) const { return edges_.at(idx); }
+	decltype(auto) edgeAt(edge_index_t idx) { return edges_.at(idx); }
+	decltype(auto) edgeAt(edge_index_t idx) const { return edges_.at(idx); }
 
-	decltype(auto) vertexAt(unsigned v) { return vertexes_.at(v); }
-	decltype(auto) vertexAt(unsigned v) const { return vertexes_.at(v); }
+	decltype(auto) vertexAt(vertex_index_t v) { return vertexes_.at(v); }
+	decltype(auto) vertexAt(vertex_index_t v) const { return vertexes_.at(v); }
 
-	edge_range outedges(unsigned v) {
+	edge_range outedges(vertex_index_t v) {
 		auto start = std::next(std::begin(edges_), edgeIndex(v));
 		auto last = (v == order() - 1) ? std::end(edges_)
 			: std::next(std::begin(edges_), edgeIndex(v + 1));
@@ -56,7 +60,7 @@ public:
 		return edge_range(start, last);
 	}
 
-	const_edge_range outedges(unsigned v) const {
+	const_edge_range outedges(vertex_index_t v) const {
 		auto start = std::next(std::cbegin(edges_), edgeIndex(v));
 		auto last = (v == order() - 1) ? std::cend(edges_)
 			: std::next(std::cbegin(edges_), edgeIndex(v + 1));
@@ -65,20 +69,20 @@ public:
 	}
 
 
-	decltype(auto) edgeIndex(unsigned vertexIdx) const {
+	decltype(auto) edgeIndex(vertex_index_t vertexIdx) const {
 		return vertex_traits_t::edgeindex(vertexAt(vertexIdx));
 	}
 
-	decltype(auto) edgeIndex(unsigned vertexIdx) {
+	decltype(auto) edgeIndex(vertex_index_t vertexIdx) {
 		return vertex_traits_t::edgeindex(vertexAt(vertexIdx));
 	}
 
-	// ݱedgeIdx, from
-	unsigned edgeFrom(unsigned edgeIdx) const {
+	// 根据边索引edgeIdx, 推算from顶点
+	vertex_index_t edgeFrom(edge_index_t edgeIdx) const {
 		assert(edgeIdx < size());
 
 		struct {
-			bool operator()(unsigned idx, const_vertex_deref_t v) const {
+			bool operator()(edge_index_t idx, const_vertex_deref_t v) const {
 				return idx < vertex_traits_t::edgeindex(v);
 			}
 		} comp;
@@ -86,7 +90,7 @@ public:
 		auto pos = std::upper_bound(std::cbegin(vertexes_), std::cend(vertexes_), edgeIdx, comp);
 		auto from = std::distance(std::cbegin(vertexes_), pos);
 		assert(from != 0 && from - 1 < static_cast<decltype(from)>(order()));
-		return static_cast<unsigned>(from - 1);
+		return static_cast<vertex_index_t>(from - 1);
 	}
 
 
@@ -3,33 +3,46 @@
 #include "vertex_traits.h"
 #include "KtFlatGraphBase.h"
 #include <vector>
+#include <tuple>
 #include <assert.h>
 
 
-/// std::vectorKtFlatGraphBaseʵ
+/// 基于std::vector的KtFlatGraphBase实现
 
 namespace kPrivate
 {
-	template<typename EDGE_TYPE>
-	using flatvg_edge_container = std::vector<edge_has_to_t<EDGE_TYPE>>;
-
-	template<typename VERTEX_TYPE>
-	using flatvg_vertex_container = std::vector<vertex_has_edgeindex_t<VERTEX_TYPE>>;
-
-	// øKtFlatGraphBase
-	template<typename EDGE_TYPE, typename VERTEX_TYPE>
-	using flatvg_base = KtFlatGraphBase<flatvg_edge_container<EDGE_TYPE>, 
-		flatvg_vertex_container<VERTEX_TYPE>>;
+	// @soa: 若为true，则to顶点与边值分列存储（KtSoaVector），否则使用带to属性的边对象数组
+	template<typename EDGE_TYPE, typename VERTEX_INDEX = unsigned, bool soa = false>
+	using flatvg_edge_container = std::conditional_t<soa, KtSoaVector<VERTEX_INDEX, EDGE_TYPE>,
+		std::vector<edge_has_to_t<EDGE_TYPE, VERTEX_INDEX>>>;
+
+	template<typename VERTEX_TYPE, typename EDGE_INDEX = unsigned>
+	using flatvg_vertex_container = std::vector<vertex_has_edgeindex_t<VERTEX_TYPE, EDGE_INDEX>>;
+
+	// 传递引用给KtFlatGraphBase
+	template<typename EDGE_TYPE, typename VERTEX_TYPE, typename VERTEX_INDEX = unsigned, 
+		typename EDGE_INDEX = unsigned, bool soa = false>
+	using flatvg_base = KtFlatGraphBase<flatvg_edge_container<EDGE_TYPE, VERTEX_INDEX, soa>, 
+		flatvg_vertex_container<VERTEX_TYPE, EDGE_INDEX>, VERTEX_INDEX>;
 }
 
 
-template<typename EDGE_TYPE, typename VERTEX_TYPE = void>
-class KtFlatGraphVectorImpl : public kPrivate::flatvg_base<EDGE_TYPE, VERTEX_TYPE>
+// @VERTEX_INDEX: 顶点索引类型，亦即边的to属性类型
+// @EDGE_INDEX: 边索引类型，亦即顶点的edgeindex属性类型（当顶点自带edgeindex属性时，以顶点属性类型为准）
+// @soa: 边的存储布局。若为true，to顶点单独连续存储，仅访问拓扑结构的算法（bfs、dfs、scc等）
+//   不必加载边值，对较大的边对象可显著改善缓存命中。此时EDGE_TYPE不能自带to属性
+template<typename EDGE_TYPE, typename VERTEX_TYPE = void, 
+	typename VERTEX_INDEX = unsigned, typename EDGE_INDEX = unsigned, bool soa = false>
+class KtFlatGraphVectorImpl : public kPrivate::flatvg_base<EDGE_TYPE, VERTEX_TYPE, VERTEX_INDEX, EDGE_INDEX, soa>
 {
+	static_assert(!soa || !has_to_v<EDGE_TYPE>, "soa layout requires edge type without property of 'to'");
+
 public:
-	using super_ = kPrivate::flatvg_base<EDGE_TYPE, VERTEX_TYPE>;
-	using edge_container = kPrivate::flatvg_edge_container<EDGE_TYPE>;
-	using vertex_container = kPrivate::flatvg_vertex_container<VERTEX_TYPE>;
+	using super_ = kPrivate::flatvg_base<EDGE_TYPE, VERTEX_TYPE, VERTEX_INDEX, EDGE_INDEX, soa>;
+	using edge_container = kPrivate::flatvg_edge_container<EDGE_TYPE, VERTEX_INDEX, soa>;
+	using vertex_container = kPrivate::flatvg_vertex_container<VERTEX_TYPE, EDGE_INDEX>;
+	using typename super_::vertex_index_t;
+	using typename super_::edge_index_t;
 
 	using edge_type = EDGE_TYPE;
 	using vertex_type = VERTEX_TYPE;
@@ -47,51 +60,51 @@ public:
 	using super_::outedges;
 
 
-	unsigned size() const {
-		return static_cast<unsigned>(super_::size() - dummyEdges_);
+	edge_index_t size() const {
+		return static_cast<edge_index_t>(super_::size() - dummyEdges_);
 	}
 
 
-	void reset(unsigned nv) {
+	void reset(vertex_index_t nv) {
 		vertexes_.resize(nv), edges_.clear(), dummyEdges_ = 0;
 		for (auto& v : vertexes_)
 			vertex_traits_t::edgeindex(v) = 0;
 	}
 
-	void reserve(unsigned nv, unsigned ne) {
+	void reserve(vertex_index_t nv, edge_index_t ne) {
 		vertexes_.reserve(nv), edges_.reserve(ne);
 	}
 
-	void reserveEdges(unsigned v, unsigned ne) {}
+	void reserveEdges(vertex_index_t v, edge_index_t ne) {}
 
 
 	template<typename T, std::enable_if_t<!std::is_void_v<T>
 		&& std::is_convertible_v<T, vertex_type>, bool> = false>
-	unsigned addVertex(const T& v) {
+	vertex_index_t addVertex(const T& v) {
 		vertexes_.push_back(vertex_type(v));
-		vertex_traits_t::edgeindex(vertexes_.back()) = static_cast<unsigned>(edges_.size());
+		vertex_traits_t::edgeindex(vertexes_.back()) = static_cast<edge_index_t>(edges_.size());
 
-		return vertexes_.size();
+		return static_cast<vertex_index_t>(vertexes_.size());
 	}
 
 	template<typename T, std::enable_if_t<!std::is_void_v<T>
 		&& std::is_same_v<T, vertex_type>, bool> = false>
-	unsigned addVertex(T&& v) {
+	vertex_index_t addVertex(T&& v) {
 		vertexes_.push_back(std::move(v));
-		vertex_traits_t::edgeindex(vertexes_.back()) = static_cast<unsigned>(edges_.size());
+		vertex_traits_t::edgeindex(vertexes_.back()) = static_cast<edge_index_t>(edges_.size());
 
-		return static_cast<unsigned>(vertexes_.size());
+		return static_cast<vertex_index_t>(vertexes_.size());
 	}
 
 	template<typename T = vertex_type, std::enable_if_t<std::is_void_v<T>, bool> = true>
-	unsigned addVertex() {
-		vertexes_.push_back(static_cast<unsigned>(edges_.size()));
-		return static_cast<unsigned>(vertexes_.size());
+	vertex_index_t addVertex() {
+		vertexes_.push_back(static_cast<edge_index_t>(edges_.size()));
+		return static_cast<vertex_index_t>(vertexes_.size());
 	}
 
 
 	template<bool dummy = false>
-	edge_iter addEdge(unsigned from, edge_iter pos, const edge_type& edge) {
+	edge_iter addEdge(vertex_index_t from, edge_iter pos, const edge_type& edge) {
 		assert(from < order());
 		assert(pos >= outedges(from).begin() && pos <= outedges(from).end());
 
@@ -104,17 +117,17 @@ public:
 		return iter;
 	}
 
-	// ɾv
-	void eraseVertex(unsigned v) {
+	// 删除顶点v
+	void eraseVertex(vertex_index_t v) {
 		assert(outedges(v).size() == 0);
 		vertexes_.erase(vertexes_.begin() + v);
 	}
 
 
-	// ɾvĳe
+	// 删除顶点v的出边e
 	template<bool dummy = false>
-	edge_iter eraseEdge(unsigned v, edge_iter e) {
-		assert(v == super_::edgeFrom(unsigned(std::distance(edges_.begin(), e))));
+	edge_iter eraseEdge(vertex_index_t v, edge_iter e) {
+		assert(v == super_::edgeFrom(edge_index_t(std::distance(edges_.begin(), e))));
 
 		updateEdgeIndex_(v, -1);
 
@@ -125,35 +138,79 @@ public:
 
 
 	template<bool dummy = false>
-	edge_iter eraseEdges(unsigned v, edge_iter first, edge_iter last) {
+	edge_iter eraseEdges(vertex_index_t v, edge_iter first, edge_iter last) {
 		assert(first >= outedges(v).begin() && last <= outedges(v).end());
 
-		int ne = int(std::distance(first, last));
-		if (dummy) dummyEdges_ -= ne;
+		auto ne = std::distance(first, last);
+		if (dummy) dummyEdges_ -= static_cast<edge_index_t>(ne);
 
 		updateEdgeIndex_(v, -ne);
 		return edges_.erase(first, last);
 	}
 
 
+	// 批量构建：清空图并一次性写入[first, last)的所有边，时间复杂度O(V+E)
+	// 迭代器解引用须为tuple-like三元组(from, to, edge)，同一from顶点的出边保持输入次序
+	// @dummyEdges: 输入边中无向图反边的数量，不计入size()
+	template<typename ITER>
+	void bulkAssign(vertex_index_t nv, ITER first, ITER last, edge_index_t dummyEdges) {
+		reset(nv);
+
+		// 统计各顶点出度，并累加为边偏移
+		std::vector<edge_index_t> offset(std::size_t(nv) + 1, 0);
+		for (auto iter = first; iter != last; ++iter) {
+			assert(std::get<0>(*iter) < nv && std::get<1>(*iter) < nv);
+			++offset[std::get<0>(*iter) + 1];
+		}
+		for (vertex_index_t v = 0; v < nv; v++)
+			offset[v + 1] += offset[v];
+		bulkAllocate(nv, offset, dummyEdges);
+
+		// 按from顶点散列写入
+		for (auto iter = first; iter != last; ++iter) {
+			auto pos = offset[std::get<0>(*iter)]++;
+			auto&& e = edges_[pos];
+			e = std::get<2>(*iter);
+			edge_traits<std::decay_t<decltype(e)>>::to(e) = std::get<1>(*iter);
+		}
+	}
+
+
+	// 按出边偏移分配存储：清空图，顶点v的出边占据[offset[v], offset[v + 1])，时间复杂度O(V+E)
+	// 各出边为缺省值，由调用者经outedges(v)原位写入边值及to属性，不同顶点的写入可并行进行
+	// @offset: 长度为nv + 1的递增序列，offset[0]须为0
+	// @dummyEdges: 同bulkAssign
+	template<typename OFFSET>
+	void bulkAllocate(vertex_index_t nv, const OFFSET& offset, edge_index_t dummyEdges) {
+		assert(offset[0] == 0);
+
+		reset(nv);
+		for (vertex_index_t v = 0; v < nv; v++)
+			super_::edgeIndex(v) = static_cast<edge_index_t>(offset[v]);
+		edges_.resize(offset[nv]);
+
+		dummyEdges_ = dummyEdges;
+	}
+
+
 private:
 
-	// vӶ㣨vƫƣedgeIndex += diff
-	void updateEdgeIndex_(unsigned v, int diff) {
+	// 更新v后接顶点（不含v）的偏移：edgeIndex += diff
+	void updateEdgeIndex_(vertex_index_t v, std::ptrdiff_t diff) {
 		for (++v; v < order(); v++) 
 			super_::edgeIndex(v) += diff;
 	}
 
 	
 private:
-	unsigned dummyEdges_; // ͼӵķ
+	edge_index_t dummyEdges_{ 0 }; // 对于无向图添加的反边数量
 };
 
 
 
-template<typename EDGE_TYPE, typename VERTEX_TYPE>
-struct graph_traits<KtFlatGraphVectorImpl<EDGE_TYPE, VERTEX_TYPE>>
-	: public graph_traits<kPrivate::flatvg_base<EDGE_TYPE, VERTEX_TYPE>>
+template<typename EDGE_TYPE, typename VERTEX_TYPE, typename VERTEX_INDEX, typename EDGE_INDEX, bool soa>
+struct graph_traits<KtFlatGraphVectorImpl<EDGE_TYPE, VERTEX_TYPE, VERTEX_INDEX, EDGE_INDEX, soa>>
+	: public graph_traits<kPrivate::flatvg_base<EDGE_TYPE, VERTEX_TYPE, VERTEX_INDEX, EDGE_INDEX, soa>>
 {
 	constexpr static bool reshapable = true;
 	constexpr static bool immutable = false;
@@ -0,0 +1,226 @@
+#pragma once
+#include <vector>
+#include <memory>
+#include <limits>
+#include <cmath>
+#include <type_traits>
+#include <assert.h>
+#include "KtShortestPath.h"
+#include "../base/parallel_for.h"
+
+
+// 按需计算的全源最短路径，接口与KtFsspAbstract相同
+// KtFsspAbstract预先分配V*V的距离和路径矩阵，对于大规模图不可行。
+// 本类在首次查询源点v时，以SSSP算法计算v的单源最短路径，并将结果作为一行缓存，
+// 各行存放于一块连续的内存中，行数由内存预算决定，超出时按LRU淘汰
+//
+// @SSSP: 单源最短路径算法，须派生自KtSsspAbstract，且可以SSSP<GRAPH, WEIGHTOR>(g, v)构造
+// @STORE: 距离的存储类型，可用于压缩：
+//   与weight_type相同时无损；
+//   为浮点类型（如float）时按精度截断；
+//   为整数类型（如uint16_t）时按量化步长quantum量化，超出范围的距离取最大可表示值
+// 最大可表示值保留用于表示不可达
+// 无符号的STORE不能表示负距离（图含负权时），负距离将被截为0，调试版以assert检查
+// NOTE: 查询会修改缓存，不能被多个线程并发调用
+template<typename GRAPH, class WEIGHTOR = default_wtor<GRAPH>,
+    template<typename, class> class SSSP = KtSsspPfs,
+    typename STORE = typename WEIGHTOR::weight_type>
+class KtFsspLazy
+{
+    static_assert(GRAPH::isDigraph(), "KtFsspLazy must be instantiated with Digraph.");
+
+public:
+    using weight_type = typename WEIGHTOR::weight_type;
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+    using store_type = STORE;
+    constexpr static vertex_index_t null_vertex = GRAPH::null_vertex;
+
+    // @memBudget: 缓存的内存预算（字节），至少缓存1行
+    // @quantum: STORE为整数类型时的量化步长
+    explicit KtFsspLazy(const GRAPH& g, std::size_t memBudget = std::size_t(256) << 20, weight_type quantum = 1)
+        : g_(g), V_(g.order()), quantum_(quantum), head_(null_vertex), tail_(null_vertex), hits_(0), misses_(0) {
+        std::size_t rowBytes = std::max<std::size_t>(1, std::size_t(V_) * (sizeof(STORE) + sizeof(vertex_index_t)));
+        cap_ = vertex_index_t(std::min<std::size_t>(std::max<std::size_t>(memBudget / rowBytes, 1), std::max<vertex_index_t>(V_, 1)));
+        dst_.reset(new STORE[std::size_t(cap_) * V_]);
+        spt_.reset(new vertex_index_t[std::size_t(cap_) * V_]);
+        slotOf_.assign(V_, null_vertex);
+        sourceOf_.assign(cap_, null_vertex);
+        prev_.assign(cap_, null_vertex);
+        next_.assign(cap_, null_vertex);
+        for (vertex_index_t i = 0; i < cap_; i++) // 初始时全部槽位均空闲，依次链入LRU链表
+            link_(i);
+    }
+
+
+    weight_type distance(vertex_index_t v, vertex_index_t w) const {
+        return decode_(row_(v)[w]);
+    }
+
+    // 返回v到w的最短路径(逆序)
+    auto pathR(vertex_index_t v, vertex_index_t w) const {
+        auto spt = sptRow_(v);
+        std::vector<vertex_index_t> p;
+        vertex_index_t s = w;
+        do {
+            p.push_back(s);
+            s = spt[s];
+        } while (s != v && s != w && s != null_vertex);
+        if (s != null_vertex) p.push_back(s);
+
+        return p;
+    }
+
+    // 是否存在从v到w的路径
+    bool reachable(vertex_index_t v, vertex_index_t w) const {
+        return sptRow_(v)[w] != null_vertex;
+    }
+
+
+    // 以nthreads个线程并行计算sources中各源点的行，最多计算capacity()行
+    // 已缓存的行只调整LRU次序
+    void precompute(const std::vector<vertex_index_t>& sources, unsigned nthreads = 0) {
+        std::vector<std::pair<vertex_index_t, vertex_index_t>> todo; // (源点, 槽位)
+        auto n = std::min<std::size_t>(sources.size(), cap_);
+        for (std::size_t i = 0; i < n; i++) {
+            auto v = sources[i];
+            if (slotOf_[v] != null_vertex)
+                touch_(slotOf_[v]);
+            else
+                todo.emplace_back(v, acquire_(v));
+        }
+
+        parallel_for(std::size_t(0), todo.size(), [this, &todo](std::size_t i) {
+            compute_(todo[i].first, todo[i].second);
+        }, nthreads, std::size_t(1));
+    }
+
+
+    // 缓存的最大行数
+    vertex_index_t capacity() const { return cap_; }
+
+    // 源点v的行是否已缓存
+    bool isCached(vertex_index_t v) const { return slotOf_[v] != null_vertex; }
+
+    // 缓存命中和未命中的次数
+    std::size_t hits() const { return hits_; }
+    std::size_t misses() const { return misses_; }
+
+
+private:
+
+    constexpr static STORE unreachable_ = std::numeric_limits<STORE>::max();
+
+    STORE encode_(weight_type d) const {
+        if (d == WEIGHTOR{}.worst_weight)
+            return unreachable_;
+
+        if constexpr (std::is_same_v<STORE, weight_type>)
+            return d;
+        else if constexpr (std::is_floating_point_v<STORE>) {
+            // 在double下判断范围：weight_type为整数时，将FLT_MAX等转换为weight_type是未定义行为
+            // 超出范围的距离取最接近的有限值，不能与不可达混淆
+            if (std::abs(double(d)) < double(unreachable_)) {
+                auto s = STORE(d);
+                if (s != unreachable_)
+                    return s;
+            }
+            return d < 0 ? std::numeric_limits<STORE>::lowest() : std::nextafter(unreachable_, STORE(0));
+        }
+        else {
+            auto q = std::round(double(d) / double(quantum_));
+            assert(std::is_signed_v<STORE> || !(q < 0));
+            if (q < double(std::numeric_limits<STORE>::lowest())) return std::numeric_limits<STORE>::lowest();
+            return q < double(unreachable_ - 1) ? STORE(q) : STORE(unreachable_ - 1);
+        }
+    }
+
+    weight_type decode_(STORE s) const {
+        if (s == unreachable_)
+            return WEIGHTOR{}.worst_weight;
+
+        if constexpr (std::is_same_v<STORE, weight_type> || std::is_floating_point_v<STORE>)
+            return weight_type(s);
+        else
+            return weight_type(s * quantum_);
+    }
+
+
+    // 返回源点v的距离行，未缓存时计算之
+    const STORE* row_(vertex_index_t v) const {
+        return &dst_[std::size_t(fetch_(v)) * V_];
+    }
+
+    const vertex_index_t* sptRow_(vertex_index_t v) const {
+        return &spt_[std::size_t(fetch_(v)) * V_];
+    }
+
+    vertex_index_t fetch_(vertex_index_t v) const {
+        auto slot = slotOf_[v];
+        if (slot != null_vertex) {
+            ++hits_;
+            touch_(slot);
+        }
+        else {
+            ++misses_;
+            slot = acquire_(v);
+            compute_(v, slot);
+        }
+        return slot;
+    }
+
+    // 以SSSP计算源点v的行，写入槽位slot
+    void compute_(vertex_index_t v, vertex_index_t slot) const {
+        SSSP<GRAPH, WEIGHTOR> sp(g_, v);
+        auto dst = &dst_[std::size_t(slot) * V_];
+        auto spt = &spt_[std::size_t(slot) * V_];
+        for (vertex_index_t w = 0; w < V_; w++) {
+            dst[w] = encode_(sp.distance(w));
+            spt[w] = sp.parent(w);
+        }
+    }
+
+    // 为源点v分配槽位：淘汰最久未用的行
+    vertex_index_t acquire_(vertex_index_t v) const {
+        auto slot = tail_;
+        if (sourceOf_[slot] != null_vertex)
+            slotOf_[sourceOf_[slot]] = null_vertex;
+        sourceOf_[slot] = v;
+        slotOf_[v] = slot;
+        touch_(slot);
+        return slot;
+    }
+
+    // LRU链表操作，head_为最近使用的槽位，tail_为最久未用的槽位
+    void unlink_(vertex_index_t i) const {
+        (prev_[i] != null_vertex ? next_[prev_[i]] : head_) = next_[i];
+        (next_[i] != null_vertex ? prev_[next_[i]] : tail_) = prev_[i];
+    }
+
+    void link_(vertex_index_t i) const {
+        prev_[i] = null_vertex;
+        next_[i] = head_;
+        (head_ != null_vertex ? prev_[head_] : tail_) = i;
+        head_ = i;
+    }
+
+    void touch_(vertex_index_t i) const {
+        if (head_ != i) {
+            unlink_(i);
+            link_(i);
+        }
+    }
+
+
+private:
+    const GRAPH& g_;
+    vertex_index_t V_;
+    vertex_index_t cap_; // 缓存的行数
+    weight_type quantum_;
+    std::unique_ptr<STORE[]> dst_; // 第i个槽位的距离行为dst_[i * V_, (i + 1) * V_)
+    std::unique_ptr<vertex_index_t[]> spt_; // 第i个槽位的最短路径树
+    mutable std::vector<vertex_index_t> slotOf_; // 源点所在的槽位
+    mutable std::vector<vertex_index_t> sourceOf_; // 槽位对应的源点
+    mutable std::vector<vertex_index_t> prev_, next_; // LRU双向链表
+    mutable vertex_index_t head_, tail_;
+    mutable std::size_t hits_, misses_;
+};
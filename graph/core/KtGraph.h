@@ -1,16 +1,19 @@
 #pragma once
 #include <algorithm>
 #include <set>
+#include <vector>
+#include <tuple>
 #include "graph_traits.h"
 #include "vertex_traits.h"
 #include "edge_traits.h"
+#include "../base/KtRange.h"
 #include "../base/KtCondRange.h"
 #include "KtAdjIter.h"
 
 
-// ʵͼķװͳһdigraph, multiEdges, alwaysSortedԼ
-// ߺͶõtooutdegreeԣȷײֻרעݽṹù
-// ѡúԵĸ
+// 实现图基本操作的封装，统一处理digraph, multiEdges, alwaysSorted等配置项，以及
+// 边和顶点对象可能内置的to、outdegree等属性，确保底层只需专注数据结构，不用关心
+// 选项配置和内置属性的更新
 
 namespace kPrivate
 {
@@ -33,13 +36,15 @@ namespace kPrivate
 	constexpr static const int graph_level_v = 
 		graph_level<graph_traits<GRAPH>::reshapable, graph_traits<GRAPH>::immutable>::value;
 
-	template<typename EDGE_TYPE>
+	HAS_MEMBER(bulkAssign);
+
+	template<typename EDGE_TYPE, typename VERTEX_INDEX = unsigned>
 	struct KpEdgeCompAllInOne {
-		bool operator()(unsigned to, const EDGE_TYPE& e) const {
+		bool operator()(VERTEX_INDEX to, const EDGE_TYPE& e) const {
 			return to < edge_traits<EDGE_TYPE>::to(e);
 		}
 
-		bool operator()(const EDGE_TYPE& e, unsigned to) const {
+		bool operator()(const EDGE_TYPE& e, VERTEX_INDEX to) const {
 			return edge_traits<EDGE_TYPE>::to(e) < to;
 		}
 
@@ -57,17 +62,22 @@ class KtGraph : public GRAPH_IMPL
 public:
 	using graph_impl = GRAPH_IMPL;
 
-	// 
+	// 导入类型
 	using vertex_type = typename graph_impl::vertex_type;
 	using edge_type = typename graph_impl::edge_type;
 
 	using underly_vertex_t = typename graph_traits<graph_impl>::underly_vertex_t;
 	using underly_edge_t = typename graph_traits<graph_impl>::underly_edge_t;
+	using const_underly_edge_t = std::decay_t<typename graph_traits<graph_impl>::const_edge_deref_t>; // 对于代理型边（如SoA存储），与underly_edge_t不同
+
+	using vertex_index_t = typename graph_traits<graph_impl>::vertex_index_t;
+	using edge_index_t = typename graph_traits<graph_impl>::edge_index_t;
 
-	using vertex_index_t = unsigned;
+	// 无效顶点索引，用作各算法的哨兵值
+	constexpr static vertex_index_t null_vertex = static_cast<vertex_index_t>(-1);
 
 
-	// 뺯
+	// 导入函数
 	using graph_impl::graph_impl;
 	using graph_impl::order;
 	using graph_impl::size;
@@ -81,23 +91,23 @@ public:
 	constexpr static bool hasVertex() { return !std::is_void_v<vertex_type>; }
 
 
-	// ͼ
+	// 空图
 	bool isEmpty() const { return order() == 0; }
 
-	// ƽͼ
+	// 平凡图
 	bool isTrivial() const { return order() == 1; }
 
-	// ͼ
+	// 零图
 	bool isNull() const { return size() == 0; }
 
 
-	// vĳȣvж
-	unsigned outdegree(unsigned v) const { 
+	// 顶点v的出度，即v有多少条出边
+	edge_index_t outdegree(vertex_index_t v) const { 
 		if constexpr (vertexHasOutDegree_()) {
 			return outdegree_(v);
 		}
 		else if constexpr (!isDense()) {
-			return static_cast<unsigned>(outedges(v).size());
+			return static_cast<edge_index_t>(outedges(v).size());
 		}
 		else {
 			struct {
@@ -107,34 +117,34 @@ public:
 			} pred;
 
 			decltype(auto) r = outedges(v);
-			return static_cast<unsigned>(std::count_if(r.begin(), r.end(), pred));
+			return static_cast<edge_index_t>(std::count_if(r.begin(), r.end(), pred));
 		}
 	}
 
 
-	// 
-	unsigned indegree(unsigned v) const {
+	// 入度
+	edge_index_t indegree(vertex_index_t v) const {
 		if constexpr (!isDigraph()) {
 			return outdegree(v);
 		}
 		else {
-			unsigned d(0);
-			for (unsigned u = 0; u < order(); u++)
-				d += static_cast<unsigned>(edges(u, v).size());
+			edge_index_t d(0);
+			for (vertex_index_t u = 0; u < order(); u++)
+				d += static_cast<edge_index_t>(edges(u, v).size());
 			return d;
 		}
 	}
 
 
-	// . עͼԻΪ21+1
-	unsigned degree(unsigned v) const {
+	// 度. 注：对于有向图的自环，度为2，1个入度+1个出度
+	edge_index_t degree(vertex_index_t v) const {
 		auto d = outdegree(v);
 		if constexpr (isDigraph()) 
 			d += indegree(v);
 		return d;
 	}
 
-	auto edges(unsigned from, unsigned to) const {
+	auto edges(vertex_index_t from, vertex_index_t to) const {
 		decltype(auto) r = graph_impl::outedges(from);
 		if constexpr (isDense()) {
 			auto first = std::next(r.begin(), to);
@@ -145,15 +155,15 @@ public:
 		}
 		else if constexpr (isAlwaysSorted()) {
 			auto range = std::equal_range(r.begin(), r.end(), to, 
-				kPrivate::KpEdgeCompAllInOne<underly_edge_t>{});
+				kPrivate::KpEdgeCompAllInOne<const_underly_edge_t, vertex_index_t>{});
 			return KtRange(range.first, range.second);
 		}
-		else { // Ҫȫռ<from, to>multi-edges
+		else { // 需要进行全遍历，收集<from, to>的所有multi-edges
 			
 			static_assert(has_to_v<underly_edge_t>, "edge missing property of 'to'");
 
 			auto pred =	[to](typename decltype(r)::const_element_type e) {
-				    return to == edge_traits<underly_edge_t>::to(e); 
+				    return to == edge_traits<const_underly_edge_t>::to(e); 
 			};
 
 			auto pos = std::find_if(r.begin(), r.end(), pred);
@@ -167,22 +177,22 @@ public:
 	}
 
 
-	bool hasEdge(unsigned from, unsigned to) const {
+	bool hasEdge(vertex_index_t from, vertex_index_t to) const {
 		return !edges(from, to).empty();
 	}
 
 
-	// Զͼصһ
-	const edge_type& getEdge(unsigned from, unsigned to) const {
+	// 对多边图，返回第一条边
+	const edge_type& getEdge(vertex_index_t from, vertex_index_t to) const {
 		assert(hasEdge(from, to));
 		auto edges = this->edges(from, to);
 		return *edges;
 	}
 
 
-	// ԶͼЧ
+	// 仅对多边图有效
 	template<bool dummy = multiEdges, typename = std::enable_if_t<dummy>>
-	auto getEdge(unsigned from, unsigned to, const edge_type& edge) const {
+	auto getEdge(vertex_index_t from, vertex_index_t to, const edge_type& edge) const {
 		auto edges = this->edges(from, to);
 		while (!edges.empty()) {
 			const edge_type& this_e = *edges;
@@ -194,18 +204,18 @@ public:
 		return edges.end();
 	}
 
-	// ԶͼЧ
+	// 仅对多边图有效
 	template<bool dummy = multiEdges, typename = std::enable_if_t<dummy>>
-	bool hasEdge(unsigned from, unsigned to, const edge_type& edge) const {
+	bool hasEdge(vertex_index_t from, vertex_index_t to, const edge_type& edge) const {
 		return getEdge(from, to, edge) != edges(from, to).end();
 	}
 
-	// ضvߵfrom㼯
-	std::vector<unsigned> inedges(unsigned v) const {
-		std::vector<unsigned> ins;
-		for (unsigned u = 0; u < order(); u++) {
+	// 返回顶点v的所有入边的from顶点集合
+	std::vector<vertex_index_t> inedges(vertex_index_t v) const {
+		std::vector<vertex_index_t> ins;
+		for (vertex_index_t u = 0; u < order(); u++) {
 			auto r = edges(u, v);
-			for (unsigned i = 0; i < r.size(); i++)
+			for (decltype(r.size()) i = 0; i < r.size(); i++)
 				ins.push_back(u);
 		}
 		return ins;
@@ -219,14 +229,14 @@ protected:
 
 	template<typename VERTEX_TYPE = underly_vertex_t,
 		std::enable_if_t<has_outdegree_v<VERTEX_TYPE>, bool> = true>
-	auto outdegree_(unsigned v) const {
+	auto outdegree_(vertex_index_t v) const {
 		return vertex_traits<VERTEX_TYPE>::outdegree(graph_impl::vertexAt(v));
 	}
 };
 
 
 /////////////////////////////////////////////////////////////////////////////////////
-/// ػimmutableӿڣӦlevel = 1
+/// 特化immutable接口：对应于level = 1
 
 template<typename GRAPH_IMPL, bool digraph, bool multiEdges, bool alwaysSorted>
 class KtGraph<GRAPH_IMPL, digraph, multiEdges, alwaysSorted, 1>
@@ -236,15 +246,17 @@ public:
 	using graph_level_0 = KtGraph<GRAPH_IMPL, digraph, multiEdges, alwaysSorted, 0>;
 	using typename graph_level_0::edge_type;
 	using typename graph_level_0::underly_edge_t;
-	using graph_level_0::edges;  // const汾edges
+	using typename graph_level_0::vertex_index_t;
+	using typename graph_level_0::edge_index_t;
+	using graph_level_0::edges;  // 导入const版本的edges
 	using graph_level_0::isDigraph;
 	using graph_level_0::isDense;
 	using graph_level_0::isAlwaysSorted;
 	using graph_level_0::isMultiEdges;
 
 
-	// ṩһд汾edgesʵ
-	auto edges(unsigned from, unsigned to) {
+	// 提供一个可写版本的edges实现
+	auto edges(vertex_index_t from, vertex_index_t to) {
 		decltype(auto) r = graph_level_0::outedges(from);
 		if constexpr (isDense()) {
 			auto first = std::next(r.begin(), to);
@@ -255,7 +267,7 @@ public:
 		}
 		else if constexpr (isAlwaysSorted()) {
 			auto range = std::equal_range(r.begin(), r.end(), to, 
-				kPrivate::KpEdgeCompAllInOne<underly_edge_t>{});
+				kPrivate::KpEdgeCompAllInOne<underly_edge_t, vertex_index_t>{});
 			return KtRange(range.first, range.second);
 		}
 		else { 
@@ -275,9 +287,9 @@ public:
 	}
 
 
-	// ԵͼЧ
+	// 仅对单边图有效
 	template<bool dummy = !multiEdges, typename = std::enable_if_t<dummy>>
-	void setEdge(unsigned from, unsigned to, const edge_type& edge) {
+	void setEdge(vertex_index_t from, vertex_index_t to, const edge_type& edge) {
 		assert(graph_level_0::hasEdge(from, to));
 		auto edges = this->edges(from, to);
 		assert(edges.size() == 1);
@@ -287,9 +299,9 @@ public:
 	}
 
 
-	// ԶͼЧ
+	// 仅对多边图有效
 	template<bool dummy = multiEdges, typename = std::enable_if_t<dummy>>
-	void setEdge(unsigned from, unsigned to, const edge_type& curEdge, const edge_type& newEdge) {
+	void setEdge(vertex_index_t from, vertex_index_t to, const edge_type& curEdge, const edge_type& newEdge) {
 		assert(graph_level_0::hasEdge(from, to, curEdge));
 		decltype(auto) iter = getEdge_(from, to, curEdge);
 		*iter = newEdge;
@@ -304,10 +316,10 @@ public:
 
 	using graph_level_0::getEdge;
 
-	// 򵥱ͼṩgetEdgeֵӿڣͼ
-	// ΪͼʵϱߣҪȨֵһ
+	// 对于有向单边图提供getEdge的左值接口，无向图则不行
+	// 因为无向图实际上保存着两条边，需要保持权值一致性
 	template<bool dummy = !multiEdges && digraph, typename = std::enable_if_t<dummy>>
-	edge_type& getEdge(unsigned from, unsigned to) {
+	edge_type& getEdge(vertex_index_t from, vertex_index_t to) {
 		auto edges = this->edges(from, to);
 		assert(edges.size() == 1);
 		return *edges;
@@ -316,9 +328,9 @@ public:
 
 protected:
 
-	// ԶͼЧ
+	// 仅对多边图有效
 	template<bool dummy = multiEdges, typename = std::enable_if_t<dummy>>
-	auto getEdge_(unsigned from, unsigned to, const edge_type& edge) {
+	auto getEdge_(vertex_index_t from, vertex_index_t to, const edge_type& edge) {
 		auto edges = this->edges(from, to);
 		while (!edges.empty()) {
 			const edge_type& this_e = *edges;
@@ -333,7 +345,7 @@ protected:
 
 
 /////////////////////////////////////////////////////////////////////////////////////
-/// ػreshapableӿڣӦlevel = 2
+/// 特化reshapable接口：对应于level = 2
 //
 
 template<typename GRAPH_IMPL, bool digraph, bool multiEdges, bool alwaysSorted>
@@ -347,6 +359,8 @@ public:
 	using underly_edge_t = typename graph_traits<graph_level_1>::underly_edge_t;
 	using edge_iter = typename graph_traits<graph_level_1>::edge_iter;
 	using const_edge_iter = typename graph_traits<graph_level_1>::const_edge_iter;
+	using typename graph_level_1::vertex_index_t;
+	using typename graph_level_1::edge_index_t;
 
 	using graph_level_1::isDigraph;
 	using graph_level_1::isDense;
@@ -358,15 +372,58 @@ public:
 
 	KtGraph() = default;
 
-	KtGraph(unsigned nv) {
+	KtGraph(vertex_index_t nv) {
 		reset(nv);
 	}
 
 
-	// addVertexֱʹûʵ
+	// addVertex直接使用基类的实现
 	using graph_level_1::addVertex;
 
-	void addEdge(unsigned from, unsigned to, const edge_type& edge) {
+
+	// 批量赋值：将图重置为nv个顶点，并添加[first, last)的所有边
+	// 迭代器解引用须为tuple-like三元组(from, to, edge)，无向图每条边只需出现一次
+	// 若底层实现支持bulkAssign（如flat图），时间复杂度为O(V+E)，否则等同于逐条addEdge
+	template<typename ITER>
+	void assign(vertex_index_t nv, ITER first, ITER last) {
+		using triple_t = std::tuple<vertex_index_t, vertex_index_t, edge_type>;
+		using triple_iter = typename std::vector<triple_t>::iterator;
+
+		if constexpr (kPrivate::has_member_bulkAssign<GRAPH_IMPL, vertex_index_t,
+			triple_iter, triple_iter, edge_index_t>::value) {
+
+			std::vector<triple_t> es;
+			edge_index_t dummy(0);
+			for (; first != last; ++first) {
+				vertex_index_t from = std::get<0>(*first), to = std::get<1>(*first);
+				es.emplace_back(from, to, std::get<2>(*first));
+				if constexpr (!isDigraph())
+					if (from != to) {
+						es.emplace_back(to, from, std::get<2>(*first));
+						++dummy;
+					}
+			}
+
+			// bulkAssign按from顶点稳定散列，预先按to顶点稳定排序即可保证各顶点出边有序
+			if constexpr (isAlwaysSorted())
+				es = sortByTo_(nv, es);
+
+			graph_level_1::bulkAssign(nv, es.begin(), es.end(), dummy);
+
+			if constexpr (graph_level_1::vertexHasOutDegree_())
+				for (vertex_index_t v = 0; v < nv; v++)
+					outdegree_(v) = static_cast<std::decay_t<decltype(outdegree_(v))>>(
+						graph_level_1::outedges(v).size());
+		}
+		else {
+			reset(nv);
+			for (; first != last; ++first)
+				addEdge(std::get<0>(*first), std::get<1>(*first), std::get<2>(*first));
+		}
+	}
+
+
+	void addEdge(vertex_index_t from, vertex_index_t to, const edge_type& edge) {
 		addEdge_(from, to, edge);
 		if constexpr (!isDigraph()) {
 			if (from != to)
@@ -375,26 +432,26 @@ public:
 	}
 
 
-	// edgetoԣṩһ򻯰addEdgeӿ
+	// 若edge具to属性，提供一个简化版的addEdge接口
 	template<typename EDGE_TYPE,
 		std::enable_if_t<has_to_v<EDGE_TYPE>, bool> = true>
-	void addEdge(unsigned from, const EDGE_TYPE& edge) {
+	void addEdge(vertex_index_t from, const EDGE_TYPE& edge) {
 		addEdge(from, edge_traits<EDGE_TYPE>::to(edge), edge);
 	}
 
 
-	// edge_type͹죩ṩһaddEdgeļ򻯰
+	// 若允许（edge_type可整型构造），则提供一个addEdge的简化版
 	template<typename EDGE_TYPE = edge_type,
 		std::enable_if_t<std::is_constructible_v<EDGE_TYPE, int>, bool> = true>
-	void addEdge(unsigned from, unsigned to) {
+	void addEdge(vertex_index_t from, vertex_index_t to) {
 		addEdge(from, to, EDGE_TYPE{ 1 });
 	}
 
 
-	using graph_level_1::eraseEdge;  // eraseEdgeKtAdjIterҪõ
+	using graph_level_1::eraseEdge;  // 导出基类的eraseEdge，KtAdjIter要用到
 
-	// ɾfromtoб
-	void eraseEdge(unsigned from, unsigned to) {
+	// 删除from到to的所有边
+	void eraseEdge(vertex_index_t from, vertex_index_t to) {
 		eraseEdge_(from, to);
 		if constexpr (!isDigraph()) {
 			if (from != to)
@@ -403,9 +460,9 @@ public:
 	}
 
 
-	// ԶͼЧ
+	// 仅对多边图有效
 	template<bool dummy = multiEdges, typename = std::enable_if_t<dummy>>
-	void eraseEdge(unsigned v, unsigned w, const edge_type& val) {
+	void eraseEdge(vertex_index_t v, vertex_index_t w, const edge_type& val) {
 		assert(graph_level_1::hasEdge(v, w, val));
 
 		auto pos = graph_level_1::getEdge_(v, w, val);
@@ -422,20 +479,20 @@ public:
 	}
 
 
-	// TODO: Ż
-	void eraseOutEdges(unsigned v) {
+	// TODO: 优化
+	void eraseOutEdges(vertex_index_t v) {
 		if constexpr (isDense()) {
-			for (unsigned u = 0; u < order(); u++)
+			for (vertex_index_t u = 0; u < order(); u++)
 				eraseEdgeIfExist_(v, u);
 		}
 		else {
 			decltype(auto) r = graph_level_1::outedges(v);
 
-			std::set<unsigned> us; // flatͼıߴ洢֣ȱߵto㣬ɾͼ(to, from)
-								   // ִɾܻӰrеĵ
-								   // Ƕߣѡset
+			std::set<vertex_index_t> us; // 兼容类似flat图的边存储布局，先保存各条边的to顶点，而后再删除无向图(to, from)边
+								   // 如果先执行删除操作，可能会影响已在r中的迭代器
+								   // 考虑多边，选择set容器
 			if constexpr (!isDigraph()) 
-				for (auto& e : r)
+				for (auto&& e : r)
 					us.insert(to_(e));
 
 			if constexpr (graph_level_1::vertexHasOutDegree_())
@@ -450,35 +507,35 @@ public:
 	}
 
 
-	void eraseInEdges(unsigned v) {
+	void eraseInEdges(vertex_index_t v) {
 		if constexpr (!isDigraph()) {
 			eraseOutEdges(v);
 		}
 		else {
-			for (unsigned u = 0; u < order(); u++) 
+			for (vertex_index_t u = 0; u < order(); u++) 
 				eraseEdgeIfExist_(u, v);
 		}
 	}
 
 
-	// ɾ붥vӵб
-	void eraseEdges(unsigned v) {
+	// 删除与顶点v相接的所有边
+	void eraseEdges(vertex_index_t v) {
 		eraseOutEdges(v);
 		if constexpr (isDigraph())
 			eraseInEdges(v);
 	}
 
 
-	void eraseVertex(unsigned v) {
+	void eraseVertex(vertex_index_t v) {
 		eraseEdges(v);
 		graph_level_1::eraseVertex(v);
 
-		// ߵtoֵ
-		// TODO: alwaysSortedŻ
+		// 调整各边的to值
+		// TODO: 考虑alwaysSorted优化
 		if constexpr (!isDense()) {
-			for (unsigned i = 0; i < order(); i++) {
+			for (vertex_index_t i = 0; i < order(); i++) {
 				decltype(auto) r = graph_level_1::outedges(i);
-				for (auto& e : r) {
+				for (auto&& e : r) {
 					assert(to_(e) != v);
 					if (to_(e) > v) to_(e)--;
 				}
@@ -489,9 +546,24 @@ public:
 
 private:
 
-	// @dummy: Ϊtrueʾӵͼߵķ
+	// 按to顶点对边三元组进行稳定的计数排序
+	template<typename TRIPLE>
+	static std::vector<TRIPLE> sortByTo_(vertex_index_t nv, const std::vector<TRIPLE>& es) {
+		std::vector<std::size_t> offset(std::size_t(nv) + 1, 0);
+		for (auto& e : es)
+			++offset[std::get<1>(e) + 1];
+		for (vertex_index_t v = 0; v < nv; v++)
+			offset[v + 1] += offset[v];
+
+		std::vector<TRIPLE> sorted(es.size());
+		for (auto& e : es)
+			sorted[offset[std::get<1>(e)]++] = e;
+		return sorted;
+	}
+
+	// @dummy: 若为true，则表示添加的是无向图边的反向边
 	template<bool dummy = false>
-	void addEdge_(unsigned from, unsigned to, const edge_type& edge) {
+	void addEdge_(vertex_index_t from, vertex_index_t to, const edge_type& edge) {
 		decltype(auto) r = graph_level_1::outedges(from);
 		if constexpr (isDense()) {
 			graph_level_1::template addEdge<dummy>(from, std::next(r.begin(), to), edge);
@@ -499,12 +571,12 @@ private:
 		else if constexpr (!isAlwaysSorted()) {
 			static_assert(has_to_v<underly_edge_t>, "edge missing property of 'to'");
 
-			auto iter = graph_level_1::template addEdge<dummy>(from, r.end(), edge); // ӱߵβ
+			auto iter = graph_level_1::template addEdge<dummy>(from, r.end(), edge); // 若不排序，添加边到尾部
 			to_(*iter) = to;
 		}
 		else {
 			auto pos = std::lower_bound(r.begin(), r.end(), to, 
-				kPrivate::KpEdgeCompAllInOne<underly_edge_t>{});
+				kPrivate::KpEdgeCompAllInOne<underly_edge_t, vertex_index_t>{});
 			auto iter = graph_level_1::template addEdge<dummy>(from, pos, edge);
 			to_(*iter) = to;
 		}
@@ -515,7 +587,7 @@ private:
 
 
 	template<bool dummy = false>
-	void eraseEdge_(unsigned from, unsigned to) {
+	void eraseEdge_(vertex_index_t from, vertex_index_t to) {
 		auto edges = graph_level_1::edges(from, to);
 		assert(edges.size() > 0);
 			
@@ -532,7 +604,7 @@ private:
 			if constexpr (graph_level_1::vertexHasOutDegree_())
 				outdegree_(from) -= edges.size();
 		}
-		else {// δĶߣμ
+		else {// 未排序的多边，依次检查
 			do {
 				auto pos = graph_level_1::template eraseEdge<dummy>(from, edges.begin());
 				auto end = graph_level_1::outedges(from).end();
@@ -546,7 +618,7 @@ private:
 	}
 
 
-	void eraseEdgeIfExist_(unsigned from, unsigned to) {
+	void eraseEdgeIfExist_(vertex_index_t from, vertex_index_t to) {
 		if (!graph_level_1::edges(from, to).empty()) {
 			eraseEdge_(from, to);
 			if constexpr (!isDigraph())
@@ -572,7 +644,7 @@ private:
 
 	template<typename VERTEX_TYPE = underly_vertex_t,
 		std::enable_if_t<has_outdegree_v<VERTEX_TYPE>, bool> = true>
-	decltype(auto) outdegree_(unsigned v) {
+	decltype(auto) outdegree_(vertex_index_t v) {
 		return vertex_traits<VERTEX_TYPE>::outdegree(graph_level_1::vertexAt(v));
 	}
 };
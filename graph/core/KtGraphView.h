@@ -0,0 +1,570 @@
+#pragma once
+#include <vector>
+#include <optional>
+#include <iterator>
+#include <assert.h>
+#include "KtAdjIter.h"
+
+
+// 图的轻量视图：不复制边和顶点对象，以底层图为数据源提供派生图的只读访问
+// 视图满足graph_traits和KtAdjIter的约定，可直接用于bfs、dfs、连通分量等只读算法
+// 视图持有底层图的引用，底层图修改后（增删边、重排存储等）视图即失效
+//   KtReverseView - 有向图的逆，基于逆邻接索引
+//   KtUndirectedView - 有向图的底图
+//   KtFilteredView - 以谓词过滤边的子图
+//   KtInducedView - 顶点子集的导出子图，子图顶点重新编号为[0, n)
+
+
+// 视图的边：to顶点及指向底层边值的指针
+template<typename EDGE_TYPE, typename VERTEX_INDEX>
+struct KtViewEdge
+{
+    VERTEX_INDEX to;
+    const EDGE_TYPE* edge;
+
+    operator const EDGE_TYPE& () const { return *edge; }
+};
+
+
+template<typename EDGE_TYPE, typename VERTEX_INDEX>
+struct edge_traits<KtViewEdge<EDGE_TYPE, VERTEX_INDEX>> : public edge_traits<EDGE_TYPE>
+{
+    using edge_type = KtViewEdge<EDGE_TYPE, VERTEX_INDEX>;
+
+    static VERTEX_INDEX to(const edge_type& e) { return e.to; }
+};
+
+
+// 视图的出边区间，由游标CURSOR实现遍历逻辑
+// CURSOR须具有value_type类型，以及isEnd(), next(), deref()方法
+template<typename CURSOR>
+class KtViewRange
+{
+public:
+    using value_type = typename CURSOR::value_type;
+    using element_type = value_type;
+    using const_element_type = value_type;
+
+    class iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename CURSOR::value_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type;
+        using pointer = void;
+
+        iterator() = default;
+        explicit iterator(const std::optional<CURSOR>& cur) : cur_(cur) {}
+        iterator(const iterator&) = default;
+        iterator& operator=(const iterator& rhs) {
+            assign_(cur_, rhs.cur_), steps_ = rhs.steps_;
+            return *this;
+        }
+
+        value_type operator*() const { return cur_->deref(); }
+        iterator& operator++() { cur_->next(), ++steps_; return *this; }
+        iterator operator++(int) { auto tmp = *this; ++(*this); return tmp; }
+
+        bool operator==(const iterator& rhs) const {
+            return isEnd_() ? rhs.isEnd_() : (!rhs.isEnd_() && steps_ == rhs.steps_);
+        }
+        bool operator!=(const iterator& rhs) const { return !(*this == rhs); }
+
+    private:
+        bool isEnd_() const { return !cur_ || cur_->isEnd(); }
+
+    private:
+        std::optional<CURSOR> cur_;
+        std::size_t steps_{ 0 };
+    };
+
+    using const_iterator = iterator;
+
+
+    KtViewRange() = default;
+    explicit KtViewRange(const CURSOR& cur) : cur_(cur) {}
+    KtViewRange(const KtViewRange&) = default;
+    KtViewRange& operator=(const KtViewRange& rhs) {
+        assign_(cur_, rhs.cur_);
+        return *this;
+    }
+
+    bool empty() const { return !cur_ || cur_->isEnd(); }
+
+    KtViewRange& operator++() { cur_->next(); return *this; }
+
+    value_type operator*() const { return cur_->deref(); }
+
+    iterator begin() const { return iterator(cur_); }
+    iterator end() const { return iterator(); }
+
+    std::size_t size() const {
+        std::size_t n(0);
+        if (cur_)
+            for (auto c = *cur_; !c.isEnd(); c.next())
+                ++n;
+        return n;
+    }
+
+private:
+    // 游标可能含有引用成员而不可赋值，因此以重新构造的方式实现赋值
+    static void assign_(std::optional<CURSOR>& lhs, const std::optional<CURSOR>& rhs) {
+        lhs.reset();
+        if (rhs) lhs.emplace(*rhs);
+    }
+
+private:
+    std::optional<CURSOR> cur_;
+};
+
+
+namespace kPrivate
+{
+    // 遍历出边区间RANGE中to顶点为指定顶点的边
+    template<typename RANGE>
+    class KtMatchCursor_
+    {
+    public:
+        using value_type = typename RANGE::value_type;
+        using vertex_index_t = decltype(std::declval<value_type>().to);
+
+        KtMatchCursor_(const RANGE& r, vertex_index_t to) : r_(r), to_(to) {
+            skip_();
+        }
+
+        bool isEnd() const { return r_.empty(); }
+        void next() { ++r_; skip_(); }
+        value_type deref() const { return *r_; }
+
+    private:
+        void skip_() {
+            while (!r_.empty() && (*r_).to != to_)
+                ++r_;
+        }
+
+    private:
+        RANGE r_;
+        vertex_index_t to_;
+    };
+
+
+    // 视图的公共实现
+    template<typename VIEW, typename GRAPH>
+    class KtGraphViewBase_
+    {
+    public:
+        using graph_type = std::remove_const_t<GRAPH>;
+        using edge_type = typename graph_type::edge_type;
+        using vertex_type = typename graph_type::vertex_type;
+        using vertex_index_t = typename graph_type::vertex_index_t;
+        using edge_index_t = typename graph_type::edge_index_t;
+        using view_edge_t = KtViewEdge<edge_type, vertex_index_t>;
+
+        constexpr static vertex_index_t null_vertex = graph_type::null_vertex;
+
+        constexpr static bool isDense() { return false; }
+        constexpr static bool isAlwaysSorted() { return false; }
+        constexpr static bool hasVertex() { return graph_type::hasVertex(); }
+
+
+        explicit KtGraphViewBase_(const graph_type& g) : graph_(g) {}
+
+        const graph_type& graph() const { return graph_; }
+
+        bool isEmpty() const { return view_().order() == 0; }
+        bool isTrivial() const { return view_().order() == 1; }
+        bool isNull() const { return view_().size() == 0; }
+
+        edge_index_t outdegree(vertex_index_t v) const {
+            return static_cast<edge_index_t>(view_().outedges(v).size());
+        }
+
+        edge_index_t indegree(vertex_index_t v) const {
+            if constexpr (!VIEW::isDigraph()) {
+                return outdegree(v);
+            }
+            else {
+                edge_index_t d(0);
+                for (vertex_index_t u = 0; u < view_().order(); u++)
+                    for (auto r = view_().outedges(u); !r.empty(); ++r)
+                        if ((*r).to == v) ++d;
+                return d;
+            }
+        }
+
+        edge_index_t degree(vertex_index_t v) const {
+            auto d = outdegree(v);
+            if constexpr (VIEW::isDigraph())
+                d += indegree(v);
+            return d;
+        }
+
+        bool hasEdge(vertex_index_t from, vertex_index_t to) const {
+            for (auto r = view_().outedges(from); !r.empty(); ++r)
+                if ((*r).to == to) return true;
+            return false;
+        }
+
+        bool hasEdge(vertex_index_t from, vertex_index_t to, const edge_type& val) const {
+            for (auto r = view_().outedges(from); !r.empty(); ++r)
+                if ((*r).to == to && *(*r).edge == val) return true;
+            return false;
+        }
+
+        // 返回from到to的所有边
+        auto edges(vertex_index_t from, vertex_index_t to) const {
+            using range_t = decltype(view_().outedges(from));
+            using cursor_t = KtMatchCursor_<range_t>;
+            return KtViewRange<cursor_t>(cursor_t(view_().outedges(from), to));
+        }
+
+        const edge_type& getEdge(vertex_index_t from, vertex_index_t to) const {
+            auto r = view_().outedges(from);
+            while (!r.empty() && (*r).to != to) ++r;
+            assert(!r.empty());
+            return *(*r).edge;
+        }
+
+        bool hasLoop() const {
+            for (vertex_index_t v = 0; v < view_().order(); v++)
+                if (hasEdge(v, v)) return true;
+            return false;
+        }
+
+    protected:
+        const VIEW& view_() const { return static_cast<const VIEW&>(*this); }
+
+        // 按照视图的邻接关系统计边数
+        edge_index_t countEdges_() const {
+            std::size_t slots(0), loops(0);
+            for (vertex_index_t v = 0; v < view_().order(); v++)
+                for (auto r = view_().outedges(v); !r.empty(); ++r) {
+                    ++slots;
+                    if ((*r).to == v) ++loops;
+                }
+
+            // 无向图的非自环边在邻接关系中出现2次
+            return static_cast<edge_index_t>(VIEW::isDigraph() ? slots : (slots + loops) / 2);
+        }
+
+        // 逆邻接索引：各顶点的入边（from顶点及边值指针），按CSR格式存储
+        void buildReverseIndex_() {
+            auto V = graph_.order();
+            rOffset_.assign(std::size_t(V) + 1, 0);
+            for (vertex_index_t v = 0; v < V; v++)
+                for (auto iter = KtAdjIter<const graph_type>(graph_, v); !iter.isEnd(); ++iter)
+                    ++rOffset_[*iter + 1];
+
+            for (vertex_index_t v = 0; v < V; v++)
+                rOffset_[v + 1] += rOffset_[v];
+
+            rEdges_.resize(rOffset_[V]);
+            std::vector<std::size_t> pos(rOffset_.begin(), rOffset_.end() - 1);
+            for (vertex_index_t v = 0; v < V; v++)
+                for (auto iter = KtAdjIter<const graph_type>(graph_, v); !iter.isEnd(); ++iter)
+                    rEdges_[pos[*iter]++] = view_edge_t{ v, &iter.edge() };
+        }
+
+    protected:
+        const graph_type& graph_;
+        std::vector<std::size_t> rOffset_;
+        std::vector<view_edge_t> rEdges_;
+    };
+
+
+    // 遍历底层图的邻接边，跳过不满足谓词的边，并对to顶点进行映射
+    // @PRED: bool(vertex_index_t from, vertex_index_t to, const edge_type&)
+    // @MAP: vertex_index_t(vertex_index_t to)，返回映射后的顶点
+    template<typename GRAPH, typename PRED, typename MAP>
+    class KtAdjCursor_
+    {
+    public:
+        using vertex_index_t = typename GRAPH::vertex_index_t;
+        using value_type = KtViewEdge<typename GRAPH::edge_type, vertex_index_t>;
+
+        KtAdjCursor_(const GRAPH& g, vertex_index_t v, const PRED* pred, const MAP* map)
+            : iter_(g, v), pred_(pred), map_(map) {
+            skip_();
+        }
+
+        bool isEnd() const { return iter_.isEnd(); }
+        void next() { ++iter_; skip_(); }
+        value_type deref() const { return { (*map_)(*iter_), &iter_.edge() }; }
+
+    private:
+        void skip_() {
+            while (!iter_.isEnd() && !(*pred_)(iter_.from(), *iter_, iter_.edge()))
+                ++iter_;
+        }
+
+    private:
+        KtAdjIter<const GRAPH> iter_;
+        const PRED* pred_;
+        const MAP* map_;
+    };
+
+
+    // 先遍历底层图的出边，再遍历逆邻接索引中的入边（跳过自环）
+    template<typename GRAPH>
+    class KtBothCursor_
+    {
+    public:
+        using vertex_index_t = typename GRAPH::vertex_index_t;
+        using value_type = KtViewEdge<typename GRAPH::edge_type, vertex_index_t>;
+
+        KtBothCursor_(const GRAPH& g, vertex_index_t v, const value_type* first, const value_type* last)
+            : iter_(g, v), first_(first), last_(last), v_(v) {
+            skip_();
+        }
+
+        bool isEnd() const { return iter_.isEnd() && first_ == last_; }
+
+        void next() {
+            if (!iter_.isEnd()) ++iter_;
+            else ++first_;
+            skip_();
+        }
+
+        value_type deref() const {
+            return iter_.isEnd() ? *first_ : value_type{ *iter_, &iter_.edge() };
+        }
+
+    private:
+        void skip_() {
+            if (iter_.isEnd())
+                while (first_ != last_ && first_->to == v_)
+                    ++first_;
+        }
+
+    private:
+        KtAdjIter<const GRAPH> iter_;
+        const value_type* first_;
+        const value_type* last_;
+        vertex_index_t v_;
+    };
+
+
+    // 遍历[first, last)区间的视图边
+    template<typename VIEW_EDGE>
+    class KtSliceCursor_
+    {
+    public:
+        using value_type = VIEW_EDGE;
+
+        KtSliceCursor_(const value_type* first, const value_type* last)
+            : first_(first), last_(last) {}
+
+        bool isEnd() const { return first_ == last_; }
+        void next() { ++first_; }
+        value_type deref() const { return *first_; }
+
+    private:
+        const value_type* first_;
+        const value_type* last_;
+    };
+
+
+    struct KpAcceptAll_
+    {
+        template<typename... ARGS>
+        bool operator()(ARGS&&...) const { return true; }
+    };
+
+    struct KpIdentity_
+    {
+        template<typename T>
+        T operator()(T v) const { return v; }
+    };
+}
+
+
+// 有向图的逆视图：outedges(v)为底层图中v的入边
+// 构造时建立逆邻接索引，占用O(V + E)个(顶点索引, 指针)对，但不复制边对象
+template<typename DIGRAPH>
+class KtReverseView : public kPrivate::KtGraphViewBase_<KtReverseView<DIGRAPH>, DIGRAPH>
+{
+    static_assert(DIGRAPH::isDigraph(), "reverse view requires digraph");
+
+public:
+    using super_ = kPrivate::KtGraphViewBase_<KtReverseView<DIGRAPH>, DIGRAPH>;
+    using typename super_::vertex_index_t;
+    using typename super_::edge_index_t;
+    using typename super_::view_edge_t;
+    using edge_range = KtViewRange<kPrivate::KtSliceCursor_<view_edge_t>>;
+
+    constexpr static bool isDigraph() { return true; }
+    constexpr static bool isMultiEdges() { return DIGRAPH::isMultiEdges(); }
+
+    explicit KtReverseView(const DIGRAPH& g) : super_(g) {
+        super_::buildReverseIndex_();
+    }
+
+    vertex_index_t order() const { return super_::graph_.order(); }
+    edge_index_t size() const { return super_::graph_.size(); }
+
+    edge_range outedges(vertex_index_t v) const {
+        auto base = super_::rEdges_.data();
+        return edge_range({ base + super_::rOffset_[v], base + super_::rOffset_[v + 1] });
+    }
+
+    template<bool dummy = super_::hasVertex(), typename = std::enable_if_t<dummy>>
+    decltype(auto) vertexAt(vertex_index_t v) const { return super_::graph_.vertexAt(v); }
+};
+
+
+// 有向图的底图视图：outedges(v)为底层图中v的出边和入边之并
+// 底层图的边(v, w)和(w, v)在视图中成为2条平行边，因此视图总是允许平行边
+template<typename DIGRAPH>
+class KtUndirectedView : public kPrivate::KtGraphViewBase_<KtUndirectedView<DIGRAPH>, DIGRAPH>
+{
+    static_assert(DIGRAPH::isDigraph(), "undirected view requires digraph");
+
+public:
+    using super_ = kPrivate::KtGraphViewBase_<KtUndirectedView<DIGRAPH>, DIGRAPH>;
+    using typename super_::vertex_index_t;
+    using typename super_::edge_index_t;
+    using edge_range = KtViewRange<kPrivate::KtBothCursor_<DIGRAPH>>;
+
+    constexpr static bool isDigraph() { return false; }
+    constexpr static bool isMultiEdges() { return true; }
+
+    explicit KtUndirectedView(const DIGRAPH& g) : super_(g) {
+        super_::buildReverseIndex_();
+    }
+
+    vertex_index_t order() const { return super_::graph_.order(); }
+    edge_index_t size() const { return super_::graph_.size(); }
+
+    edge_range outedges(vertex_index_t v) const {
+        auto base = super_::rEdges_.data();
+        return edge_range({ super_::graph_, v, base + super_::rOffset_[v], base + super_::rOffset_[v + 1] });
+    }
+
+    template<bool dummy = super_::hasVertex(), typename = std::enable_if_t<dummy>>
+    decltype(auto) vertexAt(vertex_index_t v) const { return super_::graph_.vertexAt(v); }
+};
+
+
+// 边过滤视图：仅保留满足pred(from, to, edge)的边
+// 对于无向图，pred须满足对称性，即pred(v, w, e) == pred(w, v, e)
+template<typename GRAPH, typename PRED>
+class KtFilteredView : public kPrivate::KtGraphViewBase_<KtFilteredView<GRAPH, PRED>, GRAPH>
+{
+public:
+    using super_ = kPrivate::KtGraphViewBase_<KtFilteredView<GRAPH, PRED>, GRAPH>;
+    using typename super_::vertex_index_t;
+    using typename super_::edge_index_t;
+    using edge_range = KtViewRange<kPrivate::KtAdjCursor_<GRAPH, PRED, kPrivate::KpIdentity_>>;
+
+    constexpr static bool isDigraph() { return GRAPH::isDigraph(); }
+    constexpr static bool isMultiEdges() { return GRAPH::isMultiEdges(); }
+
+    KtFilteredView(const GRAPH& g, PRED pred) : super_(g), pred_(pred) {
+        size_ = super_::countEdges_();
+    }
+
+    vertex_index_t order() const { return super_::graph_.order(); }
+    edge_index_t size() const { return size_; }
+
+    edge_range outedges(vertex_index_t v) const {
+        return edge_range({ super_::graph_, v, &pred_, &map_ });
+    }
+
+    template<bool dummy = super_::hasVertex(), typename = std::enable_if_t<dummy>>
+    decltype(auto) vertexAt(vertex_index_t v) const { return super_::graph_.vertexAt(v); }
+
+private:
+    PRED pred_;
+    kPrivate::KpIdentity_ map_;
+    edge_index_t size_;
+};
+
+
+// 导出子图视图：由顶点子集及其间的全部边构成，子图顶点按子集的给定次序编号为[0, n)
+// 构造时建立O(V)的顶点编号映射
+template<typename GRAPH>
+class KtInducedView : public kPrivate::KtGraphViewBase_<KtInducedView<GRAPH>, GRAPH>
+{
+public:
+    using super_ = kPrivate::KtGraphViewBase_<KtInducedView<GRAPH>, GRAPH>;
+    using typename super_::vertex_index_t;
+    using typename super_::edge_index_t;
+    using super_::null_vertex;
+
+private:
+    // 只接受两端均在子集中的边
+    struct KpInSubset_
+    {
+        const std::vector<vertex_index_t>* local;
+        template<typename E>
+        bool operator()(vertex_index_t, vertex_index_t to, const E&) const {
+            return (*local)[to] != null_vertex;
+        }
+    };
+
+    // 将底层图的顶点映射为子图顶点
+    struct KpToLocal_
+    {
+        const std::vector<vertex_index_t>* local;
+        vertex_index_t operator()(vertex_index_t v) const { return (*local)[v]; }
+    };
+
+public:
+    using edge_range = KtViewRange<kPrivate::KtAdjCursor_<GRAPH, KpInSubset_, KpToLocal_>>;
+
+    constexpr static bool isDigraph() { return GRAPH::isDigraph(); }
+    constexpr static bool isMultiEdges() { return GRAPH::isMultiEdges(); }
+
+    // [first, last)为底层图的顶点子集，不能有重复顶点
+    template<typename ITER>
+    KtInducedView(const GRAPH& g, ITER first, ITER last)
+        : super_(g), global_(first, last), local_(g.order(), null_vertex) {
+        for (vertex_index_t i = 0; i < global_.size(); i++) {
+            assert(local_[global_[i]] == null_vertex);
+            local_[global_[i]] = i;
+        }
+
+        pred_.local = map_.local = &local_;
+        size_ = super_::countEdges_();
+    }
+
+    // 禁止复制，以免pred_, map_指向他者的local_
+    KtInducedView(const KtInducedView&) = delete;
+    KtInducedView& operator=(const KtInducedView&) = delete;
+
+    vertex_index_t order() const { return static_cast<vertex_index_t>(global_.size()); }
+    edge_index_t size() const { return size_; }
+
+    edge_range outedges(vertex_index_t v) const {
+        return edge_range({ super_::graph_, global_[v], &pred_, &map_ });
+    }
+
+    // 子图顶点v在底层图中的编号
+    vertex_index_t globalOf(vertex_index_t v) const { return global_[v]; }
+
+    // 底层图顶点v在子图中的编号，若v不在子图中，返回null_vertex
+    vertex_index_t localOf(vertex_index_t v) const { return local_[v]; }
+
+    template<bool dummy = super_::hasVertex(), typename = std::enable_if_t<dummy>>
+    decltype(auto) vertexAt(vertex_index_t v) const { return super_::graph_.vertexAt(global_[v]); }
+
+private:
+    std::vector<vertex_index_t> global_; // 子图顶点 -> 底层图顶点
+    std::vector<vertex_index_t> local_; // 底层图顶点 -> 子图顶点
+    KpInSubset_ pred_;
+    KpToLocal_ map_;
+    edge_index_t size_;
+};
+
+
+// 辅助构造函数
+
+template<typename DIGRAPH>
+auto reverse_view(const DIGRAPH& g) { return KtReverseView<DIGRAPH>(g); }
+
+template<typename DIGRAPH>
+auto undirected_view(const DIGRAPH& g) { return KtUndirectedView<DIGRAPH>(g); }
+
+template<typename GRAPH, typename PRED>
+auto filtered_view(const GRAPH& g, PRED pred) { return KtFilteredView<GRAPH, PRED>(g, pred); }
@@ -3,23 +3,24 @@
 #include "../util/copy.h"
 
 
-// ̰ģʽµıߵ
-// KtDfsIterҪڶԻĴ
-//  -- KtDfsIterʱὫıպ϶ջʼձֶջиΨһ
-//  -- KtGreedyIterʱὫպ϶ջŸöպ϶ڶջдڶʵ
+// 贪婪模式下的边迭代器
+// 与KtDfsIter的区别主要在于对环的处理：
+//  -- KtDfsIter遇到环时，不会将环的闭合顶点入栈，始终保持堆栈中各顶点的唯一性
+//  -- KtGreedyIter遇到环时，会将闭合顶点入栈，继续沿着该顶点进行深度优先搜索，闭合顶点在堆栈中存在多个实例
 
 template<typename GRAPH, bool fullGraph = false, bool stopAtPopping = false>
 class KtGreedyIter
 {
 public:
     using vertex_index_t = typename GRAPH::vertex_index_t;
+    using edge_index_t = typename GRAPH::edge_index_t;
     using edge_type = typename GRAPH::edge_type;
-	using flat_graph_t = KtGraph<KtFlatGraphVectorImpl<edge_type>, // Զ
+	using flat_graph_t = KtGraph<KtFlatGraphVectorImpl<edge_type, void, vertex_index_t, edge_index_t>, // 忽略顶点对象
 		GRAPH::isDigraph(), GRAPH::isMultiEdges(), GRAPH::isAlwaysSorted()>;
     using const_edge_ref = decltype(std::declval<const flat_graph_t>().edgeAt(0));
 
-    // ջԪͣ<0>Ϊfrom㣬<1><2>Ϊedge_indexrange
-    using stack_element_t = std::tuple<vertex_index_t, vertex_index_t, vertex_index_t>; 
+    // 堆栈元素类型，<0>为from顶点，<1><2>为待遍历edge_index的range
+    using stack_element_t = std::tuple<vertex_index_t, edge_index_t, edge_index_t>; 
 
 
 	KtGreedyIter(GRAPH& graph, vertex_index_t startVertex) {
@@ -49,24 +50,24 @@ public:
     }
 
 
-    // صǰĶ
+    // 返回当前正在游历的顶点
     vertex_index_t operator*() const { 
         return isPopping() ? std::get<0>(todo_.back())
                            : edge_traits<typename graph_traits<flat_graph_t>::underly_edge_t>::to(edge());
     }
 
 
-    // 뵱ǰ㣨to㣩ɱߵfrom
+    // 与当前顶点（to顶点）构成边的from顶点
     vertex_index_t from() const {
         assert(!isEnd());
         if (isPopping())
-            return todo_.size() > 1 ? std::get<0>(todo_[todo_.size() - 2]) : -1;
+            return todo_.size() > 1 ? std::get<0>(todo_[todo_.size() - 2]) : GRAPH::null_vertex;
         else 
             return std::get<0>(todo_.back());
     }
 
 
-    // ر(from, to)ֵ
+    // 返回边(from, to)的值
     const_edge_ref edge() const {
         assert(!isEnd());
         return graph_.edgeAt(std::get<1>(todo_.back()));
@@ -76,7 +77,7 @@ public:
     bool isEnd() const { return todo_.empty(); }
 
 
-    // Ӷvʼйȱ
+    // 从顶点v开始接续进行广度优先遍历
     void start(vertex_index_t v) {
         assert(todo_.empty());
         inStack_(v);
@@ -90,24 +91,24 @@ public:
 
 private:
 
-    // ԶջtupleǷ<1> == <2>
+    // 辅助函数，测试堆栈顶部的tuple是否<1> == <2>
     bool testStack_() const {
         return std::get<1>(todo_.back()) == std::get<2>(todo_.back());
     }
 
-    // ջ
+    // 入栈
     void inStack_(vertex_index_t v) {
         auto r = graph_.outedges(v);
         auto edgeidx = graph_.edgeIndex(v);
-        todo_.push_back({ v,  edgeidx, static_cast<vertex_index_t>(edgeidx + r.size()) });
+        todo_.push_back({ v,  edgeidx, static_cast<edge_index_t>(edgeidx + r.size()) });
     }
 
     void fixStack_() {
 
-        // ⵱ǰǷҪ
+        // 检测当前顶点是否需要跳过
         while (!todo_.empty()) {
 
-            // Ƴѽĵ
+            // 移除已结束的迭代器
             if (testStack_()) {
                 if constexpr (stopAtPopping) 
                     return; // stop at popping
@@ -127,21 +128,21 @@ private:
             break;
         }
 
-        // 
+        // 接续遍历
         if constexpr (fullGraph) {
             if (todo_.empty()) {
-                unsigned edgeidx = firstUnvisited_();
-                if (edgeidx != -1)
-                    start(graph_.edgeFrom(edgeidx)); // 
+                edge_index_t edgeidx = firstUnvisited_();
+                if (edgeidx != static_cast<edge_index_t>(-1))
+                    start(graph_.edgeFrom(edgeidx)); // 接续遍历
             }
         }
     }
 
 
-    unsigned firstUnvisited_() const {
+    edge_index_t firstUnvisited_() const {
         auto pos = std::find(vedges_.begin(), vedges_.end(), false);
-        return pos == vedges_.end() ? -1
-            : static_cast<vertex_index_t>(std::distance(vedges_.begin(), pos));
+        return pos == vedges_.end() ? static_cast<edge_index_t>(-1)
+            : static_cast<edge_index_t>(std::distance(vedges_.begin(), pos));
     }
 
 
@@ -152,15 +153,15 @@ private:
     }
 
 
-    // ǵedgeidxΪѱ
-    void markEdge_(unsigned edgeidx) {
+    // 标记第edgeidx边为已遍历
+    void markEdge_(edge_index_t edgeidx) {
         assert(!vedges_[edgeidx]);
 
-        vedges_[edgeidx] = true; // Ϊѱ
+        vedges_[edgeidx] = true; // 设置为已遍历
         auto edgefrom = from();
         auto edgeto = **this;
 
-        // ͼǷ
+        // 对于无向图，还须标记反向边
         if constexpr (!flat_graph_t::isDigraph()) {
             if (edgefrom != edgeto) {
                 const edge_type& wt = graph_.edgeAt(edgeidx);
@@ -0,0 +1,482 @@
+#pragma once
+#include <vector>
+#include <queue>
+#include <limits>
+#include <cstdlib>
+#include <algorithm>
+#include <type_traits>
+#include <assert.h>
+#include "KtWeightor.h"
+#include "KtAdjIter.h"
+
+
+// 最小费用最大流：在s到t的所有最大流中，找出总费用（各边流量与单位费用之积的和）最小的流
+// 各边的容量由CAP_WEIGHTOR取得，单位费用由COST_WEIGHTOR取得
+
+// 与KtMaxFlow不同，余留网采用扁平的CSR表示：原图的每条边v-w对应一对互逆的余留边，
+// 前边v-w的余留量为cap-flow、费用为cost，回边w-v的余留量为flow、费用为-cost，
+// 同一顶点的余留边连续存放，并记录每条余留边的互逆边，增广时无需增删边
+// 因此不要求v-w与w-v不能同时为边，也支持平行边
+
+// 最小费用流的基类，实现余留网基本操作
+template<typename GRAPH, class CAP_WEIGHTOR, class COST_WEIGHTOR>
+class KtMinCostFlow
+{
+    static_assert(GRAPH::isDigraph(), "KtMinCostFlow must be instantiated with Digraph.");
+
+public:
+    using flow_type = typename CAP_WEIGHTOR::weight_type;
+    using cost_type = typename COST_WEIGHTOR::weight_type;
+    using total_cost_type = std::conditional_t<std::is_integral_v<cost_type>, long long, cost_type>; // 总费用的类型，避免溢出
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+    using edge_index_t = typename GRAPH::edge_index_t; // 余留边的索引类型，余留边数为原图非自环边数的2倍
+    constexpr static vertex_index_t null_vertex = GRAPH::null_vertex;
+    constexpr static edge_index_t null_arc = static_cast<edge_index_t>(-1);
+
+    static_assert(std::is_integral_v<flow_type>, "min cost flow algorithm only support integral capacity");
+
+
+protected:
+
+    // 构造余留网，初始时为零流。自环对流无影响，被忽略
+    KtMinCostFlow(const GRAPH& g, vertex_index_t s, vertex_index_t t) : V_(g.order()), s_(s), t_(t) {
+        assert(s != t);
+
+        // 统计各顶点的余留边数：前边计入起点，回边计入终点
+        first_.assign(V_ + 1, 0);
+        for (vertex_index_t v = 0; v < V_; v++)
+            for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter)
+                if (*iter != v)
+                    ++first_[v + 1], ++first_[*iter + 1];
+        for (vertex_index_t v = 0; v < V_; v++)
+            first_[v + 1] += first_[v];
+
+        auto A = first_[V_];
+        head_.resize(A), rev_.resize(A), res_.resize(A), cost_.resize(A);
+        fwd_.reserve(A / 2);
+        isFwd_.assign(A, false);
+        std::vector<edge_index_t> pos(first_.begin(), first_.end() - 1);
+        for (vertex_index_t v = 0; v < V_; v++)
+            for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter) {
+                vertex_index_t w = *iter;
+                if (w == v) continue;
+
+                auto a = pos[v]++, b = pos[w]++;
+                head_[a] = w, rev_[a] = b, res_[a] = CAP_WEIGHTOR{}(iter.edge()), cost_[a] = COST_WEIGHTOR{}(iter.edge());
+                head_[b] = v, rev_[b] = a, res_[b] = 0, cost_[b] = -cost_[a];
+                assert(res_[a] >= 0);
+                fwd_.push_back(a), isFwd_[a] = true;
+            }
+    }
+
+
+public:
+
+    // 返回s到t的总流量
+    flow_type totalFlow() const {
+        flow_type f(0);
+        for (auto a = first_[s_]; a < first_[s_ + 1]; a++)
+            f += flow_(a);
+        return f;
+    }
+
+
+    // 返回总费用
+    total_cost_type totalCost() const {
+        total_cost_type c(0);
+        for (auto a : fwd_)
+            c += total_cost_type(flow_(a)) * cost_[a];
+        return c;
+    }
+
+
+    // 返回边v-w的流量，对于平行边返回流量之和
+    flow_type flow(vertex_index_t v, vertex_index_t w) const {
+        flow_type f(0);
+        for (auto a = first_[v]; a < first_[v + 1]; a++)
+            if (head_[a] == w)
+                f += flow_(a);
+        return f;
+    }
+
+
+    // 返回边v-w的费用，即流量与单位费用之积，对于平行边返回费用之和
+    total_cost_type cost(vertex_index_t v, vertex_index_t w) const {
+        total_cost_type c(0);
+        for (auto a = first_[v]; a < first_[v + 1]; a++)
+            if (head_[a] == w)
+                c += total_cost_type(flow_(a)) * cost_[a];
+        return c;
+    }
+
+
+    // 返回顶点v的净流量 = 流入量 - 流出量
+    flow_type netflow(vertex_index_t v) const {
+        flow_type f(0);
+        for (auto a = first_[v]; a < first_[v + 1]; a++)
+            f -= flow_(a) - flow_(rev_[a]);
+        return f;
+    }
+
+
+    // 检查流的守恒性
+    bool check() const {
+        if (netflow(s_) != -totalFlow() || netflow(t_) != totalFlow())
+            return false;
+
+        for (vertex_index_t v = 0; v < V_; v++)
+            if (v != s_ && v != t_ && netflow(v) != 0)
+                return false;
+
+        return true;
+    }
+
+
+protected:
+
+    // 余留边a的网流量：仅前边的流量可能非零
+    flow_type flow_(edge_index_t a) const {
+        return isFwd_[a] ? res_[rev_[a]] : 0;
+    }
+
+    // 对余留边a增加网流delta
+    void push_(edge_index_t a, flow_type delta) {
+        res_[a] -= delta;
+        res_[rev_[a]] += delta;
+    }
+
+
+protected:
+    vertex_index_t V_, s_, t_;
+    std::vector<edge_index_t> first_; // 顶点v的余留边为[first_[v], first_[v + 1])
+    std::vector<vertex_index_t> head_; // 余留边的终点
+    std::vector<edge_index_t> rev_; // 互逆的余留边
+    std::vector<flow_type> res_; // 余留量
+    std::vector<cost_type> cost_; // 单位费用
+    std::vector<edge_index_t> fwd_; // 原图各条边对应的前边
+    std::vector<bool> isFwd_; // 余留边是否为前边
+};
+
+
+
+// 基于连续最短路径（successive shortest paths）的最小费用最大流算法
+// 反复在余留网中沿费用最小的s-t路径增广，直至s到t不可达
+// 以顶点势p（Johnson势）将费用转换为非负的约化费用c(v, w) + p(v) - p(w)，从而可用Dijkstra算法搜索最短路径：
+//   初始时若有负费用，以Bellman-Ford算法计算势，否则势为0；
+//   每次搜索后以最短距离更新势，保持余留边的约化费用非负
+// Dijkstra在t出队时即提前结束，未确定距离的顶点的势保持不变
+// 需要增广的次数最多为最大流值，时间复杂度为O(F*E*lgV)，适用于流值不大的情形
+// 要求原图不含负费用的环
+template<typename GRAPH, class CAP_WEIGHTOR, class COST_WEIGHTOR>
+class KtMinCostFlowSsp : public KtMinCostFlow<GRAPH, CAP_WEIGHTOR, COST_WEIGHTOR>
+{
+public:
+    using super_ = KtMinCostFlow<GRAPH, CAP_WEIGHTOR, COST_WEIGHTOR>;
+    using typename super_::flow_type;
+    using typename super_::cost_type;
+    using typename super_::vertex_index_t;
+    using typename super_::edge_index_t;
+    using super_::null_arc;
+    using super_::V_;
+    using super_::s_;
+    using super_::t_;
+    using super_::first_;
+    using super_::head_;
+    using super_::rev_;
+    using super_::res_;
+    using super_::cost_;
+    using super_::push_;
+
+
+    // @maxFlow: 流量的上限，达到后即停止增广
+    KtMinCostFlowSsp(const GRAPH& g, vertex_index_t s, vertex_index_t t,
+        flow_type maxFlow = std::numeric_limits<flow_type>::max()) : super_(g, s, t) {
+
+        pot_.assign(V_, cost_type(0));
+        initPotential_();
+
+        const cost_type inf = std::numeric_limits<cost_type>::max();
+        std::vector<cost_type> dist(V_, inf);
+        std::vector<edge_index_t> parc(V_, null_arc); // 最短路径树中到达各顶点的余留边
+        std::vector<vertex_index_t> settled;
+        std::vector<bool> done(V_, false);
+        using heap_item = std::pair<cost_type, vertex_index_t>;
+        std::priority_queue<heap_item, std::vector<heap_item>, std::greater<heap_item>> heap;
+
+        flow_type total(0);
+        while (total < maxFlow) {
+
+            // 以约化费用搜索s到t的最短路径
+            dist[s_] = 0, heap.emplace(cost_type(0), s_);
+            std::vector<vertex_index_t> touched{ s_ };
+            while (!heap.empty()) {
+                auto [d, v] = heap.top(); heap.pop();
+                if (done[v]) continue;
+                done[v] = true, settled.push_back(v);
+                if (v == t_) break;
+
+                for (auto a = first_[v]; a < first_[v + 1]; a++) {
+                    if (res_[a] == 0) continue;
+                    auto w = head_[a];
+                    auto nd = d + cost_[a] + pot_[v] - pot_[w];
+                    if (!done[w] && nd < dist[w]) {
+                        if (dist[w] == inf) touched.push_back(w);
+                        dist[w] = nd, parc[w] = a;
+                        heap.emplace(nd, w);
+                    }
+                }
+            }
+
+            bool reached = done[t_];
+            if (reached) {
+                // 更新势：已确定距离的顶点增加dist[v] - dist[t]
+                auto dt = dist[t_];
+                for (auto v : settled)
+                    pot_[v] += dist[v] - dt;
+
+                // 沿最短路径增广
+                flow_type delta = maxFlow - total;
+                for (auto v = t_; v != s_; v = head_[rev_[parc[v]]])
+                    delta = std::min(delta, res_[parc[v]]);
+                for (auto v = t_; v != s_; v = head_[rev_[parc[v]]])
+                    push_(parc[v], delta);
+                total += delta;
+            }
+
+            for (auto v : touched)
+                dist[v] = inf, parc[v] = null_arc, done[v] = false;
+            settled.clear();
+            while (!heap.empty()) heap.pop();
+
+            if (!reached)
+                break;
+        }
+    }
+
+
+private:
+
+    // 存在负费用的边时，以Bellman-Ford（队列优化）算法计算s到各顶点的最短距离作为初始的势
+    void initPotential_() {
+        bool negative = false;
+        for (edge_index_t a = 0; a < head_.size(); a++)
+            if (res_[a] > 0 && cost_[a] < 0) {
+                negative = true;
+                break;
+            }
+        if (!negative)
+            return;
+
+        const cost_type inf = std::numeric_limits<cost_type>::max();
+        std::vector<cost_type> dist(V_, inf);
+        std::vector<bool> inQueue(V_, false);
+        std::queue<vertex_index_t> q;
+        dist[s_] = 0, q.push(s_), inQueue[s_] = true;
+        while (!q.empty()) {
+            auto v = q.front(); q.pop();
+            inQueue[v] = false;
+            for (auto a = first_[v]; a < first_[v + 1]; a++)
+                if (res_[a] > 0 && dist[v] + cost_[a] < dist[head_[a]]) {
+                    auto w = head_[a];
+                    dist[w] = dist[v] + cost_[a];
+                    if (!inQueue[w])
+                        q.push(w), inQueue[w] = true;
+                }
+        }
+
+        // s不可达的顶点不会出现在增广路径上，其势取0即可
+        for (vertex_index_t v = 0; v < V_; v++)
+            pot_[v] = dist[v] == inf ? cost_type(0) : dist[v];
+    }
+
+
+private:
+    std::vector<cost_type> pot_; // 顶点势
+};
+
+
+
+// 基于费用缩放（cost scaling）的最小费用最大流算法，即Goldberg-Tarjan算法
+// 先以Dinic算法求得一个最大流，再在保持流值的前提下逐步降低费用：
+// 若余留网中所有边的约化费用c(v, w) + p(v) - p(w) >= -eps，则称该流是eps-最优的。
+// 将费用乘以V+1后，1-最优的流即为最优流。算法从eps = 最大费用开始，每轮将eps缩小为1/alpha，
+// 并以推送-重标号的方式将(alpha*eps)-最优流调整为eps-最优流（refine）：
+//   1. 将所有约化费用为负的余留边充满，此时流是0-最优的，但不再守恒；
+//   2. 以FIFO队列选择超额量为正的活动顶点，沿约化费用为负的合格边推送流，
+//      无合格边时降低该顶点的势，使其至少一条余留边成为合格边。
+// 时间复杂度为O(V^2*E*lg(V*C))，与流值无关，适用于大规模的实例
+// 仅支持整数费用，可含负费用（但不能有负费用的环）
+template<typename GRAPH, class CAP_WEIGHTOR, class COST_WEIGHTOR>
+class KtMinCostFlowScaling : public KtMinCostFlow<GRAPH, CAP_WEIGHTOR, COST_WEIGHTOR>
+{
+public:
+    using super_ = KtMinCostFlow<GRAPH, CAP_WEIGHTOR, COST_WEIGHTOR>;
+    using typename super_::flow_type;
+    using typename super_::cost_type;
+    using typename super_::vertex_index_t;
+    using typename super_::edge_index_t;
+    using super_::null_vertex;
+    using super_::V_;
+    using super_::s_;
+    using super_::t_;
+    using super_::first_;
+    using super_::head_;
+    using super_::rev_;
+    using super_::res_;
+    using super_::cost_;
+    using super_::push_;
+
+    static_assert(std::is_integral_v<cost_type>, "cost scaling algorithm only support integral cost");
+
+
+    // @alpha: eps的缩小倍数
+    KtMinCostFlowScaling(const GRAPH& g, vertex_index_t s, vertex_index_t t, unsigned alpha = 16) : super_(g, s, t) {
+        maxFlow_();
+        minCost_(alpha);
+    }
+
+
+private:
+
+    // Dinic算法：以BFS构造层次图，再以非递归的DFS在层次图中反复寻找增广路径
+    void maxFlow_() {
+        constexpr vertex_index_t null = null_vertex;
+        std::vector<vertex_index_t> level(V_), q;
+        std::vector<edge_index_t> cur(V_), path;
+        q.reserve(V_);
+
+        while (true) {
+            std::fill(level.begin(), level.end(), null);
+            level[s_] = 0, q.clear(), q.push_back(s_);
+            for (std::size_t i = 0; i < q.size() && level[t_] == null; i++) {
+                auto v = q[i];
+                for (auto a = first_[v]; a < first_[v + 1]; a++)
+                    if (res_[a] > 0 && level[head_[a]] == null) {
+                        level[head_[a]] = level[v] + 1;
+                        q.push_back(head_[a]);
+                    }
+            }
+            if (level[t_] == null)
+                break;
+
+            std::copy(first_.begin(), first_.end() - 1, cur.begin());
+            path.clear();
+            vertex_index_t v = s_;
+            while (true) {
+                if (v == t_) {
+                    // 沿路径增广，并退回到第一条被充满的边的起点
+                    auto delta = res_[path[0]];
+                    for (auto a : path)
+                        delta = std::min(delta, res_[a]);
+                    std::size_t k = path.size();
+                    for (std::size_t i = 0; i < path.size(); i++) {
+                        push_(path[i], delta);
+                        if (res_[path[i]] == 0 && k == path.size())
+                            k = i;
+                    }
+                    path.resize(k);
+                    v = path.empty() ? s_ : head_[path.back()];
+                    continue;
+                }
+
+                // 前进：寻找层次图中的下一条边
+                auto& a = cur[v];
+                for (; a < first_[v + 1]; a++)
+                    if (res_[a] > 0 && level[head_[a]] == level[v] + 1)
+                        break;
+
+                if (a < first_[v + 1]) {
+                    path.push_back(a);
+                    v = head_[a];
+                }
+                else { // 后退：v不再可能到达t
+                    level[v] = null;
+                    if (v == s_) break;
+                    v = head_[rev_[path.back()]];
+                    path.pop_back();
+                    ++cur[v];
+                }
+            }
+        }
+    }
+
+
+    void minCost_(unsigned alpha) {
+        // 费用乘以V+1，使1-最优即为最优
+        scost_.resize(cost_.size());
+        long long eps(0);
+        for (std::size_t a = 0; a < cost_.size(); a++) {
+            scost_[a] = static_cast<long long>(cost_[a]) * (static_cast<long long>(V_) + 1);
+            if (res_[a] > 0) eps = std::max(eps, std::abs(scost_[a]));
+        }
+
+        pot_.assign(V_, 0);
+        excess_.assign(V_, 0);
+        cur_.resize(V_);
+        while (eps > 1) {
+            eps = std::max(eps / alpha, 1ll);
+            refine_(eps);
+        }
+    }
+
+
+    long long reducedCost_(vertex_index_t v, edge_index_t a) const {
+        return scost_[a] + pot_[v] - pot_[head_[a]];
+    }
+
+
+    void refine_(long long eps) {
+        // 充满所有约化费用为负的余留边
+        for (vertex_index_t v = 0; v < V_; v++)
+            for (auto a = first_[v]; a < first_[v + 1]; a++)
+                if (res_[a] > 0 && reducedCost_(v, a) < 0) {
+                    excess_[v] -= res_[a], excess_[head_[a]] += res_[a];
+                    push_(a, res_[a]);
+                }
+
+        std::queue<vertex_index_t> active;
+        for (vertex_index_t v = 0; v < V_; v++) {
+            cur_[v] = first_[v];
+            if (excess_[v] > 0)
+                active.push(v);
+        }
+
+        while (!active.empty()) {
+            auto v = active.front(); active.pop();
+            while (excess_[v] > 0) {
+                // 推送：沿合格边推送尽可能多的流
+                auto& a = cur_[v];
+                for (; a < first_[v + 1]; a++)
+                    if (res_[a] > 0 && reducedCost_(v, a) < 0)
+                        break;
+
+                if (a < first_[v + 1]) {
+                    auto w = head_[a];
+                    auto delta = std::min(excess_[v], res_[a]);
+                    push_(a, delta);
+                    excess_[v] -= delta;
+                    if (excess_[w] <= 0 && excess_[w] + delta > 0)
+                        active.push(w);
+                    excess_[w] += delta;
+                }
+                else {
+                    // 重标号：降低v的势，使约化费用最大的余留边恰为-eps
+                    long long p = std::numeric_limits<long long>::lowest();
+                    for (auto b = first_[v]; b < first_[v + 1]; b++)
+                        if (res_[b] > 0)
+                            p = std::max(p, pot_[head_[b]] - scost_[b]);
+                    assert(p != std::numeric_limits<long long>::lowest());
+                    pot_[v] = p - eps;
+                    a = first_[v];
+                }
+            }
+        }
+    }
+
+
+private:
+    std::vector<long long> scost_; // 缩放后的费用
+    std::vector<long long> pot_; // 顶点势
+    std::vector<flow_type> excess_; // 超额量
+    std::vector<edge_index_t> cur_; // 当前边
+};
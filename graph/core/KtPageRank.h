@@ -0,0 +1,213 @@
+#pragma once
+#include <vector>
+#include <deque>
+#include <cmath>
+#include <unordered_map>
+#include "KtSpmv.h"
+
+
+// PageRank：随机游走者以概率d沿当前顶点的一条出边随机前进，以概率1-d按传送分布t跳转，
+// 各顶点的稳态访问概率即为其PageRank值：
+//   r[v] = (1-d) * t[v] + d * (Σr[u]/outdeg(u) (u->v) + D * t[v])
+// 其中D为无出边顶点（悬挂顶点）的PageRank之和，游走到悬挂顶点后按传送分布跳转
+// 全局PageRank的t为均匀分布，个性化PageRank（PPR）的t集中于给定的种子顶点
+// 基于KtSpmv的拉取方式迭代（幂迭代），直至相邻两次迭代的L1距离小于tol，或迭代次数达到maxIter
+template<typename GRAPH>
+class KtPageRank
+{
+public:
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+
+
+    // 全局PageRank
+    KtPageRank(const KtSpmv<GRAPH>& spmv, double damping = 0.85, double tol = 1e-9, unsigned maxIter = 100)
+        : spmv_(spmv) {
+        run_(damping, tol, maxIter);
+    }
+
+
+    // 个性化PageRank：传送分布为seeds中的(顶点, 权值)，权值自动归一化
+    KtPageRank(const KtSpmv<GRAPH>& spmv, const std::vector<std::pair<vertex_index_t, double>>& seeds,
+        double damping = 0.85, double tol = 1e-9, unsigned maxIter = 100) : spmv_(spmv) {
+        double sum(0);
+        for (auto& s : seeds) sum += s.second;
+        tele_.assign(spmv.order(), 0);
+        for (auto& s : seeds)
+            tele_[s.first] += s.second / sum;
+
+        run_(damping, tol, maxIter);
+    }
+
+
+    double rank(vertex_index_t v) const { return rank_[v]; }
+
+    const std::vector<double>& ranks() const { return rank_; }
+
+    // 实际的迭代次数
+    unsigned iterations() const { return iters_; }
+
+    // 是否在maxIter次迭代内收敛
+    bool converged() const { return converged_; }
+
+
+private:
+
+    double teleport_(vertex_index_t v) const {
+        return tele_.empty() ? 1.0 / spmv_.order() : tele_[v];
+    }
+
+    void run_(double d, double tol, unsigned maxIter) {
+        auto V = spmv_.order();
+        rank_.resize(V);
+        for (vertex_index_t v = 0; v < V; v++)
+            rank_[v] = teleport_(v);
+
+        std::vector<double> contrib(V), next(V);
+        iters_ = 0, converged_ = false;
+        while (iters_ < maxIter && !converged_) {
+            // 各顶点对出边邻接点的贡献，同时统计悬挂顶点的PageRank之和
+            double dangling = spmv_.map([this, &contrib](vertex_index_t v) {
+                auto deg = spmv_.outdegree(v);
+                contrib[v] = deg ? rank_[v] / deg : 0;
+                return deg ? 0 : rank_[v];
+            });
+
+            double diff = spmv_.pull(contrib.data(), [this, &next, d, dangling](vertex_index_t v, double s) {
+                auto t = teleport_(v);
+                next[v] = (1 - d) * t + d * (s + dangling * t);
+                return std::abs(next[v] - rank_[v]);
+            });
+
+            rank_.swap(next);
+            ++iters_;
+            converged_ = diff < tol;
+        }
+    }
+
+
+private:
+    const KtSpmv<GRAPH>& spmv_;
+    std::vector<double> tele_; // 传送分布，为空时取均匀分布
+    std::vector<double> rank_;
+    unsigned iters_;
+    bool converged_;
+};
+
+
+
+// 基于前向推送（forward push）的单种子个性化PageRank近似算法（Andersen-Chung-Lang）
+// 维护估计值p和残差r，初始时r[seed] = 1，反复选取r[u] >= eps*outdeg(u)的顶点u：
+//   p[u] += (1-d) * r[u]，并将d * r[u]平均推送给u的各出边邻接点，然后r[u] = 0
+// 悬挂顶点的d * r[u]推送回种子，与KtPageRank的悬挂处理一致
+// 结束时对每个顶点v，|p[v] - ppr[v]|的总和不超过Σr，而r[v] < eps*max(outdeg(v), 1)
+// 工作量为O(1 / ((1-d) * eps))，与图的规模无关，只访问种子附近的顶点
+template<typename GRAPH>
+class KtPageRankPush
+{
+public:
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+
+    KtPageRankPush(const GRAPH& g, vertex_index_t seed, double damping = 0.85, double eps = 1e-7)
+        : pushes_(0) {
+        auto degree = [&g](vertex_index_t v) { return std::max<std::size_t>(g.outdegree(v), 1); };
+
+        std::unordered_map<vertex_index_t, double> res;
+        std::deque<vertex_index_t> active;
+        res[seed] = 1;
+        active.push_back(seed);
+
+        while (!active.empty()) {
+            auto u = active.front(); active.pop_front();
+            double ru = res[u];
+            if (ru < eps * degree(u))
+                continue;
+
+            res[u] = 0;
+            p_[u] += (1 - damping) * ru;
+            ++pushes_;
+
+            auto add = [&](vertex_index_t w, double x) {
+                auto& rw = res[w];
+                bool wasActive = rw >= eps * degree(w);
+                rw += x;
+                if (!wasActive && rw >= eps * degree(w))
+                    active.push_back(w);
+            };
+
+            auto deg = g.outdegree(u);
+            if (deg == 0)
+                add(seed, damping * ru);
+            else
+                for (auto iter = KtAdjIter(g, u); !iter.isEnd(); ++iter)
+                    add(*iter, damping * ru / deg);
+        }
+
+        for (auto& r : res)
+            residual_ += r.second;
+    }
+
+
+    // 顶点v的近似PPR值，未访问的顶点为0
+    double rank(vertex_index_t v) const {
+        auto iter = p_.find(v);
+        return iter == p_.end() ? 0 : iter->second;
+    }
+
+    const std::unordered_map<vertex_index_t, double>& ranks() const { return p_; }
+
+    // 剩余的残差总和，即近似误差的L1上界
+    double residual() const { return residual_; }
+
+    // 推送次数
+    std::size_t pushes() const { return pushes_; }
+
+
+private:
+    std::unordered_map<vertex_index_t, double> p_;
+    double residual_ = 0;
+    std::size_t pushes_;
+};
+
+
+
+// Katz中心性：x = alpha * A^T * x + beta，即x[v] = alpha * Σx[u] (u->v) + beta
+// 等价于以alpha^k为权累计到达v的所有长度为k的路径数，须满足alpha < 1/λmax（A的最大特征值）才能收敛
+// 结果未归一化
+template<typename GRAPH>
+class KtKatz
+{
+public:
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+
+    KtKatz(const KtSpmv<GRAPH>& spmv, double alpha = 0.1, double beta = 1, double tol = 1e-9, unsigned maxIter = 1000) {
+        auto V = spmv.order();
+        x_.assign(V, 0);
+        std::vector<double> next(V);
+        iters_ = 0, converged_ = false;
+        while (iters_ < maxIter && !converged_) {
+            double diff = spmv.pull(x_.data(), [this, &next, alpha, beta](vertex_index_t v, double s) {
+                next[v] = alpha * s + beta;
+                return std::abs(next[v] - x_[v]);
+            });
+
+            x_.swap(next);
+            ++iters_;
+            converged_ = diff < tol;
+        }
+    }
+
+
+    double centrality(vertex_index_t v) const { return x_[v]; }
+
+    const std::vector<double>& centralities() const { return x_; }
+
+    unsigned iterations() const { return iters_; }
+
+    bool converged() const { return converged_; }
+
+
+private:
+    std::vector<double> x_;
+    unsigned iters_;
+    bool converged_;
+};
@@ -0,0 +1,828 @@
+#pragma once
+#include <vector>
+#include <queue>
+#include <tuple>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+#include <type_traits>
+#include <assert.h>
+#include "KtWeightor.h"
+#include "KtAdjIter.h"
+#include "../base/parallel_for.h"
+
+
+// 多级k路图划分：将顶点划分为k个权值大致均衡的部分，使跨部分的边尽量少，用于将大图分片到多个工作进程
+// 有向图按其底图划分（两个方向的边权相加），自环被忽略，平行边的权值相加
+// 边权由WEIGHTOR取得，须为非负整数；顶点权缺省为1，也可由调用者给定
+//
+// 算法分三个阶段（参见METIS的多级框架）：
+//   粗化：以重边匹配（heavy-edge matching）将匹配的顶点对收缩为粗图的一个顶点，重复至粗图足够小。
+//     匹配以握手方式并行求得：各未匹配顶点选出边权（按两端顶点权值归一）最大的未匹配邻接点，互选者配对，重复数轮；
+//     只匹配加权度数相近的顶点，以保留幂律图的层次结构。收缩时各线程合并一段粗顶点的邻接表
+//   初始划分：在最粗的图上递归二分，每次二分多次以贪心生长法（从随机顶点出发，优先吸收与当前部分连接最紧的顶点）
+//     构造划分并精化，取割边最少者
+//   反粗化：将划分逐级投影回细图，每级先做若干轮标签传播精化：并行地为各边界顶点求出最优的目标部分，
+//     再串行地依次复核增益和均衡约束后移动；然后做FM精化：按增益从大到小移动顶点（允许负增益以跳出局部最优），
+//     每个顶点至多移动一次，最后回滚到过程中割边最少的状态
+// 孤立顶点不参与以上过程，最后用于填充较轻的部分
+// 均衡约束：各部分的顶点权之和不超过(1 + imbalance) * 总权 / k（向上取整），超重的部分优先向外移出顶点
+// 目标可选总割边权（k_edge_cut）或总通信量（k_comm_volume，即各顶点所连的其他部分数之和）。
+// 后者在割边精化之后，再以精确的通信量增益（需扫描邻接点的邻接点）做若干轮标签传播精化
+// 匹配、收缩和标签传播的结果均与线程数无关，因此给定种子时划分结果是确定的
+template<typename GRAPH, class WEIGHTOR = unit_min_wtor<GRAPH>>
+class KtPartition
+{
+public:
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+    using weight_type = typename WEIGHTOR::weight_type;
+    using part_index_t = vertex_index_t; // 部分的序号，部分数不超过顶点数
+    constexpr static vertex_index_t null_vertex = GRAPH::null_vertex;
+    constexpr static part_index_t null_part = GRAPH::null_vertex;
+
+    static_assert(std::is_integral_v<weight_type>, "KtPartition only support integral edge weight");
+
+    // 优化目标
+    enum objective
+    {
+        k_edge_cut, // 割边的权值之和
+        k_comm_volume // 各顶点所连的其他部分数之和
+    };
+
+
+    // @k: 划分的部分数
+    // @imbalance: 允许各部分的权值超出平均值的比例
+    // @nthreads: 线程数，为0时取hardware_threads()
+    // @seed: 初始划分和匹配的随机种子
+    KtPartition(const GRAPH& g, part_index_t k, double imbalance = 0.03, objective obj = k_edge_cut,
+        unsigned nthreads = 0, std::uint64_t seed = 0)
+        : KtPartition(g, std::vector<long long>(g.order(), 1), k, imbalance, obj, nthreads, seed) {}
+
+
+    // @vwgt: 各顶点的权值，须为正
+    KtPartition(const GRAPH& g, const std::vector<long long>& vwgt, part_index_t k, double imbalance = 0.03,
+        objective obj = k_edge_cut, unsigned nthreads = 0, std::uint64_t seed = 0)
+        : k_(std::max<part_index_t>(k, 1)), nthreads_(nthreads ? nthreads : hardware_threads()), seed_(seed) {
+        assert(vwgt.size() == g.order());
+
+        KpLevel_ full;
+        build_(g, vwgt, full);
+
+        long long total(0);
+        for (auto w : vwgt) total += w;
+        maxPartWeight_ = static_cast<long long>(std::ceil((1 + imbalance) * double(total) / k_));
+
+        // 孤立顶点（含仅有自环的顶点）不影响割边和通信量，不参与多级划分，最后用于填充较轻的部分。
+        // 这样其余顶点的划分在均衡约束上有更多余地（幂律图中孤立顶点的比例往往很高）
+        std::vector<vertex_index_t> core, isolated;
+        for (vertex_index_t v = 0; v < full.order(); v++)
+            (full.xadj[v + 1] > full.xadj[v] ? core : isolated).push_back(v);
+        levels_.push_back(isolated.empty() ? full : induced_(full, core));
+
+        std::vector<long long> maxw(k_, maxPartWeight_);
+        const bool volume = obj == k_comm_volume;
+        coarsen_();
+        auto part = initialPartition_(levels_.back());
+        refine_(levels_.back(), part, maxw, volume);
+        for (auto i = levels_.size() - 1; i > 0; i--) {
+            auto& coarse = levels_[i - 1]; // levels_[i - 1].cmap将其顶点映射到levels_[i]
+            std::vector<part_index_t> fine(coarse.order());
+            for (vertex_index_t v = 0; v < coarse.order(); v++)
+                fine[v] = part[coarse.cmap[v]];
+            part.swap(fine);
+            levels_.pop_back();
+            refine_(levels_.back(), part, maxw, volume);
+        }
+        levels_.clear();
+
+        part_.assign(full.order(), 0);
+        partWeight_.assign(k_, 0);
+        for (vertex_index_t i = 0; i < core.size(); i++) {
+            part_[core[i]] = part[i];
+            partWeight_[part[i]] += full.vwgt[core[i]];
+        }
+
+        // 孤立顶点按权值从大到小依次放入当前最轻的部分
+        std::stable_sort(isolated.begin(), isolated.end(), [&full](vertex_index_t a, vertex_index_t b) {
+            return full.vwgt[a] > full.vwgt[b];
+        });
+        for (auto v : isolated) {
+            auto p = part_index_t(std::min_element(partWeight_.begin(), partWeight_.end()) - partWeight_.begin());
+            part_[v] = p;
+            partWeight_[p] += full.vwgt[v];
+        }
+
+        cut_ = cut_of_(full, part_);
+        volume_ = volume_of_(full, part_);
+    }
+
+
+    part_index_t numParts() const { return k_; }
+
+    // 顶点v所属的部分
+    part_index_t part(vertex_index_t v) const { return part_[v]; }
+
+    const std::vector<part_index_t>& parts() const { return part_; }
+
+    // 割边的权值之和
+    long long edgeCut() const { return cut_; }
+
+    // 总通信量
+    long long commVolume() const { return volume_; }
+
+    // 第p部分的顶点权值之和
+    long long partWeight(part_index_t p) const { return partWeight_[p]; }
+
+    // 均衡约束允许的部分权值上限
+    long long maxPartWeight() const { return maxPartWeight_; }
+
+    // 最重部分的权值与平均权值之比
+    double imbalance() const {
+        long long total(0), maxw(0);
+        for (auto w : partWeight_)
+            total += w, maxw = std::max(maxw, w);
+        return total ? double(maxw) * k_ / total : 1;
+    }
+
+
+    // 第p部分的顶点，按序号递增
+    std::vector<vertex_index_t> members(part_index_t p) const {
+        std::vector<vertex_index_t> vs;
+        for (vertex_index_t v = 0; v < part_.size(); v++)
+            if (part_[v] == p)
+                vs.push_back(v);
+        return vs;
+    }
+
+
+    // 第p部分的导出子图，子图顶点i对应g的顶点members(p)[i]，保留边值
+    // 仅需只读访问时，也可以members(p)构造KtInducedView
+    template<typename DST = GRAPH>
+    DST subgraph(const GRAPH& g, part_index_t p) const {
+        using triple_t = std::tuple<vertex_index_t, vertex_index_t, typename GRAPH::edge_type>;
+        auto vs = members(p);
+        std::vector<vertex_index_t> local(g.order(), GRAPH::null_vertex);
+        for (vertex_index_t i = 0; i < vs.size(); i++)
+            local[vs[i]] = i;
+
+        std::vector<triple_t> es;
+        for (auto v : vs)
+            for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter) {
+                auto w = *iter;
+                if (part_[w] == p && (GRAPH::isDigraph() || v <= w))
+                    es.emplace_back(local[v], local[w], iter.edge());
+            }
+
+        DST sub;
+        sub.assign(vertex_index_t(vs.size()), es.begin(), es.end());
+        return sub;
+    }
+
+
+private:
+
+    // 各级图的CSR表示
+    struct KpLevel_
+    {
+        std::vector<std::size_t> xadj; // 顶点v的邻接点为adj[xadj[v], xadj[v + 1])
+        std::vector<vertex_index_t> adj;
+        std::vector<long long> ewgt;
+        std::vector<long long> vwgt;
+        std::vector<vertex_index_t> cmap; // 顶点在下一级粗图中的编号
+
+        vertex_index_t order() const { return vertex_index_t(vwgt.size()); }
+    };
+
+
+    // 由种子和两个整数生成的伪随机数（splitmix64的混合函数）
+    static std::uint64_t hash_(std::uint64_t seed, std::uint64_t a, std::uint64_t b = 0) {
+        std::uint64_t z = seed + (a + 1) * 0x9e3779b97f4a7c15ull + b * 0xd1b54a32d192ed03ull;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+
+    // 构造对称的简单图CSR：去除自环，合并平行边和互逆边的权值
+    void build_(const GRAPH& g, const std::vector<long long>& vwgt, KpLevel_& lv) const {
+        const vertex_index_t V = g.order();
+        std::vector<std::size_t> first(std::size_t(V) + 1, 0);
+        for (vertex_index_t v = 0; v < V; v++)
+            for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter)
+                if (*iter != v) {
+                    ++first[v + 1];
+                    if (GRAPH::isDigraph())
+                        ++first[*iter + 1];
+                }
+        for (vertex_index_t v = 0; v < V; v++)
+            first[v + 1] += first[v];
+
+        std::vector<vertex_index_t> adj(first[V]);
+        std::vector<long long> ewgt(first[V]);
+        std::vector<std::size_t> pos(first.begin(), first.end() - 1);
+        for (vertex_index_t v = 0; v < V; v++)
+            for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter)
+                if (*iter != v) {
+                    long long wt = WEIGHTOR{}(iter.edge());
+                    assert(wt >= 0);
+                    auto i = pos[v]++;
+                    adj[i] = *iter, ewgt[i] = wt;
+                    if (GRAPH::isDigraph()) {
+                        auto j = pos[*iter]++;
+                        adj[j] = v, ewgt[j] = wt;
+                    }
+                }
+
+        // 合并重复的邻接点
+        lv.vwgt = vwgt;
+        lv.xadj.assign(std::size_t(V) + 1, 0);
+        lv.adj.clear(), lv.ewgt.clear();
+        std::vector<std::size_t> slot(V, std::size_t(-1));
+        for (vertex_index_t v = 0; v < V; v++) {
+            auto start = lv.adj.size();
+            for (auto i = first[v]; i < first[v + 1]; i++) {
+                auto w = adj[i];
+                if (slot[w] != std::size_t(-1) && slot[w] >= start)
+                    lv.ewgt[slot[w]] += ewgt[i];
+                else {
+                    slot[w] = lv.adj.size();
+                    lv.adj.push_back(w), lv.ewgt.push_back(ewgt[i]);
+                }
+            }
+            lv.xadj[v + 1] = lv.adj.size();
+        }
+    }
+
+
+    void coarsen_() {
+        long long total(0);
+        for (auto w : levels_[0].vwgt) total += w;
+        const vertex_index_t coarsenTo = std::max<vertex_index_t>(30 * k_, 64);
+        const long long maxVwgt = std::max<long long>(1, static_cast<long long>(1.5 * double(total) / coarsenTo));
+
+        while (levels_.back().order() > coarsenTo) {
+            auto& fine = levels_.back();
+            auto match = match_(fine, maxVwgt, unsigned(levels_.size()));
+
+            vertex_index_t nc(0);
+            fine.cmap.assign(fine.order(), 0);
+            for (vertex_index_t v = 0; v < fine.order(); v++)
+                if (match[v] >= v)
+                    fine.cmap[v] = fine.cmap[match[v]] = nc++;
+
+            if (nc > 0.95 * fine.order()) { // 收缩过慢，停止粗化
+                fine.cmap.clear();
+                break;
+            }
+
+            KpLevel_ coarse = contract_(fine, nc);
+            levels_.push_back(std::move(coarse));
+        }
+    }
+
+
+    // 握手式的重边匹配，返回各顶点的匹配顶点，未匹配的顶点与自身匹配
+    std::vector<vertex_index_t> match_(const KpLevel_& lv, long long maxVwgt, unsigned level) const {
+        constexpr vertex_index_t none = null_vertex;
+        const vertex_index_t n = lv.order();
+        std::vector<vertex_index_t> match(n, none), pick(n);
+
+        // 仅匹配加权度数相近（相差不超过一倍）的顶点。幂律图中若低度顶点并入与之相连的中心点，
+        // 粗图将退化为近乎完全图，失去稠密核心与外围低度顶点的分层结构，初始划分难以找到小割
+        std::vector<double> dw(n, 0);
+        for (vertex_index_t v = 0; v < n; v++)
+            for (auto i = lv.xadj[v]; i < lv.xadj[v + 1]; i++)
+                dw[v] += lv.ewgt[i];
+        auto similar = [&dw](vertex_index_t u, vertex_index_t v) { return dw[u] <= 2 * dw[v] && dw[v] <= 2 * dw[u]; };
+
+        for (unsigned round = 0; round < 8; round++) {
+            parallel_for(vertex_index_t(0), n, [&](vertex_index_t v) {
+                pick[v] = none;
+                if (match[v] != none) return;
+                double bestW(-1);
+                std::uint64_t bestH(0);
+                for (auto i = lv.xadj[v]; i < lv.xadj[v + 1]; i++) {
+                    auto u = lv.adj[i];
+                    if (match[u] != none || lv.vwgt[u] + lv.vwgt[v] > maxVwgt || !similar(u, v))
+                        continue;
+                    // 边权相同时以边的随机数决胜，两端对同一条边的判断一致，互选的机会较大
+                    auto h = hash_(seed_ + level, std::min(u, v), std::max(u, v));
+                    // 边权按两端顶点权值归一，优先合并较轻的顶点，使粗图的顶点权值较为均匀
+                    auto r = double(lv.ewgt[i]) / (double(lv.vwgt[u]) * double(lv.vwgt[v]));
+                    if (r > bestW || (r == bestW && h > bestH))
+                        bestW = r, bestH = h, pick[v] = u;
+                }
+            }, nthreads_);
+
+            std::vector<std::size_t> count(nthreads_, 0);
+            parallel_blocks(vertex_index_t(0), n, [&](unsigned tid, vertex_index_t b, vertex_index_t e) {
+                for (auto v = b; v < e; v++)
+                    if (pick[v] != none && pick[pick[v]] == v)
+                        match[v] = pick[v], ++count[tid];
+            }, nthreads_);
+
+            std::size_t matched(0);
+            for (auto c : count) matched += c;
+            if (matched == 0)
+                break;
+        }
+
+        // 未匹配的顶点过多时（如幂律图中同一中心点的大量叶子），再将共享邻接点的未匹配的低度顶点两两匹配，
+        // 孤立顶点之间也两两匹配，避免粗化停滞
+        std::size_t unmatched(0);
+        for (vertex_index_t v = 0; v < n; v++)
+            if (match[v] == none)
+                ++unmatched;
+        if (unmatched > n / 10) {
+            vertex_index_t lonely(none);
+            for (vertex_index_t u = 0; u < n; u++) {
+                if (lv.xadj[u] == lv.xadj[u + 1]) {
+                    if (match[u] != none) continue;
+                    if (lonely != none && lv.vwgt[lonely] + lv.vwgt[u] <= maxVwgt)
+                        match[u] = lonely, match[lonely] = u, lonely = none;
+                    else
+                        lonely = u;
+                    continue;
+                }
+
+                vertex_index_t last(none);
+                for (auto i = lv.xadj[u]; i < lv.xadj[u + 1]; i++) {
+                    auto v = lv.adj[i];
+                    if (match[v] != none || lv.xadj[v + 1] - lv.xadj[v] > 2) continue;
+                    if (last != none && lv.vwgt[last] + lv.vwgt[v] <= maxVwgt && similar(last, v))
+                        match[v] = last, match[last] = v, last = none;
+                    else
+                        last = v;
+                }
+            }
+        }
+
+        for (vertex_index_t v = 0; v < n; v++)
+            if (match[v] == none)
+                match[v] = v;
+        return match;
+    }
+
+
+    // 收缩匹配的顶点对，各线程合并一段粗顶点的邻接表，再按序拼接
+    KpLevel_ contract_(const KpLevel_& fine, vertex_index_t nc) const {
+        KpLevel_ coarse;
+        coarse.vwgt.assign(nc, 0);
+        std::vector<std::size_t> xmem(std::size_t(nc) + 1, 0); // 粗顶点c对应的细顶点为mem[xmem[c], xmem[c + 1])
+        for (vertex_index_t v = 0; v < fine.order(); v++) {
+            auto c = fine.cmap[v];
+            coarse.vwgt[c] += fine.vwgt[v];
+            ++xmem[c + 1];
+        }
+        for (vertex_index_t c = 0; c < nc; c++)
+            xmem[c + 1] += xmem[c];
+        std::vector<vertex_index_t> mem(fine.order());
+        std::vector<std::size_t> pos(xmem.begin(), xmem.end() - 1);
+        for (vertex_index_t v = 0; v < fine.order(); v++)
+            mem[pos[fine.cmap[v]]++] = v;
+
+        struct KpBlock_
+        {
+            std::vector<std::size_t> deg;
+            std::vector<vertex_index_t> adj;
+            std::vector<long long> ewgt;
+        };
+        std::vector<KpBlock_> blocks(nthreads_);
+        std::vector<vertex_index_t> bounds(nthreads_ + 1, nc);
+
+        parallel_blocks(vertex_index_t(0), nc, [&](unsigned tid, vertex_index_t b, vertex_index_t e) {
+            auto& blk = blocks[tid];
+            bounds[tid] = b;
+            std::vector<std::size_t> slot(nc, std::size_t(-1));
+            for (auto c = b; c < e; c++) {
+                auto start = blk.adj.size();
+                for (auto j = xmem[c]; j < xmem[c + 1]; j++) {
+                    auto x = mem[j];
+                    for (auto i = fine.xadj[x]; i < fine.xadj[x + 1]; i++) {
+                        auto d = fine.cmap[fine.adj[i]];
+                        if (d == c) continue; // 收缩的边
+                        if (slot[d] != std::size_t(-1) && slot[d] >= start)
+                            blk.ewgt[slot[d]] += fine.ewgt[i];
+                        else {
+                            slot[d] = blk.adj.size();
+                            blk.adj.push_back(d), blk.ewgt.push_back(fine.ewgt[i]);
+                        }
+                    }
+                }
+                blk.deg.push_back(blk.adj.size() - start);
+            }
+        }, nthreads_);
+
+        coarse.xadj.assign(std::size_t(nc) + 1, 0);
+        for (unsigned t = 0; t < nthreads_; t++) {
+            auto& blk = blocks[t];
+            auto c = bounds[t];
+            for (auto d : blk.deg) {
+                coarse.xadj[c + 1] = coarse.xadj[c] + d;
+                ++c;
+            }
+            coarse.adj.insert(coarse.adj.end(), blk.adj.begin(), blk.adj.end());
+            coarse.ewgt.insert(coarse.ewgt.end(), blk.ewgt.begin(), blk.ewgt.end());
+        }
+
+        return coarse;
+    }
+
+
+    // 最粗图上的初始划分：递归二分，各级二分的均衡约束取总约束的depth次方根
+    std::vector<part_index_t> initialPartition_(const KpLevel_& lv) const {
+        std::vector<part_index_t> part(lv.order(), 0);
+        std::vector<vertex_index_t> vs(lv.order());
+        for (vertex_index_t v = 0; v < lv.order(); v++)
+            vs[v] = v;
+
+        long long total(0);
+        for (auto w : lv.vwgt) total += w;
+        unsigned depth(0);
+        while ((1u << depth) < k_) ++depth;
+        double ub = total > 0 ? double(maxPartWeight_) * k_ / total : 1; // 孤立顶点已除去时，约束较总体的宽松
+        bisect_(lv, vs, 0, k_, std::pow(std::max(ub, 1.0), 1.0 / std::max(depth, 1u)), part);
+        return part;
+    }
+
+
+    // 将顶点子集vs划分为部分[first, first + k)
+    // @ub: 各部分的权值与其目标权值之比的上限
+    void bisect_(const KpLevel_& lv, const std::vector<vertex_index_t>& vs, part_index_t first, part_index_t k,
+        double ub, std::vector<part_index_t>& part) const {
+        if (k == 1) {
+            for (auto v : vs)
+                part[v] = first;
+            return;
+        }
+
+        auto sub = induced_(lv, vs);
+        long long total(0), heaviest(0);
+        for (auto w : sub.vwgt)
+            total += w, heaviest = std::max(heaviest, w);
+        part_index_t k0 = k / 2;
+        long long target = total * k0 / k;
+
+        // 粗图顶点的权值较大，均衡约束过紧时难以移动顶点，因此放宽一个顶点的权值，由其后各级的精化恢复均衡
+        std::vector<long long> maxw = {
+            static_cast<long long>(std::ceil(ub * double(total) * k0 / k)) + heaviest,
+            static_cast<long long>(std::ceil(ub * double(total) * (k - k0) / k)) + heaviest
+        };
+
+        // 多次贪心生长 + 精化，取最优者
+        const unsigned trials = unsigned(std::clamp<std::size_t>(16384 / (sub.order() + 1), 2, 8)); // 粗化停滞时最粗图可能较大
+        std::vector<part_index_t> best;
+        long long bestCut(0), bestOver(0);
+        for (unsigned t = 0; t < trials; t++) {
+            auto sp = grow_(sub, target, maxw[0], hash_(seed_, first, k * trials + t));
+            refine_(sub, sp, maxw, false);
+
+            long long pw[2] = { 0, 0 };
+            for (vertex_index_t v = 0; v < sub.order(); v++)
+                pw[sp[v]] += sub.vwgt[v];
+            long long over = std::max<long long>(0, pw[0] - maxw[0]) + std::max<long long>(0, pw[1] - maxw[1]);
+            auto cut = cut_of_(sub, sp);
+            if (best.empty() || over < bestOver || (over == bestOver && cut < bestCut))
+                best.swap(sp), bestCut = cut, bestOver = over;
+        }
+
+        std::vector<vertex_index_t> side[2];
+        for (vertex_index_t i = 0; i < vs.size(); i++)
+            side[best[i]].push_back(vs[i]);
+        bisect_(lv, side[0], first, k0, ub, part);
+        bisect_(lv, side[1], first + k0, k - k0, ub, part);
+    }
+
+
+    // 顶点子集vs的导出子图，子图顶点i对应vs[i]
+    static KpLevel_ induced_(const KpLevel_& lv, const std::vector<vertex_index_t>& vs) {
+        std::vector<vertex_index_t> local(lv.order(), null_vertex);
+        for (vertex_index_t i = 0; i < vs.size(); i++)
+            local[vs[i]] = i;
+
+        KpLevel_ sub;
+        sub.xadj.assign(vs.size() + 1, 0);
+        sub.vwgt.resize(vs.size());
+        for (vertex_index_t i = 0; i < vs.size(); i++) {
+            auto v = vs[i];
+            sub.vwgt[i] = lv.vwgt[v];
+            for (auto j = lv.xadj[v]; j < lv.xadj[v + 1]; j++)
+                if (local[lv.adj[j]] != null_vertex)
+                    sub.adj.push_back(local[lv.adj[j]]), sub.ewgt.push_back(lv.ewgt[j]);
+            sub.xadj[i + 1] = sub.adj.size();
+        }
+
+        return sub;
+    }
+
+
+    // 贪心生长：从随机顶点出发，依次吸收与部分0连接最紧的顶点，直至其权值达到target，其余顶点归入部分1
+    // 当前连通分量耗尽时，再从另一随机顶点出发
+    std::vector<part_index_t> grow_(const KpLevel_& lv, long long target, long long cap, std::uint64_t seed) const {
+        const vertex_index_t n = lv.order();
+        std::vector<part_index_t> part(n, 1);
+        std::vector<vertex_index_t> order(n);
+        for (vertex_index_t v = 0; v < n; v++)
+            order[v] = v;
+        std::sort(order.begin(), order.end(), [seed](vertex_index_t a, vertex_index_t b) {
+            return hash_(seed, a) < hash_(seed, b);
+        });
+        std::size_t next(0); // order中下一个候选的种子顶点
+
+        std::vector<long long> conn(n, 0);
+
+        std::priority_queue<std::pair<long long, vertex_index_t>> heap;
+        long long w(0);
+        while (w < target) {
+            vertex_index_t v;
+            if (!heap.empty()) {
+                auto top = heap.top();
+                heap.pop();
+                v = top.second;
+                if (part[v] == 0 || top.first != conn[v])
+                    continue;
+            }
+            else {
+                while (next < n && part[order[next]] == 0)
+                    ++next;
+                if (next == n) break;
+                v = order[next++];
+            }
+
+            if (w > 0 && w + lv.vwgt[v] > cap)
+                continue;
+            part[v] = 0, w += lv.vwgt[v];
+            for (auto i = lv.xadj[v]; i < lv.xadj[v + 1]; i++) {
+                auto u = lv.adj[i];
+                if (part[u] != 0) {
+                    conn[u] += lv.ewgt[i];
+                    heap.push({ conn[u], u });
+                }
+            }
+        }
+
+        return part;
+    }
+
+
+    // 在部分权值上限maxw的约束下精化划分，部分数为maxw.size()
+    // @volume: 为true时，割边精化之后再以通信量为目标精化
+    void refine_(const KpLevel_& lv, std::vector<part_index_t>& part, const std::vector<long long>& maxw, bool volume) const {
+        std::vector<long long> pw(maxw.size(), 0);
+        for (vertex_index_t v = 0; v < lv.order(); v++)
+            pw[part[v]] += lv.vwgt[v];
+
+        for (unsigned round = 0; round < 8; round++)
+            if (labelPropagation_(lv, part, pw, maxw, false) == 0)
+                break;
+
+        for (unsigned pass = 0; pass < 4; pass++)
+            if (!fm_(lv, part, pw, maxw))
+                break;
+
+        if (volume)
+            for (unsigned round = 0; round < 4; round++)
+                if (labelPropagation_(lv, part, pw, maxw, true) == 0)
+                    break;
+    }
+
+
+    // 计算顶点v与各部分的连接权值，返回涉及的部分列表
+    // conn为长度为部分数的数组，调用者负责在使用后清零
+    void connect_(const KpLevel_& lv, const std::vector<part_index_t>& part, vertex_index_t v,
+        std::vector<long long>& conn, std::vector<part_index_t>& touched) const {
+        touched.clear();
+        for (auto i = lv.xadj[v]; i < lv.xadj[v + 1]; i++) {
+            auto q = part[lv.adj[i]];
+            if (conn[q] == 0) touched.push_back(q);
+            conn[q] += lv.ewgt[i];
+        }
+    }
+
+
+    // 部分q的权值为w时的充满程度
+    static double fill_(long long w, const std::vector<long long>& maxw, part_index_t q) {
+        return double(w) / double(maxw[q]);
+    }
+
+
+    // 在均衡约束下为v选择连接最紧的其他部分，返回(目标部分, 割边增益)，没有可选部分时目标为null_part
+    std::pair<part_index_t, long long> bestMove_(const KpLevel_& lv, const std::vector<part_index_t>& part,
+        const std::vector<long long>& pw, const std::vector<long long>& maxw, vertex_index_t v,
+        std::vector<long long>& conn, std::vector<part_index_t>& touched) const {
+        connect_(lv, part, v, conn, touched);
+        auto a = part[v];
+        auto vw = lv.vwgt[v];
+        part_index_t best(null_part);
+        for (auto q : touched)
+            if (q != a && pw[q] + vw <= maxw[q])
+                if (best == null_part || conn[q] > conn[best] ||
+                    (conn[q] == conn[best] && fill_(pw[q], maxw, q) < fill_(pw[best], maxw, best)))
+                    best = q;
+
+        // 所在部分超重时，允许移到任一未超重的部分
+        if (best == null_part && pw[a] > maxw[a])
+            for (part_index_t q = 0; q < maxw.size(); q++)
+                if (q != a && pw[q] + vw <= maxw[q] && (best == null_part || fill_(pw[q], maxw, q) < fill_(pw[best], maxw, best)))
+                    best = q;
+
+        long long gain = best == null_part ? 0 : conn[best] - conn[a];
+        for (auto q : touched)
+            conn[q] = 0;
+        return { best, gain };
+    }
+
+
+    // 将v由部分a移到部分b是否可取：目标值减少，或者在目标值不变的情况下改善均衡，或者a超重
+    bool acceptable_(long long gain, const KpLevel_& lv, vertex_index_t v, part_index_t a, part_index_t b,
+        const std::vector<long long>& pw, const std::vector<long long>& maxw) const {
+        return gain > 0 || pw[a] > maxw[a] ||
+            (gain == 0 && fill_(pw[a] - lv.vwgt[v], maxw, a) > fill_(pw[b], maxw, b));
+    }
+
+
+    // 一轮标签传播精化，返回移动的顶点数
+    // @volume: 为true时以通信量的变化作为移动的增益，否则以割边的变化作为增益
+    std::size_t labelPropagation_(const KpLevel_& lv, std::vector<part_index_t>& part, std::vector<long long>& pw,
+        const std::vector<long long>& maxw, bool volume) const {
+        const vertex_index_t n = lv.order();
+        std::vector<part_index_t> target(n, null_part);
+
+        // 并行地基于当前划分为各顶点求出候选的目标部分
+        parallel_blocks(vertex_index_t(0), n, [&](unsigned, vertex_index_t b, vertex_index_t e) {
+            std::vector<long long> conn(maxw.size(), 0);
+            std::vector<part_index_t> touched;
+            for (auto v = b; v < e; v++) {
+                auto mv = bestMove_(lv, part, pw, maxw, v, conn, touched);
+                if (mv.first != null_part && acceptable_(mv.second, lv, v, part[v], mv.first, pw, maxw))
+                    target[v] = mv.first;
+            }
+        }, nthreads_);
+
+        // 串行地依次复核并移动
+        std::vector<long long> conn(maxw.size(), 0);
+        std::vector<part_index_t> touched;
+        std::size_t moved(0);
+        for (vertex_index_t v = 0; v < n; v++) {
+            if (target[v] == null_part) continue;
+            auto a = part[v];
+            auto mv = bestMove_(lv, part, pw, maxw, v, conn, touched);
+            auto b = mv.first;
+            if (b == null_part)
+                continue;
+
+            long long gain = mv.second;
+            if (volume && pw[a] <= maxw[a])
+                gain = -volumeDelta_(lv, part, v, b);
+            if (!acceptable_(gain, lv, v, a, b, pw, maxw))
+                continue;
+
+            part[v] = b;
+            pw[a] -= lv.vwgt[v], pw[b] += lv.vwgt[v];
+            ++moved;
+        }
+
+        return moved;
+    }
+
+
+    // 将v移到部分b引起的通信量变化
+    long long volumeDelta_(const KpLevel_& lv, const std::vector<part_index_t>& part, vertex_index_t v, part_index_t b) const {
+        auto a = part[v];
+        long long delta(0);
+        bool hasA(false), hasB(false);
+        for (auto i = lv.xadj[v]; i < lv.xadj[v + 1]; i++) {
+            auto u = lv.adj[i];
+            auto c = part[u];
+            hasA |= c == a, hasB |= c == b;
+
+            // u的邻接点中是否有（v以外）位于a的，是否有位于b的
+            bool otherA(false), inB(false);
+            for (auto j = lv.xadj[u]; j < lv.xadj[u + 1]; j++) {
+                auto x = lv.adj[j];
+                if (x != v && part[x] == a) otherA = true;
+                if (part[x] == b) inB = true;
+            }
+            if (c != a && !otherA) --delta; // u不再连接a
+            if (c != b && !inB) ++delta; // u新连接b
+        }
+
+        // v自身所连的其他部分：失去b，可能新增a
+        delta += (hasA ? 1 : 0) - (hasB ? 1 : 0);
+        return delta;
+    }
+
+
+    // 一遍k路FM精化，返回割边是否减少
+    bool fm_(const KpLevel_& lv, std::vector<part_index_t>& part, std::vector<long long>& pw, const std::vector<long long>& maxw) const {
+        const vertex_index_t n = lv.order();
+        const std::size_t limit = std::max<std::size_t>(64, n / 100); // 连续多少次移动未改善时停止
+
+        std::vector<long long> conn(maxw.size(), 0);
+        std::vector<part_index_t> touched;
+        std::vector<unsigned> version(n, 0);
+        std::vector<bool> locked(n, false);
+        std::priority_queue<std::tuple<long long, vertex_index_t, unsigned>> heap; // (增益, 顶点, 版本)
+
+        // 以不考虑均衡约束的增益入堆，出堆时再检查均衡约束，以免当时无法移动的顶点在部分权值变化后不再被考虑
+        auto push = [&](vertex_index_t v) {
+            connect_(lv, part, v, conn, touched);
+            long long best(std::numeric_limits<long long>::min());
+            for (auto q : touched)
+                if (q != part[v])
+                    best = std::max(best, conn[q]);
+            if (best != std::numeric_limits<long long>::min())
+                heap.push({ best - conn[part[v]], v, ++version[v] });
+            for (auto q : touched)
+                conn[q] = 0;
+        };
+        for (vertex_index_t v = 0; v < n; v++)
+            for (auto i = lv.xadj[v]; i < lv.xadj[v + 1]; i++)
+                if (part[lv.adj[i]] != part[v]) { // 边界顶点
+                    push(v);
+                    break;
+                }
+
+        auto overweight = [&]() {
+            long long over(0);
+            for (part_index_t q = 0; q < maxw.size(); q++)
+                over += std::max<long long>(0, pw[q] - maxw[q]);
+            return over;
+        };
+
+        std::vector<std::pair<vertex_index_t, part_index_t>> moves; // (顶点, 原部分)
+        long long cut(0), bestCut(0), bestOver(overweight());
+        std::size_t bestLen(0);
+        while (!heap.empty() && moves.size() - bestLen < limit) {
+            auto [gain, v, ver] = heap.top();
+            heap.pop();
+            if (locked[v] || ver != version[v])
+                continue;
+
+            auto mv = bestMove_(lv, part, pw, maxw, v, conn, touched);
+            if (mv.first == null_part)
+                continue;
+
+            auto a = part[v], b = mv.first;
+            part[v] = b, locked[v] = true;
+            pw[a] -= lv.vwgt[v], pw[b] += lv.vwgt[v];
+            cut -= mv.second;
+            moves.push_back({ v, a });
+
+            auto over = overweight();
+            if (over < bestOver || (over == bestOver && cut < bestCut))
+                bestCut = cut, bestOver = over, bestLen = moves.size();
+
+            for (auto i = lv.xadj[v]; i < lv.xadj[v + 1]; i++)
+                if (!locked[lv.adj[i]])
+                    push(lv.adj[i]);
+        }
+
+        // 回滚到最优状态
+        while (moves.size() > bestLen) {
+            auto [v, a] = moves.back();
+            moves.pop_back();
+            pw[part[v]] -= lv.vwgt[v], pw[a] += lv.vwgt[v];
+            part[v] = a;
+        }
+
+        return bestLen > 0;
+    }
+
+
+    static long long cut_of_(const KpLevel_& lv, const std::vector<part_index_t>& part) {
+        long long cut(0);
+        for (vertex_index_t v = 0; v < lv.order(); v++)
+            for (auto i = lv.xadj[v]; i < lv.xadj[v + 1]; i++)
+                if (part[lv.adj[i]] != part[v])
+                    cut += lv.ewgt[i];
+        return cut / 2;
+    }
+
+    long long volume_of_(const KpLevel_& lv, const std::vector<part_index_t>& part) const {
+        long long vol(0);
+        std::vector<vertex_index_t> mark(k_, null_vertex);
+        for (vertex_index_t v = 0; v < lv.order(); v++) {
+            mark[part[v]] = v;
+            for (auto i = lv.xadj[v]; i < lv.xadj[v + 1]; i++) {
+                auto q = part[lv.adj[i]];
+                if (mark[q] != v)
+                    mark[q] = v, ++vol;
+            }
+        }
+        return vol;
+    }
+
+
+private:
+    part_index_t k_;
+    unsigned nthreads_;
+    std::uint64_t seed_;
+    long long maxPartWeight_;
+    std::vector<KpLevel_> levels_; // levels_[0]为原图，粗化完成后逐级弹出
+
+    std::vector<part_index_t> part_;
+    std::vector<long long> partWeight_;
+    long long cut_, volume_;
+};
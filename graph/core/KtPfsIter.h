@@ -2,21 +2,24 @@
 #include <queue>
 #include <assert.h>
 #include "KtAdjIter.h"
+#include "KtTraversalSpace.h"
 
 
-// ȶеͼ
+// 基于优先队列的图遍历
 
 
 
-// PRIORITOR - ȶȵĺӣΪfrom, to, value
-// COMP - Ƚȶȵĺ
+// PRIORITOR - 计算优先度的函数子，输入参数为：from, to, value
+// COMP - 比较优先度的函数子
 template <typename GRAPH, typename PRIORITOR, typename COMP, bool fullGraph = false>
 class KtPfsIter
 {
 public:
     using edge_type = typename GRAPH::edge_type;
-    using prior_type = decltype(std::declval<PRIORITOR>()(0, 0, edge_type(0))); // õPRIORITORӵķ
-    using element_type = std::pair<std::pair<unsigned, unsigned>, prior_type>;
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+    constexpr static vertex_index_t null_vertex = GRAPH::null_vertex;
+    using prior_type = decltype(std::declval<PRIORITOR>()(0, 0, edge_type(0))); // 得到PRIORITOR算子的返回类型
+    using element_type = std::pair<std::pair<vertex_index_t, vertex_index_t>, prior_type>;
 
     struct Comp {
         bool operator()(const element_type& a, const element_type& b) {
@@ -25,53 +28,56 @@ public:
     };
 
     using pfs_queue = std::priority_queue<element_type, std::vector<element_type>, Comp>;
+    using space_type = KtTraversalSpace<vertex_index_t>;
 
 public:
-    KtPfsIter(GRAPH& g, unsigned v0)
-        : graph_(g)
-        , v0_(v0)
-        , isPushed_(g.order(), false)
-        , st_(g.order(), -1) {
-        start(v0);
-    }
+    KtPfsIter(GRAPH& g, vertex_index_t v0)
+        : KtPfsIter(g, v0, nullptr) {}
+
+    // space -- 外部提供的工作空间，参见KtBfsIter
+    KtPfsIter(GRAPH& g, vertex_index_t v0, space_type& space)
+        : KtPfsIter(g, v0, &space) {}
 
 
     void operator++() {
         assert(!isEnd());
         auto x = pq_.top().first; pq_.pop();
-        unsigned w = x.second;
-        st_[w] = x.first;
+        vertex_index_t w = x.second;
+        st_().set(w, x.first);
 
         auto iter= KtAdjIter(graph_, w);
         for (; !iter.isEnd(); ++iter) {
-            unsigned t = *iter;
+            vertex_index_t t = *iter;
             if (!isPushed(t)) {
-                pq_.emplace(std::pair<unsigned, unsigned>{w, t}, PRIORITOR{}(w, t, iter.edge())); // put it
-                isPushed_[t] = true;
+                pq_.emplace(std::pair<vertex_index_t, vertex_index_t>{w, t}, PRIORITOR{}(w, t, iter.edge())); // put it
+                pushed_().mark(t);
              }
-            else if(!isPopped(t) // isPopped(v0)ʼΪfalse
-                && (graph_.isDigraph() || t != x.first && t != v0_) // ͼĻر
+            else if(!isPopped(t) // isPopped(v0)始终为false
+                && (graph_.isDigraph() || t != x.first && t != v0_) // 忽略无向图的回边
                 ) 
-                pq_.emplace(std::pair<unsigned, unsigned>{w, t}, PRIORITOR{}(w, t, iter.edge())); // update it
+                pq_.emplace(std::pair<vertex_index_t, vertex_index_t>{w, t}, PRIORITOR{}(w, t, iter.edge())); // update it
         }
 
 
         if (fullGraph && isEnd()) {
-            auto pos = std::find(isPushed_.begin(), isPushed_.end(), false);
-            if (pos != isPushed_.end()) 
-                start(unsigned(std::distance(isPushed_.begin(), pos)));
+            // scan_之前的顶点均已遍历，因此全图遍历的总扫描代价为O(V)
+            for (; scan_ < graph_.order(); scan_++)
+                if (!isPushed(scan_)) {
+                    start(scan_);
+                    break;
+                }
         }
     }
 
-    // صǰĶ
-    unsigned operator*() const {
+    // 返回当前正在游历的顶点
+    vertex_index_t operator*() const {
         assert(!isEnd());
         return pq_.top().first.second;
     }
 
 
-    // 뵱ǰ㣨to㣩ɱߵfrom
-    unsigned from() const {
+    // 与当前顶点（to顶点）构成边的from顶点
+    vertex_index_t from() const {
         assert(!isEnd());
         return pq_.top().first.first;
     }
@@ -89,32 +95,44 @@ public:
     }
 
 
-    unsigned from(unsigned w) const {
-        return st_[w];
+    vertex_index_t from(vertex_index_t w) const {
+        return st_()[w];
     }
 
 
     bool isEnd() const { return pq_.empty(); }
 
 
-    // Ӷvʼйȱ
-    void start(unsigned v) {
+    // 从顶点v开始接续进行广度优先遍历
+    void start(vertex_index_t v) {
         assert(isEnd() && !isPushed(v));
-        pq_.emplace(std::pair<unsigned, unsigned>{-1, v}, 0);
-        isPushed_[v] = true;
+        pq_.emplace(std::pair<vertex_index_t, vertex_index_t>{null_vertex, v}, 0);
+        pushed_().mark(v);
     }
 
 
-    bool isPushed(unsigned v) const { return isPushed_[v]; }
-    bool isPopped(unsigned v) const { return st_[v] != -1; }
+    bool isPushed(vertex_index_t v) const { return pushed_().isMarked(v); }
+    bool isPopped(vertex_index_t v) const { return st_()[v] != null_vertex; }
+
 
+private:
+    auto& pushed_() const { return space_.flags(0); }
+    auto& st_() const { return space_.marks(0); } // 树
+
+    KtPfsIter(GRAPH& g, vertex_index_t v0, space_type* space)
+        : graph_(g)
+        , v0_(v0)
+        , scan_(0)
+        , space_(space, g.order(), 1, 1) {
+        start(v0);
+    }
 
 private:
     GRAPH& graph_;
-    unsigned v0_;
-    std::vector<bool> isPushed_;
+    vertex_index_t v0_;
+    vertex_index_t scan_; // 全图遍历时，搜寻未遍历顶点的起始位置
+    KtTraversalSpaceRef<space_type> space_; // 外部提供的工作空间，未提供时自建
 
-    pfs_queue pq_; // Ե
-    std::vector<unsigned> st_; // 
+    pfs_queue pq_; // 边缘带
 };
 
@@ -0,0 +1,192 @@
+#pragma once
+#include <vector>
+#include <random>
+#include <cstdint>
+#include <algorithm>
+#include "KtAdjIter.h"
+#include "KtStronglyConnected.h"
+#include "../base/KtStampedVector.h"
+#include "../base/parallel_for.h"
+
+
+// 基于GRAIL区间标签的可达性索引
+// 先将图分解为强连通分量，在缩合得到的DAG上进行k次随机dfs，
+// 每次为各分量x生成区间标签[lo(x), hi(x)]：hi(x)为x的后序编号，lo(x)为x所有后代的最小后序编号
+// 若x可达y，则y的每个区间都包含于x的对应区间，因此区间不包含即可判定不可达，
+// 否则以区间标签剪枝进行dfs确认。
+// 此外，Tarjan算法得到的分量编号为逆拓扑序，即x可达y（x != y）必有x > y，可用于进一步剪枝
+// 索引的构建时间和空间均为O(k(V + E))，与传递闭包的O(V^2)空间相比，适用于大规模图
+// 分量编号不超过顶点数，故与顶点使用相同的索引类型
+// 线程安全：reachable(v, w)虽为const方法，却使用内部工作空间，即便通过const引用，也不能并发调用；
+//   并发查询须使用带query_space参数的重载或批量查询
+template<typename GRAPH>
+class KtReachIndex
+{
+    static_assert(GRAPH::isDigraph(), "KtReachIndex must instantiated with Digraph.");
+
+public:
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+
+    // 查询的工作空间。并发查询时，各线程须使用各自的工作空间
+    struct query_space
+    {
+        KtStampedVector<std::uint8_t> visited;
+        std::vector<vertex_index_t> stack;
+    };
+
+
+    // @numLabels: 区间标签的数量k，越大则剪枝效果越好，但占用更多空间
+    // @seed: 随机dfs的种子
+    explicit KtReachIndex(const GRAPH& g, unsigned numLabels = 3, unsigned seed = 0)
+        : k_(numLabels), scc_(g) {
+
+        // 构建缩合DAG（CSR格式，已去除重边和自环）
+        const vertex_index_t C = scc_.count();
+        offset_.assign(std::size_t(C) + 1, 0);
+        std::vector<std::pair<vertex_index_t, vertex_index_t>> arcs;
+        for (vertex_index_t v = 0; v < g.order(); v++)
+            for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter) {
+                auto x = scc_[v], y = scc_[*iter];
+                if (x != y)
+                    arcs.emplace_back(x, y);
+            }
+        std::sort(arcs.begin(), arcs.end());
+        arcs.erase(std::unique(arcs.begin(), arcs.end()), arcs.end());
+        adj_.reserve(arcs.size());
+        for (auto& a : arcs) {
+            ++offset_[a.first + 1];
+            adj_.push_back(a.second);
+        }
+        for (vertex_index_t x = 0; x < C; x++)
+            offset_[x + 1] += offset_[x];
+
+        // 生成k组区间标签
+        labels_.resize(std::size_t(C) * k_);
+        std::mt19937 rng(seed);
+        for (unsigned t = 0; t < k_; t++)
+            label_(t, rng);
+
+        space_.visited.resize(C);
+    }
+
+
+    // 顶点v是否可达w。该方法修改内部工作空间，非线程安全，不能被多个线程并发调用
+    bool reachable(vertex_index_t v, vertex_index_t w) const {
+        return reachable(v, w, space_);
+    }
+
+
+    // 使用外部工作空间的可达性查询，各线程使用各自的工作空间时可并发调用
+    bool reachable(vertex_index_t v, vertex_index_t w, query_space& space) const {
+        vertex_index_t x = scc_[v], y = scc_[w];
+        if (x == y) return true;
+        if (x < y || !contains_(x, y)) return false;
+
+        // 剪枝dfs
+        if (space.visited.size() < scc_.count())
+            space.visited.resize(scc_.count());
+        space.visited.reset();
+        space.stack.clear();
+        space.stack.push_back(x);
+        space.visited.mark(x);
+        while (!space.stack.empty()) {
+            auto a = space.stack.back(); space.stack.pop_back();
+            for (auto i = offset_[a]; i < offset_[a + 1]; i++) {
+                auto c = adj_[i];
+                if (c == y) return true;
+                if (c > y && !space.visited.isMarked(c) && contains_(c, y)) {
+                    space.visited.mark(c);
+                    space.stack.push_back(c);
+                }
+            }
+        }
+
+        return false;
+    }
+
+
+    // 批量查询，以nthreads个线程并行处理queries中的(v, w)对
+    // 返回结果的第i个元素表示queries[i]是否可达
+    std::vector<std::uint8_t> reachable(const std::vector<std::pair<vertex_index_t, vertex_index_t>>& queries,
+        unsigned nthreads = 0) const {
+        std::vector<std::uint8_t> res(queries.size());
+        parallel_blocks(std::size_t(0), queries.size(), [this, &queries, &res](unsigned, std::size_t b, std::size_t e) {
+            query_space space;
+            for (auto i = b; i < e; i++)
+                res[i] = reachable(queries[i].first, queries[i].second, space);
+        }, nthreads);
+        return res;
+    }
+
+
+    // 缩合DAG的顶点数，即强连通分量数
+    vertex_index_t components() const { return scc_.count(); }
+
+    // 顶点v所在的强连通分量
+    vertex_index_t componentOf(vertex_index_t v) const { return scc_[v]; }
+
+
+private:
+
+    struct KpInterval_
+    {
+        vertex_index_t lo, hi; // 后序编号
+    };
+
+    // 分量y的全部区间标签是否包含于分量x的对应区间
+    bool contains_(vertex_index_t x, vertex_index_t y) const {
+        auto lx = &labels_[std::size_t(x) * k_], ly = &labels_[std::size_t(y) * k_];
+        for (unsigned t = 0; t < k_; t++)
+            if (ly[t].lo < lx[t].lo || ly[t].hi > lx[t].hi)
+                return false;
+        return true;
+    }
+
+    // 以随机的根顶点和孩子顶点次序进行非递归dfs，生成第t组区间标签
+    void label_(unsigned t, std::mt19937& rng) {
+        const vertex_index_t C = scc_.count();
+        std::vector<vertex_index_t> adj(adj_), roots(C);
+        for (vertex_index_t x = 0; x < C; x++) {
+            roots[x] = x;
+            std::shuffle(adj.begin() + offset_[x], adj.begin() + offset_[x + 1], rng);
+        }
+        std::shuffle(roots.begin(), roots.end(), rng);
+
+        std::vector<bool> visited(C, false);
+        std::vector<std::pair<vertex_index_t, std::size_t>> stack; // (分量，下一个孩子的位置)
+        vertex_index_t rank(0);
+        for (auto r : roots) {
+            if (visited[r]) continue;
+            visited[r] = true;
+            stack.emplace_back(r, offset_[r]);
+            while (!stack.empty()) {
+                auto& top = stack.back();
+                auto x = top.first;
+                if (top.second < offset_[x + 1]) {
+                    auto c = adj[top.second++];
+                    if (!visited[c]) {
+                        visited[c] = true;
+                        stack.emplace_back(c, offset_[c]);
+                    }
+                }
+                else {
+                    // 出栈时所有孩子均已编号
+                    auto& lb = labels_[std::size_t(x) * k_ + t];
+                    lb.hi = rank++;
+                    lb.lo = lb.hi;
+                    for (auto i = offset_[x]; i < offset_[x + 1]; i++)
+                        lb.lo = std::min(lb.lo, labels_[std::size_t(adj_[i]) * k_ + t].lo);
+                    stack.pop_back();
+                }
+            }
+        }
+    }
+
+private:
+    unsigned k_;
+    KtStronglyConnectedTar<GRAPH> scc_;
+    std::vector<std::size_t> offset_; // 缩合DAG的CSR
+    std::vector<vertex_index_t> adj_;
+    std::vector<KpInterval_> labels_; // 分量x的第t组标签为labels_[x * k_ + t]
+    mutable query_space space_;
+};
@@ -3,28 +3,29 @@
 #include "KtWeightor.h"
 #include "KtBfsIter.h"
 #include "KtDfsIter.h"
+#include "KtDfsKernel.h"
 #include "KtTopologySort.h"
 
 
-// ·㷨
-// 㷨ĹؼǶ㴦˳򣬶Ӧ˳DfsBfsPfsTsȷ
-// ͬʵֵʱ临Ӷ£
-// Դ
-//   DijkstraڷǸȨֵO(V^2)ͼ
-//   PFSڷǸȨֵO(E*lgV)رֵ߽
-//   TS޻ͼO(E)
-//   Bellman-Ford޸ͼO(V*E)иĽ
-// ȫԴ
-//    DijkstraڷǸȨֵO(V^3)ͼͬ
-//    PFSڷǸȨֵO(V*E*lgV)رֵ߽
-//    DFS޻ͼO(V*E)ͼͬ
-//    Floyd޸ͼO(V^3)ͼͬ
-//    Johnson޸ͼO(V*E*lgV)رֵ߽
-// עȨֵֵƫתͳһJohnsonδʵ
+// 最短路径算法
+// 此类算法的关键是顶点处理的顺序，对应有顺序遍历、Dfs、Bfs、Pfs、Ts等方法。
+// 不同实现的时间复杂度如下：
+// 单源：
+//   Dijkstra，适用于非负权值，O(V^2)，稠密图最优
+//   PFS，适用于非负权值，O(E*lgV)，保守边界值
+//   TS，适用于无环图，O(E)，最优
+//   Bellman-Ford，适用于无负环图，O(V*E)，有改进余地吗？
+// 全源：
+//    Dijkstra，适用于非负权值，O(V^3)，对所有图均相同
+//    PFS，适用于非负权值，O(V*E*lgV)，保守边界值
+//    DFS，适用于无环图，O(V*E)，对所有图均相同
+//    Floyd，适用于无负环图，O(V^3)，对所有图均相同
+//    Johnson，适用于无负环图，O(V*E*lgV)，保守边界值
+// 注：由于权值的零值和偏移转换难以统一，Johnson尚未实现
 
 
 
-// Դ·Ļࣺʼv0Դ㣩ͼg·
+// 单源最短路径的基类：计算起始顶点v0（源点）到图g中其他各顶点的最短路径
 // SSSP(Single Source Shortest Path)
 template<typename GRAPH, class WEIGHTOR>
 class KtSsspAbstract
@@ -34,48 +35,54 @@ class KtSsspAbstract
 public:
     using weight_type = typename WEIGHTOR::weight_type;
     using vertex_index_t = typename GRAPH::vertex_index_t;
+    constexpr static vertex_index_t null_vertex = GRAPH::null_vertex;
 
     KtSsspAbstract(const GRAPH& g, vertex_index_t v0) :
         v0_(v0),
-        spt_(g.order(), -1),
+        spt_(g.order(), null_vertex),
         dist_(g.order(), WEIGHTOR{}.worst_weight) {}
 
-    // شԴ㵽v·()
+    // 返回从源点到顶点v的最短路径(逆序)
     auto pathR(vertex_index_t v) const {
         std::vector<vertex_index_t> p;
         vertex_index_t s = v;
         do {
             p.push_back(s);
             s = spt_[s];
-        } while (s != v0_ && s != v && s != -1);
+        } while (s != v0_ && s != v && s != null_vertex);
 
-        // s == -1ʾûл··ջɹ
-        // s == v0ʾv0ڻ·Ҫֶv0ջ
-        // s == vʾھvĸʱʧ˴v0->v·ջ·˻ΪvΪֹĸ
-        if(s != -1) p.push_back(s);
+        // s == null_vertex，表示没有环路，路径入栈成功
+        // s == v0，表示v0存在环路，需要手动将v0入栈
+        // s == v，表示存在经过v的负环，这时丢失了从v0->v的最短路径，栈中路径退化为以v为起止点的负环。
+        if(s != null_vertex) p.push_back(s);
 
         return p;
     }
 
 
-    // شԴ㵽v̾
+    // 返回从源点到顶点v的最短距离
     weight_type distance(vertex_index_t v) const {
         return dist_[v];
     }
 
 
-    // ǷڴԴ㵽v·
+    // 是否存在从源点到v的路径
     bool reachable(vertex_index_t v) const {
-        return spt_[v] != -1;
+        return spt_[v] != null_vertex;
+    }
+
+    // 最短路径树中顶点v的父顶点，即从源点到v的最短路径上v的前一顶点
+    vertex_index_t parent(vertex_index_t v) const {
+        return spt_[v];
     }
 
 
 protected:
 
-    // ɳ. жv0(v, w)w·Ƿȵǰw·
-    // wtΪ(v, w)Ȩֵ
+    // 边松弛. 判断v0经过边(v, w)到w的路径是否比当前到w的路径更好
+    // wt为边(v, w)的权值
     bool relax_(vertex_index_t v, vertex_index_t w, weight_type wt) {
-        if (spt_[v] != -1) {
+        if (spt_[v] != null_vertex) {
             if (v != v0_)
                 wt = WEIGHTOR{}.acc(wt, dist_[v]);
         }
@@ -91,16 +98,16 @@ protected:
     }
 
 protected:
-    vertex_index_t v0_; // Դ
-    std::vector<vertex_index_t> spt_; // (spt_[i], i)ʾԴv0_i·ϵһ
-    std::vector<weight_type> dist_; // dist_[i]ʾԴv0_i̾
+    vertex_index_t v0_; // 源点
+    std::vector<vertex_index_t> spt_; // (spt_[i], i)表示从源点v0_到顶点i的最短路径上的最后一条边
+    std::vector<weight_type> dist_; // dist_[i]表示从源点v0_到顶点i的最短距离
 };
 
 
-// ڹĵԴ·ʵ
-// Eϴлͼʱٶȷǳ
-// DAGƣòƱTS
-// NOTE: иʱ򣬻޵ݹ
+// 基于广度优先搜索的单源最短路径实现
+// 处理E较大的有环图时，速度非常慢
+// 处理DAG较有优势，貌似比TS方法还快
+// NOTE: 当有负环的时候，会陷入无限递归
 template<typename GRAPH, class WEIGHTOR = default_wtor<GRAPH>>
 class KtSsspBfs : public KtSsspAbstract<GRAPH, WEIGHTOR>
 {
@@ -119,7 +126,7 @@ private:
         for (; !iter.isEnd(); ++iter) {
             vertex_index_t v = iter.from(), w = *iter;
 
-            // relax_ѳջĶϢҪԳջbfs
+            // 如果relax_更新了已出栈的顶点信息，则需要对出栈顶点重新bfs
             if (super_::relax_(v, w, WEIGHTOR{}(iter.edge())) && iter.isPopped(w))
                 bfs_(g, w); 
         }
@@ -127,7 +134,9 @@ private:
 };
 
 
-// ٶȱbfsܶ࣬
+// 基于深度优先搜索的单源最短路径实现
+// 若非树边松弛成功，则须以其to顶点为源重新dfs，使用待处理顶点栈代替递归
+// 速度比bfs还慢，慢很多，弃疗
 template<typename GRAPH, class WEIGHTOR = default_wtor<GRAPH>>
 class KtSsspDfs : public KtSsspAbstract<GRAPH, WEIGHTOR>
 {
@@ -136,58 +145,79 @@ class KtSsspDfs : public KtSsspAbstract<GRAPH, WEIGHTOR>
 
 public:
     KtSsspDfs(const GRAPH& g, vertex_index_t v0) : super_(g, v0) {
-        dfs_(g, v0);
+        KtDfsKernel<GRAPH> dfs(g);
+        KpVisitor_ vis{ {}, *this, {} };
+        dfs.run(v0, vis);
+
+        while (!vis.todo.empty()) {
+            auto v = vis.todo.back(); vis.todo.pop_back();
+            dfs.reset();
+            dfs.run(v, vis);
+        }
     }
 
 private:
-    void dfs_(const GRAPH& g, vertex_index_t v) {
-        KtDfsIter<const GRAPH, false, true> iter(g, v);
-        for (; !iter.isEnd(); ++iter) {
-            vertex_index_t v = iter.from(), w = *iter;
 
-            if (super_::relax_(v, w, WEIGHTOR{}(iter.edge())))
-                if (!iter.isTree() && w != v)
-                    dfs_(g, w); // TODO: ֲͬ͵ıߣߣ±ߣرߣһŻ
+    struct KpVisitor_ : public KtDfsVisitor
+    {
+        KtSsspDfs& sp;
+        std::vector<vertex_index_t> todo; // 待重新dfs的顶点
+
+        template<typename E>
+        void treeEdge(vertex_index_t v, vertex_index_t w, const E& e) {
+            sp.relax_(v, w, WEIGHTOR{}(e));
         }
-    }
+
+        template<typename E>
+        void backEdge(vertex_index_t v, vertex_index_t w, const E& e) {
+            if (sp.relax_(v, w, WEIGHTOR{}(e)) && w != v)
+                todo.push_back(w); // TODO: 区分不同类型的边（跨边，下边，回边），进一步优化
+        }
+
+        template<typename E>
+        void crossEdge(vertex_index_t v, vertex_index_t w, const E& e) {
+            backEdge(v, w, e);
+        }
+    };
 };
 
 
 
-// Dijkstra㷨ĵԴ·ʵ
-// NOTE: 㷨ָ֧Ҳָ֧ȨֵΪһָȨֵ
-// ܻһ֮ǰ̵·ƻʼ·׼
-// Ҳ˵޷жϵǰ·ǲ̣ΪֵĸȨֵܻ·
+// 基于Dijkstra算法的单源最短路径实现
+// NOTE: 该算法不支持负环，也不支持负权值，因为一旦出现负权值，
+// 可能会出现一条比之前更短的路径，这会破坏始终延着最短路径生长的准则
+// 也就是说，我们无法判断当前的最短路径是不是真的最短，因为后面出现的负权值可能会让其他路径更短
 template<typename GRAPH, class WEIGHTOR = default_wtor<GRAPH>>
 class KtSsspDijkstra : public KtSsspAbstract<GRAPH, WEIGHTOR>
 {
     using super_ = KtSsspAbstract<GRAPH, WEIGHTOR>;
     using typename super_::vertex_index_t;
+    using super_::null_vertex;
     using super_::spt_;
     using super_::dist_;
 
 public:
     KtSsspDijkstra(const GRAPH& g, vertex_index_t v0) : super_(g, v0) {
 
-        std::vector<bool> vis(g.order(), false); // ڱԴv0i·ǷѼ
+        std::vector<bool> vis(g.order(), false); // 用于标记源点v0到顶点i的最短路径是否已计算
 
         vertex_index_t v = v0;
-        while (v != -1) { 
+        while (v != null_vertex) { 
             vis[v] = true;
 
-            // ɳ
+            // 边松弛
             for (vertex_index_t w = 0; w < g.order(); w++)
                 if ((!vis[w] || w == v0/*permit loop path*/) && g.hasEdge(v, w))
                     super_::relax_(v, w, WEIGHTOR{}(g.getEdge(v, w)));
 
 
-            // vis[i]falseļУѰҾv0·ŵĶ. TODO: ʹȶʵ
-            v = -1;
+            // 在vis[i]等于false的集合中，寻找距离v0路径最优的顶点. TODO: 使用优先队列实现
+            v = null_vertex;
             for (vertex_index_t w = 0; w < g.order(); w++)
-                if (!vis[w] && (v == -1 || WEIGHTOR{}.comp(dist_[w], dist_[v])))
+                if (!vis[w] && (v == null_vertex || WEIGHTOR{}.comp(dist_[w], dist_[v])))
                     v = w;
 
-            if (v == -1 || spt_[v] == -1/*disconnecte to v0*/) break; // all done
+            if (v == null_vertex || spt_[v] == null_vertex/*disconnecte to v0*/) break; // all done
         }
     }
 };
@@ -206,13 +236,13 @@ public:
         using element_type = std::pair<vertex_index_t, typename WEIGHTOR::weight_type>;
         struct Comp {
             bool operator()(const element_type& a, const element_type& b) {
-                return WEIGHTOR{}.comp(b.second, a.second); // ȶеıȽϺҪȽϣܱ֤Ԫڶж
+                return WEIGHTOR{}.comp(b.second, a.second); // 优先队列的比较函数需要反过来比较，才能保证最优元素在队列顶端
             }
         };
 
         using priority_queue = std::priority_queue<element_type, std::vector<element_type>, Comp>;
         priority_queue pq; pq.emplace(v0, dist_[v0]);
-        std::vector<bool> vis(g.order(), false); // ڱԴv0i·ǷѼ
+        std::vector<bool> vis(g.order(), false); // 用于标记源点v0到顶点i的最短路径是否已计算
 
         while (!pq.empty()) {
 
@@ -220,18 +250,19 @@ public:
             if (vis[v]) continue;
             vis[v] = true;
 
-            // ɳ
-            for (vertex_index_t w = 0; w < g.order(); w++)
-                if ((!vis[w] || w == v0/*permit loop path*/) && g.hasEdge(v, w))
-                    if (super_::relax_(v, w, WEIGHTOR{}(g.getEdge(v, w))))
-                        pq.emplace(w, dist_[w]);
+            // 边松弛
+            for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter) {
+                auto w = *iter;
+                if ((!vis[w] || w == v0/*permit loop path*/) && super_::relax_(v, w, WEIGHTOR{}(iter.edge())))
+                    pq.emplace(w, dist_[w]);
+            }
         }
     }
 };
 
 
-// 㷨ĵԴ·ʵ֣DAG.
-// ٶûп죬ЧʻȲbfs
+// 基于拓扑排序算法的单源最短路径实现，仅适用于DAG.
+// 运行速度没有想像中快，效率还比不上bfs方法
 template<typename DAG, class WEIGHTOR = default_wtor<DAG>>
 class KtSsspTs : public KtSsspAbstract<DAG, WEIGHTOR>
 {
@@ -242,7 +273,7 @@ public:
     KtSsspTs(const DAG& g, vertex_index_t v0) : super_(g, v0) {
         assert(!has_loop(g));
         KtTopologySort<DAG> ts(g);
-        auto j = ts.relabel(v0); // j֮ǰĶԺԣΪv0ûпɴ·
+        auto j = ts.relabel(v0); // j之前的顶点可以忽略，因为按照拓扑排序，v0与它们没有可达路径
         for(auto v = ts[j++]; j < g.order(); v = ts[j++]) {
             auto iter = KtAdjIter(g, v);
             while(!iter.isEnd()) {
@@ -255,10 +286,10 @@ public:
 
 
 
-// Bellman-Ford㷨ĵԴ·ʵ
-// NOTE: ȨֵĵԴ·⣬ʱ临ӶO(VE)
-// ڳͼʱ䲻Floyd㷨ãFloyd㷨Ҫҳȫ·ǵԴ
-// ϡͼʱFloyd㷨V޸ȨֵͼʱDijkstra㷨ԼV
+// 基于Bellman-Ford算法的单源最短路径实现
+// NOTE: 可用来解决包含负权值的单源最短路径问题，时间复杂度O(VE)。
+// 对于稠密图，其运行时间不比Floyd算法更好，Floyd算法则要找出全部最短路径，而不仅仅是单源。
+// 对于稀疏图，其运行时间最多比Floyd算法快V倍，但对于无负权值的图，其运行时间比Dijkstra算法慢约V倍。
 template<typename GRAPH, class WEIGHTOR = default_wtor<GRAPH>>
 class KtSsspBellmanFord : public KtSsspAbstract<GRAPH, WEIGHTOR>
 {
@@ -268,13 +299,13 @@ class KtSsspBellmanFord : public KtSsspAbstract<GRAPH, WEIGHTOR>
 public:
     KtSsspBellmanFord(const GRAPH& g, vertex_index_t v0) : super_(g, v0) {
         std::queue<vertex_index_t> q;
-        unsigned V = g.order();
-        q.push(v0); q.push(V); // ֵVǰһһָʹÿV鴦ֹ
-        unsigned N = 0;
+        vertex_index_t V = g.order();
+        q.push(v0); q.push(V); // 标记值V将当前一批顶点与下一批顶点分隔，并使得可以在V遍处理后终止。
+        std::size_t N = 0;
         while (!q.empty()) {
             vertex_index_t v = q.front(); q.pop();
             while (v == V) {
-                if (N++ > V) return; // һȳV·ʾ϶ڸ
+                if (N++ > V) return; // 存在一条长度超过V的最短路径，这表示肯定存在负环。
                 q.push(V);
                 v = q.front(); q.pop();
             }
@@ -290,7 +321,7 @@ public:
 
 
 
-// ȫԴ·Ļࣺⶥ㵽ͼ·
+// 全源最短路径的基类：计算任意顶点到图中其他各顶点的最短路径
 // FSSP(Full Source Shortest Path)
 template<typename GRAPH, class WEIGHTOR>
 class KtFsspAbstract
@@ -300,9 +331,10 @@ class KtFsspAbstract
 public:
     using weight_type = typename WEIGHTOR::weight_type;
     using vertex_index_t = typename GRAPH::vertex_index_t;
+    constexpr static vertex_index_t null_vertex = GRAPH::null_vertex;
 
     KtFsspAbstract(const GRAPH& g) 
-        : spt_(g.order(), std::vector<vertex_index_t>(g.order(), -1)),
+        : spt_(g.order(), std::vector<vertex_index_t>(g.order(), null_vertex)),
         dst_(g.order(), std::vector<weight_type>(g.order(), WEIGHTOR{}.worst_weight)) {}
 
 
@@ -311,31 +343,31 @@ public:
     }
 
 
-    // vw·()
+    // 返回v到w的最短路径(逆序)
     auto pathR(vertex_index_t v, vertex_index_t w) const {
         std::vector<vertex_index_t> p;
         vertex_index_t s = w;
         do {
             p.push_back(s);
             s = spt_[v][s];
-        } while (s != v && s != w && s != -1 );
-        if (s != -1) p.push_back(s);
+        } while (s != v && s != w && s != null_vertex);
+        if (s != null_vertex) p.push_back(s);
 
         return p;
     }
 
-    // Ƿڴvw·
+    // 是否存在从v到w的路径
     bool reachable(vertex_index_t v, vertex_index_t w) const {
-        return spt_[v][w] != -1;
+        return spt_[v][w] != null_vertex;
     }
 
 protected:
 
-    // ·ɳ. жsxٵt·Ƿȵǰst·
+    // 路径松弛. 判断s经过x再到t的路径是否比当前s到t的路径更好
     bool relax_(vertex_index_t s, vertex_index_t t, vertex_index_t x) {
-        assert(x != s && x != t); // sܵtڼ̻·
+        assert(x != s && x != t); // s可能等于t，用于计算最短环路
         const auto dst = WEIGHTOR{}.acc(dst_[s][x], dst_[x][t]);
-        if (WEIGHTOR{}.comp(dst, dst_[s][t])) { // dstdst_[s][t]
+        if (WEIGHTOR{}.comp(dst, dst_[s][t])) { // dst比dst_[s][t]更优
             dst_[s][t] = dst;
             spt_[s][t] = spt_[x][t];
             return true;
@@ -354,23 +386,24 @@ protected:
 
 
 
-// FloydʵȫԴ·
-// ʱ临ӶO(V^3)ڳͼ
-// ϡͼDijkstra㷨㵥Դ·ӶõȫԴ·
-// NOTE: 㷨δȨֵκμ裬˼ʹڸȨֵҲЧġ
-// ڸ·ֻҳһ·
+// Floyd实现全源最短路径
+// 时间复杂度O(V^3)，适用于稠密图
+// 对于稀疏图，可逐个顶点用Dijkstra算法计算单源最短路径，从而得到全源最短路径
+// NOTE: 该算法未对权值作任何假设，因此即使存在负权值也是有效的。
+// 如果不存在负环，则会计算出最短路径；否则，只能找出一条不包括负环的最短路径。
 template<typename GRAPH, class WEIGHTOR = default_wtor<GRAPH>>
 class KtFsspFloyd : public KtFsspAbstract<GRAPH, WEIGHTOR>
 {
     using super_ = KtFsspAbstract<GRAPH, WEIGHTOR>;
     using typename super_::vertex_index_t;
+    using super_::null_vertex;
     using super_::spt_;
     using super_::dst_;
 
 public:
     KtFsspFloyd(const GRAPH& g) : super_(g) {
 
-        // ߳ʼspt_dst_
+        // 按边初始化spt_和dst_
         KtBfsIter<const GRAPH, true, true> iter(g, 0);
         for (; !iter.isEnd(); ++iter) {
             vertex_index_t v = iter.from(), w = *iter;
@@ -380,10 +413,10 @@ public:
 
         const vertex_index_t V = g.order();
 
-        // ж·s->x->tǷ·s->t
+        // 判定路径s->x->t是否比路径s->t更优
         for (vertex_index_t x = 0; x < V; x++)
             for (vertex_index_t s = 0; s < V; s++)
-                if (spt_[s][x] != -1 && s != x) // s->xͨs==xԹ
+                if (spt_[s][x] != null_vertex && s != x) // 若s->x不通，或者s==x，则略过
                     for (vertex_index_t t = 0; t < V; t++)
                         if(t != x) super_::relax_(s, t, x);
     }
@@ -391,49 +424,52 @@ public:
 
 
 
-// DFSʵȫԴ·DAG
-// ʱ临ӶO(V*E)
-// ٶȱTSܶ
+// DFS实现全源最短路径，仅适用于DAG
+// 时间复杂度O(V*E)
+// 速度比TS方法快很多
 template<typename GRAPH, class WEIGHTOR = default_wtor<GRAPH>>
 class KtFsspDfs : public KtFsspAbstract<GRAPH, WEIGHTOR>
 {
     using super_ = KtFsspAbstract<GRAPH, WEIGHTOR>;
     using typename super_::vertex_index_t;
+    using super_::null_vertex;
     using super_::spt_;
     using super_::dst_;
 
 public:
-    KtFsspDfs(const GRAPH& g) : super_(g), done_(g.order(), false) {
+    KtFsspDfs(const GRAPH& g) : super_(g) {
         assert(!has_loop(g));
 
-        for (vertex_index_t v = 0; v < g.order(); v++)
-            if(!done_[v]) dfs_(g, v);
+        KtDfsKernel<GRAPH> dfs(g);
+        KpVisitor_ vis{ {}, g, *this };
+        dfs.runAll(vis);
     }
 
 private:
-    void dfs_(const GRAPH& g, vertex_index_t v) {
-        done_[v] = true;
-
-        auto iter = KtAdjIter(g, v);
-        for (; !iter.isEnd(); ++iter) {
-            auto w = *iter;
-            auto wt = WEIGHTOR{}(iter.edge());
-            if (WEIGHTOR{}.comp(wt, dst_[v][w])) {
-                dst_[v][w] = wt;
-                spt_[v][w] = v;
-            }
 
-            if (!done_[w]) dfs_(g, w);
+    // 顶点v出栈时，其所有后继顶点均已出栈，据此由后继顶点的最短路径推导v的最短路径
+    struct KpVisitor_ : public KtDfsVisitor
+    {
+        const GRAPH& g;
+        KtFsspDfs& sp;
 
-            if (w != v) {
-                for (vertex_index_t i = 0; i < g.order(); i++)
-                    if (spt_[w][i] != -1 && w != i)
-                        super_::relax_(v, i, w);
+        void finish(vertex_index_t v, vertex_index_t) {
+            auto iter = KtAdjIter(g, v);
+            for (; !iter.isEnd(); ++iter) {
+                auto w = *iter;
+                auto wt = WEIGHTOR{}(iter.edge());
+                if (WEIGHTOR{}.comp(wt, sp.dst_[v][w])) {
+                    sp.dst_[v][w] = wt;
+                    sp.spt_[v][w] = v;
+                }
+
+                if (w != v) {
+                    for (vertex_index_t i = 0; i < g.order(); i++)
+                        if (sp.spt_[w][i] != null_vertex && w != i)
+                            sp.relax_(v, i, w);
+                }
             }
         }
-    }
-
-private:
-    std::vector<bool> done_;
+    };
 };
 
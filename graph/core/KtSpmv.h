@@ -0,0 +1,141 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include "KtAdjIter.h"
+#include "../base/parallel_for.h"
+
+
+// 稀疏矩阵-向量乘（SpMV）式的迭代引擎，用于PageRank、Katz等需要反复扫描全图的分析算法
+// 将图视为邻接矩阵A（边v->w对应A[v][w] = 1），提供两种扫描方式：
+//   拉取（pull）：y = A^T * x，即y[w] = Σx[v] (v->w)。为此构造一份CSR格式的转置图（各顶点的入边），
+//     各顶点只写自己的结果，可按顶点区间无锁并行；
+//   推送（push）：沿原图的出边将x[v]累加到各邻接点，适合只有少数顶点非零的稀疏向量，单线程执行
+// 向量以连续数组存放，顶点区间按入边数划分为固定大小的块，块的划分与线程数无关，
+// 因此各项归约的结果（含浮点舍入）与线程数无关
+// 边的值不参与计算，需要加权时可由调用者以顶点向量缩放（如PageRank以出度归一化）
+template<typename GRAPH>
+class KtSpmv
+{
+public:
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+    constexpr static std::size_t chunk_size = std::size_t(1) << 16; // 每块的目标工作量（入边数 + 顶点数）
+
+
+    // @nthreads: 线程数，为0时取hardware_threads()
+    explicit KtSpmv(const GRAPH& g, unsigned nthreads = 0)
+        : g_(g), V_(g.order()), nthreads_(nthreads ? nthreads : hardware_threads()) {
+
+        outdeg_.assign(V_, 0);
+        inFirst_.assign(V_ + 1, 0);
+        for (vertex_index_t v = 0; v < V_; v++)
+            for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter) {
+                ++outdeg_[v];
+                ++inFirst_[*iter + 1];
+            }
+        for (vertex_index_t v = 0; v < V_; v++)
+            inFirst_[v + 1] += inFirst_[v];
+
+        // 按起点递增的次序填充，各顶点的入边按起点有序，拉取时的访存较为连续
+        inSrc_.resize(inFirst_[V_]);
+        std::vector<std::size_t> pos(inFirst_.begin(), inFirst_.end() - 1);
+        for (vertex_index_t v = 0; v < V_; v++)
+            for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter)
+                inSrc_[pos[*iter]++] = v;
+
+        // 划分顶点区间
+        chunks_.push_back(0);
+        std::size_t work(0);
+        for (vertex_index_t v = 0; v < V_; v++) {
+            work += indegree(v) + 1;
+            if (work >= chunk_size) {
+                chunks_.push_back(v + 1);
+                work = 0;
+            }
+        }
+        if (chunks_.back() != V_)
+            chunks_.push_back(V_);
+    }
+
+
+    const GRAPH& graph() const { return g_; }
+
+    vertex_index_t order() const { return V_; }
+
+    // 边数，无向图的每条边计2次
+    std::size_t size() const { return inSrc_.size(); }
+
+    unsigned outdegree(vertex_index_t v) const { return outdeg_[v]; }
+
+    unsigned indegree(vertex_index_t v) const { return unsigned(inFirst_[v + 1] - inFirst_[v]); }
+
+    unsigned threads() const { return nthreads_; }
+
+
+    // 拉取：对每个顶点v，计算s = Σx[u] (u->v)，并调用func(v, s)
+    // func返回double（如新旧值之差，用于收敛判断），返回各次返回值之和
+    // func可写入与x不同的数组的第v项，但不应修改x
+    template<typename T, typename FUNC>
+    double pull(const T* x, FUNC func) const {
+        return reduce_([this, x, &func](vertex_index_t first, vertex_index_t last) {
+            double acc(0);
+            for (auto v = first; v < last; v++) {
+                T s(0);
+                const vertex_index_t* src = inSrc_.data() + inFirst_[v];
+                const vertex_index_t* end = inSrc_.data() + inFirst_[v + 1];
+                for (; src != end; ++src)
+                    s += x[*src];
+                acc += func(v, s);
+            }
+            return acc;
+        });
+    }
+
+
+    // 推送：对每条边v->w，y[w] += x[v]，跳过x[v]为0的顶点
+    template<typename T>
+    void push(const T* x, T* y) const {
+        for (vertex_index_t v = 0; v < V_; v++)
+            if (x[v] != T(0))
+                for (auto iter = KtAdjIter(g_, v); !iter.isEnd(); ++iter)
+                    y[*iter] += x[v];
+    }
+
+
+    // 并行地对每个顶点调用func(v)，返回各次返回值之和
+    template<typename FUNC>
+    double map(FUNC func) const {
+        return reduce_([&func](vertex_index_t first, vertex_index_t last) {
+            double acc(0);
+            for (auto v = first; v < last; v++)
+                acc += func(v);
+            return acc;
+        });
+    }
+
+
+private:
+
+    // 以nthreads_个线程对各块执行func(first, last)，按块序累加返回值
+    template<typename FUNC>
+    double reduce_(FUNC func) const {
+        std::vector<double> partial(chunks_.size() - 1);
+        parallel_for(std::size_t(0), partial.size(), [this, &partial, &func](std::size_t c) {
+            partial[c] = func(chunks_[c], chunks_[c + 1]);
+        }, nthreads_, std::size_t(1));
+
+        double sum(0);
+        for (auto p : partial)
+            sum += p;
+        return sum;
+    }
+
+
+private:
+    const GRAPH& g_;
+    vertex_index_t V_;
+    unsigned nthreads_;
+    std::vector<unsigned> outdeg_;
+    std::vector<std::size_t> inFirst_; // 顶点v的入边为inSrc_[inFirst_[v], inFirst_[v + 1])
+    std::vector<vertex_index_t> inSrc_; // 入边的起点
+    std::vector<vertex_index_t> chunks_; // 第c块的顶点区间为[chunks_[c], chunks_[c + 1])
+};
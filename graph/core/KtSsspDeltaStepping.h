@@ -0,0 +1,250 @@
+#pragma once
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <algorithm>
+#include <type_traits>
+#include "KtShortestPath.h"
+#include "../base/parallel_for.h"
+
+
+// 基于delta-stepping算法的并行单源最短路径实现，适用于非负权值
+// 按距离将顶点分入宽度为delta的桶，依次处理各桶：
+//   1.反复松弛桶内顶点的轻边（权值 < delta），直至桶为空，新进入该桶的顶点将被再次处理
+//   2.对从该桶移出的全部顶点，松弛其重边（权值 >= delta），重边的终点必然落入后续的桶
+// 同一桶内的顶点可并行处理，各线程将松弛成功的顶点写入线程局部的桶，避免竞争
+// 处理第b个桶时，新的暂定距离总是落在第b至b + maxW/delta + 1个桶（maxW为最大边权），
+// 故各线程只需maxW/delta + 2个循环使用的桶，桶为空时直接跳至下一个非空的桶
+// delta越小越接近Dijkstra（并行度低），越大越接近Bellman-Ford（重复松弛多）
+// 结果与KtSsspDijkstra一致，包括distance(v0)为经过v0的最短环路
+template<typename GRAPH, class WEIGHTOR = default_wtor<GRAPH>>
+class KtSsspDeltaStepping : public KtSsspAbstract<GRAPH, WEIGHTOR>
+{
+    using super_ = KtSsspAbstract<GRAPH, WEIGHTOR>;
+    using super_::v0_;
+    using super_::spt_;
+    using super_::dist_;
+
+public:
+    using typename super_::weight_type;
+    using typename super_::vertex_index_t;
+    using super_::null_vertex;
+    constexpr static vertex_index_t parallel_threshold = 256;
+
+    // @nthreads: 线程数，为0时取hardware_threads()
+    // @delta: 桶的宽度，为0时由autoDelta估计
+    KtSsspDeltaStepping(const GRAPH& g, vertex_index_t v0, unsigned nthreads = 0, weight_type delta = 0)
+        : super_(g, v0), g_(g), delta_(delta > 0 ? delta : autoDelta(g)), nthreads_(nthreads ? nthreads : hardware_threads()) {
+        run_();
+    }
+
+
+    // 估计桶的宽度：平均权值与平均出度之比的2倍，使每个桶的轻边松弛约有常数轮
+    static weight_type autoDelta(const GRAPH& g) {
+        double sum(0), E(0);
+        for (vertex_index_t v = 0; v < g.order(); v++)
+            for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter) {
+                sum += WEIGHTOR{}(iter.edge());
+                E += 1;
+            }
+
+        double delta = E > 0 ? 2 * sum / E * g.order() / E : 1;
+        if constexpr (std::is_integral_v<weight_type>)
+            return std::max(weight_type(delta), weight_type(1));
+        else
+            return delta > 0 ? weight_type(delta) : weight_type(1);
+    }
+
+    weight_type delta() const { return delta_; }
+
+
+private:
+
+    struct KpLocal_
+    {
+        std::vector<std::vector<vertex_index_t>> buckets; // 线程局部的循环桶，第b个桶位于buckets[b % numBuckets_]
+        std::vector<vertex_index_t> removed; // 本线程从当前桶移出的顶点
+        weight_type cycle; // 经过v0的最短环路
+        vertex_index_t cycleFrom; // 最短环路上回到v0的边的起点
+    };
+
+    std::size_t bucketOf_(weight_type d) const {
+        return static_cast<std::size_t>(d / delta_);
+    }
+
+    // 以w为终点的边松弛，成功时返回true
+    bool relaxTo_(vertex_index_t v, vertex_index_t w, weight_type d) {
+        if (!(d < tent_[w].load(std::memory_order_relaxed)))
+            return false;
+
+        // 距离与父顶点须一并更新，以顶点锁保护
+        while (locks_[w].exchange(true, std::memory_order_acquire));
+        bool ok = d < tent_[w].load(std::memory_order_relaxed);
+        if (ok) {
+            tent_[w].store(d, std::memory_order_relaxed);
+            parent_[w] = v;
+        }
+        locks_[w].store(false, std::memory_order_release);
+        return ok;
+    }
+
+    // 松弛顶点v的轻边（light为true）或重边
+    void relaxEdges_(KpLocal_& local, vertex_index_t v, bool light) {
+        auto dv = tent_[v].load(std::memory_order_relaxed);
+        for (auto iter = KtAdjIter(g_, v); !iter.isEnd(); ++iter) {
+            weight_type wt = WEIGHTOR{}(iter.edge());
+            if ((wt < delta_) != light)
+                continue;
+
+            auto w = *iter;
+            auto d = dv + wt;
+            if (w == v0_) { // 回到源点的边只用于计算最短环路
+                if (d < local.cycle)
+                    local.cycle = d, local.cycleFrom = v;
+            }
+            else if (relaxTo_(v, w, d)) {
+                local.buckets[bucketOf_(d) % numBuckets_].push_back(w);
+            }
+        }
+    }
+
+    // 以nthreads_个线程对vs中的各顶点执行func(local, v)，较少的顶点不值得启动线程
+    template<typename FUNC>
+    void forEach_(const std::vector<vertex_index_t>& vs, FUNC func) {
+        auto expand = [this, &vs, &func](unsigned tid, std::size_t b, std::size_t e) {
+            for (auto i = b; i < e; i++)
+                func(locals_[tid], vs[i]);
+        };
+
+        if (vs.size() < parallel_threshold)
+            expand(0, 0, vs.size());
+        else
+            parallel_blocks(std::size_t(0), vs.size(), expand, nthreads_);
+    }
+
+    // 收集各线程局部的第b个桶
+    void gather_(std::size_t b, std::vector<vertex_index_t>& frontier) {
+        frontier.clear();
+        for (auto& local : locals_) {
+            auto& bucket = local.buckets[b % numBuckets_];
+            frontier.insert(frontier.end(), bucket.begin(), bucket.end());
+            bucket.clear();
+        }
+    }
+
+    // 第b个桶之后的首个非空桶与b的距离，全部桶均为空时返回0
+    std::size_t nextBucket_(std::size_t b) const {
+        for (std::size_t k = 1; k < numBuckets_; k++)
+            for (auto& local : locals_)
+                if (!local.buckets[(b + k) % numBuckets_].empty())
+                    return k;
+        return 0;
+    }
+
+    // 最大的边权，用于确定循环桶的数量
+    weight_type maxWeight_() const {
+        std::vector<weight_type> maxWt(nthreads_, weight_type(0));
+        parallel_blocks(vertex_index_t(0), g_.order(), [this, &maxWt](unsigned tid, vertex_index_t b, vertex_index_t e) {
+            for (auto v = b; v < e; v++)
+                for (auto iter = KtAdjIter(g_, v); !iter.isEnd(); ++iter) {
+                    weight_type wt = WEIGHTOR{}(iter.edge());
+                    if (maxWt[tid] < wt)
+                        maxWt[tid] = wt;
+                }
+        }, nthreads_);
+        return *std::max_element(maxWt.begin(), maxWt.end());
+    }
+
+    void run_();
+
+private:
+    const GRAPH& g_;
+    weight_type delta_;
+    unsigned nthreads_;
+    std::size_t numBuckets_; // 各线程循环桶的数量
+    std::unique_ptr<std::atomic<weight_type>[]> tent_; // 暂定距离，计算完成后写入dist_
+    std::unique_ptr<std::atomic<bool>[]> locks_;
+    std::unique_ptr<std::atomic<std::size_t>[]> stamps_; // 顶点最近一次被处理的轮次，用于去除同一轮中的重复顶点
+    std::unique_ptr<std::atomic<std::size_t>[]> removedIn_; // 顶点最近一次被移出的桶（加1），用于去除重复的重边松弛
+    std::vector<vertex_index_t> parent_;
+    std::vector<KpLocal_> locals_;
+};
+
+
+template<typename GRAPH, class WEIGHTOR>
+void KtSsspDeltaStepping<GRAPH, WEIGHTOR>::run_()
+{
+    const vertex_index_t V = g_.order();
+    tent_.reset(new std::atomic<weight_type>[V]);
+    locks_.reset(new std::atomic<bool>[V]);
+    stamps_.reset(new std::atomic<std::size_t>[V]);
+    removedIn_.reset(new std::atomic<std::size_t>[V]);
+    for (vertex_index_t v = 0; v < V; v++) {
+        tent_[v].store(WEIGHTOR{}.worst_weight, std::memory_order_relaxed);
+        locks_[v].store(false, std::memory_order_relaxed);
+        stamps_[v].store(0, std::memory_order_relaxed);
+        removedIn_[v].store(0, std::memory_order_relaxed);
+    }
+    parent_.assign(V, null_vertex);
+    numBuckets_ = bucketOf_(maxWeight_()) + 3; // 多留一个桶，以容纳浮点权值的舍入误差
+    locals_.resize(nthreads_);
+    for (auto& local : locals_) {
+        local.buckets.resize(numBuckets_);
+        local.cycle = WEIGHTOR{}.worst_weight, local.cycleFrom = null_vertex;
+    }
+
+    tent_[v0_].store(weight_type(0), std::memory_order_relaxed);
+    locals_[0].buckets[0].push_back(v0_);
+
+    std::vector<vertex_index_t> frontier, removed;
+    std::size_t round(0);
+    for (std::size_t b = 0; ; b++) {
+        gather_(b, frontier);
+        if (frontier.empty()) {
+            // 跳至下一个非空的桶，全部桶均为空时结束
+            auto k = nextBucket_(b);
+            if (k == 0) break;
+            b += k - 1;
+            continue;
+        }
+
+        // 反复松弛轻边，直至当前桶为空
+        while (!frontier.empty()) {
+            ++round;
+            forEach_(frontier, [this, b, round](KpLocal_& local, vertex_index_t v) {
+                // 跳过已移入更早的桶（已处理过）的顶点，以及本轮的重复顶点
+                if (bucketOf_(tent_[v].load(std::memory_order_relaxed)) != b
+                    || stamps_[v].exchange(round, std::memory_order_relaxed) == round)
+                    return;
+                if (removedIn_[v].exchange(b + 1, std::memory_order_relaxed) != b + 1)
+                    local.removed.push_back(v);
+                relaxEdges_(local, v, true);
+            });
+            gather_(b, frontier);
+        }
+
+        // 松弛移出顶点的重边
+        removed.clear();
+        for (auto& local : locals_) {
+            removed.insert(removed.end(), local.removed.begin(), local.removed.end());
+            local.removed.clear();
+        }
+        forEach_(removed, [this](KpLocal_& local, vertex_index_t v) {
+            relaxEdges_(local, v, false);
+        });
+    }
+
+    // 输出结果
+    for (vertex_index_t v = 0; v < V; v++)
+        if (v != v0_ && parent_[v] != null_vertex) {
+            dist_[v] = tent_[v].load(std::memory_order_relaxed);
+            spt_[v] = parent_[v];
+        }
+    for (auto& local : locals_)
+        if (local.cycleFrom != null_vertex && local.cycle < dist_[v0_])
+            dist_[v0_] = local.cycle, spt_[v0_] = local.cycleFrom;
+
+    tent_.reset(); locks_.reset(); stamps_.reset(); removedIn_.reset();
+    std::vector<vertex_index_t>().swap(parent_);
+    std::vector<KpLocal_>().swap(locals_);
+}
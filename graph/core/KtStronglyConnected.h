@@ -1,72 +1,82 @@
 #pragma once
 #include <vector>
-#include "KtDfsIterX.h"
+#include "KtDfsIter.h"
+#include "KtDfsKernel.h"
 #include "KtTopologySort.h"
 #include "../util/inverse.h"
 
 
 /*
- һͼӼSSȡuvҵһuv·ôSǿͨġ
- ǿͨĶ㼯Sмⶥ㣬ǿͨģôSԭͼһǿͨSCCStrongly Connected Component
- ͼԷֽɲɵSCCǿֽͨ⡣
- ѷֽSCCһ㣬͵õһDAG
+ 对于一个有向图顶点的子集S，如果在S内任取两个顶点u和v，都能找到一条从u到v的路径，那么S是强连通的。
+ 如果在强连通的顶点集合S中加入其他任意顶点，它都不再是强连通的，那么S是原图的一个强连通分量（SCC：Strongly Connected Component）。
+ 任意有向图都可以分解成若干不相干的SCC，这就是强连通分量分解。
+ 把分解后的SCC缩成一个顶点，就得到一个DAG。
 */
 
+template<typename VERTEX_INDEX = unsigned>
 class KvStronglyConnected
 {
 public:
+    using vertex_index_t = VERTEX_INDEX;
+    constexpr static vertex_index_t null_vertex = static_cast<vertex_index_t>(-1);
 
-    // ǿͨĿ
-    unsigned count() const {
+    // 返回强连通分量数目
+    vertex_index_t count() const {
         return numScc_;
     }
 
-    // жϽڵvwǷͬһǿͨ
-    bool reachable(unsigned v, unsigned w) const {
+    // 判断节点v和w是否属于同一强连通分量
+    bool reachable(vertex_index_t v, vertex_index_t w) const {
         return idScc_[v] == idScc_[w];
     }
 
-    // ؽڵvǿͨID
-    unsigned operator[](unsigned v) const {
+    // 返回节点v所在强连通分量的ID
+    vertex_index_t operator[](vertex_index_t v) const {
         return idScc_[v];
     }
 
 
 protected:
-    unsigned numScc_; // ǿͨĿ
-    std::vector<unsigned> idScc_; // ǿͨidͬidĶͬһǿͨ
+    vertex_index_t numScc_; // 强连通分量数目
+    std::vector<vertex_index_t> idScc_; // 强连通分量的id，相同id的顶点属于同一强连通分量
 };
 
 
-// Kosaraju㷨SCCֽ
-// 㷨ͨ򵥵DFSʵ֣
-//   һ飺жкšɺԽӽͼβҶӣıԽС
-//   ڶ飺Ƚб߷򣨻ͼȻԱĶΪDFS㼯ϼΪһSCC
-//          ֻ֮ҪδʵĶ㣬ʹѡȡĲظDFS
+// 基于Kosaraju算法的SCC分解
+// 算法通过两遍简单的DFS实现：
+//   第一遍：对所有顶点进行后序编号。完成后，越接近图的尾部（搜索树的叶子），顶点的编号越小。
+//   第二遍：先将所有边反向（或进行逆图操作），然后以编号最大的顶点为起点进行DFS，遍历顶点集合即为一个SCC。
+//          之后，只要还有尚未访问的顶点，就从中选取编号最大的不断重复DFS。
 template<typename GRAPH>
-class KtStronglyConnectedKos : public KvStronglyConnected
+class KtStronglyConnectedKos : public KvStronglyConnected<typename GRAPH::vertex_index_t>
 {
     static_assert(GRAPH::isDigraph(), "KtStronglyConnectedKos must instantiated with DiGraph.");
 
+    using super_ = KvStronglyConnected<typename GRAPH::vertex_index_t>;
+    using super_::numScc_;
+    using super_::idScc_;
+
 public:
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+
     KtStronglyConnectedKos(const GRAPH& g) {
-        // һDFS
-        KtTopologySortInv<GRAPH> ts(g); // 㷨ֻDAGЧԴ˴ʹûDFS
+        // 第一遍DFS
+        KtTopologySortInv<GRAPH> ts(g); // 拓扑排序算法只对DAG有效，所以此处使用基于DFS的逆拓扑排序计算后序编号
 
-        // ڶDFS
+        // 第二遍DFS
         auto gR = inverse(g); 
-        unsigned V = g.order();
+        vertex_index_t V = g.order();
         numScc_ = 0;
-        idScc_.assign(V, -1);        
-        unsigned i(V-1);
-        KtDfsIter<const GRAPH> iter(gR, -1);
+        idScc_.assign(V, GRAPH::null_vertex);        
+        vertex_index_t i(V-1);
+        KtDfsIter<const GRAPH> iter(gR, GRAPH::null_vertex);
     
         while(true) {
             iter.start(ts[i]);
 
             while(!iter.isEnd()) {
                 if(iter.isTree()) {
-                    assert(idScc_[*iter] == -1);
+                    assert(idScc_[*iter] == GRAPH::null_vertex);
                     idScc_[*iter] = numScc_;
                 }
                 ++iter;      
@@ -74,72 +84,108 @@ public:
 
             ++numScc_;
 
-            // δʵŶ
-            while(i != 0 && idScc_[ts[--i]] != -1);
+            // 搜索尚未访问的最大编号顶点
+            while(i != 0 && idScc_[ts[--i]] != GRAPH::null_vertex);
 
-            if(idScc_[ts[i]] != -1) // жѷ
+            if(idScc_[ts[i]] != GRAPH::null_vertex) // 所有顶点均已访问
                 break;
         }
     }
 };
 
 
-// Tarjan㷨SCCֽ
-// findBridge㷨ƣͨlowֵԾۺͨ
+// 基于Tarjan算法的SCC分解
+// 与findBridge算法相似，通过low值回溯以聚合连通分量
 template<typename GRAPH>
-class KtStronglyConnectedTar : public KvStronglyConnected
+class KtStronglyConnectedTar : public KvStronglyConnected<typename GRAPH::vertex_index_t>
 {
     static_assert(GRAPH::isDigraph(), "KtStronglyConnectedTar must instantiated with DiGraph.");
 
+    using super_ = KvStronglyConnected<typename GRAPH::vertex_index_t>;
+    using super_::numScc_;
+    using super_::idScc_;
+
 public:
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+
     KtStronglyConnectedTar(const GRAPH& g) {
-        unsigned V = g.order();
         numScc_ = 0;
-        idScc_.resize(V, -1);       
-        std::vector<unsigned> S; 
-        KtDfsIterX<const GRAPH, true> iter(g, 0);
-        while(!iter.isEnd()) {
-            unsigned v = *iter;
-            if(iter.isPushing()) 
-                S.push_back(v);
+        idScc_.resize(g.order(), GRAPH::null_vertex);
+        KtDfsKernel<GRAPH> dfs(g);
+        KpVisitor_ vis{ {}, dfs, std::vector<vertex_index_t>(g.order()), {}, *this };
+        dfs.runAll(vis);
+    }
+
+private:
+
+    struct KpVisitor_ : public KtDfsVisitor
+    {
+        const KtDfsKernel<GRAPH>& dfs;
+        std::vector<vertex_index_t> low;
+        std::vector<vertex_index_t> S; // 尚未归入SCC的顶点栈
+        KtStronglyConnectedTar& scc;
+
+        void discover(vertex_index_t v) {
+            low[v] = dfs.pushIndex(v);
+            S.push_back(v);
+        }
+
+        // 只有尚未归入SCC的顶点才能更新low值
+        template<typename E>
+        void backEdge(vertex_index_t v, vertex_index_t w, const E&) {
+            if (scc.idScc_[w] == GRAPH::null_vertex && low[v] > dfs.pushIndex(w))
+                low[v] = dfs.pushIndex(w);
+        }
+
+        template<typename E>
+        void crossEdge(vertex_index_t v, vertex_index_t w, const E& e) {
+            backEdge(v, w, e);
+        }
 
-            if(iter.isBridge()) {
-                unsigned w;
+        void finish(vertex_index_t v, vertex_index_t p) {
+            if (low[v] == dfs.pushIndex(v)) {
+                vertex_index_t w;
                 do {
                     w = S.back(); S.pop_back();
-                    idScc_[w] = numScc_; 
-                    iter.resetLowIndex(w); 
-                }while(w != v);
-                numScc_++;
-            } 
+                    scc.idScc_[w] = scc.numScc_;
+                } while (w != v);
+                scc.numScc_++;
+            }
 
-            ++iter;
+            if (p != GRAPH::null_vertex && low[p] > low[v])
+                low[p] = low[v];
         }
-    }
+    };
 };
 
 
-// Gabow㷨SCCֽ
+// 基于Gabow算法的SCC分解
 template<typename GRAPH>
-class KtStronglyConnectedGab : public KvStronglyConnected
+class KtStronglyConnectedGab : public KvStronglyConnected<typename GRAPH::vertex_index_t>
 {
     static_assert(GRAPH::isDigraph(), "KtStronglyConnectedGab must instantiated with DiGraph.");
 
+    using super_ = KvStronglyConnected<typename GRAPH::vertex_index_t>;
+    using super_::numScc_;
+    using super_::idScc_;
+
 public:
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+
     KtStronglyConnectedGab(const GRAPH& g) {
-        unsigned V = g.order();
+        vertex_index_t V = g.order();
         numScc_ = 0;
-        idScc_.resize(V, -1);       
-        std::vector<unsigned> S, path;
+        idScc_.resize(V, GRAPH::null_vertex);       
+        std::vector<vertex_index_t> S, path;
         KtDfsIter<const GRAPH, true, true, true> iter(g, 0);
         while(!iter.isEnd()) {
-            unsigned v = *iter;
+            vertex_index_t v = *iter;
             if(iter.isTree()) {
                 S.push_back(v);
                 path.push_back(v);
             }
-            else if(idScc_[v] == -1) {
-                assert(iter.pushIndex(v) != -1);
+            else if(idScc_[v] == GRAPH::null_vertex) {
+                assert(iter.pushIndex(v) != GRAPH::null_vertex);
                 while(iter.pushIndex(path.back()) > iter.pushIndex(v))
                     path.pop_back();
             }
@@ -147,7 +193,7 @@ public:
             if(iter.isPopping() && path.back() == v) {
                 path.pop_back();
 
-                unsigned w;
+                vertex_index_t w;
                 do {
                     w = S.back(); S.pop_back();
                     idScc_[w] = numScc_;
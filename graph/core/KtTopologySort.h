@@ -2,40 +2,48 @@
 #include "KtDfsIter.h"
 #include <assert.h>
 #include <queue>
-
-
-// Դ㣨Ϊ0Ķ㣩е㷨
-// 2ֶ壺
-//   1.±ţDAG±ŴӶʹÿɽСŶָϴŶ
-//   2.DAGһˮƽӶʹб߾ָ
-// ֶǵȼۺͻģ֪ts±ż㷽£tsI[ts[v]] = v
-// ֪ͬ±tsI㷽£ts[tsI[v]] = v
+#include <atomic>
+#include <memory>
+#include "../base/KtRange.h"
+#include "../base/parallel_for.h"
+
+
+// 基于源点（入度为0的顶点）队列的拓扑排序算法
+// 拓扑排序的2种定义：
+//   1.重新编号：对DAG顶点重新编号从而使每条边由较小编号顶点指向较大编号顶点
+//   2.重新整理：将DAG顶点在一条水平线上重新整理，从而使所有边均由左指向右
+// 以上两种定义是等价和互逆的，若已知重新整理ts，则重新编号计算方法如下：tsI[ts[v]] = v
+// 同样，若已知重新编号tsI，则重新整理计算方法如下：ts[tsI[v]] = v
 template<typename DAG>
 class KtTopologySort
 {
     static_assert(DAG::isDigraph(), "KtTopologySort must instantiated with Digraph.");
 
 public:
+    using vertex_index_t = typename DAG::vertex_index_t;
+    using edge_index_t = typename DAG::edge_index_t;
+
     KtTopologySort(const DAG& dag) {
         //assert(!dag.hasLoop());
-        unsigned V = dag.order();
-        ts_.resize(V, -1); tsI_.resize(V, -1);
-
-        // 
-        std::vector<unsigned> ins(V, 0);
-        for (unsigned v = 0; v < V; v++)
-            ins[v] = dag.indegree(v);
+        vertex_index_t V = dag.order();
+        ts_.resize(V, DAG::null_vertex); tsI_.resize(V, DAG::null_vertex);
+
+        // 遍历一次邻接表计算各顶点的入度，避免逐顶点调用dag.indegree
+        std::vector<edge_index_t> ins(V, 0);
+        for (vertex_index_t v = 0; v < V; v++)
+            for (auto iter = KtAdjIter(dag, v); !iter.isEnd(); ++iter)
+                ++ins[*iter];
         
-        // Դq
-        std::queue<unsigned> q; // Դ
-        for(unsigned v = 0; v < V; v++) 
+        // 将源点推入队列q
+        std::queue<vertex_index_t> q; // 源点队列
+        for(vertex_index_t v = 0; v < V; v++) 
             if(ins[v] == 0) q.push(v);
         assert(!q.empty());
 
 
-        // FIFO˳򣬶Դ
-        for(unsigned i = 0; !q.empty(); i++) {
-            unsigned v = q.front(); q.pop();
+        // 按照FIFO顺序，对源点进行拓扑排序
+        for(vertex_index_t i = 0; !q.empty(); i++) {
+            vertex_index_t v = q.front(); q.pop();
             ts_[i] = v; 
             tsI_[v] = i;
             auto iter = KtAdjIter(dag, v);
@@ -45,13 +53,13 @@ public:
         }
     }
 
-    // 
-    unsigned operator[](unsigned v) const {
+    // 返回重新整理
+    vertex_index_t operator[](vertex_index_t v) const {
         return ts_[v];
     }
     
-    // ±
-    unsigned relabel(unsigned v) const {
+    // 返回重新编号
+    vertex_index_t relabel(vertex_index_t v) const {
         return tsI_[v];
     }
 
@@ -62,44 +70,159 @@ public:
 
 
 private:
-    std::vector<unsigned> ts_, tsI_; 
+    std::vector<vertex_index_t> ts_, tsI_; 
 };
 
 
 
-// Dfs㷨
-// DFSеĺſԵõһ
-// ڷDAG
+// 按层并行的拓扑排序
+// 第0层为全部源点，第k层为所有前驱均位于前k-1层、且至少有一个前驱位于第k-1层的顶点
+// 同层顶点之间没有依赖关系，因此层划分可直接用作DAG任务的并行调度（波前）
+// 各层内部并行处理：以原子操作递减后继顶点的入度，入度减为0的顶点进入下一层
+// 层内顶点按编号升序排列，因此结果与线程数无关
+template<typename DAG>
+class KtTopologyLevels
+{
+    static_assert(DAG::isDigraph(), "KtTopologyLevels must instantiated with Digraph.");
+
+public:
+    using vertex_index_t = typename DAG::vertex_index_t;
+    using edge_index_t = typename DAG::edge_index_t;
+    constexpr static vertex_index_t parallel_threshold = 1024;
+
+    // @nthreads: 线程数，为0时取hardware_threads()
+    KtTopologyLevels(const DAG& dag, unsigned nthreads = 0) {
+        const vertex_index_t V = dag.order();
+        if (nthreads == 0) nthreads = hardware_threads();
+        ts_.reserve(V); tsI_.resize(V, DAG::null_vertex); level_.resize(V, DAG::null_vertex);
+        offset_.push_back(0);
+
+        // 计算各顶点的入度
+        std::unique_ptr<std::atomic<edge_index_t>[]> ins(new std::atomic<edge_index_t>[V]);
+        for (vertex_index_t v = 0; v < V; v++)
+            ins[v].store(0, std::memory_order_relaxed);
+        parallel_for(vertex_index_t(0), V, [&dag, &ins](vertex_index_t v) {
+            for (auto iter = KtAdjIter(dag, v); !iter.isEnd(); ++iter)
+                ins[*iter].fetch_add(1, std::memory_order_relaxed);
+        }, nthreads);
+
+        // 第0层
+        for (vertex_index_t v = 0; v < V; v++)
+            if (ins[v].load(std::memory_order_relaxed) == 0)
+                ts_.push_back(v);
+
+        // 逐层推进，当前层为ts_[offset_.back(), ts_.size())
+        std::vector<std::vector<vertex_index_t>> nexts(nthreads);
+        while (ts_.size() > offset_.back()) {
+            vertex_index_t first = static_cast<vertex_index_t>(offset_.back());
+            vertex_index_t last = static_cast<vertex_index_t>(ts_.size());
+            offset_.push_back(last);
+
+            auto expand = [this, &dag, &ins, &nexts](unsigned tid, vertex_index_t b, vertex_index_t e) {
+                auto& next = nexts[tid];
+                for (auto i = b; i < e; i++)
+                    for (auto iter = KtAdjIter(dag, ts_[i]); !iter.isEnd(); ++iter)
+                        if (ins[*iter].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                            next.push_back(*iter);
+            };
+
+            // 较小的层不值得启动线程
+            if (last - first < parallel_threshold)
+                expand(0, first, last);
+            else
+                parallel_blocks(first, last, expand, nthreads);
+
+            for (auto& next : nexts) {
+                ts_.insert(ts_.end(), next.begin(), next.end());
+                next.clear();
+            }
+            std::sort(ts_.begin() + last, ts_.end());
+        }
+
+        for (vertex_index_t l = 0; l < levels(); l++)
+            for (auto i = offset_[l]; i < offset_[l + 1]; i++) {
+                tsI_[ts_[i]] = static_cast<vertex_index_t>(i);
+                level_[ts_[i]] = l;
+            }
+    }
+
+
+    // 图是否为DAG。若图有环，环上及环可达的顶点不会被排序
+    bool isDag() const { return ts_.size() == tsI_.size(); }
+
+    // 返回重新整理
+    vertex_index_t operator[](vertex_index_t v) const {
+        return ts_[v];
+    }
+
+    // 返回重新编号
+    vertex_index_t relabel(vertex_index_t v) const {
+        return tsI_[v];
+    }
+
+    const auto& relabels() const {
+        return tsI_;
+    }
+
+    // 返回层数
+    vertex_index_t levels() const { 
+        return static_cast<vertex_index_t>(offset_.size() - 1); 
+    }
+
+    // 返回顶点v所在的层
+    vertex_index_t level(vertex_index_t v) const {
+        return level_[v];
+    }
+
+    // 返回第l层的全部顶点
+    auto levelAt(vertex_index_t l) const {
+        return KtRange(ts_.cbegin() + offset_[l], ts_.cbegin() + offset_[l + 1]);
+    }
+
+
+private:
+    std::vector<vertex_index_t> ts_, tsI_;
+    std::vector<vertex_index_t> level_; // 各顶点所在的层
+    std::vector<std::size_t> offset_; // 第l层顶点为ts_[offset_[l], offset_[l + 1])
+};
+
+
+
+// 基于Dfs算法的逆拓扑排序
+// DFS中的后序编号可以得到一个逆拓扑排序
+// 适用于非DAG
 template<typename GRAPH>
 class KtTopologySortInv
 {
     static_assert(GRAPH::isDigraph(), "KtTopologySortInv must instantiated with Digraph.");
 
 public:
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+
     KtTopologySortInv(const GRAPH& g) : dfs_(g, 0) {
 
         while(!dfs_.isEnd())
             ++dfs_;
         
-        unsigned V = g.order();
+        vertex_index_t V = g.order();
         popI_.resize(V);
-        for (unsigned v = 0; v < V; v++) {
+        for (vertex_index_t v = 0; v < V; v++) {
             assert(relabel(v) < V);
             popI_[relabel(v)] = v;
         }
     }
 
 
-    unsigned operator[](unsigned v) const {
+    vertex_index_t operator[](vertex_index_t v) const {
         return popI_[v];
     }
     
-    unsigned relabel(unsigned v) const {
+    vertex_index_t relabel(vertex_index_t v) const {
         return dfs_.popIndex(v);
     }
 
 
 private:
     KtDfsIter<const GRAPH, true> dfs_;
-    std::vector<unsigned> popI_;
+    std::vector<vertex_index_t> popI_;
 };
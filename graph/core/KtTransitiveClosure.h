@@ -6,9 +6,9 @@
 #include "KtStronglyConnected.h"
 
 
-// ͼıհĻ
-// @useSpare: Ƿʹϡͼհ
-// TODO: հ·ϢȨֵϢ
+// 计算图的闭包的基类
+// @useSpare: 是否使用稀疏图保存闭包结果
+// TODO: 闭包结果不包含路径信息和权值信息
 template<typename GRAPH, bool useSpare>
 class KtTcAbstract
 {
@@ -32,7 +32,7 @@ public:
     }
 
 
-    // жϱհͼvǷɴw
+    // 判断闭包图中v是否可达w
     bool reachable(vertex_index_t v, vertex_index_t w) const {
         return clsg_.hasEdge(v, w);
     }
@@ -42,7 +42,7 @@ public:
 protected:
 
     void set_(vertex_index_t v, vertex_index_t w) {
-        if (reachable(v, w))
+        if (!reachable(v, w))
             clsg_.addEdge(v, w);
     }
 
@@ -51,13 +51,13 @@ protected:
     }
 
 private:
-    closure_graph_t clsg_; // հͼ
+    closure_graph_t clsg_; // 闭包图
 };
 
 
 /*
-  Warshall㷨ıհʵ.
-  Warshall㷨ڲĴݱհʵʱ临ӶȴV ^ 3 * log2VΪV ^ 3
+  基于Warshall算法的闭包实现.
+  Warshall算法将基于布尔矩阵的传递闭包实现时间复杂度从V ^ 3 * log2V降低为V ^ 3
  */
 
 template<typename GRAPH, bool useSpare = false>
@@ -73,10 +73,10 @@ public:
         auto V = g.order();
         for (unsigned v = 0; v < V; v++) 
             for (unsigned w = 0; w < V; w++)
-                if (v == w || g.hasEdge(v, w)) // νʳʼȷԻ
+                if (v == w || g.hasEdge(v, w)) // 用谓词初始化，并确保自环
                     set_(v, w);
 
-        // Warshall㷨
+        // Warshall算法
         for (unsigned i = 0; i < V; i++)
             for (unsigned s = 0; s < V; s++)
                 if (reachable(s, i)) {
@@ -89,8 +89,8 @@ public:
 
 
 /*
-  DFSıհʵ.
-  GĸΪʼһDFSɴĶ㼯Դ˼㴫ݱհ
+  基于DFS的闭包实现.
+  它以G的各个顶点作为开始完成一个单独的DFS，计算其可达的顶点集，以此计算传递闭包。
  */
 
 template<typename GRAPH, bool useSpare = false>
@@ -108,7 +108,7 @@ public:
 
         for (unsigned v = 0; v < V; v++) {
             KtDfsIter<const GRAPH> iter(g, v);
-            assert(iter.from() == -1);
+            assert(iter.from() == GRAPH::null_vertex);
             ++iter; // skip edge(-1, v)
             for (; !iter.isEnd(); ++iter)
                 if (iter.isTree())
@@ -119,11 +119,11 @@ public:
 
 
 /*
-  DAGĴݱհDFS㷨ʵ֡
-  KtClosureDfsҪDAGԽŻ.
-    1.ûлر
-    2.±߿ԺԣõݹչҲûݴݱհ
-    3.߲õݹչֱӻݼ
+  DAG的传递闭包，基于DFS算法实现。
+  相比KtClosureDfs，主要利用DAG的特性进行优化.
+    1.没有回边
+    2.下边可以忽略，即不用递归展开，也不用回溯传递闭包
+    3.跨边不用递归展开，直接回溯即可
  */
 
 template<typename GRAPH, bool useSpare = false>
@@ -143,15 +143,15 @@ public:
 
         KtDfsIter<const GRAPH, true, true, true> iter(g, 0);
         for (; !iter.isEnd(); ++iter) {
-            unsigned p = iter.from();
-            if (p == -1)
+            auto p = iter.from();
+            if (p == GRAPH::null_vertex)
                 continue; // skip edge(-1, v)
 
             unsigned v = *iter;
             if (!iter.isPopping())
                 set_(p, v);
 
-            assert(!iter.isBack()); // DAGûлر
+            assert(!iter.isBack()); // DAG没有回边
 
             if (iter.isCross() || iter.isPopping()) {
                 auto iter = super_::adjIter_(v);
@@ -164,7 +164,7 @@ public:
 
 
 /*
- ǿĴݱհʵ.
+ 基于强分量的传递闭包实现.
  */
 
 template<typename GRAPH, bool useSpare = false>
@@ -174,20 +174,20 @@ public:
     using vertex_index_t = typename GRAPH::vertex_index_t;
 
     KtTcScc(const GRAPH& g) : scc_(g) {
-        // ÿǿͨΪһ㹹DAG
+        // 以每个强连通分量为一个顶点构建DAG
         DigraphDx<bool> K(scc_.count());
         for (unsigned v = 0; v < g.order(); v++) {
             auto iter = KtAdjIter(g, v);
             while (!iter.isEnd()) {
                 auto x = scc_[v];
                 auto y = scc_[*iter];
-                if (x != y && !K.hasEdge(x, y)) // Ի
+                if (x != y && !K.hasEdge(x, y)) // 消除自环
                     K.addEdge(x, y);
                 ++iter;
             }
         }
 
-        // ʹûDAGĴݱհŻ㷨
+        // 使用基于DAG的传递闭包优化算法
         dagCls_ = new KtTcDag<DigraphDx<bool>>(K);
     }
 
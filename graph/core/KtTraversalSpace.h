@@ -0,0 +1,104 @@
+#pragma once
+#include <assert.h>
+#include "../base/KtStampedVector.h"
+
+
+// 图遍历的工作空间，存储遍历迭代器所需的顶点标记
+// 遍历迭代器在构造时调用prepare，以O(1)代价清除上次遍历留下的标记，
+// 因此同一工作空间可被多次局部遍历复用，每次遍历的开销仅与所访问的顶点数相关。
+// 标记分两类，均在首次使用时才分配：
+//   顶点数组（marks）- 记录各顶点的序号（压栈序、low值等），每顶点约sizeof(vertex_index_t)字节
+//   标记位集（flags）- 记录各顶点是否已压栈/出栈，每顶点约1.5位
+// 工作空间同一时刻只能服务于一个迭代器
+template<typename VERTEX_INDEX = unsigned>
+class KtTraversalSpace
+{
+public:
+    using vertex_index_t = VERTEX_INDEX;
+    using marks_type = KtStampedVector<vertex_index_t, std::uint32_t, 64>;
+    using flags_type = KtStampedBitset<>;
+    constexpr static vertex_index_t null_vertex = static_cast<vertex_index_t>(-1);
+    constexpr static unsigned num_marks = 3; // 顶点数组的数量，足够KtDfsIterX使用
+    constexpr static unsigned num_flags = 2;
+
+    explicit KtTraversalSpace(vertex_index_t order = 0) : order_(order) {
+        for (auto& m : marks_)
+            m = marks_type(0, null_vertex);
+    }
+
+    // 为遍历阶数为order的图作准备，已分配的各数组均复位，代价为O(1)
+    void prepare(vertex_index_t order) {
+        order_ = order;
+        for (auto& m : marks_)
+            m.reset(null_vertex);
+        for (auto& f : flags_)
+            f.reset();
+    }
+
+    // 返回第i个顶点数组，其元素缺省为null_vertex。若长度不足当前阶数，则扩展之
+    marks_type& marks(unsigned i) {
+        assert(i < num_marks);
+        if (marks_[i].size() < order_)
+            marks_[i].resize(order_);
+        return marks_[i];
+    }
+
+    // 返回第i个标记位集。若长度不足当前阶数，则扩展之
+    flags_type& flags(unsigned i) {
+        assert(i < num_flags);
+        if (flags_[i].size() < order_)
+            flags_[i].resize(order_);
+        return flags_[i];
+    }
+
+private:
+    vertex_index_t order_;
+    marks_type marks_[num_marks];
+    flags_type flags_[num_flags];
+};
+
+
+// 遍历迭代器对工作空间的持有：外部提供时引用之，否则自建
+// 构造时复位工作空间，并取得迭代器所用的前nmarks个顶点数组和前nflags个标记位集，其余数组不分配
+// 复制时，自建的工作空间随之复制，外部工作空间则由副本共享
+template<typename SPACE>
+class KtTraversalSpaceRef
+{
+public:
+    using space_type = SPACE;
+    using marks_type = typename SPACE::marks_type;
+    using flags_type = typename SPACE::flags_type;
+
+    KtTraversalSpaceRef(SPACE* ext, typename SPACE::vertex_index_t order, unsigned nmarks, unsigned nflags)
+        : ext_(ext), nmarks_(nmarks), nflags_(nflags) {
+        space().prepare(order);
+        bind_();
+    }
+
+    KtTraversalSpaceRef(const KtTraversalSpaceRef& rhs)
+        : own_(rhs.ext_ ? SPACE() : rhs.own_), ext_(rhs.ext_), nmarks_(rhs.nmarks_), nflags_(rhs.nflags_) {
+        bind_();
+    }
+
+    KtTraversalSpaceRef& operator=(const KtTraversalSpaceRef&) = delete;
+
+    SPACE& space() { return ext_ ? *ext_ : own_; }
+
+    marks_type& marks(unsigned i) const { return *marks_[i]; }
+    flags_type& flags(unsigned i) const { return *flags_[i]; }
+
+private:
+    void bind_() {
+        for (unsigned i = 0; i < nmarks_; i++)
+            marks_[i] = &space().marks(i);
+        for (unsigned i = 0; i < nflags_; i++)
+            flags_[i] = &space().flags(i);
+    }
+
+private:
+    SPACE own_;
+    SPACE* ext_;
+    unsigned nmarks_, nflags_;
+    marks_type* marks_[SPACE::num_marks]{};
+    flags_type* flags_[SPACE::num_flags]{};
+};
@@ -0,0 +1,151 @@
+#pragma once
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <algorithm>
+#include "../util/simple_csr.h"
+
+
+// 无向图的三角形计数和聚类系数，忽略自环和平行边
+// 按度定向：令rank(v) = (deg(v), v)，每条边只保留由rank小的顶点指向rank大的顶点的方向，
+// 则每个三角形恰好被其rank最小的顶点计数一次，且各顶点的出度不超过O(sqrt(E))
+// 对每条定向边v->w，两个有序出边表的交集即为以v-w为底边的三角形：
+// 两表长度相近时线性归并，相差悬殊时在长表中倍增查找（galloping），时间复杂度为O(E^1.5)
+// 各顶点并行处理，三角形分摊到3个顶点的计数以原子操作累加
+template<typename GRAPH>
+class KtTriangles
+{
+    static_assert(!GRAPH::isDigraph(), "KtTriangles must be instantiated with undirected Graph.");
+
+public:
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+    constexpr static std::size_t gallop_ratio = 16; // 长表超过短表的该倍数时改用倍增查找
+
+
+    // @nthreads: 线程数，为0时取hardware_threads()
+    explicit KtTriangles(const GRAPH& g, unsigned nthreads = 0) : V_(g.order()) {
+        std::vector<std::size_t> first;
+        std::vector<vertex_index_t> adj;
+        simple_csr(g, first, adj, nthreads);
+
+        deg_.resize(V_);
+        for (vertex_index_t v = 0; v < V_; v++)
+            deg_[v] = first[v + 1] - first[v];
+
+        // 定向：只保留指向rank更大的邻接点的边，行内仍按序号有序
+        auto less = [this](vertex_index_t a, vertex_index_t b) {
+            return deg_[a] < deg_[b] || (deg_[a] == deg_[b] && a < b);
+        };
+        std::vector<std::size_t> ofirst(V_ + 1, 0);
+        std::vector<vertex_index_t> oadj;
+        oadj.reserve(adj.size() / 2);
+        for (vertex_index_t v = 0; v < V_; v++) {
+            for (auto i = first[v]; i < first[v + 1]; i++)
+                if (less(v, adj[i]))
+                    oadj.push_back(adj[i]);
+            ofirst[v + 1] = oadj.size();
+        }
+        std::vector<std::size_t>().swap(first);
+        std::vector<vertex_index_t>().swap(adj);
+
+        std::unique_ptr<std::atomic<std::uint64_t>[]> tri(new std::atomic<std::uint64_t>[V_]);
+        for (vertex_index_t v = 0; v < V_; v++)
+            tri[v].store(0, std::memory_order_relaxed);
+
+        parallel_for(vertex_index_t(0), V_, [&](vertex_index_t v) {
+            const vertex_index_t* a = oadj.data() + ofirst[v];
+            std::size_t na = ofirst[v + 1] - ofirst[v];
+            std::uint64_t cv(0);
+            for (std::size_t i = 0; i < na; i++) {
+                auto w = a[i];
+                std::uint64_t cw(0);
+                intersect_(a, na, oadj.data() + ofirst[w], ofirst[w + 1] - ofirst[w], [&](vertex_index_t x) {
+                    tri[x].fetch_add(1, std::memory_order_relaxed);
+                    ++cw;
+                });
+                if (cw) tri[w].fetch_add(cw, std::memory_order_relaxed);
+                cv += cw;
+            }
+            if (cv) tri[v].fetch_add(cv, std::memory_order_relaxed);
+        }, nthreads);
+
+        tri_.resize(V_);
+        std::uint64_t sum(0);
+        for (vertex_index_t v = 0; v < V_; v++)
+            sum += tri_[v] = tri[v].load(std::memory_order_relaxed);
+        total_ = sum / 3;
+    }
+
+
+    // 三角形总数
+    std::uint64_t total() const { return total_; }
+
+    // 包含顶点v的三角形数
+    std::uint64_t triangles(vertex_index_t v) const { return tri_[v]; }
+
+
+    // 局部聚类系数：v的邻接点之间实际存在的边数与可能存在的边数之比，度小于2时为0
+    double localClustering(vertex_index_t v) const {
+        auto d = deg_[v];
+        return d < 2 ? 0 : 2.0 * tri_[v] / (double(d) * (d - 1));
+    }
+
+    // 各顶点局部聚类系数的平均值
+    double averageClustering() const {
+        double sum(0);
+        for (vertex_index_t v = 0; v < V_; v++)
+            sum += localClustering(v);
+        return V_ ? sum / V_ : 0;
+    }
+
+    // 全局聚类系数（传递性）：3 * 三角形数 / 连通三元组（长度为2的路径）数
+    double globalClustering() const {
+        double wedges(0);
+        for (vertex_index_t v = 0; v < V_; v++)
+            wedges += double(deg_[v]) * (deg_[v] - 1) / 2;
+        return wedges > 0 ? 3.0 * total_ / wedges : 0;
+    }
+
+
+private:
+
+    // 对有序表a、b的每个公共元素x调用func(x)
+    template<typename FUNC>
+    static void intersect_(const vertex_index_t* a, std::size_t na, const vertex_index_t* b, std::size_t nb, FUNC func) {
+        if (na > nb)
+            std::swap(a, b), std::swap(na, nb);
+        if (na == 0)
+            return;
+
+        if (nb > gallop_ratio * na) {
+            // 对短表的每个元素，从上次的位置起在长表中倍增查找
+            std::size_t lo(0);
+            for (std::size_t i = 0; i < na && lo < nb; i++) {
+                auto x = a[i];
+                std::size_t step(1), hi = lo;
+                while (hi < nb && b[hi] < x)
+                    lo = hi + 1, hi += step, step <<= 1;
+                hi = std::min(hi + 1, nb); // b[hi]可能即为x
+                lo = std::lower_bound(b + lo, b + hi, x) - b;
+                if (lo < nb && b[lo] == x)
+                    func(x), ++lo;
+            }
+        }
+        else {
+            std::size_t i(0), j(0);
+            while (i < na && j < nb) {
+                if (a[i] < b[j]) ++i;
+                else if (b[j] < a[i]) ++j;
+                else func(a[i]), ++i, ++j;
+            }
+        }
+    }
+
+
+private:
+    vertex_index_t V_;
+    std::vector<std::size_t> deg_; // 简单图中的度
+    std::vector<std::uint64_t> tri_;
+    std::uint64_t total_;
+};
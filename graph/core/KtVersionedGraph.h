@@ -0,0 +1,419 @@
+#pragma once
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <cstdint>
+#include <algorithm>
+#include <unordered_map>
+#include <assert.h>
+#include "edge_traits.h"
+#include "../base/KtRange.h"
+
+
+// 多版本图：单个写者分批修改，多个读者并发读取各自固定的快照（snapshot isolation）
+//   写者调用addVertex、addEdge、eraseEdge等暂存修改，commit时原子地发布为新版本；
+//   读者调用snapshot获得当前版本的只读快照KtGraphSnapshot，其满足graph_traits和KtAdjIter的约定，
+//   可直接用于bfs、dfs、最短路径等只读算法，快照在其生存期内保持不变，不受写者后续提交的影响
+// 存储：各顶点的出边行（row）不可变，修改时复制该行（copy-on-write）；
+//   行指针按块（chunk）组织为两级表，新版本仅复制块目录以及被修改行所在的块，未修改的块和行由各版本共享
+// 回收：每个版本有一个递增的纪元（epoch），读者固定快照时在读者槽中登记所见的纪元；
+//   被替换的行、块和版本对象按替换时的纪元挂起，待所有读者登记的纪元均不小于该纪元后释放（epoch-based reclamation）
+
+
+namespace kPrivate
+{
+    // 块：一组连续顶点的行指针，空指针表示该顶点无出边
+    template<typename ROW, unsigned CHUNK_SIZE>
+    struct KtGraphChunk_
+    {
+        const ROW* rows[CHUNK_SIZE] = {};
+    };
+
+    // 图的一个版本，发布后不再修改
+    template<typename ROW, unsigned CHUNK_SIZE>
+    struct KtGraphVersion_
+    {
+        using chunk_type = KtGraphChunk_<ROW, CHUNK_SIZE>;
+
+        std::uint64_t epoch;
+        std::size_t order;
+        std::size_t size;
+        std::vector<const chunk_type*> chunks; // 空指针表示该块的顶点均无出边
+
+        const ROW* row(std::size_t v) const {
+            auto c = chunks[v / CHUNK_SIZE];
+            return c ? c->rows[v % CHUNK_SIZE] : nullptr;
+        }
+    };
+}
+
+
+// 多版本图的只读快照，由KtVersionedGraph::snapshot构造
+// 快照只能移动不能复制，析构时解除对版本的固定；快照的生存期不能超过其所属的KtVersionedGraph
+template<typename EDGE_TYPE, bool digraph, typename VERTEX_INDEX, typename EDGE_INDEX, unsigned CHUNK_SIZE>
+class KtGraphSnapshot
+{
+public:
+    using edge_type = EDGE_TYPE;
+    using vertex_type = void;
+    using vertex_index_t = VERTEX_INDEX;
+    using edge_index_t = EDGE_INDEX;
+    using adj_edge_t = edge_has_to_t<EDGE_TYPE, VERTEX_INDEX>; // 行中存储的边对象，带to属性
+    using row_type = std::vector<adj_edge_t>;
+    using version_type = kPrivate::KtGraphVersion_<row_type, CHUNK_SIZE>;
+    using edge_range = KtRange<const adj_edge_t*>;
+
+    constexpr static vertex_index_t null_vertex = static_cast<vertex_index_t>(-1);
+
+    constexpr static bool isDigraph() { return digraph; }
+    constexpr static bool isDense() { return false; }
+    constexpr static bool isMultiEdges() { return true; }
+    constexpr static bool isAlwaysSorted() { return false; }
+    constexpr static bool hasVertex() { return false; }
+
+
+    KtGraphSnapshot(const version_type* ver, std::atomic<std::uint64_t>* slot)
+        : ver_(ver), slot_(slot) {}
+
+    KtGraphSnapshot(KtGraphSnapshot&& rhs) noexcept : ver_(rhs.ver_), slot_(rhs.slot_) {
+        rhs.slot_ = nullptr;
+    }
+
+    KtGraphSnapshot& operator=(KtGraphSnapshot&& rhs) noexcept {
+        if (this != &rhs) {
+            release_();
+            ver_ = rhs.ver_, slot_ = rhs.slot_;
+            rhs.slot_ = nullptr;
+        }
+        return *this;
+    }
+
+    KtGraphSnapshot(const KtGraphSnapshot&) = delete;
+    KtGraphSnapshot& operator=(const KtGraphSnapshot&) = delete;
+
+    ~KtGraphSnapshot() { release_(); }
+
+
+    // 快照所属版本的纪元，每次commit递增1
+    std::uint64_t version() const { return ver_->epoch; }
+
+    vertex_index_t order() const { return static_cast<vertex_index_t>(ver_->order); }
+    edge_index_t size() const { return static_cast<edge_index_t>(ver_->size); }
+
+    bool isEmpty() const { return order() == 0; }
+    bool isTrivial() const { return order() == 1; }
+    bool isNull() const { return size() == 0; }
+
+    edge_range outedges(vertex_index_t v) const {
+        assert(v < order());
+        auto row = ver_->row(v);
+        return row && !row->empty() ? edge_range(row->data(), row->data() + row->size()) : edge_range(nullptr, nullptr);
+    }
+
+    edge_index_t outdegree(vertex_index_t v) const {
+        auto row = ver_->row(v);
+        return row ? static_cast<edge_index_t>(row->size()) : 0;
+    }
+
+    // 有向图需扫描全部边，时间复杂度O(V + E)
+    edge_index_t indegree(vertex_index_t v) const {
+        if constexpr (!digraph) {
+            return outdegree(v);
+        }
+        else {
+            edge_index_t d(0);
+            for (vertex_index_t u = 0; u < order(); u++)
+                for (auto& e : outedges(u))
+                    if (edge_traits<adj_edge_t>::to(e) == v) ++d;
+            return d;
+        }
+    }
+
+    edge_index_t degree(vertex_index_t v) const {
+        auto d = outdegree(v);
+        if constexpr (digraph)
+            d += indegree(v);
+        return d;
+    }
+
+    bool hasEdge(vertex_index_t from, vertex_index_t to) const {
+        for (auto& e : outedges(from))
+            if (edge_traits<adj_edge_t>::to(e) == to) return true;
+        return false;
+    }
+
+    const edge_type& getEdge(vertex_index_t from, vertex_index_t to) const {
+        for (auto& e : outedges(from))
+            if (edge_traits<adj_edge_t>::to(e) == to) return e;
+        assert(false);
+        return edge_traits<edge_type>::null_edge;
+    }
+
+private:
+    void release_() {
+        if (slot_) {
+            slot_->store(UINT64_MAX, std::memory_order_release);
+            slot_ = nullptr;
+        }
+    }
+
+private:
+    const version_type* ver_;
+    std::atomic<std::uint64_t>* slot_; // 登记了本快照纪元的读者槽
+};
+
+
+// @CHUNK_SIZE: 每块的行数，commit时每个被修改的块复制CHUNK_SIZE个行指针
+// 注意：写操作（addVertex、addEdge、eraseEdge、commit、rollback）只能由单个线程调用；snapshot可由任意线程并发调用
+template<typename EDGE_TYPE, bool digraph = false, typename VERTEX_INDEX = unsigned,
+    typename EDGE_INDEX = std::size_t, unsigned CHUNK_SIZE = 256>
+class KtVersionedGraph
+{
+public:
+    using snapshot_type = KtGraphSnapshot<EDGE_TYPE, digraph, VERTEX_INDEX, EDGE_INDEX, CHUNK_SIZE>;
+    using edge_type = EDGE_TYPE;
+    using vertex_index_t = VERTEX_INDEX;
+    using edge_index_t = EDGE_INDEX;
+    using adj_edge_t = typename snapshot_type::adj_edge_t;
+    using row_type = typename snapshot_type::row_type;
+    using version_type = typename snapshot_type::version_type;
+    using chunk_type = typename version_type::chunk_type;
+
+    constexpr static bool isDigraph() { return digraph; }
+
+
+    // @nv: 初始顶点数
+    // @maxReaders: 读者槽的数量，即可同时存在的快照数上限，超出时snapshot等待其他快照释放
+    explicit KtVersionedGraph(vertex_index_t nv = 0, unsigned maxReaders = 256)
+        : slots_(new slot_type[std::max(maxReaders, 1u)]), numSlots_(std::max(maxReaders, 1u)) {
+        auto ver = new version_type{ 0, nv, 0, {} };
+        ver->chunks.resize(numChunks_(nv), nullptr);
+        current_.store(ver, std::memory_order_relaxed);
+        order_ = nv;
+    }
+
+    ~KtVersionedGraph() {
+        freeAll_(retiredRows_), freeAll_(retiredChunks_), freeAll_(retiredVersions_);
+
+        auto ver = current_.load(std::memory_order_relaxed);
+        for (auto c : ver->chunks)
+            if (c) {
+                for (auto row : c->rows)
+                    delete row;
+                delete c;
+            }
+        delete ver;
+    }
+
+    KtVersionedGraph(const KtVersionedGraph&) = delete;
+    KtVersionedGraph& operator=(const KtVersionedGraph&) = delete;
+
+
+    /// 读者接口，线程安全
+
+    // 固定当前版本，返回其快照。不复制任何数据
+    snapshot_type snapshot() const {
+        auto h = std::hash<std::thread::id>{}(std::this_thread::get_id());
+        for (;;) {
+            for (unsigned i = 0; i < numSlots_; i++) {
+                auto& slot = slots_[(h + i) % numSlots_].epoch;
+                auto free = UINT64_MAX;
+                // 先登记纪元，再读取版本：读到的版本的纪元不小于登记的纪元，写者不会回收之
+                auto epoch = epoch_.load(std::memory_order_seq_cst);
+                if (slot.load(std::memory_order_relaxed) == free && slot.compare_exchange_strong(free, epoch, std::memory_order_seq_cst))
+                    return snapshot_type(current_.load(std::memory_order_seq_cst), &slot);
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    // 最近一次提交的纪元
+    std::uint64_t version() const { return epoch_.load(std::memory_order_acquire); }
+
+
+    /// 写者接口，修改在commit之前对读者不可见
+
+    // 包含暂存修改的顶点数和边数
+    vertex_index_t order() const { return static_cast<vertex_index_t>(order_); }
+    edge_index_t size() const { return static_cast<edge_index_t>(current_.load(std::memory_order_relaxed)->size + sizeDiff_); }
+
+    vertex_index_t addVertex() {
+        return addVertices(1);
+    }
+
+    // 新增n个序号连续的顶点，返回首个顶点的序号
+    vertex_index_t addVertices(vertex_index_t n) {
+        auto first = static_cast<vertex_index_t>(order_);
+        order_ += n;
+        return first;
+    }
+
+    void addEdge(vertex_index_t from, vertex_index_t to, const edge_type& edge) {
+        assert(from < order() && to < order());
+
+        append_(from, to, edge);
+        if (!digraph && from != to)
+            append_(to, from, edge);
+
+        ++sizeDiff_;
+    }
+
+    // 删除from到to的所有边，返回删除的边数
+    edge_index_t eraseEdge(vertex_index_t from, vertex_index_t to) {
+        assert(from < order() && to < order());
+
+        auto n = erase_(from, to);
+        if (!digraph && from != to)
+            erase_(to, from);
+
+        sizeDiff_ -= static_cast<std::ptrdiff_t>(n);
+        return static_cast<edge_index_t>(n);
+    }
+
+    // 包含暂存修改的出边，返回的引用在下一次写操作前有效
+    edge_index_t outdegree(vertex_index_t v) const {
+        auto row = pendingRow_(v);
+        return row ? static_cast<edge_index_t>(row->size()) : 0;
+    }
+
+    // 发布暂存的修改，成为读者可见的新版本，并回收不再被任何快照引用的旧行。返回新版本的纪元
+    // 时间复杂度为O(V / CHUNK_SIZE + 修改的行数 * CHUNK_SIZE)，另加被修改行的复制（已在暂存时完成）
+    std::uint64_t commit() {
+        auto cur = current_.load(std::memory_order_relaxed);
+
+        auto ver = new version_type{ cur->epoch + 1, order_,
+            static_cast<std::size_t>(static_cast<std::ptrdiff_t>(cur->size) + sizeDiff_), cur->chunks };
+        ver->chunks.resize(numChunks_(order_), nullptr);
+
+        // 复制被修改行所在的块，并以新行替换旧行
+        std::vector<bool> cloned(ver->chunks.size(), false);
+        for (auto& d : dirty_) {
+            auto c = d.first / CHUNK_SIZE;
+            if (!cloned[c]) {
+                auto old = ver->chunks[c];
+                ver->chunks[c] = old ? new chunk_type(*old) : new chunk_type;
+                if (old) retiredChunks_.emplace_back(ver->epoch, old);
+                cloned[c] = true;
+            }
+
+            auto& row = const_cast<chunk_type*>(ver->chunks[c])->rows[d.first % CHUNK_SIZE];
+            if (row) retiredRows_.emplace_back(ver->epoch, row);
+            row = d.second->empty() ? nullptr : d.second.release();
+        }
+        dirty_.clear();
+        sizeDiff_ = 0;
+
+        current_.store(ver, std::memory_order_seq_cst);
+        epoch_.store(ver->epoch, std::memory_order_seq_cst);
+        retiredVersions_.emplace_back(ver->epoch, cur);
+
+        reclaim();
+        return ver->epoch;
+    }
+
+    // 放弃暂存的修改
+    void rollback() {
+        dirty_.clear();
+        sizeDiff_ = 0;
+        order_ = current_.load(std::memory_order_relaxed)->order;
+    }
+
+    // 释放不再被任何快照引用的旧版本对象，commit时自动调用
+    void reclaim() {
+        auto pinned = epoch_.load(std::memory_order_seq_cst);
+        for (unsigned i = 0; i < numSlots_; i++)
+            pinned = std::min(pinned, slots_[i].epoch.load(std::memory_order_seq_cst));
+
+        reclaim_(retiredRows_, pinned);
+        reclaim_(retiredChunks_, pinned);
+        reclaim_(retiredVersions_, pinned);
+    }
+
+    // 尚待回收的行数
+    std::size_t retiredRows() const { return retiredRows_.size(); }
+
+
+private:
+
+    static std::size_t numChunks_(std::size_t nv) {
+        return (nv + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    }
+
+    // 顶点v包含暂存修改的当前行
+    const row_type* pendingRow_(vertex_index_t v) const {
+        auto iter = dirty_.find(v);
+        if (iter != dirty_.end())
+            return iter->second.get();
+
+        auto cur = current_.load(std::memory_order_relaxed);
+        return v < cur->order ? cur->row(v) : nullptr;
+    }
+
+    // 顶点v的暂存行，首次修改时复制已提交的行
+    row_type& dirtyRow_(vertex_index_t v) {
+        auto iter = dirty_.find(v);
+        if (iter == dirty_.end()) {
+            auto row = pendingRow_(v);
+            iter = dirty_.emplace(v, row ? std::make_unique<row_type>(*row) : std::make_unique<row_type>()).first;
+        }
+        return *iter->second;
+    }
+
+    void append_(vertex_index_t from, vertex_index_t to, const edge_type& edge) {
+        auto& row = dirtyRow_(from);
+        row.emplace_back(edge);
+        edge_traits<adj_edge_t>::to(row.back()) = to;
+    }
+
+    std::size_t erase_(vertex_index_t from, vertex_index_t to) {
+        auto row = pendingRow_(from);
+        if (row == nullptr || std::none_of(row->begin(), row->end(),
+            [to](const adj_edge_t& e) { return edge_traits<adj_edge_t>::to(e) == to; }))
+            return 0; // 无需复制
+
+        auto& r = dirtyRow_(from);
+        auto n = r.size();
+        r.erase(std::remove_if(r.begin(), r.end(),
+            [to](const adj_edge_t& e) { return edge_traits<adj_edge_t>::to(e) == to; }), r.end());
+        return n - r.size();
+    }
+
+    // 释放纪元不大于pinned的挂起对象。各列表按纪元递增的次序挂起
+    template<typename T>
+    static void reclaim_(std::vector<std::pair<std::uint64_t, const T*>>& retired, std::uint64_t pinned) {
+        auto last = std::find_if(retired.begin(), retired.end(),
+            [pinned](const std::pair<std::uint64_t, const T*>& r) { return r.first > pinned; });
+        for (auto iter = retired.begin(); iter != last; ++iter)
+            delete iter->second;
+        retired.erase(retired.begin(), last);
+    }
+
+    template<typename T>
+    static void freeAll_(std::vector<std::pair<std::uint64_t, const T*>>& retired) {
+        reclaim_(retired, UINT64_MAX);
+    }
+
+
+private:
+    // 读者槽，UINT64_MAX表示空闲；各槽独占缓存行，避免读者之间的伪共享
+    struct alignas(64) slot_type
+    {
+        std::atomic<std::uint64_t> epoch{ UINT64_MAX };
+    };
+
+    std::atomic<const version_type*> current_{ nullptr };
+    std::atomic<std::uint64_t> epoch_{ 0 };
+    std::unique_ptr<slot_type[]> slots_;
+    const unsigned numSlots_;
+
+    // 写者的暂存状态
+    std::unordered_map<vertex_index_t, std::unique_ptr<row_type>> dirty_;
+    std::size_t order_{ 0 };
+    std::ptrdiff_t sizeDiff_{ 0 };
+
+    // 待回收的对象：(替换时的纪元, 对象)
+    std::vector<std::pair<std::uint64_t, const row_type*>> retiredRows_;
+    std::vector<std::pair<std::uint64_t, const chunk_type*>> retiredChunks_;
+    std::vector<std::pair<std::uint64_t, const version_type*>> retiredVersions_;
+};
@@ -3,7 +3,7 @@
 
 #undef max
 
-// ȨֵйصĲӱֵȨֵתȨֵıȽϣȨֵۼ
+// 与权值有关的操作：包括从边值到权值的转换，权值的比较，权值的累加
 
 template<typename VALUE_TYPE>
 class KtWeightSelf
@@ -37,7 +37,7 @@ public:
 };
 
 
-// @minimumΪtrueʱСֵţֵš
+// @minimum：为true时则小值更优，否则大值更优。
 template<class WeightorBase, class Accumlate, bool minimum>
 class KtWeightor : public WeightorBase
 {
@@ -48,12 +48,12 @@ public:
         std::numeric_limits<weight_type>::lowest();
 
 
-    // w1Ƿw2ţ
+    // w1是否比w2更优？
     bool comp(const weight_type& w1, const weight_type& w2) const {
         return minimum ? w1 < w2 : w1 > w2;
     }
 
-    // Ȩֵۼ
+    // 权值累加
     auto acc(const weight_type& w1, const weight_type& w2) const {
         return Accumlate{}(w1, w2);
     }
@@ -1,5 +1,6 @@
 #pragma once
 #include "../base/KtHolder.h"
+#include "../base/KtSoaVector.h"
 #include "../base/traits_helper.h"
 
 
@@ -21,15 +22,16 @@ struct edge_traits
 
 namespace kPrivate
 {
-	template<typename EDGE_TYPE>
-	class KtEdgeWrapper_ : public KtTupleHolder<unsigned, EDGE_TYPE>
+	// @VERTEX_INDEX: to顶点的索引类型
+	template<typename EDGE_TYPE, typename VERTEX_INDEX = unsigned>
+	class KtEdgeWrapper_ : public KtTupleHolder<VERTEX_INDEX, EDGE_TYPE>
 	{
 	public:
-		using super_ = KtTupleHolder<unsigned, EDGE_TYPE>;
+		using super_ = KtTupleHolder<VERTEX_INDEX, EDGE_TYPE>;
 		using super_::super_;
 		using super_::inside;
 
-		KtEdgeWrapper_(const EDGE_TYPE& edge) : super_(-1, edge) {}
+		KtEdgeWrapper_(const EDGE_TYPE& edge) : super_(static_cast<VERTEX_INDEX>(-1), edge) {}
 
 		KtEdgeWrapper_& operator=(const EDGE_TYPE& edge) {
 			std::get<1>(inside()) = edge;
@@ -44,31 +46,42 @@ namespace kPrivate
 };
 
 
-template<typename EDGE_TYPE>
-struct edge_traits<kPrivate::KtEdgeWrapper_<EDGE_TYPE>>
+template<typename EDGE_TYPE, typename VERTEX_INDEX>
+struct edge_traits<kPrivate::KtEdgeWrapper_<EDGE_TYPE, VERTEX_INDEX>>
 	: public edge_traits<EDGE_TYPE>
 {
-	using edge_type = kPrivate::KtEdgeWrapper_<EDGE_TYPE>;
+	using edge_type = kPrivate::KtEdgeWrapper_<EDGE_TYPE, VERTEX_INDEX>;
 
 	//static_assert(!std::is_trivial_v<EDGE_TYPE> || std::is_trivial_v<edge_type>,
 	//	"constructing trivial edge wrapper error");
 
-	static decltype(auto) to(const edge_type& wrap_edge) { return wrap_edge.inside<0>(); }
-	static decltype(auto) to(edge_type& wrap_edge) { return wrap_edge.inside<0>(); }
+	static decltype(auto) to(const edge_type& wrap_edge) { return wrap_edge.template inside<0>(); }
+	static decltype(auto) to(edge_type& wrap_edge) { return wrap_edge.template inside<0>(); }
 };
 
 
-template<typename EDGE_TYPE>
-struct edge_traits<const kPrivate::KtEdgeWrapper_<EDGE_TYPE>>
+template<typename EDGE_TYPE, typename VERTEX_INDEX>
+struct edge_traits<const kPrivate::KtEdgeWrapper_<EDGE_TYPE, VERTEX_INDEX>>
 	: public edge_traits<const EDGE_TYPE>
 {
-	using edge_type = const kPrivate::KtEdgeWrapper_<EDGE_TYPE>;
+	using edge_type = const kPrivate::KtEdgeWrapper_<EDGE_TYPE, VERTEX_INDEX>;
 
-	static decltype(auto) to(edge_type& wrap_edge) { return wrap_edge.inside<0>(); }
+	static decltype(auto) to(edge_type& wrap_edge) { return wrap_edge.template inside<0>(); }
 };
 
 
-// EDGE_TRAITSйbool
+// SoA边存储的代理类型：第0列为to顶点，第1列为边值
+template<typename VERTEX_INDEX, typename EDGE_TYPE>
+struct edge_traits<KtSoaRef<VERTEX_INDEX, EDGE_TYPE>>
+	: public edge_traits<std::remove_const_t<EDGE_TYPE>>
+{
+	using edge_type = KtSoaRef<VERTEX_INDEX, EDGE_TYPE>;
+
+	static VERTEX_INDEX& to(const edge_type& soa_edge) { return soa_edge.key(); }
+};
+
+
+// 根据EDGE_TRAITS生成有关bool常量
 template<typename EDGE_TRAITS>
 struct edge_traits_helper
 {
@@ -91,7 +104,8 @@ template<typename EDGE_TYPE>
 inline constexpr bool has_to_v = kPrivate::hasTo_<EDGE_TYPE>();
 
 
-// EDGE_TYPEtoϢʹKtEdgeWrapper_һ
-template<typename EDGE_TYPE>
+// 若EDGE_TYPE不带to信息，使用KtEdgeWrapper_附加一个
+// @VERTEX_INDEX: 附加的to信息的索引类型
+template<typename EDGE_TYPE, typename VERTEX_INDEX = unsigned>
 using edge_has_to_t = std::conditional_t<has_to_v<EDGE_TYPE>,
-	EDGE_TYPE, kPrivate::KtEdgeWrapper_<EDGE_TYPE>>;
\ No newline at end of file
+	EDGE_TYPE, kPrivate::KtEdgeWrapper_<EDGE_TYPE, VERTEX_INDEX>>;
\ No newline at end of file
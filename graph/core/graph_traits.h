@@ -1,4 +1,5 @@
 #pragma once
+#include <type_traits>
 #include "../base/traits_helper.h"
 
 namespace kPrivate 
@@ -17,6 +18,34 @@ namespace kPrivate
 
 	template<typename GRAPH>
 	using underly_vertex_t = typename underly_vertex_helper<GRAPH, has_member_vertexAt<GRAPH, unsigned>::value>::type;
+
+
+	// 若GRAPH未定义vertex_index_t/edge_index_t，则缺省为unsigned
+	template<typename GRAPH, typename = void>
+	struct vertex_index_helper {
+		using type = unsigned;
+	};
+
+	template<typename GRAPH>
+	struct vertex_index_helper<GRAPH, std::void_t<typename GRAPH::vertex_index_t>> {
+		using type = typename GRAPH::vertex_index_t;
+	};
+
+	template<typename GRAPH, typename = void>
+	struct edge_index_helper {
+		using type = unsigned;
+	};
+
+	template<typename GRAPH>
+	struct edge_index_helper<GRAPH, std::void_t<typename GRAPH::edge_index_t>> {
+		using type = typename GRAPH::edge_index_t;
+	};
+
+	template<typename GRAPH>
+	using vertex_index_t = typename vertex_index_helper<std::remove_const_t<GRAPH>>::type;
+
+	template<typename GRAPH>
+	using edge_index_t = typename edge_index_helper<std::remove_const_t<GRAPH>>::type;
 }
 
 
@@ -24,13 +53,13 @@ namespace kPrivate
 template<typename GRAPH>
 struct graph_traits
 {
-	/// ֶõı־
+	/// 须手动设置的标志
 	constexpr static bool reshapable = false; // support reset, addEdge, addVertex, eraseEdge, eraseVertex, ...
 	constexpr static bool immutable = true; // support setEdge, ...
 	constexpr static bool is_dense = false;
 
 
-	/// ͼ
+	/// 图的相关类型
 	using graph_type = GRAPH;
 	using const_graph_type = std::add_const_t<graph_type>;
 	using edge_type = typename graph_type::edge_type;
@@ -43,5 +72,7 @@ struct graph_traits
 	using const_edge_deref_t = decltype(*std::declval<const_edge_iter>());
 	using underly_edge_t = typename std::decay_t<decltype(*std::declval<edge_iter>())>;
 	using underly_vertex_t = kPrivate::underly_vertex_t<graph_type>;
+	using vertex_index_t = kPrivate::vertex_index_t<graph_type>; // 顶点索引类型
+	using edge_index_t = kPrivate::edge_index_t<graph_type>; // 边索引类型（flat图的边偏移、边计数等）
 };
 
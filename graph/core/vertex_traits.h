@@ -10,7 +10,7 @@ struct vertex_traits
 	using vertex_type = VERTEX_TYPE;
 
 
-	// ɾеľ̬Ա
+	// 可具有的静态成员函数
 	//static auto outdegree(VERTEX_TYPE);
 	//static auto indegree(VERTEX_TYPE);
 
@@ -19,7 +19,7 @@ struct vertex_traits
 
 	//static auto weight(VERTEX_TYPE);
 
-	//static auto edgeindex(VERTEX_TYPE); flatͼЧ
+	//static auto edgeindex(VERTEX_TYPE); 仅对flat图有效
 
 	template<typename T = vertex_type, 
 		typename = std::enable_if_t<std::is_integral_v<T>>>
@@ -37,45 +37,62 @@ struct vertex_traits
 
 namespace kPrivate
 {
-	template<typename VERTEX_TYPE>
+	// @EDGE_INDEX: 边偏移的索引类型
+	template<typename VERTEX_TYPE, typename EDGE_INDEX = unsigned>
 	class KtFlatVertexWrapper_ : public KtHolder<VERTEX_TYPE>
 	{
 	public:
 		using super_ = KtHolder<VERTEX_TYPE>;
+		using value_type = VERTEX_TYPE;
+
+		KtFlatVertexWrapper_() : super_(), edgeindex_(0) {}
+		KtFlatVertexWrapper_(const value_type& v) : super_(v), edgeindex_(0) {}
+		KtFlatVertexWrapper_(value_type&& v) : super_(std::move(v)), edgeindex_(0) {}
+
+		// 以顶点值赋值时，保留边偏移
+		KtFlatVertexWrapper_& operator=(const value_type& v) {
+			super_::operator=(v); return *this;
+		}
+
+		KtFlatVertexWrapper_& operator=(value_type&& v) {
+			super_::operator=(std::move(v)); return *this;
+		}
 
-		unsigned edgeindex() const { return edgeindex_; }
-		unsigned& edgeindex() { return edgeindex_; }
+		EDGE_INDEX edgeindex() const { return edgeindex_; }
+		EDGE_INDEX& edgeindex() { return edgeindex_; }
 
 	private:
-		unsigned edgeindex_;
+		EDGE_INDEX edgeindex_;
 	};
 
-	template<>
-	struct KtFlatVertexWrapper_<void> : public KtHolder<unsigned>
+	template<typename EDGE_INDEX>
+	struct KtFlatVertexWrapper_<void, EDGE_INDEX> : public KtHolder<EDGE_INDEX>
 	{
 	public:
+		using KtHolder<EDGE_INDEX>::inside;
+
 		decltype(auto) edgeindex() const { return inside(); }
 		decltype(auto) edgeindex() { return inside(); }
 	};
 };
 
 
-template<typename VERTEX_TYPE>
-struct vertex_traits<kPrivate::KtFlatVertexWrapper_<VERTEX_TYPE>>
+template<typename VERTEX_TYPE, typename EDGE_INDEX>
+struct vertex_traits<kPrivate::KtFlatVertexWrapper_<VERTEX_TYPE, EDGE_INDEX>>
 	: public vertex_traits<VERTEX_TYPE>
 {
-	using vertex_type = kPrivate::KtFlatVertexWrapper_<VERTEX_TYPE>;
+	using vertex_type = kPrivate::KtFlatVertexWrapper_<VERTEX_TYPE, EDGE_INDEX>;
 
 	static decltype(auto) edgeindex(const vertex_type& v) { return v.edgeindex(); }
 	static decltype(auto) edgeindex(vertex_type& v) { return v.edgeindex(); }
 };
 
 
-template<typename VERTEX_TYPE>
-struct vertex_traits<const kPrivate::KtFlatVertexWrapper_<VERTEX_TYPE>>
+template<typename VERTEX_TYPE, typename EDGE_INDEX>
+struct vertex_traits<const kPrivate::KtFlatVertexWrapper_<VERTEX_TYPE, EDGE_INDEX>>
 	: public vertex_traits<VERTEX_TYPE>
 {
-	using vertex_type = const kPrivate::KtFlatVertexWrapper_<VERTEX_TYPE>;
+	using vertex_type = const kPrivate::KtFlatVertexWrapper_<VERTEX_TYPE, EDGE_INDEX>;
 
 	static decltype(auto) edgeindex(vertex_type& v) { return v.edgeindex(); }
 };
@@ -91,7 +108,7 @@ namespace kPrivate
 }
 
 
-// VERTEX_TRAITSйbool
+// 根据VERTEX_TRAITS生成有关bool常量
 template<typename VERTEX_TRAITS>
 struct vertex_traits_helper
 {
@@ -134,8 +151,10 @@ template<typename VERTEX_TYPE>
 inline constexpr bool has_weight_v = kPrivate::hasWeight_<VERTEX_TYPE>();
 
 
-// VERTEX_TYPEƫϢʹKtFlatVertexWrapper_һ
-template<typename VERTEX_TYPE>
-using vertex_has_edgeindex_t = std::conditional_t<std::is_void_v<VERTEX_TYPE>, unsigned,
-	std::conditional_t<has_edgeindex_v<VERTEX_TYPE>,
-	VERTEX_TYPE, kPrivate::KtFlatVertexWrapper_<VERTEX_TYPE>>>;
\ No newline at end of file
+// 若VERTEX_TYPE不带边偏移信息，使用KtFlatVertexWrapper_附加一个
+// 算术类型的顶点值亦须附加：缺省traits将整数视为边偏移本身，顶点值会与之混用
+// @EDGE_INDEX: 附加的边偏移信息的索引类型
+template<typename VERTEX_TYPE, typename EDGE_INDEX = unsigned>
+using vertex_has_edgeindex_t = std::conditional_t<std::is_void_v<VERTEX_TYPE>, EDGE_INDEX,
+	std::conditional_t<has_edgeindex_v<VERTEX_TYPE> && !std::is_arithmetic_v<VERTEX_TYPE>,
+	VERTEX_TYPE, kPrivate::KtFlatVertexWrapper_<VERTEX_TYPE, EDGE_INDEX>>>;
\ No newline at end of file
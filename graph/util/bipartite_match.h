@@ -6,14 +6,14 @@
 #include "../core/KtAdjIter.h"
 
 
-/// 㷨ʵֵƥ䣬㷨ӶO(VE)
+/// 基于最大流算法实现的最大基数二部匹配，算法复杂度O(VE)
 /// 
-/// ƥ䣺һͼҳһı߼
-/// Ӷʹһӡ
+/// 最大基数二部匹配：给定一个二部图，找出一个有最大基数的边集，
+/// 从而使各个顶点至多与一个其它顶点相连接。
 /// 
 
-// @GRAPH: ͼͼ
-// @return: ƥĶԣemptyʾͼǶͼ
+// @GRAPH: 二部图（无向图）
+// @return: 匹配的顶点对，empty表示错误（输入的图非二部图）
 template<typename GRAPH>
 auto bipartite_match(const GRAPH& g) -> std::vector<std::pair<unsigned, unsigned>>
 {
@@ -21,7 +21,7 @@ auto bipartite_match(const GRAPH& g) -> std::vector<std::pair<unsigned, unsigned
 	KtBipartite<GRAPH> bip(g);
 	if (bip.ok()) {
 		DigraphSx<int> newG(g.order() + 2);
-		auto s = g.order(); // Ϊst
+		auto s = g.order(); // 最后两个顶点为st顶点
 		auto t = s + 1;
 
 		for (unsigned v = 0; v < g.order(); v++) {
@@ -45,7 +45,7 @@ auto bipartite_match(const GRAPH& g) -> std::vector<std::pair<unsigned, unsigned
 			for (; !adj.isEnd(); ++adj) {
 				if (*adj != t && mf.flow(v, *adj) == 1) {
 					res.push_back({ v, *adj }); 
-					break; // ֻһ
+					break; // 最多只有一条边有流量
 				}
 			}
 		}
@@ -15,12 +15,12 @@ DST copy(const SRC& src)
             for (auto r = src.edges(v, w); !r.empty(); ++r)
                 if constexpr (std::is_same_v<typename DST::edge_type, bool>) {
                     dst.addEdge(v, w);
-                    if constexpr (DST::isDigraph() && !SRC::isDigraph()) // ͼתͼ˫
+                    if constexpr (DST::isDigraph() && !SRC::isDigraph()) // 无向图转有向图，加双边
                         dst.addEdge(w, v);
                 }
                 else {
                     dst.addEdge(v, w, WTOR{}(*r));
-                    if constexpr (DST::isDigraph() && !SRC::isDigraph()) // ͼתͼ˫
+                    if constexpr (DST::isDigraph() && !SRC::isDigraph()) // 无向图转有向图，加双边
                         dst.addEdge(w, v, WTOR{}(*r));
                 }
 
@@ -2,10 +2,10 @@
 #include "loop.h"
 
 
-// KtGraph::degree޶
-// ҪͼԻĶ㲻ͬ
-//   KtGraph::degree趨ͼԻΪ1
-//   ˴趨ͼԻΪ2
+// KtGraph::degree的修订版
+// 主要差异在于无向图自环的度数计算不同
+//   KtGraph::degree设定无向图的自环度数为1
+//   此处设定无向图的自环度数为2
 
 template<typename GRAPH>
 unsigned degree(const GRAPH& g, unsigned v)
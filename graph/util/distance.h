@@ -10,7 +10,7 @@
  */
 
 
- // Դdistance
+ // 单源distance
 template<typename GRAPH>
 auto distance(const GRAPH& g, unsigned u) 
 {
@@ -23,7 +23,7 @@ auto distance(const GRAPH& g, unsigned u)
 }
 
 
-// ȫԴdistance
+// 全源distance
 template<typename GRAPH>
 auto distance(const GRAPH& g) 
 {
@@ -35,7 +35,7 @@ auto distance(const GRAPH& g)
 }
 
 
-// distance-1ʾ
+// 两点distance，返回-1表示两点无连接
 template<typename GRAPH>
 auto distance(const GRAPH& g, unsigned u, unsigned v) 
 {
@@ -20,7 +20,7 @@ void dump(const GRAPH& g, std::ostream& os)
                 if constexpr (has_operator_output<decltype(os), decltype(r)>::value)
                     os << *r;
                 else
-                    os << "?"; // ռλ?
+                    os << "?"; // 输出占位符号?
             }
                     
             os << ") ";
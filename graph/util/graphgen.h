@@ -0,0 +1,378 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <tuple>
+#include <random>
+#include <numeric>
+#include <algorithm>
+#include <type_traits>
+#include "../core/KtGraph.h"
+#include "../base/parallel_for.h"
+
+
+// 可扩展的随机图生成器
+// 与randgen不同，以下生成器的时间复杂度为O(E)（gnm、dag另需对候选边排序），不依赖全局的rand()，
+// 各生成器将边划分为固定大小的块，每块以(seed, 块序号)派生独立的随机数引擎，
+// 多线程并行生成后按块序拼接，再以assign批量构建，因此结果只取决于seed，与线程数无关
+//
+// 边的值：浮点类型取(0, 1]的均匀分布，整数类型取[1, 65535]的均匀分布
+// 对于非多重边图，生成结果中的重复边被去除，因此rmat、ba生成的边数可能少于请求数
+// 无向图的每条边只生成一次
+// @nthreads: 线程数，为0时取hardware_threads()
+
+namespace kPrivate
+{
+    constexpr std::size_t gen_block_size = std::size_t(1) << 16; // 每块生成的边数
+
+
+    inline std::uint64_t splitmix64_(std::uint64_t x)
+    {
+        x += 0x9e3779b97f4a7c15ull;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+        return x ^ (x >> 31);
+    }
+
+    // 第block块的随机数引擎
+    inline std::mt19937_64 gen_engine_(std::uint64_t seed, std::uint64_t block)
+    {
+        return std::mt19937_64(splitmix64_(splitmix64_(seed) ^ block));
+    }
+
+    template<typename T, typename ENGINE>
+    T gen_edge_value_(ENGINE& eng)
+    {
+        if constexpr (std::is_floating_point_v<T>)
+            return T(1 - std::uniform_real_distribution<double>(0, 1)(eng));
+        else
+            return T(std::uniform_int_distribution<int>(1, 65535)(eng));
+    }
+
+    // 将[0, nblocks)的各块分配给nthreads个线程，以func(block, engine, out)生成第block块的边，
+    // 按块序拼接后返回
+    template<typename TRIPLE, typename FUNC>
+    std::vector<TRIPLE> gen_blocks_(std::size_t nblocks, std::uint64_t seed, unsigned nthreads, FUNC func)
+    {
+        std::vector<std::vector<TRIPLE>> blocks(nblocks);
+        parallel_for(std::size_t(0), nblocks, [&blocks, &func, seed](std::size_t b) {
+            auto eng = gen_engine_(seed, b);
+            func(b, eng, blocks[b]);
+        }, nthreads, std::size_t(1));
+
+        std::size_t total(0);
+        for (auto& b : blocks) total += b.size();
+
+        std::vector<TRIPLE> edges;
+        edges.reserve(total);
+        for (auto& b : blocks) {
+            edges.insert(edges.end(), b.begin(), b.end());
+            std::vector<TRIPLE>().swap(b);
+        }
+
+        return edges;
+    }
+
+    // 以edges构建图：无向图的端点规范为(min, max)，非多重边图去除重复边
+    template<typename GRAPH, typename TRIPLE>
+    GRAPH gen_build_(typename GRAPH::vertex_index_t V, std::vector<TRIPLE>& edges, bool dedup)
+    {
+        if constexpr (!GRAPH::isDigraph())
+            for (auto& e : edges)
+                if (std::get<0>(e) > std::get<1>(e))
+                    std::swap(std::get<0>(e), std::get<1>(e));
+
+        if (dedup && !GRAPH::isMultiEdges()) {
+            auto less = [](const TRIPLE& a, const TRIPLE& b) {
+                return std::get<0>(a) < std::get<0>(b) ||
+                    (std::get<0>(a) == std::get<0>(b) && std::get<1>(a) < std::get<1>(b));
+            };
+            auto equal = [](const TRIPLE& a, const TRIPLE& b) {
+                return std::get<0>(a) == std::get<0>(b) && std::get<1>(a) == std::get<1>(b);
+            };
+            std::stable_sort(edges.begin(), edges.end(), less);
+            edges.erase(std::unique(edges.begin(), edges.end(), equal), edges.end());
+        }
+
+        GRAPH g;
+        g.assign(V, edges.begin(), edges.end());
+        return g;
+    }
+
+    // 顶点对的编号：有向图为V*(V-1)个非自环顶点对，无向图（及dag）为V*(V-1)/2个(i < j)顶点对
+    // 按行优先编号，第i行的长度为row_length_
+    inline std::uint64_t gen_row_length_(std::uint64_t V, std::uint64_t i, bool digraph)
+    {
+        return digraph ? V - 1 : V - 1 - i;
+    }
+
+    inline std::uint64_t gen_column_(std::uint64_t i, std::uint64_t c, bool digraph)
+    {
+        return digraph ? (c >= i ? c + 1 : c) : i + 1 + c;
+    }
+
+    // 从V个顶点的候选顶点对中无放回地均匀抽取E个，返回按(from, to)排序的顶点对
+    // 分批并行生成随机顶点对，排序去重，不足时继续补充，多于E时随机剔除
+    template<typename VERTEX_INDEX>
+    std::vector<std::pair<VERTEX_INDEX, VERTEX_INDEX>>
+        gen_pairs_(VERTEX_INDEX V, std::uint64_t E, bool digraph, std::uint64_t seed, unsigned nthreads)
+    {
+        using pair_t = std::pair<VERTEX_INDEX, VERTEX_INDEX>;
+        std::vector<pair_t> pairs;
+        if (V < 2) return pairs;
+
+        std::uint64_t N = digraph ? std::uint64_t(V) * (V - 1) : std::uint64_t(V) * (V - 1) / 2;
+        E = std::min(E, N);
+
+        std::uint64_t round(0);
+        while (pairs.size() < E) {
+            std::uint64_t need = E - pairs.size();
+            need += need / 8 + 16; // 多生成少量，抵消重复
+            auto nblocks = (need + gen_block_size - 1) / gen_block_size;
+            auto more = gen_blocks_<pair_t>(nblocks, seed + (++round << 32), nthreads,
+                [V, need, digraph](std::size_t b, std::mt19937_64& eng, std::vector<pair_t>& out) {
+                std::uniform_int_distribution<std::uint64_t> dist(0, V - 1);
+                auto n = std::min<std::uint64_t>(gen_block_size, need - b * gen_block_size);
+                out.reserve(n);
+                while (out.size() < n) {
+                    auto i = dist(eng), j = dist(eng);
+                    if (i == j) continue;
+                    if (!digraph && i > j) std::swap(i, j);
+                    out.emplace_back(VERTEX_INDEX(i), VERTEX_INDEX(j));
+                }
+            });
+
+            auto mid = pairs.size();
+            pairs.insert(pairs.end(), more.begin(), more.end());
+            std::sort(pairs.begin() + mid, pairs.end());
+            std::inplace_merge(pairs.begin(), pairs.begin() + mid, pairs.end());
+            pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+        }
+
+        if (pairs.size() > E) { // 随机剔除多余的顶点对，保持均匀性
+            auto eng = gen_engine_(seed, ~std::uint64_t(0));
+            std::shuffle(pairs.begin(), pairs.end(), eng);
+            pairs.resize(E);
+            std::sort(pairs.begin(), pairs.end());
+        }
+
+        return pairs;
+    }
+
+    // 以pairs为顶点对，并行生成边的值
+    template<typename GRAPH>
+    auto gen_valued_(const std::vector<std::pair<typename GRAPH::vertex_index_t, typename GRAPH::vertex_index_t>>& pairs,
+        const std::vector<typename GRAPH::vertex_index_t>* perm, std::uint64_t seed, unsigned nthreads)
+    {
+        using vertex_index_t = typename GRAPH::vertex_index_t;
+        using edge_type = typename GRAPH::edge_type;
+        using triple_t = std::tuple<vertex_index_t, vertex_index_t, edge_type>;
+
+        auto nblocks = (pairs.size() + gen_block_size - 1) / gen_block_size;
+        return gen_blocks_<triple_t>(nblocks, seed, nthreads,
+            [&pairs, perm](std::size_t b, std::mt19937_64& eng, std::vector<triple_t>& out) {
+            auto first = b * gen_block_size, last = std::min(pairs.size(), first + gen_block_size);
+            out.reserve(last - first);
+            for (auto i = first; i < last; i++) {
+                vertex_index_t from = pairs[i].first, to = pairs[i].second;
+                if (perm) from = (*perm)[from], to = (*perm)[to];
+                out.emplace_back(from, to, gen_edge_value_<edge_type>(eng));
+            }
+        });
+    }
+
+    // 以seed生成[0, V)的随机排列
+    template<typename VERTEX_INDEX>
+    std::vector<VERTEX_INDEX> gen_permutation_(VERTEX_INDEX V, std::uint64_t seed)
+    {
+        std::vector<VERTEX_INDEX> perm(V);
+        std::iota(perm.begin(), perm.end(), VERTEX_INDEX(0));
+        auto eng = gen_engine_(seed, ~std::uint64_t(1));
+        std::shuffle(perm.begin(), perm.end(), eng);
+        return perm;
+    }
+}
+
+
+// Erdos-Renyi G(n, m)模型：从所有非自环顶点对中均匀抽取E条边
+template<typename GRAPH>
+GRAPH gen_gnm(typename GRAPH::vertex_index_t V, std::size_t E, std::uint64_t seed = 0, unsigned nthreads = 0)
+{
+    auto pairs = kPrivate::gen_pairs_(V, E, GRAPH::isDigraph(), seed, nthreads);
+    auto edges = kPrivate::gen_valued_<GRAPH>(pairs, nullptr, seed, nthreads);
+    return kPrivate::gen_build_<GRAPH>(V, edges, false);
+}
+
+
+// Erdos-Renyi G(n, p)模型：每个非自环顶点对以概率p独立地生成边
+// 以几何分布跳过未选中的顶点对，时间复杂度为O(V + E)
+// 顶点按行分块，每块的期望边数约为gen_block_size
+template<typename GRAPH>
+GRAPH gen_gnp(typename GRAPH::vertex_index_t V, double p, std::uint64_t seed = 0, unsigned nthreads = 0)
+{
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+    using edge_type = typename GRAPH::edge_type;
+    using triple_t = std::tuple<vertex_index_t, vertex_index_t, edge_type>;
+    constexpr bool digraph = GRAPH::isDigraph();
+
+    std::vector<triple_t> edges;
+    if (V >= 2 && p > 0) {
+        std::uint64_t rowsPerBlock = std::max<std::uint64_t>(1,
+            std::uint64_t(kPrivate::gen_block_size / std::max(1.0, p * V)));
+        auto nblocks = (std::uint64_t(V) + rowsPerBlock - 1) / rowsPerBlock;
+        double logq = p < 1 ? std::log(1 - p) : 0;
+
+        edges = kPrivate::gen_blocks_<triple_t>(nblocks, seed, nthreads,
+            [V, rowsPerBlock, p, logq](std::size_t b, std::mt19937_64& eng, std::vector<triple_t>& out) {
+            std::uniform_real_distribution<double> unif(0, 1);
+            auto skip = [&]() -> std::uint64_t { // 到下一条边之前跳过的顶点对数
+                if (p >= 1) return 0;
+                double s = std::floor(std::log(1 - unif(eng)) / logq);
+                return s < 1e18 ? std::uint64_t(s) : std::uint64_t(1e18);
+            };
+
+            std::uint64_t i = b * rowsPerBlock, last = std::min<std::uint64_t>(V, i + rowsPerBlock);
+            std::uint64_t c = skip(); // 当前行内的列序号
+            while (i < last) {
+                auto len = kPrivate::gen_row_length_(V, i, digraph);
+                if (c >= len) {
+                    c -= len, ++i;
+                    continue;
+                }
+
+                out.emplace_back(vertex_index_t(i), vertex_index_t(kPrivate::gen_column_(i, c, digraph)),
+                    kPrivate::gen_edge_value_<edge_type>(eng));
+                c += 1 + skip();
+            }
+        });
+    }
+
+    return kPrivate::gen_build_<GRAPH>(V, edges, false);
+}
+
+
+// R-MAT（递归矩阵）模型，生成2^scale个顶点、幂律度分布的图
+// 每条边从邻接矩阵出发，以概率(a, b, c, 1-a-b-c)递归地选择4个象限之一，直至落到单个元素
+// a = 0.57, b = c = 0.19为Graph500的Kronecker参数
+// 自环被丢弃，顶点编号经随机排列打乱，以消除编号与度的相关性
+template<typename GRAPH>
+GRAPH gen_rmat(unsigned scale, std::size_t E, double a = 0.57, double b = 0.19, double c = 0.19,
+    std::uint64_t seed = 0, unsigned nthreads = 0)
+{
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+    using edge_type = typename GRAPH::edge_type;
+    using triple_t = std::tuple<vertex_index_t, vertex_index_t, edge_type>;
+
+    vertex_index_t V = vertex_index_t(1) << scale;
+    auto perm = kPrivate::gen_permutation_(V, seed);
+    auto nblocks = (E + kPrivate::gen_block_size - 1) / kPrivate::gen_block_size;
+    double ab = a + b, abc = a + b + c;
+
+    auto edges = kPrivate::gen_blocks_<triple_t>(nblocks, seed, nthreads,
+        [scale, E, a, ab, abc, &perm](std::size_t blk, std::mt19937_64& eng, std::vector<triple_t>& out) {
+        std::uniform_real_distribution<double> unif(0, 1);
+        auto n = std::min(kPrivate::gen_block_size, E - blk * kPrivate::gen_block_size);
+        out.reserve(n);
+        for (std::size_t k = 0; k < n; k++) {
+            vertex_index_t from(0), to(0);
+            for (unsigned level = 0; level < scale; level++) {
+                auto r = unif(eng);
+                from <<= 1, to <<= 1;
+                if (r >= ab) from |= 1; // 下半部分：c或d象限
+                if ((r >= a && r < ab) || r >= abc) to |= 1; // 右半部分：b或d象限
+            }
+
+            if (from != to)
+                out.emplace_back(perm[from], perm[to], kPrivate::gen_edge_value_<edge_type>(eng));
+        }
+    });
+
+    return kPrivate::gen_build_<GRAPH>(V, edges, true);
+}
+
+
+// Barabasi-Albert优先连接模型：每个新顶点连接m条边，终点按度的比例选取
+// 采用Batagelj-Brandes的重复顶点表实现，时间复杂度为O(V*m)
+// 该过程本质上是顺序的，因此不支持多线程；自环被丢弃
+template<typename GRAPH>
+GRAPH gen_ba(typename GRAPH::vertex_index_t V, unsigned m, std::uint64_t seed = 0)
+{
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+    using edge_type = typename GRAPH::edge_type;
+    using triple_t = std::tuple<vertex_index_t, vertex_index_t, edge_type>;
+
+    auto eng = kPrivate::gen_engine_(seed, 0);
+    std::vector<vertex_index_t> nodes(2 * std::size_t(V) * m); // 各边的端点，顶点的出现次数即其度
+    std::vector<triple_t> edges;
+    edges.reserve(std::size_t(V) * m);
+    for (vertex_index_t v = 0; v < V; v++)
+        for (unsigned i = 0; i < m; i++) {
+            auto k = 2 * (std::size_t(v) * m + i);
+            nodes[k] = v;
+            nodes[k + 1] = nodes[std::uniform_int_distribution<std::size_t>(0, k)(eng)];
+            if (nodes[k + 1] != v)
+                edges.emplace_back(v, nodes[k + 1], kPrivate::gen_edge_value_<edge_type>(eng));
+        }
+
+    return kPrivate::gen_build_<GRAPH>(V, edges, true);
+}
+
+
+// rows*cols的网格图，模拟道路网络：顶点(r, c)的序号为r*cols+c，与4个邻居相连
+// 边的值为base * (1 + perturb * u)，u为[-1, 1]的均匀分布；整数类型取整后至少为1
+// 对于有向图，两个方向的边分别扰动
+template<typename GRAPH>
+GRAPH gen_grid(typename GRAPH::vertex_index_t rows, typename GRAPH::vertex_index_t cols,
+    typename GRAPH::edge_type base = 1, double perturb = 0.2, std::uint64_t seed = 0, unsigned nthreads = 0)
+{
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+    using edge_type = typename GRAPH::edge_type;
+    using triple_t = std::tuple<vertex_index_t, vertex_index_t, edge_type>;
+
+    std::size_t rowsPerBlock = std::max<std::size_t>(1, kPrivate::gen_block_size / (4 * std::size_t(std::max<vertex_index_t>(cols, 1))));
+    auto nblocks = (std::size_t(rows) + rowsPerBlock - 1) / rowsPerBlock;
+
+    auto edges = kPrivate::gen_blocks_<triple_t>(nblocks, seed, nthreads,
+        [rows, cols, base, perturb, rowsPerBlock](std::size_t b, std::mt19937_64& eng, std::vector<triple_t>& out) {
+        std::uniform_real_distribution<double> unif(-1, 1);
+        auto weight = [&]() {
+            double w = double(base) * (1 + perturb * unif(eng));
+            if constexpr (std::is_integral_v<edge_type>)
+                return edge_type(std::max(1.0, std::round(w)));
+            else
+                return edge_type(w);
+        };
+        auto add = [&](vertex_index_t v, vertex_index_t w) {
+            out.emplace_back(v, w, weight());
+            if constexpr (GRAPH::isDigraph())
+                out.emplace_back(w, v, weight());
+        };
+
+        vertex_index_t first = vertex_index_t(b * rowsPerBlock);
+        vertex_index_t last = vertex_index_t(std::min<std::size_t>(rows, first + rowsPerBlock));
+        for (vertex_index_t r = first; r < last; r++)
+            for (vertex_index_t c = 0; c < cols; c++) {
+                auto v = r * cols + c;
+                if (c + 1 < cols) add(v, v + 1);
+                if (r + 1 < rows) add(v, v + cols);
+            }
+    });
+
+    return kPrivate::gen_build_<GRAPH>(rows * cols, edges, false);
+}
+
+
+// 随机有向无环图：从i < j的顶点对中均匀抽取E条边(i, j)
+// shuffle为true时以随机排列打乱顶点编号，否则顶点序号即为一个拓扑序
+template<typename GRAPH>
+GRAPH gen_dag(typename GRAPH::vertex_index_t V, std::size_t E, bool shuffle = true,
+    std::uint64_t seed = 0, unsigned nthreads = 0)
+{
+    static_assert(GRAPH::isDigraph(), "gen_dag must be instantiated with Digraph.");
+
+    auto pairs = kPrivate::gen_pairs_(V, E, false, seed, nthreads);
+    std::vector<typename GRAPH::vertex_index_t> perm;
+    if (shuffle) perm = kPrivate::gen_permutation_(V, seed);
+    auto edges = kPrivate::gen_valued_<GRAPH>(pairs, shuffle ? &perm : nullptr, seed, nthreads);
+    return kPrivate::gen_build_<GRAPH>(V, edges, false);
+}
@@ -2,7 +2,7 @@
 #include "../core/KtBfsIter.h"
 
 
-// 㵱ǰͼ
+// 计算当前图的逆
 template<typename INGRAPH, typename OUTGRAPH = INGRAPH>
 OUTGRAPH inverse(const INGRAPH& g)
 {
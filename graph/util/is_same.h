@@ -3,8 +3,8 @@
 #include "../core/graph_traits.h"
 
 
-// жͼg1g2˽ṹǷͬԶбȽ
-// ٶ˳һ
+// 判断两个图g1、g2的拓扑结构是否相同，不对顶点对象进行比较
+// 假定顶点顺序一致
 template<typename G1, typename G2>
 bool is_topo_same(const G1& g1, const G2& g2)
 {
@@ -27,10 +27,9 @@ bool is_topo_same(const G1& g1, const G2& g2)
             }
 
 
-            if constexpr (!g1.isAlwaysSorted())
-                std::sort(e1.begin(), e1.end());
-            if constexpr (!g2.isAlwaysSorted())
-                std::sort(e2.begin(), e2.end());
+            // alwaysSorted仅保证按to顶点有序，平行边的值仍须排序后比较
+            std::sort(e1.begin(), e1.end());
+            std::sort(e2.begin(), e2.end());
 
             for (size_t i = 0; i < e1.size(); i++)
                 if (e1[i] != e2[i])
@@ -45,7 +44,7 @@ bool is_topo_same(const G1& g1, const G2& g2)
 template<typename G1, typename G2>
 bool is_same(const G1& g1, const G2& g2)
 {
-    // ȱȽ϶
+    // 先比较顶点对象
     if constexpr (!std::is_same_v<graph_traits<G1>::vertex_type, graph_traits<G2>::vertex_type>)
         return false;
 
@@ -56,6 +55,6 @@ bool is_same(const G1& g1, const G2& g2)
     }
 
 
-    // ٱȽ˽ṹ
+    // 再比较拓扑结构
     return is_topo_same(g1, g2);
 }
\ No newline at end of file
@@ -14,7 +14,7 @@ bool has_selfloop(const GRAPH& g)
 }
 
 
-// Ի<v, v>
+// 自环<v, v>的数量
 template<typename GRAPH>
 unsigned selfloops(const GRAPH& g, unsigned v)
 {
@@ -38,7 +38,7 @@ std::pair<unsigned, unsigned> selfloops(const GRAPH& g)
 }
 
 
-// ɾԻ
+// 删除自环
 template<typename GRAPH>
 void erase_selfloop(GRAPH& g) 
 {
@@ -49,7 +49,7 @@ void erase_selfloop(GRAPH& g)
 }
 
 
-// һͼDAGҽʹDFSÿʱδκλر
+// 一个有向图是DAG，当且仅当在使用DFS检查每条边时未遇到任何回边
 template<typename GRAPH>
 bool has_loop(const GRAPH& g) 
 {
@@ -64,11 +64,11 @@ bool has_loop(const GRAPH& g)
 }
     
 
-// ɾ
+// 删除环
 template<typename GRAPH>
 void erase_loop(GRAPH& g) 
 {
-    // ɾر. ԻҲǻر
+    // 删除回边. 自环也是回边
     KtDfsIter<GRAPH, true, true> iter(g, 0);
     while(!iter.isEnd()) {
         if(iter.isBack())
@@ -5,8 +5,8 @@
 #include "is_connected.h"
 
 
-// ͼgĻӱߣԱ֤gΪͨͼ
-// ӵı
+// 在图g的基础上增加边，以保证g为连通图
+// 返回增加的边
 template<typename GRAPH>
 auto make_connect(GRAPH& g)
 {
@@ -17,7 +17,7 @@ auto make_connect(GRAPH& g)
         unsigned cnt(0);
         for (unsigned i = 0; i < g.order() && cnt < cc.count(); i++) {
             if (v[cc[i]] == -1) {
-                v[cc[i]] = i; // ѹÿͨĵ1
+                v[cc[i]] = i; // 压入每个连通分量的第1个顶点
                 ++cnt;
             }
         }
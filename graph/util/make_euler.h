@@ -5,20 +5,20 @@
 #include "degree.h"
 
 
-// ŷͼʱֻ֧ͼ
+// 构造欧拉图，暂时只支持无向图
 
 template<typename GRAPH>
 void make_euler(GRAPH& g, bool cycle)
 {
 	make_connect(g);
 
-	// ѼΪĶ
+	// 搜集度数为奇数的顶点
 	std::vector<unsigned> odds; odds.reserve(g.order() / 2);
 	for (unsigned v = 0; v < g.order(); v++)
 		if (degree(g, v) % 2)
 			odds.push_back(v);
 
-	assert(odds.size() % 2 == 0); // ĸΪż
+	assert(odds.size() % 2 == 0); // 奇数顶点的个数必为偶数
 
 	unsigned resid = cycle ? 0 : 2;
 	while (odds.size() > resid) {
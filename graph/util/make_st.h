@@ -6,8 +6,8 @@
 #include "sinks.h"
 
 
-// ҪʱgʵĶͱߣȷgֻ1Դ1㡣
-// ԴͻidxߵȨֵΪĬֵ
+// 必要时对g添加适当的顶点和边，确保g只有1个源点和1个汇点。
+// 返回源点和汇点的idx。新增边的权值为默认值。
 template<typename GRAPH>
 std::pair<unsigned, unsigned> make_st(GRAPH& g)
 {
@@ -18,7 +18,7 @@ std::pair<unsigned, unsigned> make_st(GRAPH& g)
 
     auto src = sources(g);
     assert(src.size() > 0);
-    if (src.size() != 1) { // Դ
+    if (src.size() != 1) { // 新增源点
         unsigned s = g.addVertex();
         assert(g.degree(s) == 0);
         for (auto w : src)
@@ -30,7 +30,7 @@ std::pair<unsigned, unsigned> make_st(GRAPH& g)
 
     auto sik = sinks(g);
     assert(sik.size() > 0);
-    if (sik.size() != 1) { // 
+    if (sik.size() != 1) { // 新增汇点
         unsigned t = g.addVertex();
         assert(g.degree(t) == 0);
         for (auto v : sik)
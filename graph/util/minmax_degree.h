@@ -3,7 +3,7 @@
 #include "degree.h"
 
 
-// ͼgС
+// 计算图g的最大最小度
 template<typename GRAPH>
 std::pair<unsigned, unsigned> minmax_degree(const GRAPH& g)
 {
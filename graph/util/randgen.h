@@ -3,14 +3,14 @@
 #include "../core/KtGraph.h"
 
 
-// [x0, x1]
+// 返回[x0, x1]区间的随机数
 inline double rand(double x0, double x1)
 {
     return x0 + (x1 - x0) * rand() / RAND_MAX;
 }
 
 
-// pĸʷtrue.
+// 以p的概率返回true.
 // 0 <= p <= 1
 inline bool rand_p(double p)
 {
@@ -23,7 +23,7 @@ GRAPH randgen(unsigned V, unsigned E)
 {
     GRAPH g(V);
     double p = static_cast<double>(E) / (V * V);
-    if (!g.isDigraph()) p *= 2; // ͼߵɸʷ
+    if (!g.isDigraph()) p *= 2; // 对于无向图，边的生成概率翻倍
     for (unsigned i = 0; i < V; i++) {
         unsigned jMax = g.isDigraph() ? V : i + 1;
         for (unsigned j = 0; j < jMax; j++)
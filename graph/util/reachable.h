@@ -32,7 +32,7 @@ std::vector<bool> get_reachable(const GRAPH& g, unsigned v)
 template<typename GRAPH>
 void erase_unreachable(GRAPH& g, unsigned v) 
 {
-	auto flags = get_reachable(v);
+	auto flags = get_reachable(g, v);
 
 	// 逆序删除v不可达的顶点
 	for (unsigned i = unsigned(flags.size()) - 1; i != -1; i--)
@@ -0,0 +1,293 @@
+#pragma once
+#include <vector>
+#include <queue>
+#include <algorithm>
+#include <cmath>
+#include <assert.h>
+#include "../core/KtAdjIter.h"
+
+
+// 顶点重排序算法，用于改善图遍历的访存局部性
+// 各函数均返回old->new的编号映射order，即顶点v的新编号为order[v]，可配合permute/resort使用
+
+namespace kPrivate
+{
+    // CSR格式的邻接表，仅记录邻接顶点
+    template<typename VERTEX_INDEX>
+    struct KpAdjCsr_
+    {
+        std::vector<std::size_t> offset;
+        std::vector<VERTEX_INDEX> adj;
+
+        std::size_t degree(VERTEX_INDEX v) const { return offset[v + 1] - offset[v]; }
+        const VERTEX_INDEX* begin(VERTEX_INDEX v) const { return adj.data() + offset[v]; }
+        const VERTEX_INDEX* end(VERTEX_INDEX v) const { return adj.data() + offset[v + 1]; }
+    };
+
+
+    // 构建图g的邻接表
+    // @outs: 是否收录出边的邻接顶点
+    // @ins: 是否收录入边的邻接顶点（仅对有向图有效，无向图的入边即出边）
+    template<typename GRAPH>
+    auto make_adj_csr_(const GRAPH& g, bool outs, bool ins)
+    {
+        using vertex_index_t = typename GRAPH::vertex_index_t;
+        if (!g.isDigraph()) outs = true, ins = false;
+
+        const vertex_index_t V = g.order();
+        KpAdjCsr_<vertex_index_t> csr;
+        csr.offset.assign(std::size_t(V) + 1, 0);
+        for (vertex_index_t v = 0; v < V; v++) {
+            auto iter = KtAdjIter(g, v);
+            for (; !iter.isEnd(); ++iter) {
+                if (outs) ++csr.offset[v + 1];
+                if (ins && *iter != v) ++csr.offset[*iter + 1];
+            }
+        }
+
+        for (vertex_index_t v = 0; v < V; v++)
+            csr.offset[v + 1] += csr.offset[v];
+
+        csr.adj.resize(csr.offset[V]);
+        std::vector<std::size_t> pos(csr.offset.begin(), csr.offset.end() - 1);
+        for (vertex_index_t v = 0; v < V; v++) {
+            auto iter = KtAdjIter(g, v);
+            for (; !iter.isEnd(); ++iter) {
+                vertex_index_t w = *iter;
+                if (outs) csr.adj[pos[v]++] = w;
+                if (ins && w != v) csr.adj[pos[w]++] = v;
+            }
+        }
+
+        return csr;
+    }
+
+
+    // 按度数对顶点进行稳定的计数排序，返回排序后的顶点序列
+    template<typename VERTEX_INDEX>
+    std::vector<VERTEX_INDEX> sort_by_degree_(const KpAdjCsr_<VERTEX_INDEX>& csr, bool descending)
+    {
+        auto V = static_cast<VERTEX_INDEX>(csr.offset.size() - 1);
+        std::size_t maxd(0);
+        for (VERTEX_INDEX v = 0; v < V; v++)
+            maxd = std::max(maxd, csr.degree(v));
+
+        std::vector<std::size_t> count(maxd + 2, 0);
+        for (VERTEX_INDEX v = 0; v < V; v++) {
+            auto d = descending ? maxd - csr.degree(v) : csr.degree(v);
+            ++count[d + 1];
+        }
+        for (std::size_t i = 1; i < count.size(); i++)
+            count[i] += count[i - 1];
+
+        std::vector<VERTEX_INDEX> seq(V);
+        for (VERTEX_INDEX v = 0; v < V; v++) {
+            auto d = descending ? maxd - csr.degree(v) : csr.degree(v);
+            seq[count[d]++] = v;
+        }
+
+        return seq;
+    }
+
+
+    // 从顶点s出发进行bfs，返回最后一层中度数最小的顶点及bfs的层数
+    // @stamp, @tag: 访问标记，stamp[v] == tag表示v已访问，避免每次bfs都清零标记数组
+    template<typename VERTEX_INDEX>
+    std::pair<VERTEX_INDEX, std::size_t> bfs_last_level_(const KpAdjCsr_<VERTEX_INDEX>& csr,
+        VERTEX_INDEX s, std::vector<std::size_t>& stamp, std::size_t tag)
+    {
+        std::vector<VERTEX_INDEX> level{ s }, next;
+        stamp[s] = tag;
+        std::size_t depth(0);
+        while (true) {
+            next.clear();
+            for (auto v : level)
+                for (auto p = csr.begin(v); p != csr.end(v); ++p)
+                    if (stamp[*p] != tag) {
+                        stamp[*p] = tag;
+                        next.push_back(*p);
+                    }
+
+            if (next.empty()) break;
+            level.swap(next);
+            ++depth;
+        }
+
+        auto pos = std::min_element(level.begin(), level.end(),
+            [&csr](VERTEX_INDEX a, VERTEX_INDEX b) { return csr.degree(a) < csr.degree(b); });
+        return { *pos, depth };
+    }
+}
+
+
+// 度数排序：度数大的顶点排在前面（hub优先），度数相同的顶点保持原有次序
+// 对于有向图，度数为出度与入度之和
+template<typename GRAPH>
+auto degree_order(const GRAPH& g, bool descending = true)
+{
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+    auto csr = kPrivate::make_adj_csr_(g, true, true);
+    auto seq = kPrivate::sort_by_degree_(csr, descending);
+
+    std::vector<vertex_index_t> order(g.order());
+    for (vertex_index_t i = 0; i < g.order(); i++)
+        order[seq[i]] = i;
+    return order;
+}
+
+
+// bfs排序：按照bfs的访问次序编号，有向图忽略边的方向
+template<typename GRAPH>
+auto bfs_order(const GRAPH& g, typename GRAPH::vertex_index_t s = 0)
+{
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+    const vertex_index_t V = g.order();
+    const auto null_vertex = GRAPH::null_vertex;
+    auto csr = kPrivate::make_adj_csr_(g, true, true);
+
+    std::vector<vertex_index_t> order(V, null_vertex);
+    std::vector<vertex_index_t> queue; queue.reserve(V);
+    vertex_index_t cursor(0); // 接续遍历的候选起点
+
+    while (queue.size() < V) {
+        if (s == null_vertex || order[s] != null_vertex) {
+            while (order[cursor] != null_vertex) ++cursor;
+            s = cursor;
+        }
+
+        auto head = queue.size();
+        order[s] = static_cast<vertex_index_t>(queue.size());
+        queue.push_back(s);
+        for (; head < queue.size(); head++) {
+            auto v = queue[head];
+            for (auto p = csr.begin(v); p != csr.end(v); ++p)
+                if (order[*p] == null_vertex) {
+                    order[*p] = static_cast<vertex_index_t>(queue.size());
+                    queue.push_back(*p);
+                }
+        }
+    }
+
+    return order;
+}
+
+
+// 逆Cuthill-McKee排序，用于减小邻接矩阵的带宽
+// 对每个连通分量，以伪外围顶点为起点进行bfs，各顶点的邻接顶点按度数从小到大访问，最后将访问次序逆转
+// 有向图按其基础无向图处理
+template<typename GRAPH>
+auto rcm_order(const GRAPH& g)
+{
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+    const vertex_index_t V = g.order();
+    auto csr = kPrivate::make_adj_csr_(g, true, true);
+    auto byDegree = kPrivate::sort_by_degree_(csr, false);
+
+    std::vector<bool> visited(V, false);
+    std::vector<std::size_t> stamp(V, 0);
+    std::size_t tag(0);
+    std::vector<vertex_index_t> seq; seq.reserve(V); // Cuthill-McKee访问次序
+    std::vector<vertex_index_t> adjs;
+
+    for (auto s : byDegree) {
+        if (visited[s]) continue;
+
+        // 寻找伪外围顶点（George-Liu算法）：反复从最后一层的最小度数顶点出发bfs，直至层数不再增加
+        auto last = kPrivate::bfs_last_level_(csr, s, stamp, ++tag);
+        for (int i = 0; i < 8; i++) { // 限制迭代次数
+            auto next = kPrivate::bfs_last_level_(csr, last.first, stamp, ++tag);
+            if (next.second <= last.second) break;
+            s = last.first, last = next;
+        }
+
+        auto head = seq.size();
+        visited[s] = true;
+        seq.push_back(s);
+        for (; head < seq.size(); head++) {
+            auto v = seq[head];
+            adjs.clear();
+            for (auto p = csr.begin(v); p != csr.end(v); ++p)
+                if (!visited[*p]) {
+                    visited[*p] = true;
+                    adjs.push_back(*p);
+                }
+
+            std::stable_sort(adjs.begin(), adjs.end(), [&csr](vertex_index_t a, vertex_index_t b) {
+                return csr.degree(a) < csr.degree(b); });
+            seq.insert(seq.end(), adjs.begin(), adjs.end());
+        }
+    }
+
+    assert(seq.size() == V);
+    std::vector<vertex_index_t> order(V);
+    for (vertex_index_t i = 0; i < V; i++)
+        order[seq[i]] = V - 1 - i;
+    return order;
+}
+
+
+// Gorder排序（Wei et al., SIGMOD 2016）的贪心实现
+// 依次选取与最近放置的window个顶点关联最紧密的顶点，关联度为两者之间的边数与共同入邻接顶点数之和
+// 出度超过hub阈值（缺省为sqrt(E)）的入邻接顶点不参与共同邻居的计数，以控制计算量
+template<typename GRAPH>
+auto gorder_order(const GRAPH& g, unsigned window = 5, std::size_t hub = 0)
+{
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+    const vertex_index_t V = g.order();
+    auto outs = kPrivate::make_adj_csr_(g, true, false);
+    auto ins = g.isDigraph() ? kPrivate::make_adj_csr_(g, false, true) : outs;
+    if (hub == 0) hub = static_cast<std::size_t>(std::sqrt(double(outs.adj.size()))) + 1;
+
+    std::vector<std::size_t> key(V, 0);
+    std::vector<bool> placed(V, false);
+    std::priority_queue<std::pair<std::size_t, vertex_index_t>> pq; // 惰性更新的最大堆
+
+    auto update = [&](vertex_index_t u, bool inc) {
+        auto touch = [&](vertex_index_t w) {
+            if (placed[w]) return;
+            inc ? ++key[w] : --key[w];
+            pq.emplace(key[w], w);
+        };
+
+        for (auto p = outs.begin(u); p != outs.end(u); ++p)
+            touch(*p);
+
+        for (auto p = ins.begin(u); p != ins.end(u); ++p) {
+            touch(*p);
+            if (outs.degree(*p) <= hub)
+                for (auto q = outs.begin(*p); q != outs.end(*p); ++q)
+                    if (*q != u) touch(*q);
+        }
+    };
+
+    auto byDegree = kPrivate::sort_by_degree_(ins, true);
+    std::size_t cursor(0); // 堆为空时，选取入度最大的未放置顶点
+
+    std::vector<vertex_index_t> seq; seq.reserve(V);
+    while (seq.size() < V) {
+        vertex_index_t u = GRAPH::null_vertex;
+        while (!pq.empty()) {
+            auto top = pq.top(); pq.pop();
+            if (!placed[top.second] && key[top.second] == top.first) {
+                u = top.second;
+                break;
+            }
+        }
+
+        if (u == GRAPH::null_vertex) {
+            while (placed[byDegree[cursor]]) ++cursor;
+            u = byDegree[cursor];
+        }
+
+        placed[u] = true;
+        seq.push_back(u);
+        update(u, true);
+        if (seq.size() > window)
+            update(seq[seq.size() - window - 1], false);
+    }
+
+    std::vector<vertex_index_t> order(V);
+    for (vertex_index_t i = 0; i < V; i++)
+        order[seq[i]] = i;
+    return order;
+}
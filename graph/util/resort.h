@@ -1,55 +1,81 @@
 #pragma once
 #include <vector>
+#include <tuple>
 #include <assert.h>
 #include "../core/KtAdjIter.h"
+#include "../core/vertex_traits.h"
 
 
-// ͼgĶ㰴order򣬼g[v]Ϊg[order[v]]
-//   GRAPH - ͼ
-//   ORDER - []
+namespace kPrivate
+{
+    // 仅复制顶点值：flat图的顶点对象附带边偏移，顶点亦可能自带出度，这些属性由assign构建，须保留
+    template<typename VERTEX>
+    void copy_vertex_value_(VERTEX& dst, const VERTEX& src)
+    {
+        using traits_t = vertex_traits<VERTEX>;
+        using helper_t = vertex_traits_helper<traits_t>;
+
+        VERTEX old(dst);
+        dst = src;
+        if constexpr (helper_t::has_edgeindex)
+            traits_t::edgeindex(dst) = traits_t::edgeindex(old);
+        if constexpr (helper_t::has_outdegree)
+            traits_t::outdegree(dst) = traits_t::outdegree(old);
+    }
+}
+
+
+// 按照order对图g的顶点重新编号，返回新图，即g的顶点v在新图中的编号为order[v]
+// 一次性收集所有边后调用assign批量构建新图，对于flat图时间复杂度为O(V+E)
+//   GRAPH - 图类型
+//   ORDER - 具[]操作符的类型
 template<class GRAPH, class ORDER>
-void resort(GRAPH& g, const ORDER& order)
+GRAPH permute(const GRAPH& g, const ORDER& order)
 {
     using edge_type = typename GRAPH::edge_type;
     using vertex_index_t = typename GRAPH::vertex_index_t;
 
-    auto E = g.size(); // verify
-    std::vector<bool> flags(g.order(), false); // ڱǶflags[i]Ƿ
-
-    // ѯţҪǽvĳߵΪorder[v]ĳ
-    for (auto v = 0u; v < g.order(); v++) {
-        if (flags[v]) continue;
-
-        // ռvĳ
-        std::vector<std::pair<vertex_index_t, edge_type>> v_outEdges;
+    std::vector<std::tuple<vertex_index_t, vertex_index_t, edge_type>> edges;
+    edges.reserve(g.size());
+    for (vertex_index_t v = 0; v < g.order(); v++) {
         auto iter = KtAdjIter(g, v);
-        for (; !iter.isEnd(); ++iter)
-            v_outEdges.emplace_back(*iter, iter.edge());
+        for (; !iter.isEnd(); ++iter) {
+            vertex_index_t w = *iter;
+            if (!g.isDigraph() && w < v) // 无向图的每条边只收集一次
+                continue;
+            edges.emplace_back(order[v], order[w], iter.edge());
+        }
+    }
 
+    GRAPH ng;
+    ng.assign(g.order(), edges.begin(), edges.end());
 
-        do {
-            flags[v] = true;
-            auto nv = order[v]; // vΪnv
+    if constexpr (GRAPH::hasVertex())
+        for (vertex_index_t v = 0; v < g.order(); v++)
+            kPrivate::copy_vertex_value_(ng.vertexAt(order[v]), g.vertexAt(v));
 
-            // vĳߵΪnvĳ֮ǰȱnvĳߣϢʧ
-            std::vector<std::pair<vertex_index_t, edge_type>> nv_outEdges;
-            if (!flags[nv]) { // nvѴϢŹռ
-                auto iter = KtAdjIter(g, nv);
-                for (; !iter.isEnd(); ++iter)
-                    nv_outEdges.emplace_back(*iter, iter.edge());
-            }
+    assert(ng.size() == g.size());
+    return ng;
+}
 
-            // ߵoutEdges(v) -> outEdges(nv)
-            g.eraseOutEdges(nv);
-            for (const auto& e : v_outEdges)
-                g.addEdge(nv, order[e.first], e.second);
 
+// 对图g的顶点按照order进行重排序，即g[v]变为g[order[v]]
+//   GRAPH - 图类型
+//   ORDER - 具[]操作符的类型
+template<class GRAPH, class ORDER>
+void resort(GRAPH& g, const ORDER& order)
+{
+    g = permute(g, order);
+}
 
-            // ˳v -> order[v] -> order[order[v]] -> ... һֱǰ
-            v = nv;
-            std::swap(v_outEdges, nv_outEdges);
-        } while (!flags[v]);
-    }
 
-    assert(g.size() == E);
+// 由old->new的编号映射order，计算new->old的逆映射
+template<class ORDER>
+auto inverse_order(const ORDER& order)
+{
+    using index_t = std::decay_t<decltype(order[0])>;
+    std::vector<index_t> inv(order.size());
+    for (std::size_t v = 0; v < order.size(); v++)
+        inv[order[v]] = static_cast<index_t>(v);
+    return inv;
 }
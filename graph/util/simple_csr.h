@@ -0,0 +1,41 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include "../core/KtAdjIter.h"
+#include "../base/parallel_for.h"
+
+
+// 将图g的邻接结构复制为CSR格式：顶点v的邻接点为adj[first[v], first[v + 1])
+// 去除自环和平行边，且每行按顶点序号递增排列
+// 若g为alwaysSorted，各行已有序，只需线性去重，否则以nthreads个线程并行排序各行
+// 用于三角形计数、k-core等只关心简单图结构的算法
+template<typename GRAPH, typename INDEX>
+void simple_csr(const GRAPH& g, std::vector<std::size_t>& first, std::vector<INDEX>& adj, unsigned nthreads = 0)
+{
+    const INDEX V = INDEX(g.order());
+    first.assign(std::size_t(V) + 1, 0);
+    adj.clear();
+    for (INDEX v = 0; v < V; v++) {
+        for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter)
+            if (INDEX(*iter) != v)
+                adj.push_back(INDEX(*iter));
+        first[v + 1] = adj.size();
+    }
+
+    if constexpr (!GRAPH::isAlwaysSorted())
+        parallel_for(INDEX(0), V, [&first, &adj](INDEX v) {
+            std::sort(adj.begin() + first[v], adj.begin() + first[v + 1]);
+        }, nthreads);
+
+    // 去除平行边，原地压缩
+    std::size_t n(0);
+    for (INDEX v = 0; v < V; v++) {
+        auto b = first[v], e = first[v + 1];
+        first[v] = n;
+        for (auto i = b; i < e; i++)
+            if (i == b || adj[i] != adj[i - 1])
+                adj[n++] = adj[i];
+    }
+    first[V] = n;
+    adj.resize(n);
+}
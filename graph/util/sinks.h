@@ -1,7 +1,7 @@
 #include <vector>
 
 
-// ػ㼯
+// 返回汇点集合
 template<typename GRAPH>
 std::vector<unsigned> sinks(const GRAPH& g)
 {
@@ -2,7 +2,7 @@
 #include <vector>
 
 
-// Դ㼯
+// 返回源点集合
 template<typename GRAPH>
 std::vector<unsigned> sources(const GRAPH& g) 
 {
@@ -1,31 +1,31 @@
 #pragma once
 
 
-// תΪDIGRAPHͼ
+// 转换为DIGRAPH的无向图
 template<typename DIGRAPH>
 using graph_of = KtGraph<typename DIGRAPH::graph_impl, false, DIGRAPH::isMultiEdges(), DIGRAPH::isAlwaysSorted()>;
 
-// תΪGRAPHͼ
+// 转换为GRAPH的有向图
 template<typename GRAPH>
 using digraph_of = KtGraph<typename GRAPH::graph_impl, true, GRAPH::isMultiEdges(), GRAPH::isAlwaysSorted()>;
 
-// תΪGƽͼ
+// 转换为G的平行图
 template<typename G>
 using parallel_of = KtGraph<typename G::graph_impl, G::isDigraph(), true, G::isAlwaysSorted()>;
 
-// תΪGͼ
+// 转换为G的有序图
 template<typename G>
 using sorted_of = KtGraph<typename G::graph_impl, G::isDigraph(), G::isMultiEdges(), true>;
 
-// תΪGflatͼ
+// 转换为G的flat图
 template<typename G, typename E = typename G::edge_type, typename V = typename G::vertex_type>
-using flat_of = KtGraph<KtFlatGraphVectorImpl<E, V>, G::isDigraph(), G::isMultiEdges(), G::isAlwaysSorted()>;
+using flat_of = KtGraph<KtFlatGraphVectorImpl<E, V, typename G::vertex_index_t, typename G::edge_index_t>, G::isDigraph(), G::isMultiEdges(), G::isAlwaysSorted()>;
 
-// תΪGdenseͼ
+// 转换为G的dense图
 template<typename G, typename E = typename G::edge_type, typename V = typename G::vertex_type>
-using dense_of = KtGraph<KtAdjGraphDenseImpl<E, V>, G::isDigraph(), G::isMultiEdges(), G::isAlwaysSorted()>;
+using dense_of = KtGraph<KtAdjGraphDenseImpl<E, V, typename G::vertex_index_t, typename G::edge_index_t>, G::isDigraph(), G::isMultiEdges(), G::isAlwaysSorted()>;
 
-// תΪGsparseͼ
+// 转换为G的sparse图
 template<typename G, typename E = typename G::edge_type, typename V = typename G::vertex_type>
-using sparse_of = KtGraph<KtAdjGraphSparseImpl<E, V>, G::isDigraph(), G::isMultiEdges(), G::isAlwaysSorted()>;
+using sparse_of = KtGraph<KtAdjGraphSparseImpl<E, V, typename G::vertex_index_t, typename G::edge_index_t>, G::isDigraph(), G::isMultiEdges(), G::isAlwaysSorted()>;
 
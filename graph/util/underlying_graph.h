@@ -3,7 +3,7 @@
 #include "type_converter.h"
 
 
-// ͼĵͼͼ
+// 构造有向图的底图（基础图）
 template<typename DIGRAPH, typename GRAPH = graph_of<DIGRAPH>, 
 	typename = std::enable_if_t<DIGRAPH::isDigraph() && !GRAPH::isDigraph()>>
 GRAPH underlying_graph(const DIGRAPH& dg)
@@ -282,8 +282,8 @@ int KgHmmTopo::numPdfClasses(int phone) const
 
 
 
-// TODO: ʹkGraph·ʵ
-// weightoredgeΪadj_iter
+// TODO: 使用kGraph的最短路径实现
+// weightor的输入由edge改为adj_iter
 int KgHmmTopo::shortestLength(int phone) const
 {
 	auto entry = topologyForPhone(phone);
@@ -12,12 +12,12 @@
     ~class_name() = default;
 
 
-// ȡkaldihmm-topologyļ
-// kaldiΪÿphoneһhmmģ͡ͼ۵ĽǶȿÿhmmģ൱һͼ
-// ͼĶӦhmmģ͵״̬ͼı߶Ӧhmmģ͵תƸʡ
-// hmm-topoÿͼ˽ṹ󲿷hmmģ͵˽ṹͬģ
-// ֻǱߣתƸʣͶ㣨ʣͬ
-// ߵֵTransitionModel
+// 读取kaldi的hmm-topology文件
+// kaldi为每个phone定义一个hmm模型。从图论的角度看，每个hmm模型相当于一个子图，
+// 图的顶点对应hmm模型的状态，图的边对应hmm模型的转移概率。
+// hmm-topo定义了每个子图的拓扑结构，大部分hmm模型的拓扑结构是相同的，
+// 只是边（转移概率）和顶点（发射概率）不同。
+// 边的数值在TransitionModel给出。
 
 class KgHmmTopo
 {
@@ -26,8 +26,8 @@ public:
 		std::int32_t forward; std::int32_t self_loop;
 	};
 
-	// ΪKpPdfClassHmm״̬<forward_pdf_class, self_loop_pdf_class>
-	// ߵΪfloatHmmתƸ
+	// 顶点对象的类型为KpPdfClass，代表各Hmm状态的<forward_pdf_class, self_loop_pdf_class>
+	// 边的类型为float，代表Hmm转移概率
 	using kHmm = DigraphSx<float, KpPdfClass>;
 
 	DECLARE_DEFAULT(KgHmmTopo)
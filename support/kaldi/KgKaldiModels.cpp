@@ -40,7 +40,7 @@ double KgKaldiModels::prob(unsigned transId, const double* feat)
 	assert(transId > 0 && transId <= tm_.numTrans());
 	auto pdfId = tm_.transId2Pdf(transId);
 	assert(pdfId >= 0 && pdfId < pdfs_.size());
-	return pdfs_[pdfId]->prob(feat) * 0.1; // TODO: 0.1Ϊac_scaleΪ
+	return pdfs_[pdfId]->prob(feat) * 0.1; // TODO: 0.1为ac_scale，调整为可配置
 }
 
 
@@ -8,20 +8,20 @@
 #include "../extend/wfst/WfstX.h"
 
 
-// װkaldiйģͣѧģ͡硢ĸ
+// 封装kaldi的语音解码有关模型：包括声学模型、解码网络、字母表
 
 class KgKaldiModels
 {
 public:
 	using WFST = MmapWfst<KtLogSemiring<float>>;
 
-	// pathĿ¼ļ:
-	//    final.mdl - hmmѧģ
-	//    HCLG.fst - wfst
-	//    words.txt - ĸӳ
+	// path目录下须有如下文件:
+	//    final.mdl - hmm声学模型
+	//    HCLG.fst - wfst解码网络
+	//    words.txt - 字母表映射
 	KgKaldiModels(const std::string& path);
 
-	// transIdתƸʣʼ㣨״̬featĸ
+	// 计算边transId（转移概率）的起始顶点（隐藏状态）输出feat的概率
 	double prob(unsigned transId, const double* feat);
 
 	// ok???
@@ -31,7 +31,7 @@ public:
 
 	std::string dump(const char* prefix) const;
 
-	// idУsymbol
+	// 输入id序列，返回symbol序列
 	template<typename ID_ITER>
 	auto getWords(ID_ITER begin, ID_ITER end) const {
 		std::vector<std::string> words;
@@ -4,9 +4,9 @@
 #include "KgHmmTopo.h"
 
 
-// hmmģ͵ıߵļϡ
-// ÿTuple(phone, hmm_state, forward_pdf, self_loop_pdf)Ӧһ
-// kaldiΪÿָΨһtransition_id״̬תƵıʶ
+// 所有hmm模型的边的集合。
+// 每个Tuple(phone, hmm_state, forward_pdf, self_loop_pdf)对应有一条边
+// kaldi为每条边指定唯一的transition_id，用于状态转移的标识
 class KgTransitionModel
 {
 public:
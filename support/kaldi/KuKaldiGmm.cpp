@@ -125,7 +125,7 @@ std::vector<std::shared_ptr<kGmm>> KuKaldiGmm::loadGmms(const char* filePath)
 
     auto bin = KuKaldiIO::binaryTest(ifs);
     if (!bin)
-        return { 0 }; // ݲ֧textģʽ
+        return { 0 }; // 暂不支持text模式
 
     stdx::istreamx strm(ifs, bin);
     return loadGmms(strm);
@@ -6,16 +6,16 @@
 class KcMixModel;
 using kGmm = KcMixModel;
 
-// ṩkalid-gmmĶȡ֧
+// 提供kalid-gmm的读取支持
 
 class KuKaldiGmm
 {
 public:
 
-	// ȡkaldiĵgmmģ
+	// 读取kaldi的单个gmm模型
 	static bool loadGmm(stdx::istreamx& strm, kGmm& gmm);
 
-	// ȡkaldigmmģ
+	// 读取kaldi的gmm模型序列
 	static std::vector<std::shared_ptr<kGmm>> loadGmms(stdx::istreamx& strm);
 
 	static std::vector<std::shared_ptr<kGmm>> loadGmms(const char* filePath);
@@ -20,24 +20,24 @@ public:
 	template<typename T>
 	static bool readBasicType(stdx::istreamx &strm, T& val);
 
-	// ȡ
+	// 读取整数序列
 	template<typename T>
 	static bool readIntVector(stdx::istreamx& strm, std::vector<T>& vec);
 
-	// ȡУӦkaldiVectorṹбҪת
+	// 读取浮点序列，对应kaldi的Vector结构，进行必要浮点类型转换
 	template<typename T>
 	static bool readFloatVector(stdx::istreamx &strm, std::vector<T>& vec);
 
-	// ȡ󣬶ӦkaldiMatrixṹбҪת
+	// 读取浮点矩阵，对应kaldi的Matrix结构，进行必要浮点类型转换
 	template<typename T>
 	static bool readFloatMatrix(stdx::istreamx& strm, std::vector<std::vector<T>>& mat);
 
-	// ȡkaldiɵļ
-	// ÷Զжbin/txtģʽ
+	// 读取kaldi生成的特征文件
+	// 该方法会自动判断bin/txt模式
 	template<typename T>
 	static bool readTable(std::istream& strm, std::string& key, std::vector<std::vector<T>>& table);
 
-	// ȡkaldiwords.txtļ
+	// 读取kaldi的words.txt文件
 	static KgSymbolTable* loadWordIdPair(const char* path);
 
 	// TODO: there's mistake, test all writing methods
@@ -97,7 +97,7 @@ bool KuKaldiIO::readFloatVector(stdx::istreamx &strm, std::vector<T>& vec)
 {
 	static_assert(std::is_floating_point_v<T>, "T must be floating type");
 
-	if (!strm.binary()) // ֻʵbinaryģʽµĶȡ
+	if (!strm.binary()) // 只实现binary模式下的读取
 		return false;
 
 	std::string sig;
@@ -112,16 +112,16 @@ bool KuKaldiIO::readFloatVector(stdx::istreamx &strm, std::vector<T>& vec)
 	vec.resize(vecSize);
 	if (sig[0] == 'D' && sizeof(T) == sizeof(double) ||
 		sig[0] == 'F' && sizeof(T) == sizeof(float))
-		return strm.read(&vec[0], vecSize); // һ£ֱӶȡ
+		return strm.read(&vec[0], vecSize); // 类型一致，直接读取
 
-	// Ҫиת
-	if (sig[0] == 'D') { // doubleתΪfloatlong double
+	// 需要进行浮点类型转换
+	if (sig[0] == 'D') { // double转换为float或long double
 		std::vector<double> tmp(vecSize);
 		if (!strm.read(&tmp[0], vecSize))
 			return false;
 		stdx::copy(tmp, vec);
 	}
-	else { // floatתΪdoublelong double
+	else { // float转换为double或long double
 		std::vector<float> tmp(vecSize);
 		if (!strm.read(&tmp[0], vecSize))
 			return false;
@@ -137,7 +137,7 @@ bool KuKaldiIO::readFloatMatrix(stdx::istreamx& strm, std::vector<std::vector<T>
 {
 	static_assert(std::is_floating_point_v<T>, "T must be floating type");
 
-	if (!strm.binary()) // ֻʵbinaryģʽµĶȡ
+	if (!strm.binary()) // 只实现binary模式下的读取
 		return false;
 
 	std::string sig;
@@ -151,14 +151,14 @@ bool KuKaldiIO::readFloatMatrix(stdx::istreamx& strm, std::vector<std::vector<T>
 
 	mat.resize(rows);
 	if (sig[0] == 'D' && sizeof(T) == sizeof(double) ||
-		sig[0] == 'F' && sizeof(T) == sizeof(float)) { // һ£ֱӶȡ
+		sig[0] == 'F' && sizeof(T) == sizeof(float)) { // 类型一致，直接读取
 		for (std::int32_t i = 0; i < rows; i++) {
 			mat[i].resize(cols);
 			if (!strm.read(&mat[i][0], cols))
 				return false;
 		}
 	}
-	else if (sig[0] == 'D') { // doubleתΪfloatlong double
+	else if (sig[0] == 'D') { // double转换为float或long double
 		std::vector<double> tmp(cols);
 		for (std::int32_t i = 0; i < rows; i++) {
 			if (!strm.read(&tmp[0], cols))
@@ -166,7 +166,7 @@ bool KuKaldiIO::readFloatMatrix(stdx::istreamx& strm, std::vector<std::vector<T>
 			stdx::copy(tmp, mat[i]);
 		}
 	}
-	else { // floatתΪdoublelong double
+	else { // float转换为double或long double
 		std::vector<float> tmp(cols);
 		for (std::int32_t i = 0; i < rows; i++) {
 			if (!strm.read(&tmp[0], cols))
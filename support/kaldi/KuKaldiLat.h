@@ -7,7 +7,7 @@
 #include "../openfst/KuFstIO.h"
 
 
-// ṩkalid-latĶȡ֧
+// 提供kalid-lat的读取支持
 
 class KuKaldiLat
 {
@@ -75,7 +75,7 @@ namespace kPrivate
 		wfst_copy<LAT1, LAT2, WTOR_>(src, dst);
 	}
 
-	// ȡkalid-latĸ(binģʽ)strmжȡLAT2ͣתΪLAT1
+	// 读取kalid-lat的辅助函数(bin模式)，从strm中读取LAT2类型，转换为LAT1类型
 	template<typename LAT1, typename LAT2>
 	bool readBin_(stdx::istreamx& strm, const KuFstIO::KpFstHeader& hdr, LAT1& lat1)
 	{
@@ -183,23 +183,23 @@ bool KuKaldiLat::readText_(stdx::istreamx& strm, LAT& lat)
 {
 	assert(!KuFstIO::isFstHeader(strm));
 	
-	auto pos = strm->tellg(); // ״̬
+	auto pos = strm->tellg(); // 保存状态
 
-	// ȳֱӽLAT
+	// 先尝试直接解析LAT
 	if (kPrivate::readText_(strm, lat))
 		return true;
 
-	// ʧܣԽ͵lattice
-	strm->seekg(pos); // ָ״̬
+	// 若失败，则尝试解析其他类型的lattice
+	strm->seekg(pos); // 恢复状态
 	using weight_type = typename LAT::weight_type;
 	if constexpr (weight_type::isCompact()) {
-		// compact͵lattice
+		// 构造非compact类型的lattice
 		using naive_weight_type = std::remove_reference_t<decltype(std::declval<weight_type>().value0())>;
 		using NONCOMPACT_T = KtLattice<naive_weight_type>;
 		return kPrivate::readTxt_<LAT, NONCOMPACT_T>(strm, lat);
 	}
 	else {
-		// compact͵lattice
+		// 构造compact类型的lattice
 		using COMPACT_T = KtLattice<KtCompactLatWeight<weight_type, int>>;
 		return kPrivate::readTxt_<LAT, COMPACT_T>(strm, lat);
 	}
@@ -0,0 +1,383 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <tuple>
+#include <memory>
+#include <fstream>
+#include <charconv>
+#include <unordered_map>
+#include <mutex>
+#include <atomic>
+#include <limits>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include "../../graph/base/parallel_for.h"
+
+
+// 边列表文件的并行读取
+// 按块读入数据，各块在行（记录）边界处切分后由多个线程并行解析，最后通过assign批量构建图
+// 解析结果保持文件中的边次序，与线程数无关
+
+class KuEdgeListIO
+{
+public:
+
+	enum KeFormat
+	{
+		k_text,           // 空白分隔的文本，每行为"from to [weight]"
+		k_csv,            // 逗号分隔的文本，每行为"from,to[,weight]"
+		k_binary_pair,    // 二进制(from, to)记录
+		k_binary_triple   // 二进制(from, to, weight)记录，weight为float
+	};
+
+	struct KpOptions
+	{
+		KeFormat format = k_text;
+		bool remap = false;         // 是否将稀疏的外部id重映射为稠密的顶点索引（按外部id的升序编号）
+		bool skipHeader = false;    // 是否跳过首行，用于带表头的csv文件
+		char comment = '#';         // 注释行的首字符
+		unsigned idBytes = 4;       // 二进制格式的id宽度，4或8（本机字节序）
+		unsigned threads = 0;       // 解析线程数，0表示hardware_threads()
+		std::size_t chunkBytes = std::size_t(1) << 24; // 每次读入的字节数
+		double defaultWeight = 1;   // 文本格式缺省weight时的边值
+	};
+
+
+	// 读取边列表并构建图g
+	// @ids: 若非空且opt.remap为真，返回各顶点对应的外部id
+	template<typename GRAPH>
+	static bool read(std::istream& strm, GRAPH& g, const KpOptions& opt,
+		std::vector<std::uint64_t>* ids = nullptr);
+
+	template<typename GRAPH>
+	static bool read(const std::string& path, GRAPH& g, const KpOptions& opt,
+		std::vector<std::uint64_t>* ids = nullptr) {
+		std::ifstream ifs(path, std::ios_base::binary);
+		return ifs && read(ifs, g, opt, ids);
+	}
+
+	// 以缺省选项读取空白分隔的文本
+	template<typename GRAPH>
+	static bool read(std::istream& strm, GRAPH& g) {
+		return read(strm, g, KpOptions{});
+	}
+
+	template<typename GRAPH>
+	static bool read(const std::string& path, GRAPH& g) {
+		return read(path, g, KpOptions{});
+	}
+
+
+private:
+
+	struct KpRawEdge_
+	{
+		std::uint64_t from, to;
+		double weight;
+	};
+
+	// 读入全部原始边
+	static bool readRaw_(std::istream& strm, const KpOptions& opt, std::vector<KpRawEdge_>& edges);
+
+	// 解析[first, last)中的文本行，结果追加到out
+	static bool parseText_(const char* first, const char* last, const KpOptions& opt, std::vector<KpRawEdge_>& out);
+
+	static bool parseBinary_(const char* first, const char* last, const KpOptions& opt, std::vector<KpRawEdge_>& out);
+
+	static std::size_t recordBytes_(const KpOptions& opt) {
+		return opt.idBytes * 2 + (opt.format == k_binary_triple ? sizeof(float) : 0);
+	}
+
+	// 将外部id重映射为[0, n)，返回n。重映射后raw中的from、to即为顶点索引
+	static std::uint64_t remap_(std::vector<KpRawEdge_>& raw, unsigned nthreads, std::vector<std::uint64_t>* ids);
+
+
+	// 分片加锁的并发哈希表，用于外部id到临时编号的映射
+	class KpShardedIdMap_
+	{
+	public:
+		explicit KpShardedIdMap_(unsigned shards) : shards_(new Shard_[shards]), numShards_(shards) {}
+
+		// 返回id的临时编号，若id首次出现则分配新编号
+		std::uint64_t insert(std::uint64_t id) {
+			auto& s = shards_[mix_(id) % numShards_];
+			std::lock_guard<std::mutex> lock(s.mtx);
+			auto r = s.map.try_emplace(id, 0);
+			if (r.second) r.first->second = next_++;
+			return r.first->second;
+		}
+
+		std::uint64_t size() const { return next_; }
+
+		// 返回临时编号到外部id的映射
+		std::vector<std::uint64_t> table() const {
+			std::vector<std::uint64_t> t(next_);
+			for (unsigned i = 0; i < numShards_; i++)
+				for (auto& kv : shards_[i].map)
+					t[kv.second] = kv.first;
+			return t;
+		}
+
+	private:
+		static std::uint64_t mix_(std::uint64_t x) { // splitmix64
+			x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+			x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+			return x ^ (x >> 31);
+		}
+
+		struct Shard_
+		{
+			std::mutex mtx;
+			std::unordered_map<std::uint64_t, std::uint64_t> map;
+		};
+
+		std::unique_ptr<Shard_[]> shards_;
+		unsigned numShards_;
+		std::atomic<std::uint64_t> next_{ 0 };
+	};
+};
+
+
+template<typename GRAPH>
+bool KuEdgeListIO::read(std::istream& strm, GRAPH& g, const KpOptions& opt, std::vector<std::uint64_t>* ids)
+{
+	using vertex_index_t = typename GRAPH::vertex_index_t;
+	using edge_type = typename GRAPH::edge_type;
+	const unsigned nthreads = opt.threads ? opt.threads : hardware_threads();
+
+	std::vector<KpRawEdge_> raw;
+	if (!readRaw_(strm, opt, raw))
+		return false;
+
+	std::uint64_t nv(0);
+	if (opt.remap) {
+		nv = remap_(raw, nthreads, ids);
+	}
+	else {
+		std::vector<std::uint64_t> maxs(nthreads, 0);
+		parallel_blocks(std::size_t(0), raw.size(), [&raw, &maxs](unsigned tid, std::size_t b, std::size_t e) {
+			for (auto i = b; i < e; i++)
+				maxs[tid] = std::max(maxs[tid], std::max(raw[i].from, raw[i].to) + 1);
+		}, nthreads);
+		nv = raw.empty() ? 0 : *std::max_element(maxs.begin(), maxs.end());
+	}
+
+	// 最大值保留为null_vertex
+	if (nv > std::uint64_t(std::numeric_limits<vertex_index_t>::max()))
+		return false;
+
+	std::vector<std::tuple<vertex_index_t, vertex_index_t, edge_type>> edges(raw.size());
+	parallel_for(std::size_t(0), raw.size(), [&raw, &edges](std::size_t i) {
+		edges[i] = std::make_tuple(static_cast<vertex_index_t>(raw[i].from),
+			static_cast<vertex_index_t>(raw[i].to), static_cast<edge_type>(raw[i].weight));
+	}, nthreads);
+	decltype(raw)().swap(raw);
+
+	g.assign(static_cast<vertex_index_t>(nv), edges.begin(), edges.end());
+	return true;
+}
+
+
+inline bool KuEdgeListIO::readRaw_(std::istream& strm, const KpOptions& opt, std::vector<KpRawEdge_>& edges)
+{
+	const bool binary = opt.format == k_binary_pair || opt.format == k_binary_triple;
+	if (binary && opt.idBytes != 4 && opt.idBytes != 8)
+		return false;
+
+	const unsigned nthreads = opt.threads ? opt.threads : hardware_threads();
+	const std::size_t rec = binary ? recordBytes_(opt) : 1;
+	const std::size_t chunk = std::max(opt.chunkBytes, rec);
+
+	std::vector<char> buf;
+	std::size_t carry(0); // 上一块末尾不完整的行（记录）的字节数
+	bool skipHeader = !binary && opt.skipHeader;
+	bool eof(false);
+
+	while (!eof) {
+
+		/// 读入一块数据，接在上一块的残余数据之后
+
+		buf.resize(carry + chunk);
+		strm.read(buf.data() + carry, chunk);
+		auto len = carry + static_cast<std::size_t>(strm.gcount());
+		eof = !strm;
+		if (strm.bad()) return false;
+
+		const char* first = buf.data();
+		const char* last = first + len;
+		if (skipHeader) {
+			auto eol = static_cast<const char*>(std::memchr(first, '\n', len));
+			if (eol == nullptr && !eof) { // 首行尚未读完
+				carry = len;
+				continue;
+			}
+			first = eol ? eol + 1 : last;
+			skipHeader = false;
+		}
+
+		// 在完整的行（记录）边界处截断，剩余部分留待下一块
+		if (!eof) {
+			if (binary) {
+				last = first + (last - first) / rec * rec;
+			}
+			else {
+				auto p = last;
+				while (p != first && p[-1] != '\n') --p;
+				last = p;
+			}
+		}
+
+		/// 切分为若干片段并行解析
+
+		auto total = static_cast<std::size_t>(last - first);
+		unsigned pieces = static_cast<unsigned>(std::max<std::size_t>(1,
+			std::min<std::size_t>(nthreads * 4, total / (rec * 4096) + 1)));
+		std::vector<const char*> bounds(pieces + 1);
+		bounds[0] = first, bounds[pieces] = last;
+		for (unsigned i = 1; i < pieces; i++) {
+			auto p = first + total / pieces * i;
+			if (binary)
+				p = first + (p - first) / rec * rec;
+			else
+				while (p > first && p < last && p[-1] != '\n') ++p;
+			bounds[i] = std::max(p, bounds[i - 1]);
+		}
+
+		std::vector<std::vector<KpRawEdge_>> parts(pieces);
+		std::vector<char> ok(pieces, 0);
+		parallel_for(0u, pieces, [&](unsigned i) {
+			ok[i] = binary ? parseBinary_(bounds[i], bounds[i + 1], opt, parts[i])
+				: parseText_(bounds[i], bounds[i + 1], opt, parts[i]);
+		}, nthreads, 1u);
+
+		if (std::find(ok.begin(), ok.end(), 0) != ok.end())
+			return false;
+
+		for (auto& p : parts)
+			edges.insert(edges.end(), p.begin(), p.end());
+
+		/// 残余数据移至缓冲区头部
+
+		carry = static_cast<std::size_t>(buf.data() + len - last);
+		std::memmove(buf.data(), last, carry);
+	}
+
+	return true;
+}
+
+
+inline bool KuEdgeListIO::parseText_(const char* first, const char* last, const KpOptions& opt, std::vector<KpRawEdge_>& out)
+{
+	const bool csv = opt.format == k_csv;
+	auto isSep = [csv](char c) {
+		return c == ' ' || c == '\t' || c == '\r' || (csv && c == ',');
+	};
+
+	while (first < last) {
+		auto eol = static_cast<const char*>(std::memchr(first, '\n', last - first));
+		if (eol == nullptr) eol = last;
+
+		auto p = first;
+		first = eol + 1;
+
+		while (p < eol && isSep(*p)) ++p;
+		if (p == eol || *p == opt.comment) // 空行或注释行
+			continue;
+
+		KpRawEdge_ e;
+		auto r = std::from_chars(p, eol, e.from);
+		if (r.ec != std::errc()) return false;
+		p = r.ptr;
+
+		while (p < eol && isSep(*p)) ++p;
+		r = std::from_chars(p, eol, e.to);
+		if (r.ec != std::errc()) return false;
+		p = r.ptr;
+
+		while (p < eol && isSep(*p)) ++p;
+		if (p == eol) {
+			e.weight = opt.defaultWeight;
+		}
+		else {
+			r = std::from_chars(p, eol, e.weight);
+			if (r.ec != std::errc()) return false;
+			p = r.ptr;
+			while (p < eol && isSep(*p)) ++p;
+			if (p != eol) return false; // 多余的字段
+		}
+
+		out.push_back(e);
+	}
+
+	return true;
+}
+
+
+inline bool KuEdgeListIO::parseBinary_(const char* first, const char* last, const KpOptions& opt, std::vector<KpRawEdge_>& out)
+{
+	const auto rec = recordBytes_(opt);
+	out.reserve(out.size() + (last - first) / rec);
+
+	for (; first + rec <= last; first += rec) {
+		KpRawEdge_ e;
+		if (opt.idBytes == 4) {
+			std::uint32_t ft[2];
+			std::memcpy(ft, first, sizeof(ft));
+			e.from = ft[0], e.to = ft[1];
+		}
+		else {
+			std::memcpy(&e.from, first, 8);
+			std::memcpy(&e.to, first + 8, 8);
+		}
+
+		if (opt.format == k_binary_triple) {
+			float wt;
+			std::memcpy(&wt, first + 2 * opt.idBytes, sizeof(wt));
+			e.weight = wt;
+		}
+		else {
+			e.weight = opt.defaultWeight;
+		}
+
+		out.push_back(e);
+	}
+
+	return first == last;
+}
+
+
+inline std::uint64_t KuEdgeListIO::remap_(std::vector<KpRawEdge_>& raw, unsigned nthreads, std::vector<std::uint64_t>* ids)
+{
+	// 并发地分配临时编号
+	KpShardedIdMap_ idmap(nthreads * 16);
+	parallel_for(std::size_t(0), raw.size(), [&raw, &idmap](std::size_t i) {
+		raw[i].from = idmap.insert(raw[i].from);
+		raw[i].to = idmap.insert(raw[i].to);
+	}, nthreads);
+
+	// 临时编号依赖于线程调度，按外部id的升序重新编号，以保证结果确定
+	auto table = idmap.table();
+	std::vector<std::uint64_t> byId(table.size());
+	for (std::uint64_t i = 0; i < byId.size(); i++)
+		byId[i] = i;
+	std::sort(byId.begin(), byId.end(), [&table](std::uint64_t a, std::uint64_t b) {
+		return table[a] < table[b]; });
+
+	std::vector<std::uint64_t> rank(table.size());
+	for (std::uint64_t i = 0; i < byId.size(); i++)
+		rank[byId[i]] = i;
+
+	parallel_for(std::size_t(0), raw.size(), [&raw, &rank](std::size_t i) {
+		raw[i].from = rank[raw[i].from];
+		raw[i].to = rank[raw[i].to];
+	}, nthreads);
+
+	if (ids) {
+		ids->resize(table.size());
+		for (std::uint64_t i = 0; i < byId.size(); i++)
+			(*ids)[i] = table[byId[i]];
+	}
+
+	return table.size();
+}
@@ -0,0 +1,526 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <tuple>
+#include <fstream>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <algorithm>
+#include <new>
+#include "../../common/KuEndian.h"
+#include "../../graph/core/KtGraph.h"
+#include "../../graph/core/KtAdjIter.h"
+#include "../openfst/KtFlatGraphMmapImpl.h"
+
+
+// kGraph原生二进制格式的读写
+// 文件布局（各段起始位置按kAlignment字节对齐）：
+//   文件头 KpGraphHeader
+//   顶点偏移段：order个edge_index_t，即各顶点首条出边在边段中的序号
+//   边段：slots个边记录，记录布局与edge_has_to_t<EDGE_TYPE, VERTEX_INDEX>的内存布局一致
+//   顶点段（可选）：order个VERTEX_TYPE
+// 无向图的每条边在边段中存储2次（自环除外），与flat图的内存布局一致
+// 由于边段与顶点偏移段即为flat图的内存镜像，map方法可直接映射为KtFlatGraphMmapImpl，无需任何解析
+
+// 映射型的只读flat图
+template<typename EDGE_TYPE, bool digraph = true, bool alwaysSorted = false,
+	typename VERTEX_INDEX = unsigned, typename EDGE_INDEX = unsigned>
+using MmapGraph = KtGraph<KtFlatGraphMmapImpl<EDGE_TYPE, void, VERTEX_INDEX, EDGE_INDEX>,
+	digraph, true, alwaysSorted>;
+
+
+class KuGraphIO
+{
+public:
+
+	struct KpGraphHeader
+	{
+		std::uint32_t magic;             // kGraphMagicNumber
+		std::uint16_t version;           // 文件格式版本
+		std::uint8_t endian;             // 写入时的字节序，k_little_endian或k_big_endian
+		std::uint8_t flags;              // k_digraph | k_multi_edges | ...
+		std::uint8_t vertexIndexBytes;   // 顶点索引的字节宽度
+		std::uint8_t edgeIndexBytes;     // 边索引的字节宽度
+		std::uint16_t edgeBytes;         // 边记录的字节数
+		std::uint16_t edgeToOffset;      // to属性在边记录中的字节偏移
+		std::uint16_t vertexBytes;       // 顶点记录的字节数，无顶点段时为0
+		std::uint64_t order;             // 顶点数
+		std::uint64_t size;              // 边数
+		std::uint64_t slots;             // 边记录数，对于无向图大于size
+		std::uint64_t offsetPos;         // 顶点偏移段的起始位置（相对文件头）
+		std::uint64_t edgePos;           // 边段的起始位置
+		std::uint64_t vertexPos;         // 顶点段的起始位置，无顶点段时为0
+		std::uint64_t checksum;          // 各数据段的FNV-1a校验和
+
+		enum { k_digraph = 0x01, k_multi_edges = 0x02, k_sorted = 0x04, k_has_vertex = 0x08 };
+		enum { k_little_endian = 1, k_big_endian = 2 };
+	};
+
+
+	// 写入图g，适用于任意后端。strm须支持定位（写完数据段后回填文件头）
+	template<typename GRAPH>
+	static bool write(std::ostream& strm, const GRAPH& g);
+
+	template<typename GRAPH>
+	static bool write(const std::string& path, const GRAPH& g) {
+		std::ofstream ofs(path, std::ios_base::binary);
+		return ofs && write(ofs, g);
+	}
+
+
+	// 逐条读取边记录，通过assign构建图g，适用于任意可构建的图类型
+	// 读取时总是校验checksum
+	template<typename GRAPH>
+	static bool read(std::istream& strm, GRAPH& g);
+
+	template<typename GRAPH>
+	static bool read(const std::string& path, GRAPH& g) {
+		std::ifstream ifs(path, std::ios_base::binary);
+		return ifs && read(ifs, g);
+	}
+
+
+	// 将文件path直接映射为图g，g须为MmapGraph类型（或其他基于KtFlatGraphMmapImpl的图）
+	// 文件的索引宽度、边记录布局须与g一致，不支持顶点段
+	// 映射前总是检查各数据段均位于文件范围之内，截断的文件将被拒绝
+	// @verify: 是否校验checksum，以及顶点偏移的单调性和边的to顶点是否越界。
+	//   校验需读取整个文件，将失去按需缺页加载的优势；对不可信的文件应开启
+	template<typename GRAPH>
+	static bool map(const std::string& path, GRAPH& g, bool verify = false);
+
+
+	static bool readHeader(std::istream& strm, KpGraphHeader& hdr);
+
+	// 判断文件头hdr描述的图能否载入图类型GRAPH
+	// @mapping: 若为真，按map方法的要求进行判断，否则按read方法的要求
+	template<typename GRAPH>
+	static bool compatible(const KpGraphHeader& hdr, bool mapping);
+
+
+private:
+
+	template<typename GRAPH>
+	using edge_record_t = edge_has_to_t<typename GRAPH::edge_type, typename GRAPH::vertex_index_t>;
+
+	template<typename RECORD>
+	static std::size_t toOffset_();
+
+	static std::uint8_t nativeEndian_() {
+		return KuEndian::isNativeBig() ? KpGraphHeader::k_big_endian : KpGraphHeader::k_little_endian;
+	}
+
+	static std::uint64_t checksum_(std::uint64_t hash, const void* data, std::size_t bytes) {
+		auto p = static_cast<const unsigned char*>(data);
+		for (std::size_t i = 0; i < bytes; i++)
+			hash = (hash ^ p[i]) * kFnvPrime;
+		return hash;
+	}
+
+	static std::uint64_t align_(std::uint64_t pos) {
+		return (pos + kAlignment - 1) / kAlignment * kAlignment;
+	}
+
+	// 以0填充至pos处
+	static void pad_(std::ostream& strm, std::uint64_t from, std::uint64_t to) {
+		static const char zeros[kAlignment] = { 0 };
+		strm.write(zeros, static_cast<std::streamsize>(to - from));
+	}
+
+	// 读取bytes字节宽度的无符号整数
+	static bool readIndex_(std::istream& strm, unsigned bytes, std::uint64_t& idx, std::uint64_t& hash);
+
+	// 校验各数据段的checksum，strm位于文件头处
+	static bool verify_(std::istream& strm, const KpGraphHeader& hdr);
+
+	// 检查各数据段是否位于长度为fileSize的文件之内
+	static bool checkBounds_(const KpGraphHeader& hdr, std::uint64_t fileSize);
+
+	// 检查顶点偏移单调不减且不超过边记录数，各边的to顶点小于顶点数
+	template<typename GRAPH>
+	static bool checkIndexes_(std::istream& strm, const KpGraphHeader& hdr);
+
+private:
+
+	// Identifies stream data as a kGraph binary file (and its endianity).
+	static constexpr std::uint32_t kGraphMagicNumber = 0x4b475246; // "KGRF"
+
+	static constexpr std::uint16_t kFileVersion = 1;
+
+	static constexpr std::uint64_t kAlignment = 64;
+
+	static constexpr std::uint64_t kFnvOffset = 14695981039346656037ull;
+	static constexpr std::uint64_t kFnvPrime = 1099511628211ull;
+};
+
+
+template<typename RECORD>
+std::size_t KuGraphIO::toOffset_()
+{
+	RECORD rec{};
+	auto& to = edge_traits<RECORD>::to(rec);
+	return reinterpret_cast<const char*>(std::addressof(to))
+		- reinterpret_cast<const char*>(std::addressof(rec));
+}
+
+
+template<typename GRAPH>
+bool KuGraphIO::compatible(const KpGraphHeader& hdr, bool mapping)
+{
+	using record_t = edge_record_t<GRAPH>;
+
+	if (hdr.magic != kGraphMagicNumber || hdr.version > kFileVersion || hdr.endian != nativeEndian_())
+		return false;
+
+	if (bool(hdr.flags & KpGraphHeader::k_digraph) != GRAPH::isDigraph())
+		return false;
+
+	if ((hdr.flags & KpGraphHeader::k_multi_edges) && !GRAPH::isMultiEdges())
+		return false;
+
+	if (hdr.vertexIndexBytes != sizeof(typename GRAPH::vertex_index_t)
+		|| hdr.edgeBytes != sizeof(record_t) || hdr.edgeToOffset != toOffset_<record_t>())
+		return false;
+
+	if (mapping) {
+		if (hdr.edgeIndexBytes != sizeof(typename GRAPH::edge_index_t))
+			return false;
+
+		if (GRAPH::isAlwaysSorted() && !(hdr.flags & KpGraphHeader::k_sorted))
+			return false;
+
+		if (GRAPH::hasVertex())
+			return false;
+	}
+	else if constexpr (GRAPH::hasVertex()) {
+		if ((hdr.flags & KpGraphHeader::k_has_vertex)
+			&& hdr.vertexBytes != sizeof(typename GRAPH::vertex_type))
+			return false;
+	}
+
+	return true;
+}
+
+
+template<typename GRAPH>
+bool KuGraphIO::write(std::ostream& strm, const GRAPH& g)
+{
+	using vertex_index_t = typename GRAPH::vertex_index_t;
+	using edge_index_t = typename GRAPH::edge_index_t;
+	using edge_type = typename GRAPH::edge_type;
+	using record_t = edge_record_t<GRAPH>;
+	static_assert(std::is_trivially_copyable_v<edge_type>, "edge type must be trivially copyable");
+
+	constexpr bool writeVertex = [] {
+		if constexpr (GRAPH::hasVertex())
+			return std::is_trivially_copyable_v<typename GRAPH::vertex_type>;
+		else
+			return false;
+	}();
+
+	auto start = strm.tellp();
+	if (start == std::ostream::pos_type(-1))
+		return false;
+
+	KpGraphHeader hdr;
+	std::memset(&hdr, 0, sizeof(hdr));
+	hdr.magic = kGraphMagicNumber;
+	hdr.version = kFileVersion;
+	hdr.endian = nativeEndian_();
+	if (GRAPH::isDigraph()) hdr.flags |= KpGraphHeader::k_digraph;
+	if (GRAPH::isMultiEdges()) hdr.flags |= KpGraphHeader::k_multi_edges;
+	if (GRAPH::isAlwaysSorted()) hdr.flags |= KpGraphHeader::k_sorted;
+	if (writeVertex) hdr.flags |= KpGraphHeader::k_has_vertex;
+	hdr.vertexIndexBytes = sizeof(vertex_index_t);
+	hdr.edgeIndexBytes = sizeof(edge_index_t);
+	hdr.edgeBytes = sizeof(record_t);
+	hdr.edgeToOffset = static_cast<std::uint16_t>(toOffset_<record_t>());
+	hdr.order = g.order();
+	hdr.size = g.size();
+
+	strm.write(reinterpret_cast<const char*>(&hdr), sizeof(hdr)); // 占位，最后回填
+	std::uint64_t pos = sizeof(hdr);
+	std::uint64_t hash = kFnvOffset;
+
+	/// 顶点偏移段
+
+	hdr.offsetPos = align_(pos);
+	pad_(strm, pos, hdr.offsetPos);
+	pos = hdr.offsetPos;
+
+	edge_index_t idx(0);
+	for (vertex_index_t v = 0; v < g.order(); v++) {
+		strm.write(reinterpret_cast<const char*>(&idx), sizeof(idx));
+		hash = checksum_(hash, &idx, sizeof(idx));
+		for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter)
+			++idx;
+	}
+	pos += std::uint64_t(g.order()) * sizeof(idx);
+	hdr.slots = idx;
+
+	/// 边段
+
+	hdr.edgePos = align_(pos);
+	pad_(strm, pos, hdr.edgePos);
+	pos = hdr.edgePos;
+
+	alignas(record_t) char buf[sizeof(record_t)];
+	for (vertex_index_t v = 0; v < g.order(); v++) {
+		for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter) {
+			std::memset(buf, 0, sizeof(buf)); // 确保填充字节确定，以便校验
+			auto rec = new (buf) record_t(static_cast<const edge_type&>(iter.edge()));
+			edge_traits<record_t>::to(*rec) = *iter;
+			strm.write(buf, sizeof(buf));
+			hash = checksum_(hash, buf, sizeof(buf));
+			rec->~record_t();
+		}
+	}
+	pos += hdr.slots * sizeof(record_t);
+
+	/// 顶点段
+
+	if constexpr (writeVertex) {
+		using vertex_type = typename GRAPH::vertex_type;
+		hdr.vertexBytes = sizeof(vertex_type);
+		hdr.vertexPos = align_(pos);
+		pad_(strm, pos, hdr.vertexPos);
+		pos = hdr.vertexPos;
+
+		for (vertex_index_t v = 0; v < g.order(); v++) {
+			const vertex_type& vt = g.vertexAt(v);
+			strm.write(reinterpret_cast<const char*>(&vt), sizeof(vt));
+			hash = checksum_(hash, &vt, sizeof(vt));
+		}
+		pos += std::uint64_t(g.order()) * sizeof(vertex_type);
+	}
+
+	/// 回填文件头
+
+	hdr.checksum = hash;
+	strm.seekp(start);
+	strm.write(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
+	strm.seekp(start + static_cast<std::streamoff>(pos));
+
+	return bool(strm);
+}
+
+
+inline bool KuGraphIO::readHeader(std::istream& strm, KpGraphHeader& hdr)
+{
+	strm.read(reinterpret_cast<char*>(&hdr), sizeof(hdr));
+	return strm && hdr.magic == kGraphMagicNumber;
+}
+
+
+inline bool KuGraphIO::readIndex_(std::istream& strm, unsigned bytes, std::uint64_t& idx, std::uint64_t& hash)
+{
+	char buf[8];
+	if (bytes > sizeof(buf) || !strm.read(buf, bytes))
+		return false;
+
+	hash = checksum_(hash, buf, bytes);
+	switch (bytes) {
+	case 1: { std::uint8_t x; std::memcpy(&x, buf, 1); idx = x; break; }
+	case 2: { std::uint16_t x; std::memcpy(&x, buf, 2); idx = x; break; }
+	case 4: { std::uint32_t x; std::memcpy(&x, buf, 4); idx = x; break; }
+	case 8: { std::memcpy(&idx, buf, 8); break; }
+	default: return false;
+	}
+
+	return true;
+}
+
+
+template<typename GRAPH>
+bool KuGraphIO::read(std::istream& strm, GRAPH& g)
+{
+	using vertex_index_t = typename GRAPH::vertex_index_t;
+	using edge_type = typename GRAPH::edge_type;
+	using record_t = edge_record_t<GRAPH>;
+
+	auto start = strm.tellg();
+	KpGraphHeader hdr;
+	if (!readHeader(strm, hdr) || !compatible<GRAPH>(hdr, false))
+		return false;
+
+	// 先确认各数据段位于流的范围之内，再按文件头分配空间
+	strm.seekg(0, std::ios_base::end);
+	auto streamSize = static_cast<std::uint64_t>(strm.tellg() - start);
+	if (!strm || !checkBounds_(hdr, streamSize))
+		return false;
+
+	std::uint64_t hash = kFnvOffset;
+
+	/// 顶点偏移段
+
+	strm.seekg(start + static_cast<std::streamoff>(hdr.offsetPos));
+	std::vector<std::uint64_t> offset(hdr.order + 1);
+	for (std::uint64_t v = 0; v < hdr.order; v++)
+		if (!readIndex_(strm, hdr.edgeIndexBytes, offset[v], hash))
+			return false;
+	offset[hdr.order] = hdr.slots;
+
+	/// 边段，无向图的反边不予收集
+
+	strm.seekg(start + static_cast<std::streamoff>(hdr.edgePos));
+	std::vector<std::tuple<vertex_index_t, vertex_index_t, edge_type>> edges;
+	edges.reserve(hdr.size);
+	alignas(record_t) char buf[sizeof(record_t)];
+	for (std::uint64_t v = 0; v < hdr.order; v++) {
+		if (offset[v] > offset[v + 1])
+			return false;
+
+		for (auto i = offset[v]; i < offset[v + 1]; i++) {
+			if (!strm.read(buf, sizeof(buf)))
+				return false;
+			hash = checksum_(hash, buf, sizeof(buf));
+
+			auto& rec = *reinterpret_cast<const record_t*>(buf);
+			std::uint64_t w = edge_traits<record_t>::to(rec);
+			if (w >= hdr.order)
+				return false;
+			if (GRAPH::isDigraph() || w >= v)
+				edges.emplace_back(static_cast<vertex_index_t>(v), static_cast<vertex_index_t>(w),
+					static_cast<const edge_type&>(rec));
+		}
+	}
+
+	/// 顶点段
+
+	std::vector<char> vbuf;
+	if (hdr.flags & KpGraphHeader::k_has_vertex) {
+		strm.seekg(start + static_cast<std::streamoff>(hdr.vertexPos));
+		vbuf.resize(hdr.order * hdr.vertexBytes);
+		if (!strm.read(vbuf.data(), vbuf.size()))
+			return false;
+		hash = checksum_(hash, vbuf.data(), vbuf.size());
+	}
+
+	if (hash != hdr.checksum || edges.size() != hdr.size)
+		return false;
+
+	g.assign(static_cast<vertex_index_t>(hdr.order), edges.begin(), edges.end());
+
+	if constexpr (GRAPH::hasVertex()) {
+		using vertex_type = typename GRAPH::vertex_type;
+		if (!vbuf.empty())
+			for (vertex_index_t v = 0; v < g.order(); v++)
+				std::memcpy(&g.vertexAt(v), vbuf.data() + v * sizeof(vertex_type), sizeof(vertex_type));
+	}
+
+	return true;
+}
+
+
+inline bool KuGraphIO::verify_(std::istream& strm, const KpGraphHeader& hdr)
+{
+	auto start = strm.tellg();
+	std::uint64_t hash = kFnvOffset;
+
+	auto section = [&](std::uint64_t pos, std::uint64_t bytes) {
+		strm.seekg(start + static_cast<std::streamoff>(pos));
+		char buf[4096];
+		while (bytes > 0) {
+			auto n = std::min<std::uint64_t>(bytes, sizeof(buf));
+			if (!strm.read(buf, n)) return false;
+			hash = checksum_(hash, buf, n);
+			bytes -= n;
+		}
+		return true;
+	};
+
+	if (!section(hdr.offsetPos, hdr.order * hdr.edgeIndexBytes)
+		|| !section(hdr.edgePos, hdr.slots * hdr.edgeBytes))
+		return false;
+
+	if ((hdr.flags & KpGraphHeader::k_has_vertex)
+		&& !section(hdr.vertexPos, hdr.order * hdr.vertexBytes))
+		return false;
+
+	return hash == hdr.checksum;
+}
+
+
+inline bool KuGraphIO::checkBounds_(const KpGraphHeader& hdr, std::uint64_t fileSize)
+{
+	// 以除法判断，避免pos + count * bytes溢出
+	auto within = [fileSize](std::uint64_t pos, std::uint64_t count, std::uint64_t bytes) {
+		return pos >= sizeof(KpGraphHeader) && pos <= fileSize
+			&& (bytes == 0 || count <= (fileSize - pos) / bytes);
+	};
+
+	if (hdr.slots < hdr.size || hdr.edgeIndexBytes == 0 || hdr.edgeBytes == 0)
+		return false;
+
+	if (!within(hdr.offsetPos, hdr.order, hdr.edgeIndexBytes)
+		|| !within(hdr.edgePos, hdr.slots, hdr.edgeBytes))
+		return false;
+
+	return !(hdr.flags & KpGraphHeader::k_has_vertex)
+		|| within(hdr.vertexPos, hdr.order, hdr.vertexBytes);
+}
+
+
+template<typename GRAPH>
+bool KuGraphIO::checkIndexes_(std::istream& strm, const KpGraphHeader& hdr)
+{
+	using edge_index_t = typename GRAPH::edge_index_t;
+	using record_t = edge_record_t<GRAPH>;
+
+	auto start = strm.tellg();
+
+	strm.seekg(start + static_cast<std::streamoff>(hdr.offsetPos));
+	std::uint64_t prev = 0;
+	for (std::uint64_t v = 0; v < hdr.order; v++) {
+		edge_index_t off;
+		if (!strm.read(reinterpret_cast<char*>(&off), sizeof(off)))
+			return false;
+		if (off < prev || off > hdr.slots || (v == 0 && off != 0))
+			return false;
+		prev = off;
+	}
+
+	strm.seekg(start + static_cast<std::streamoff>(hdr.edgePos));
+	alignas(record_t) char buf[sizeof(record_t)];
+	for (std::uint64_t i = 0; i < hdr.slots; i++) {
+		if (!strm.read(buf, sizeof(buf)))
+			return false;
+		auto& rec = *reinterpret_cast<const record_t*>(buf);
+		if (static_cast<std::uint64_t>(edge_traits<record_t>::to(rec)) >= hdr.order)
+			return false;
+	}
+
+	return true;
+}
+
+
+template<typename GRAPH>
+bool KuGraphIO::map(const std::string& path, GRAPH& g, bool verify)
+{
+	KpGraphHeader hdr;
+	{
+		std::ifstream ifs(path, std::ios_base::binary);
+		if (!ifs || !readHeader(ifs, hdr) || !compatible<GRAPH>(hdr, true))
+			return false;
+
+		ifs.seekg(0, std::ios_base::end);
+		auto fileSize = static_cast<std::uint64_t>(ifs.tellg());
+		if (!ifs || !checkBounds_(hdr, fileSize))
+			return false;
+
+		if (verify) {
+			ifs.seekg(0);
+			if (!verify_(ifs, hdr))
+				return false;
+
+			ifs.seekg(0);
+			if (!checkIndexes_<GRAPH>(ifs, hdr))
+				return false;
+		}
+	}
+
+	return g.map(path, static_cast<std::size_t>(hdr.order), static_cast<std::size_t>(hdr.slots), 0,
+		static_cast<std::int64_t>(hdr.offsetPos), static_cast<std::int64_t>(hdr.edgePos),
+		static_cast<std::size_t>(hdr.slots - hdr.size));
+}
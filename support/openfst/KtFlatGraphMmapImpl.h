@@ -6,28 +6,32 @@
 #include <fcntl.h>
 
 
-// ڴӳKtFlatGraphBaseʵ
-// ڴӳʹmioԴ(https://github.com/mandreyel)
+// 基于内存映射的KtFlatGraphBase实现
+// 内存映射使用mio开源库(https://github.com/mandreyel)
 
 namespace kPrivate
 {
-	template<typename EDGE_TYPE>
-	using flatmg_edge_range = KtRange<const edge_has_to_t<EDGE_TYPE>*>;
+	template<typename EDGE_TYPE, typename VERTEX_INDEX = unsigned>
+	using flatmg_edge_range = KtRange<const edge_has_to_t<EDGE_TYPE, VERTEX_INDEX>*>;
 
-	template<typename VERTEX_TYPE>
-	using flatmg_vertex_range = KtRange<const vertex_has_edgeindex_t<VERTEX_TYPE>*>;
+	template<typename VERTEX_TYPE, typename EDGE_INDEX = unsigned>
+	using flatmg_vertex_range = KtRange<const vertex_has_edgeindex_t<VERTEX_TYPE, EDGE_INDEX>*>;
 
-	template<typename EDGE_TYPE, typename VERTEX_TYPE>
-	using flatmg_base = KtFlatGraphBase<flatmg_edge_range<EDGE_TYPE>,
-		flatmg_vertex_range<VERTEX_TYPE>>;
+	template<typename EDGE_TYPE, typename VERTEX_TYPE, typename VERTEX_INDEX = unsigned, typename EDGE_INDEX = unsigned>
+	using flatmg_base = KtFlatGraphBase<flatmg_edge_range<EDGE_TYPE, VERTEX_INDEX>,
+		flatmg_vertex_range<VERTEX_TYPE, EDGE_INDEX>, VERTEX_INDEX>;
 }
 
 
-template<typename EDGE_TYPE, typename VERTEX_TYPE = void>
-class KtFlatGraphMmapImpl : public kPrivate::flatmg_base<EDGE_TYPE, VERTEX_TYPE>
+// @VERTEX_INDEX, @EDGE_INDEX: 须与映射文件中的存储宽度一致
+template<typename EDGE_TYPE, typename VERTEX_TYPE = void, 
+	typename VERTEX_INDEX = unsigned, typename EDGE_INDEX = unsigned>
+class KtFlatGraphMmapImpl : public kPrivate::flatmg_base<EDGE_TYPE, VERTEX_TYPE, VERTEX_INDEX, EDGE_INDEX>
 {
 public:
-	using super_ = kPrivate::flatmg_base<EDGE_TYPE, VERTEX_TYPE>;
+	using super_ = kPrivate::flatmg_base<EDGE_TYPE, VERTEX_TYPE, VERTEX_INDEX, EDGE_INDEX>;
+	using typename super_::vertex_index_t;
+	using typename super_::edge_index_t;
 	using edge_type = EDGE_TYPE;
 	using vertex_type = VERTEX_TYPE;
 
@@ -36,10 +40,11 @@ public:
 	~KtFlatGraphMmapImpl() { mmap_.unmap(); }
 
 
-	// ļpathƫfoffڴӳ
-	// ӳռvoffӳnvṹeoffӳne߽ṹ
-	bool map(const std::string& path, unsigned nv, unsigned ne, std::int64_t foff = 0, 
-		std::int64_t voff = 0, std::int64_t eoff = 0) {
+	// 从文件path的偏移foff处进行内存映射
+	// 从映射空间的voff处，映射nv个顶点结构，eoff处映射ne个边结构
+	// @dummy: ne个边结构中无向图反边的数量，不计入size()
+	bool map(const std::string& path, std::size_t nv, std::size_t ne, std::int64_t foff = 0, 
+		std::int64_t voff = 0, std::int64_t eoff = 0, std::size_t dummy = 0) {
 		std::error_code error;
 		mmap_ = mio::make_mmap_source(path, static_cast<size_t>(foff), mio::map_entire_file, error);
 		if (error) return false;
@@ -47,21 +52,27 @@ public:
 		auto vbuf = (const typename super_::vertex_type*)(mmap_.data() + voff);
 		super_::vertexes_ = decltype(super_::vertexes_)(vbuf, vbuf + nv);
 
-		if (eoff == 0) eoff = voff + nv * sizeof(super_::vertex_type);
+		if (eoff == 0) eoff = voff + nv * sizeof(typename super_::vertex_type);
 		auto ebuf = (const typename super_::edge_type*)(mmap_.data() + eoff);
 		super_::edges_ = decltype(super_::edges_)(ebuf, ebuf + ne);
+		dummyEdges_ = static_cast<edge_index_t>(dummy);
 
 		return true;
 	}
 
+	edge_index_t size() const {
+		return static_cast<edge_index_t>(super_::size() - dummyEdges_);
+	}
+
 private:
 	mio::mmap_source mmap_;
+	edge_index_t dummyEdges_{ 0 };
 };
 
 
-template<typename EDGE_TYPE, typename VERTEX_TYPE>
-struct graph_traits<KtFlatGraphMmapImpl<EDGE_TYPE, VERTEX_TYPE>>
-	: public graph_traits<kPrivate::flatmg_base<EDGE_TYPE, VERTEX_TYPE>>
+template<typename EDGE_TYPE, typename VERTEX_TYPE, typename VERTEX_INDEX, typename EDGE_INDEX>
+struct graph_traits<KtFlatGraphMmapImpl<EDGE_TYPE, VERTEX_TYPE, VERTEX_INDEX, EDGE_INDEX>>
+	: public graph_traits<kPrivate::flatmg_base<EDGE_TYPE, VERTEX_TYPE, VERTEX_INDEX, EDGE_INDEX>>
 {
 	constexpr static bool reshapable = false;
 	constexpr static bool immutable = true;
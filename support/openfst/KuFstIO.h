@@ -73,7 +73,7 @@ struct vertex_traits<const kPrivate::KpConstState<WEIGHT_TYPE>>
 };
 
 
-// ػedge_traitsͬʱʵwfstҪtrans_traitsӿ
+// 特化edge_traits，同时实现wfst需要的trans_traits接口
 template<typename WEIGHT_TYPE>
 struct edge_traits<kPrivate::KpStdArc<WEIGHT_TYPE>>
 {
@@ -90,7 +90,7 @@ struct edge_traits<kPrivate::KpStdArc<WEIGHT_TYPE>>
 	inline static const edge_type null_edge = {};
 
 
-	// Ϊtrans_traitsӿڳԱ
+	// 以下为trans_traits接口成员
 
 	using trans_type = edge_type;
 	using alpha_type = typename std::int32_t;
@@ -146,12 +146,12 @@ public:
 	static bool read(stdx::istreamx& strm, const KpFstHeader& hdr, WFST& fst, KgSymbolTable* isym = nullptr, KgSymbolTable* osym = nullptr);
 
 	// read fst as text
-	// @AS_ACCEPTOR: Ϊ棬תƱûolabel(olabel = ilabel)
+	// @AS_ACCEPTOR: 若为真，则转移边没有olabel属性(olabel = ilabel)
 	template <typename WFST, bool AS_ACCEPTOR = false>
 	static bool readText(std::istream& strm, WFST& fst, 
 		std::function<bool(const std::string&, typename WFST::weight_type&)> str2wt);
 
-	// readText棬ṩһȱʡstr2wt
+	// readText辅助版，提供一个缺省的str2wt
 	template <typename WFST, bool AS_ACCEPTOR = false, 
 		typename = std::enable_if_t<std::is_assignable_v<typename WFST::weight_type, double>>>
 	static bool readText(std::istream& strm, WFST& fst) {
@@ -163,7 +163,7 @@ public:
 	}
 
 	// read fst as mmap
-	// wfstflatģʽ
+	// wfst须是flat模式，
 	template <typename WEIGHT_TYPE>
 	static MmapWfst<WEIGHT_TYPE>* readMmap(const std::string& path);
 
@@ -265,7 +265,7 @@ bool KuFstIO::readText(std::istream &is, WFST& fst,
 
 		case 5:
 			if constexpr (AS_ACCEPTOR) {
-				if (tokens.size() == 5) { // case 3  fall-through
+				if (tokens.size() == 5) { // case 3 会 fall-through
 					// 5 columns only ok for non-acceptor.
 					ok = false;
 					break;
@@ -326,10 +326,10 @@ bool KuFstIO::read(std::istream& strm_, WFST& fst, KgSymbolTable* isym, KgSymbol
 	if (hdr.version < kMinFileVersion)
 		return false;
 
-	if (hdr.fsttype != "vector" && hdr.fsttype != "const") // TODO: ֶֻ֧ȡvectorconstfst
+	if (hdr.fsttype != "vector" && hdr.fsttype != "const") // TODO: 只支持读取vector和const类型fst
 		return false;
 
-	if (hdr.arctype != "standard")  // TODO: ֶֻ֧ȡ׼arc
+	if (hdr.arctype != "standard")  // TODO: 只支持读取标准型arc
 		return false;
 
 	return read(strm, hdr, fst, isym, osym);
@@ -402,7 +402,7 @@ MmapWfst<WEIGHT_TYPE>* KuFstIO::readMmap(const std::string& path)
 	/// now everything is ok, ready to read mmap
 	auto mmap = std::make_unique<MmapWfst<WEIGHT_TYPE>>();
 	if (!mmap->map(path, static_cast<unsigned>(hdr.numstates),
-		static_cast<unsigned>(hdr.numarcs), off)) // ȶvertexٶarc
+		static_cast<unsigned>(hdr.numarcs), off)) // 先读vertex，再读arc
 		return nullptr;
 
 	mmap->setInitial(static_cast<unsigned>(hdr.start));
@@ -422,7 +422,7 @@ bool KuFstIO::readVector_(stdx::istreamx& strm, WFST& fst, std::int64_t numState
 		strm >> finalWt; // final weight of current state
 		if (!strm) return false;
 		if (WFST::weight_type::zero() != finalWt)
-			fst.setFinal(s, finalWt); // TODO: ˼
+			fst.setFinal(s, finalWt); // TODO: 是这个意思吗
 
 		std::int64_t narcs;
 		strm >> narcs;
@@ -893,9 +893,9 @@ inline auto query_file_size(file_handle_type handle, std::error_code& error)
     if(::fstat(handle, &sbuf) == -1)
     {
         error = detail::last_error();
-        return 0;
+        return int64_t(0);
     }
-    return sbuf.st_size;
+    return static_cast<int64_t>(sbuf.st_size);
 #endif
 }
 
@@ -48,7 +48,7 @@ edges adj_iter_reedge_test_(GRAPH& g, ITER iter)
     for (; !iter.isEnd(); ++iter) {
         auto v = iter.from();
         auto w = iter.to();
-        if ((g.isDigraph() || v >= w) && rand() < RAND_MAX / 4) { // 25%ĸ޸ıȨֵ
+        if ((g.isDigraph() || v >= w) && rand() < RAND_MAX / 4) { // 以25%的概率修改边权值
             double wt = double(rand()) / double(RAND_MAX);
             if (wt != g.null_edge) {
                 iter.reedge(wt);
@@ -65,13 +65,13 @@ template<typename GRAPH, typename ITER>
 std::pair<edges, unsigned> adj_iter_erase_test_(GRAPH& g, ITER iter)
 {
     edges es;
-    unsigned erased(0); // ɾĴ
+    unsigned erased(0); // 连续删除的次数
 
-    bool flag(false); // ϴǷִɾ
+    bool flag(false); // 上次是否执行删除操作
     for (; !iter.isEnd(); ) {
         auto v = iter.from();
         auto w = iter.to();
-        if ((g.isDigraph() || v >= w) && rand() < RAND_MAX / 5) { // 20%ĸɾ
+        if ((g.isDigraph() || v >= w) && rand() < RAND_MAX / 5) { // 以20%的概率删除边
             es.push_back({ { v, w }, iter.edge() });
             iter.erase();
 
@@ -179,7 +179,7 @@ void adj_iter_test__(GRAPH& g, bool iterR)
     for (auto& i : esAll) {
         auto& pos = i.first;
         double wt = getWeight(esErased, pos.first, pos.second);
-        if (wt != 0) { // ȷϸѱɾ
+        if (wt != 0) { // 确认该条边已被删除
             if(g.hasEdge(pos.first, pos.second))
                 test_failed(g);
         }
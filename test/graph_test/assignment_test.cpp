@@ -0,0 +1,201 @@
+#include <stdio.h>
+#include <cmath>
+#include <random>
+#include "GraphX.h"
+#include "core/KtAssignment.h"
+#include "test_util.h"
+
+
+// 状态压缩的动态规划：依次指派较少一侧的各顶点，状态为较多一侧已被占用的顶点集合
+// @w: w[l][r]为左侧l与右侧r之间的权值，NAN表示无边
+// @return: 最优总权值，不存在饱和较少一侧的匹配时返回NAN
+inline double naive_assignment_(std::vector<std::vector<double>> w, bool minimum)
+{
+    if (w.empty())
+        return 0;
+    if (w.size() > w[0].size()) { // 转置
+        std::vector<std::vector<double>> t(w[0].size(), std::vector<double>(w.size()));
+        for (unsigned l = 0; l < w.size(); l++)
+            for (unsigned r = 0; r < w[0].size(); r++)
+                t[r][l] = w[l][r];
+        w.swap(t);
+    }
+
+    unsigned n = unsigned(w.size()), m = unsigned(w[0].size());
+    std::vector<double> dp(std::size_t(1) << m, NAN);
+    dp[0] = 0;
+    for (unsigned mask = 0; mask < dp.size(); mask++) {
+        if (std::isnan(dp[mask])) continue;
+        unsigned i(0);
+        for (unsigned x = mask; x; x &= x - 1) ++i;
+        if (i == n) continue;
+        for (unsigned r = 0; r < m; r++)
+            if (!(mask >> r & 1) && !std::isnan(w[i][r])) {
+                auto& d = dp[mask | (1u << r)];
+                auto x = dp[mask] + w[i][r];
+                if (std::isnan(d) || (minimum ? x < d : x > d))
+                    d = x;
+            }
+    }
+
+    double best(NAN);
+    for (unsigned mask = 0; mask < dp.size(); mask++) {
+        unsigned i(0);
+        for (unsigned x = mask; x; x &= x - 1) ++i;
+        if (i == n && !std::isnan(dp[mask]) && (std::isnan(best) || (minimum ? dp[mask] < best : dp[mask] > best)))
+            best = dp[mask];
+    }
+    return best;
+}
+
+
+// 检查KtAuction的结果：匹配合法，且总权值与各匹配边的权值之和一致
+template<typename GRAPH, typename WEIGHTOR>
+bool auction_ok_(const GRAPH& g, unsigned nl, const KtAuction<GRAPH, WEIGHTOR>& auc)
+{
+    unsigned nr = g.order() - nl;
+    double sum(0);
+    unsigned matched(0);
+    for (unsigned l = 0; l < nl; l++) {
+        auto r = auc.mate(l);
+        if (r == GRAPH::null_vertex) continue;
+        if (r < nl || auc.mate(r) != l || !g.hasEdge(l, r))
+            return false;
+        sum += WEIGHTOR{}(g.getEdge(l, r));
+        ++matched;
+    }
+
+    return matched == std::min(nl, nr) && std::abs(sum - double(auc.totalWeight())) < 1e-6 * (1 + std::abs(sum));
+}
+
+
+// 随机稀疏二部图，左侧nl个顶点，每个左侧顶点有deg条边
+template<typename GRAPH>
+GRAPH random_bipartite_(unsigned nl, unsigned nr, unsigned deg, unsigned maxWeight, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    GRAPH g(nl + nr);
+    for (unsigned l = 0; l < nl; l++)
+        for (unsigned k = 0; k < deg; k++) {
+            unsigned r = nl + rng() % nr;
+            if (!g.hasEdge(l, r))
+                g.addEdge(l, r, typename GRAPH::edge_type(1 + rng() % maxWeight));
+        }
+    return g;
+}
+
+
+template<typename GRAPH, typename WEIGHTOR>
+void auction_test_(const GRAPH& g, unsigned nl)
+{
+    unsigned nr = g.order() - nl;
+    std::vector<std::vector<double>> w(nl, std::vector<double>(nr, NAN));
+    for (unsigned l = 0; l < nl; l++)
+        for (auto iter = KtAdjIter(g, l); !iter.isEnd(); ++iter)
+            if (*iter >= nl)
+                w[l][*iter - nl] = WEIGHTOR{}(iter.edge());
+    auto expect = naive_assignment_(w, kPrivate::is_minimum_wtor<WEIGHTOR>());
+
+    KtAuction<GRAPH, WEIGHTOR> auc(g, nl, 3);
+    KtAuction<GRAPH, WEIGHTOR> auc1(g, nl, 1);
+    if (auc.ok() == std::isnan(expect) || auc1.ok() != auc.ok())
+        test_failed(g);
+    if (auc.ok()) {
+        if (!auction_ok_(g, nl, auc) || std::abs(double(auc.totalWeight()) - expect) > 1e-6 * (1 + std::abs(expect)))
+            test_failed(g);
+        if (auc.pairs() != auc1.pairs()) // 结果与线程数无关
+            test_failed(g);
+    }
+}
+
+
+void assignment_test()
+{
+    printf("assignment test...\n");
+    fflush(stdout);
+
+    printf("   hungarian"); fflush(stdout);
+    {
+        std::mt19937 rng(1);
+        for (unsigned t = 0; t < 60; t++) {
+            unsigned rows = 1 + rng() % 7, cols = 1 + rng() % 7;
+            KtMatrix<int> m(rows, cols, 0);
+            GraphSi<> g(rows + cols); // 仅用于失败时输出
+            std::vector<std::vector<double>> w(rows, std::vector<double>(cols));
+            for (unsigned r = 0; r < rows; r++)
+                for (unsigned c = 0; c < cols; c++) {
+                    int x = int(rng() % 41) - 20;
+                    m.insert(r, c, x), w[r][c] = x;
+                    g.addEdge(r, rows + c, x);
+                }
+
+            KtHungarian<int> hmin(m);
+            KtHungarian<int, KtWeightorMax<KtWeightSelf<int>, KtAdder<int>>> hmax(m);
+            if (hmin.totalWeight() != naive_assignment_(w, true) || hmax.totalWeight() != naive_assignment_(w, false))
+                test_failed(g);
+
+            auto pairs = hmin.pairs();
+            if (pairs.size() != std::min(rows, cols))
+                test_failed(g);
+            long long sum(0);
+            for (auto& p : pairs) {
+                if (hmin.colOf(p.first) != p.second || hmin.rowOf(p.second) != p.first)
+                    test_failed(g);
+                sum += m.row(p.first).at(p.second);
+            }
+            if (sum != hmin.totalWeight())
+                test_failed(g);
+        }
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   auction, small"); fflush(stdout);
+    for (unsigned t = 0; t < 40; t++) {
+        unsigned nl = 1 + t % 9, nr = 1 + (t * 7) % 11;
+        auto g = random_bipartite_<GraphSi<>>(nl, nr, 3, 50, t);
+        auction_test_<GraphSi<>, default_min_wtor<GraphSi<>>>(g, nl);
+        auction_test_<GraphSi<>, default_max_wtor<GraphSi<>>>(g, nl);
+    }
+    for (unsigned t = 0; t < 20; t++) {
+        auto g = random_bipartite_<DigraphSd<>>(8, 12, 4, 1000, 100 + t);
+        auction_test_<DigraphSd<>, default_min_wtor<DigraphSd<>>>(g, 8);
+        auction_test_<DigraphSd<>, default_max_wtor<DigraphSd<>>>(g, 8);
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   auction vs. hungarian"); fflush(stdout);
+    {
+        // 完全二部图上与匈牙利算法的结果一致
+        std::mt19937 rng(2);
+        for (auto sz : { std::pair<unsigned, unsigned>(60, 60), { 40, 70 }, { 70, 40 } }) {
+            unsigned nl = sz.first, nr = sz.second;
+            KtMatrix<int> m(nl, nr, 0);
+            GraphSi<> g(nl + nr);
+            for (unsigned l = 0; l < nl; l++)
+                for (unsigned r = 0; r < nr; r++) {
+                    int x = 1 + rng() % 10000;
+                    m.insert(l, r, x);
+                    g.addEdge(l, nl + r, x);
+                }
+
+            KtAuction<GraphSi<>> amin(g, nl, 3);
+            KtAuction<GraphSi<>, default_max_wtor<GraphSi<>>> amax(g, nl, 3);
+            if (!amin.ok() || amin.totalWeight() != KtHungarian<int>(m).totalWeight() || !auction_ok_(g, nl, amin))
+                test_failed(g);
+            if (!amax.ok() || amax.totalWeight() != KtHungarian<int, KtWeightorMax<KtWeightSelf<int>, KtAdder<int>>>(m).totalWeight())
+                test_failed(g);
+        }
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   auction, infeasible"); fflush(stdout);
+    {
+        // 左侧0、1都只与右侧顶点2相连
+        GraphSi<> g(5);
+        g.addEdge(0, 2, 1), g.addEdge(1, 2, 2);
+        KtAuction<GraphSi<>> auc(g, 2);
+        if (auc.ok())
+            test_failed(g);
+    }
+    printf("  > passed\n"); fflush(stdout);
+}
@@ -0,0 +1,139 @@
+#include <stdio.h>
+#include <cmath>
+#include "GraphX.h"
+#include "core/KtBetweenness.h"
+#include "util/graphgen.h"
+#include "test_util.h"
+
+
+// 权值取边值模3加1，以产生较多的等长最短路径
+template<typename GRAPH>
+struct small_weight_
+{
+    using weight_type = int;
+    int operator()(const typename GRAPH::edge_type& e) const { return int(e) % 3 + 1; }
+};
+
+template<typename GRAPH>
+using small_wtor = KtWeightorMin<small_weight_<GRAPH>, KtAdder<int>>;
+
+
+// 按定义计算介数：先以朴素的O(V^2)Dijkstra求各顶点对的距离和最短路径数
+template<typename GRAPH, typename WEIGHTOR>
+std::vector<double> naive_betweenness_(const GRAPH& g)
+{
+    const long long inf = 1ll << 50;
+    unsigned V = g.order();
+    std::vector<std::vector<long long>> dist(V, std::vector<long long>(V, inf));
+    std::vector<std::vector<double>> sigma(V, std::vector<double>(V, 0));
+    for (unsigned s = 0; s < V; s++) {
+        dist[s][s] = 0, sigma[s][s] = 1;
+        std::vector<bool> done(V, false);
+        while (true) {
+            unsigned v = V;
+            for (unsigned u = 0; u < V; u++)
+                if (!done[u] && dist[s][u] < inf && (v == V || dist[s][u] < dist[s][v]))
+                    v = u;
+            if (v == V) break;
+            done[v] = true;
+            for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter) {
+                auto w = *iter;
+                auto nd = dist[s][v] + WEIGHTOR{}(iter.edge());
+                if (nd < dist[s][w])
+                    dist[s][w] = nd, sigma[s][w] = sigma[s][v];
+                else if (nd == dist[s][w] && w != s)
+                    sigma[s][w] += sigma[s][v];
+            }
+        }
+    }
+
+    std::vector<double> bc(V, 0);
+    for (unsigned s = 0; s < V; s++)
+        for (unsigned t = 0; t < V; t++)
+            for (unsigned v = 0; v < V; v++)
+                if (s != t && v != s && v != t && dist[s][t] < inf && dist[s][v] + dist[v][t] == dist[s][t])
+                    bc[v] += sigma[s][v] * sigma[v][t] / sigma[s][t];
+
+    if (!g.isDigraph())
+        for (auto& x : bc) x /= 2;
+
+    return bc;
+}
+
+
+template<typename GRAPH, typename WEIGHTOR>
+void betweenness_test_(const GRAPH& g)
+{
+    auto expect = naive_betweenness_<GRAPH, WEIGHTOR>(g);
+    KtBetweenness<GRAPH, WEIGHTOR> bc(g, 3);
+    KtBetweenness<GRAPH, WEIGHTOR> bc1(g, 1);
+    for (unsigned v = 0; v < g.order(); v++)
+        if (std::abs(bc.centrality(v) - expect[v]) > 1e-6 * (1 + expect[v]) ||
+            std::abs(bc1.centrality(v) - expect[v]) > 1e-6 * (1 + expect[v]))
+            test_failed(g);
+}
+
+
+void betweenness_test()
+{
+    printf("betweenness test...\n");
+    fflush(stdout);
+
+    printf("   path"); fflush(stdout);
+    {
+        GraphSi<> g(5);
+        for (unsigned v = 0; v < 4; v++)
+            g.addEdge(v, v + 1, 1);
+        KtBetweenness<GraphSi<>> bc(g);
+        double expect[] = { 0, 3, 4, 3, 0 };
+        for (unsigned v = 0; v < 5; v++)
+            if (bc.centrality(v) != expect[v])
+                test_failed(g);
+        if (bc.normalized(2) != 4.0 / 6)
+            test_failed(g);
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   random digraph, unweighted"); fflush(stdout);
+    betweenness_test_<DigraphSi<>, unit_min_wtor<DigraphSi<>>>(gen_gnm<DigraphSi<>>(80, 300, 1));
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   random graph, unweighted"); fflush(stdout);
+    betweenness_test_<GraphSi<>, unit_min_wtor<GraphSi<>>>(gen_gnm<GraphSi<>>(80, 200, 2));
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   random digraph, weighted"); fflush(stdout);
+    betweenness_test_<DigraphSi<>, small_wtor<DigraphSi<>>>(gen_gnm<DigraphSi<>>(80, 300, 3));
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   random graph, weighted"); fflush(stdout);
+    betweenness_test_<GraphSi<>, small_wtor<GraphSi<>>>(gen_gnm<GraphSi<>>(80, 200, 4));
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   grid, weighted"); fflush(stdout);
+    betweenness_test_<GraphSi<>, default_wtor<GraphSi<>>>(gen_grid<GraphSi<>>(8, 9, 10, 0.3, 5));
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   sampling"); fflush(stdout);
+    {
+        using G = GraphSi<>;
+        auto g = gen_ba<G>(1000, 3, 6);
+        KtBetweenness<G> exact(g);
+
+        // 全部顶点作为样本时与精确计算一致
+        KtBetweenness<G> all(g, KtBetweenness<G>::sample(g.order(), g.order(), 7));
+        for (unsigned v = 0; v < g.order(); v++)
+            if (std::abs(all.centrality(v) - exact.centrality(v)) > 1e-6 * (1 + exact.centrality(v)))
+                test_failed(g);
+
+        auto k = KtBetweenness<G>::samplesFor(g.order(), 0.1, 0.01);
+        KtBetweenness<G> approx(g, KtBetweenness<G>::sample(g.order(), k, 8));
+        if (approx.samples() != k || approx.errorBound(0.01) <= 0)
+            test_failed(g);
+        auto bound = approx.errorBound(0.01);
+        for (unsigned v = 0; v < g.order(); v++)
+            if (std::abs(approx.centrality(v) - exact.centrality(v)) > bound)
+                test_failed(g);
+    }
+    printf("  > passed\n"); fflush(stdout);
+}
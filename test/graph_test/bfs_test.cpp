@@ -33,6 +33,37 @@ void bfs_test_(const GRAPH& g)
     }
 
     printf("  > passed\n"); fflush(stdout);
+
+
+    printf("      shared workspace");
+    fflush(stdout);
+    typename KtBfsIter<const GRAPH>::space_type space;
+    for (unsigned s = 0; s < g.order(); s += 7) {
+        KtBfsIter<const GRAPH> bfs3(g, s), bfs4(g, s, space);
+        for (; !bfs3.isEnd(); ++bfs3, ++bfs4)
+            if (bfs4.isEnd() || *bfs3 != *bfs4)
+                test_failed(g);
+        if (!bfs4.isEnd())
+            test_failed(g);
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+
+    printf("      copied iterator");
+    fflush(stdout);
+    {
+        // 自建工作空间的迭代器复制后，副本与原迭代器独立推进
+        KtBfsIter<const GRAPH> bfs5(g, 0);
+        for (unsigned i = 0; i < g.order() / 2 && !bfs5.isEnd(); i++)
+            ++bfs5;
+        auto bfs6 = bfs5;
+        for (; !bfs5.isEnd(); ++bfs5, ++bfs6)
+            if (bfs6.isEnd() || *bfs5 != *bfs6)
+                test_failed(g);
+        if (!bfs6.isEnd())
+            test_failed(g);
+    }
+    printf("  > passed\n"); fflush(stdout);
 }
 
 
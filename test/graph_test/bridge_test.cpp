@@ -55,4 +55,18 @@ void bridge_test()
     fflush(stdout);
     bridge_test_(rg);
     printf("  > passed\n"); fflush(stdout);
+
+    // 深度很大的路径，用于检验非递归实现
+    const unsigned N = 300000;
+    GraphSi<> pg(N);
+    for (unsigned v = 0; v + 1 < N; v++)
+        pg.addEdge(v, v + 1);
+    printf("   deep path V = %d, E = %d", pg.order(), pg.size());
+    fflush(stdout);
+    if (KtBridges(pg).size() != N - 1)
+        test_failed(pg);
+    pg.addEdge(0, N - 1); // 成环后没有桥
+    if (KtBridges(pg).size() != 0)
+        test_failed(pg);
+    printf("  > passed\n"); fflush(stdout);
 }
@@ -0,0 +1,177 @@
+#include <stdio.h>
+#include <set>
+#include <cmath>
+#include "GraphX.h"
+#include "core/KtTriangles.h"
+#include "core/KtCoreDecomposition.h"
+#include "util/graphgen.h"
+#include "test_util.h"
+
+
+// 去除自环和平行边后的邻接点集合
+template<typename GRAPH>
+std::vector<std::set<unsigned>> simple_adj_(const GRAPH& g)
+{
+    std::vector<std::set<unsigned>> adj(g.order());
+    for (unsigned v = 0; v < g.order(); v++)
+        for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter)
+            if (*iter != v)
+                adj[v].insert(*iter);
+    return adj;
+}
+
+
+// 逐对检查邻接点，计算包含各顶点的三角形数
+inline std::vector<std::uint64_t> naive_triangles_(const std::vector<std::set<unsigned>>& adj)
+{
+    std::vector<std::uint64_t> tri(adj.size(), 0);
+    for (unsigned v = 0; v < adj.size(); v++)
+        for (auto i = adj[v].begin(); i != adj[v].end(); ++i)
+            for (auto j = std::next(i); j != adj[v].end(); ++j)
+                if (adj[*i].count(*j))
+                    ++tri[v];
+    return tri;
+}
+
+
+// 对k = 1, 2, ...反复删除度小于k的顶点，顶点v的核数为其未被删除的最大的k
+inline std::vector<unsigned> naive_cores_(const std::vector<std::set<unsigned>>& adj)
+{
+    auto V = unsigned(adj.size());
+    std::vector<unsigned> core(V, 0);
+    std::vector<bool> alive(V, true);
+    std::vector<unsigned> deg(V);
+    for (unsigned v = 0; v < V; v++)
+        deg[v] = unsigned(adj[v].size());
+
+    for (unsigned k = 1; ; k++) {
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (unsigned v = 0; v < V; v++)
+                if (alive[v] && deg[v] < k) {
+                    alive[v] = false, changed = true;
+                    for (auto u : adj[v])
+                        --deg[u];
+                }
+        }
+
+        bool any = false;
+        for (unsigned v = 0; v < V; v++)
+            if (alive[v])
+                core[v] = k, any = true;
+        if (!any) break;
+    }
+
+    return core;
+}
+
+
+template<typename GRAPH>
+void clustering_test_(const GRAPH& g)
+{
+    auto adj = simple_adj_(g);
+    auto expect = naive_triangles_(adj);
+    std::uint64_t total(0);
+    for (auto t : expect) total += t;
+    total /= 3;
+
+    KtTriangles<GRAPH> tri(g, 3);
+    KtTriangles<GRAPH> tri1(g, 1);
+    if (tri.total() != total || tri1.total() != total)
+        test_failed(g);
+
+    double wedges(0), avg(0);
+    for (unsigned v = 0; v < g.order(); v++) {
+        if (tri.triangles(v) != expect[v] || tri1.triangles(v) != expect[v])
+            test_failed(g);
+        double d = double(adj[v].size());
+        double lc = d < 2 ? 0 : expect[v] / (d * (d - 1) / 2);
+        if (std::abs(tri.localClustering(v) - lc) > 1e-12)
+            test_failed(g);
+        wedges += d * (d - 1) / 2, avg += lc;
+    }
+    if (std::abs(tri.globalClustering() - (wedges > 0 ? 3 * total / wedges : 0)) > 1e-12 ||
+        std::abs(tri.averageClustering() - avg / g.order()) > 1e-12)
+        test_failed(g);
+
+    auto cores = naive_cores_(adj);
+    KtCoreDecomposition<GRAPH> kc(g, 3);
+    KtCoreDecomposition<GRAPH> kc1(g, 1);
+    if (kc.cores() != cores || kc1.cores() != cores)
+        test_failed(g);
+    if (kc.maxCore() != *std::max_element(cores.begin(), cores.end()))
+        test_failed(g);
+
+    // maxCore-core中各顶点在该子图内的度均不小于maxCore
+    auto k = kc.maxCore();
+    auto vs = kc.kcore(k);
+    std::set<unsigned> in(vs.begin(), vs.end());
+    for (auto v : vs) {
+        unsigned d(0);
+        for (auto u : adj[v])
+            d += unsigned(in.count(u));
+        if (d < k)
+            test_failed(g);
+    }
+}
+
+
+void clustering_test()
+{
+    printf("clustering test...\n");
+    fflush(stdout);
+
+    printf("   small graph"); fflush(stdout);
+    {
+        // 两个共用边0-1的三角形，外加一条悬挂边1-4
+        GraphSi<> g(5);
+        g.addEdge(0, 1, 1); g.addEdge(0, 2, 1); g.addEdge(1, 2, 1);
+        g.addEdge(0, 3, 1); g.addEdge(1, 3, 1); g.addEdge(1, 4, 1);
+        KtTriangles<GraphSi<>> tri(g);
+        if (tri.total() != 2 || tri.triangles(0) != 2 || tri.triangles(4) != 0)
+            test_failed(g);
+        if (tri.localClustering(0) != 2.0 / 3 || tri.localClustering(1) != 2.0 / 6)
+            test_failed(g);
+        if (std::abs(tri.globalClustering() - 6.0 / 11) > 1e-12) // 三元组数为3 + 6 + 1 + 1 + 0
+            test_failed(g);
+
+        KtCoreDecomposition<GraphSi<>> kc(g, 1);
+        std::vector<unsigned> expect{ 2, 2, 2, 2, 1 };
+        if (kc.cores() != expect || kc.maxCore() != 2)
+            test_failed(g);
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   random graph, sparse"); fflush(stdout);
+    clustering_test_(gen_gnm<GraphSi<>>(300, 2000, 1));
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   random graph, sorted"); fflush(stdout);
+    clustering_test_(gen_gnm<GraphSd<true>>(300, 3000, 2));
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   random graph, flat"); fflush(stdout);
+    clustering_test_(gen_gnm<GraphFf<true>>(300, 3000, 3));
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   power-law graph"); fflush(stdout);
+    clustering_test_(gen_rmat<GraphSd<true>>(10, 8000, 0.57, 0.19, 0.19, 4));
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   preferential attachment"); fflush(stdout);
+    clustering_test_(gen_ba<GraphSi<>>(2000, 5, 5));
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   multigraph with loops"); fflush(stdout);
+    {
+        auto g = gen_gnm<GraphPi<>>(200, 1200, 6);
+        for (unsigned v = 0; v < g.order(); v += 7) {
+            g.addEdge(v, v, 1);
+            if (g.outdegree(v) > 1)
+                g.addEdge(v, *KtAdjIter(g, v), 2);
+        }
+        clustering_test_(g);
+    }
+    printf("  > passed\n"); fflush(stdout);
+}
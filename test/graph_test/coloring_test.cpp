@@ -0,0 +1,134 @@
+#include <stdio.h>
+#include "GraphX.h"
+#include "core/KtColoring.h"
+#include "core/KtCoreDecomposition.h"
+#include "util/graphgen.h"
+#include "test_util.h"
+
+
+// 检查着色是否合法（自环除外），颜色数及各色顶点数是否与着色一致
+template<typename GRAPH>
+bool coloring_ok_(const GRAPH& g, const KtColoring<GRAPH>& col)
+{
+    std::vector<std::size_t> counts(col.numColors(), 0);
+    for (unsigned v = 0; v < g.order(); v++) {
+        if (col.color(v) >= col.numColors())
+            return false;
+        ++counts[col.color(v)];
+        for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter)
+            if (*iter != v && col.color(*iter) == col.color(v))
+                return false;
+    }
+
+    return counts == col.colorCounts() && col.check();
+}
+
+
+template<typename GRAPH>
+void coloring_test_(const GRAPH& g)
+{
+    using coloring = KtColoring<GRAPH>;
+
+    // 简单图中的最大度
+    unsigned md(0);
+    for (unsigned v = 0; v < g.order(); v++) {
+        std::vector<unsigned> adj;
+        for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter)
+            if (*iter != v)
+                adj.push_back(*iter);
+        std::sort(adj.begin(), adj.end());
+        md = std::max(md, unsigned(std::unique(adj.begin(), adj.end()) - adj.begin()));
+    }
+
+    for (auto order : { coloring::k_natural, coloring::k_largest_first, coloring::k_smallest_last, coloring::k_incidence }) {
+        coloring col(g, order);
+        if (!coloring_ok_(g, col) || col.numColors() > md + 1)
+            test_failed(g);
+    }
+
+    coloring sl(g, coloring::k_smallest_last);
+    if (sl.numColors() > KtCoreDecomposition<GRAPH>(g, 1).maxCore() + 1)
+        test_failed(g);
+
+    // Jones-Plassmann的结果与线程数无关
+    coloring jp(g, coloring::k_jones_plassmann, 3, 7);
+    coloring jp1(g, coloring::k_jones_plassmann, 1, 7);
+    if (!coloring_ok_(g, jp) || jp.colors() != jp1.colors() || jp.rounds() != jp1.rounds())
+        test_failed(g);
+    if (jp.numColors() > md + 1)
+        test_failed(g);
+
+    coloring sp(g, coloring::k_speculative, 3);
+    coloring sp1(g, coloring::k_speculative, 1);
+    if (!coloring_ok_(g, sp) || !coloring_ok_(g, sp1) || sp1.rounds() != 1)
+        test_failed(g);
+}
+
+
+void coloring_test()
+{
+    printf("coloring test...\n");
+    fflush(stdout);
+
+    printf("   complete graph & odd cycle"); fflush(stdout);
+    {
+        using G = GraphSi<>;
+        const unsigned n = 9;
+        G k(n), c(n);
+        for (unsigned v = 0; v < n; v++) {
+            for (unsigned w = v + 1; w < n; w++)
+                k.addEdge(v, w, 1);
+            c.addEdge(v, (v + 1) % n, 1);
+        }
+
+        for (auto order : { KtColoring<G>::k_natural, KtColoring<G>::k_largest_first,
+            KtColoring<G>::k_smallest_last, KtColoring<G>::k_incidence }) {
+            if (KtColoring<G>(k, order).numColors() != n)
+                test_failed(k);
+            if (KtColoring<G>(c, order).numColors() != 3)
+                test_failed(c);
+        }
+        if (KtColoring<G>(k, KtColoring<G>::k_jones_plassmann, 2).rounds() != n)
+            test_failed(k);
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   grid"); fflush(stdout);
+    {
+        // 连通的二分图，按行优先次序和incidence次序着色时，各顶点的已着色邻接点均位于另一侧，得到2-着色
+        auto g = gen_grid<GraphSi<>>(20, 30);
+        coloring_test_(g);
+        if (KtColoring<GraphSi<>>(g, KtColoring<GraphSi<>>::k_natural).numColors() != 2 ||
+            KtColoring<GraphSi<>>(g, KtColoring<GraphSi<>>::k_incidence).numColors() != 2)
+            test_failed(g);
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   random graph"); fflush(stdout);
+    coloring_test_(gen_gnm<GraphSi<>>(2000, 20000, 1));
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   random graph, flat"); fflush(stdout);
+    coloring_test_(gen_gnm<GraphFf<true>>(2000, 30000, 2));
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   power-law graph"); fflush(stdout);
+    coloring_test_(gen_rmat<GraphSd<true>>(12, 40000, 0.57, 0.19, 0.19, 3));
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   preferential attachment"); fflush(stdout);
+    coloring_test_(gen_ba<GraphSi<>>(5000, 4, 4));
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   multigraph with loops"); fflush(stdout);
+    {
+        auto g = gen_gnm<GraphPi<>>(500, 3000, 5);
+        for (unsigned v = 0; v < g.order(); v += 7) {
+            g.addEdge(v, v, 1);
+            if (g.outdegree(v) > 1)
+                g.addEdge(v, *KtAdjIter(g, v), 2);
+        }
+        coloring_test_(g);
+    }
+    printf("  > passed\n"); fflush(stdout);
+}
@@ -0,0 +1,142 @@
+#include <stdio.h>
+#include <thread>
+#include <random>
+#include <algorithm>
+#include "GraphX.h"
+#include "core/KtConcurrentGraph.h"
+#include "test_util.h"
+
+
+// 各顶点的出边(to, edge)排序后的列表
+template<typename GRAPH>
+std::vector<std::vector<std::pair<unsigned, int>>> sorted_adj_(const GRAPH& g)
+{
+    std::vector<std::vector<std::pair<unsigned, int>>> adj(g.order());
+    for (unsigned v = 0; v < g.order(); v++) {
+        for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter)
+            adj[v].emplace_back(*iter, int(iter.edge()));
+        std::sort(adj[v].begin(), adj[v].end());
+    }
+    return adj;
+}
+
+
+// 多个线程并发添加顶点和随机边，freeze后与串行构建的图比较
+template<bool digraph>
+void concurrent_graph_test_(unsigned nthreads, unsigned nv, unsigned edgesPerThread)
+{
+    using cgraph = KtConcurrentGraph<int, digraph>;
+    using G = typename cgraph::frozen_type;
+    using S = std::conditional_t<digraph, DigraphPx<int>, GraphPx<int>>;
+
+    cgraph cg(nv / 2);
+    std::vector<std::vector<unsigned>> newVertexes(nthreads);
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < nthreads; t++)
+        threads.emplace_back([&, t]() {
+            // 各线程新增一批顶点，然后添加边：端点取自初始顶点和本线程新增的顶点，边值唯一标识线程和序号
+            for (unsigned i = 0; i < nv / 2 / nthreads; i++)
+                newVertexes[t].push_back(cg.addVertex());
+            std::mt19937 rng(t);
+            for (unsigned i = 0; i < edgesPerThread; i++) {
+                auto pick = [&]() {
+                    auto r = rng() % (nv / 2 + newVertexes[t].size());
+                    return r < nv / 2 ? r : newVertexes[t][r - nv / 2];
+                };
+                unsigned from = pick(), to = pick();
+                cg.addEdge(from, to, int(t * edgesPerThread + i));
+            }
+        });
+    for (auto& th : threads)
+        th.join();
+
+    // 顶点序号各不相同
+    std::vector<unsigned> all;
+    for (auto& vs : newVertexes)
+        all.insert(all.end(), vs.begin(), vs.end());
+    std::sort(all.begin(), all.end());
+    if (std::unique(all.begin(), all.end()) != all.end() || cg.order() != nv / 2 + all.size())
+        test_failed(GraphSi<>(1));
+
+    // 由边值还原各条边，串行构建参照图
+    S expect(cg.order());
+    std::vector<std::tuple<unsigned, unsigned, int>> es;
+    for (unsigned v = 0; v < cg.order(); v++)
+        for (auto& e : cg.outedges(v))
+            if (digraph || e.first >= v)
+                es.emplace_back(v, e.first, e.second);
+    std::sort(es.begin(), es.end(), [](auto& a, auto& b) { return std::get<2>(a) < std::get<2>(b); });
+    if (es.size() != cg.size() || cg.size() != std::size_t(nthreads) * edgesPerThread)
+        test_failed(expect);
+    for (unsigned i = 0; i < es.size(); i++)
+        if (std::get<2>(es[i]) != int(i))
+            test_failed(expect);
+    for (auto& e : es)
+        expect.addEdge(std::get<0>(e), std::get<1>(e), std::get<2>(e));
+
+    G g = cg.freeze(3);
+    if (g.order() != expect.order() || g.size() != expect.size() || sorted_adj_(g) != sorted_adj_(expect))
+        test_failed(g, expect);
+
+    // freeze为其他图类型
+    auto s = cg.template freeze<S>(1);
+    if (s.size() != expect.size() || sorted_adj_(s) != sorted_adj_(expect))
+        test_failed(s, expect);
+}
+
+
+void concurrent_graph_test()
+{
+    printf("concurrent graph test...\n");
+    fflush(stdout);
+
+    printf("   empty graph"); fflush(stdout);
+    {
+        KtConcurrentGraph<int> cg;
+        auto g = cg.freeze();
+        if (g.order() != 0 || g.size() != 0)
+            test_failed(GraphSi<>(1));
+
+        // 跨越多个段的顶点
+        cg.addVertices(5000);
+        cg.addEdge(4999, 0, 1);
+        cg.addEdge(1023, 1024, 2);
+        cg.addEdge(3071, 3071, 3);
+        auto h = cg.freeze();
+        if (h.order() != 5000 || h.size() != 3 || !h.hasEdge(0, 4999) || !h.hasEdge(1024, 1023) || !h.hasEdge(3071, 3071))
+            test_failed(h);
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   graph"); fflush(stdout);
+    concurrent_graph_test_<false>(8, 2000, 20000);
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   digraph"); fflush(stdout);
+    concurrent_graph_test_<true>(8, 2000, 20000);
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   few stripes"); fflush(stdout);
+    {
+        // 所有行共用2个锁，仍应正确
+        KtConcurrentGraph<int, true> cg(100, 2);
+        std::vector<std::thread> threads;
+        for (unsigned t = 0; t < 6; t++)
+            threads.emplace_back([&cg, t]() {
+                for (unsigned i = 0; i < 10000; i++)
+                    cg.addEdge((t + i) % 100, i % 100, 1);
+            });
+        for (auto& th : threads)
+            th.join();
+
+        auto g = cg.freeze();
+        if (g.size() != 60000 || cg.size() != 60000)
+            test_failed(GraphSi<>(1));
+        std::size_t deg(0);
+        for (unsigned v = 0; v < 100; v++)
+            deg += cg.outdegree(v);
+        if (deg != 60000)
+            test_failed(GraphSi<>(1));
+    }
+    printf("  > passed\n"); fflush(stdout);
+}
@@ -1,7 +1,52 @@
 #include <stdio.h>
 #include "GraphX.h"
 #include "core/KtConnected.h"
+#include "core/KtConnectedParallel.h"
+#include "util/randgen.h"
 #include "test_util.h"
+#include <thread>
+
+
+// 并行算法的分量编号应与KtConnected完全一致
+template<typename GRAPH>
+void parallel_connected_test_(const GRAPH& g)
+{
+    KtConnected<GRAPH> cc(g);
+    KtConnectedAfforest<GRAPH> acc(g, 4);
+    printf("      afforest: %d components", int(acc.count()));
+    fflush(stdout);
+    if (acc.count() != cc.count())
+        test_failed(g);
+    for (unsigned v = 0; v < g.order(); v++)
+        if (acc[v] != cc[v])
+            test_failed(g);
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("      incremental");
+    fflush(stdout);
+    KtConnectedIncremental<> inc(g.order());
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < 4; t++)
+        threads.emplace_back([&g, &inc, t]() {
+            for (unsigned v = t; v < g.order(); v += 4) {
+                auto iter = KtAdjIter(g, v);
+                for (; !iter.isEnd(); ++iter) {
+                    inc.addEdge(v, *iter);
+                    if (!inc.connected(*iter, v)) // 已插入的边，两端顶点必然连通
+                        abort();
+                }
+            }
+        });
+    for (auto& t : threads)
+        t.join();
+    if (inc.count() != cc.count())
+        test_failed(g);
+    for (unsigned v = 0; v < g.order(); v += 7)
+        for (unsigned w = 0; w < g.order(); w += 11)
+            if (inc.connected(v, w) != cc.reachable(v, w))
+                test_failed(g);
+    printf("  > passed\n"); fflush(stdout);
+}
 
 
 void connected_component_test()
@@ -25,4 +70,17 @@ void connected_component_test()
     if(cc.count() != 3)
         test_failed(g);
     printf("  > passed\n"); fflush(stdout);
+    parallel_connected_test_(g);
+
+    // 含大量小分量的稀疏图
+    auto sg = randgen<GraphFi<>>(5000, 3000);
+    printf("   random sparse graph V = %d, E = %d\n", sg.order(), sg.size());
+    fflush(stdout);
+    parallel_connected_test_(sg);
+
+    // 含巨型分量的图
+    auto dg = randgen<GraphFi<>>(5000, 15000);
+    printf("   random graph V = %d, E = %d\n", dg.order(), dg.size());
+    fflush(stdout);
+    parallel_connected_test_(dg);
 }
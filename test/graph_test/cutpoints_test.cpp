@@ -57,4 +57,15 @@ void cutpoints_test()
     cutpoints_test_(rg);
     printf("  > passed\n"); fflush(stdout);
 
+    // 深度很大的路径，用于检验非递归实现
+    const unsigned N = 300000;
+    GraphSi<> pg(N);
+    for (unsigned v = 0; v + 1 < N; v++)
+        pg.addEdge(v, v + 1);
+    printf("   deep path V = %d, E = %d", pg.order(), pg.size());
+    fflush(stdout);
+    if (KtCutPoints(pg).size() != N - 2)
+        test_failed(pg);
+    printf("  > passed\n"); fflush(stdout);
+
 }
@@ -45,6 +45,36 @@ void dfs_test_(const GRAPH& g)
             test_failed(g);
     }
     printf("  > passed\n"); fflush(stdout);
+
+    printf("      shared workspace");
+    fflush(stdout);
+    typename KtDfsIter<const GRAPH>::space_type space;
+    for (unsigned s = 0; s < g.order(); s += 7) {
+        KtDfsIter<const GRAPH, false, false, true> dfs4(g, s), dfs5(g, s, space);
+        for (; !dfs4.isEnd(); ++dfs4, ++dfs5)
+            if (dfs5.isEnd() || *dfs4 != *dfs5 || dfs4.isPopping() != dfs5.isPopping())
+                test_failed(g);
+        if (!dfs5.isEnd())
+            test_failed(g);
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+
+    printf("      copied iterator");
+    fflush(stdout);
+    {
+        // 自建工作空间的迭代器复制后，副本与原迭代器独立推进
+        KtDfsIter<const GRAPH, false, false, true> dfs6(g, 0);
+        for (unsigned i = 0; i < g.order() && !dfs6.isEnd(); i++)
+            ++dfs6;
+        auto dfs7 = dfs6;
+        for (; !dfs6.isEnd(); ++dfs6, ++dfs7)
+            if (dfs7.isEnd() || *dfs6 != *dfs7 || dfs6.isPopping() != dfs7.isPopping())
+                test_failed(g);
+        if (!dfs7.isEnd())
+            test_failed(g);
+    }
+    printf("  > passed\n"); fflush(stdout);
 }
 
 
@@ -27,9 +27,9 @@ bool is_euler_path(const GRAPH& g, const std::vector<unsigned>& path)
 }
 
 
-// r = 0ʾgΪŷͼ
-// r = 1ʾgŷ
-// r = 2ʾgŷ·
+// r = 0，表示g为非欧拉图
+// r = 1，表示g存在欧拉环
+// r = 2，表示g存在欧拉路径
 template<typename GRAPH>
 void verify(const GRAPH& g, int r)
 {
@@ -58,7 +58,7 @@ void euler_test()
     printf("euler test...\n");
     fflush(stdout);
 
-    // 
+    // 七桥问题测试
     {
         GraphPi<> g(5);
         g.addEdge(0, 1), g.addEdge(0, 1), g.addEdge(0, 2), g.addEdge(0, 2), g.addEdge(0, 4);
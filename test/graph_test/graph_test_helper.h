@@ -18,39 +18,41 @@ bool equal_test(const G1& g1, const G2& g2)
 
 
     if (g1.size() != g2.size()) {
-        printf("size disagree: %d vs %d ", g1.size(), g2.size());
+        printf("size disagree: %d vs %d ", 
+            static_cast<unsigned>(g1.size()), 
+            static_cast<unsigned>(g2.size()));
         return false;
     }
 
 
-    // ĳȱȽ
+    // 各顶点的出度比较
     for (unsigned v = 0; v < g1.order(); v++) {
         if (g1.outdegree(v) != g2.outdegree(v)) {
             printf("outdegree of vertex %d disagree: %d vs %d ", v, 
-                g1.outdegree(v), g2.outdegree(v));
+                static_cast<unsigned>(g1.outdegree(v)), static_cast<unsigned>(g2.outdegree(v)));
             return false;
         }
     }
 
-    // ȱȽ
+    // 各顶点的入度比较
     for (unsigned v = 0; v < g1.order(); v++) {
         if (g1.indegree(v) != g2.indegree(v)) {
             printf("indegree of vertex %d disagree: %d vs %d ", v,
-                g1.indegree(v), g2.indegree(v));
+                static_cast<unsigned>(g1.indegree(v)), static_cast<unsigned>(g2.indegree(v)));
             return false;
         }
     }
 
-    // ĶȱȽ
+    // 各顶点的度比较
     for (unsigned v = 0; v < g1.order(); v++) {
         if (g1.degree(v) != g2.degree(v)) {
             printf("degree of vertex %d disagree: %d vs %d ", v,
-                g1.degree(v), g2.degree(v));
+                static_cast<unsigned>(g1.degree(v)), static_cast<unsigned>(g2.degree(v)));
             return false;
         }
     }
 
-    // ԵedgesȽ
+    // 各顶点对的edges比较
     for (unsigned v = 0; v < g1.order(); v++) {
         for (unsigned w = 0; w < g1.order(); w++) {
             if (g1.hasEdge(v, w) != g2.hasEdge(v, w)) {
@@ -101,7 +103,7 @@ bool equal_test(const G1& g1, const G2& g2)
         }
     }
 
-    // ֵȽ
+    // 各顶点值比较
     if constexpr (!std::is_void_v<typename G1::vertex_type>
         && !std::is_void_v<typename G2::vertex_type>) {
         for(unsigned v = 0; v < g1.order(); v++)
@@ -118,7 +120,7 @@ bool equal_test(const G1& g1, const G2& g2)
 template<typename G1, typename G2>
 void graph_test_helper()
 {
-    // ƶ200-800Χ
+    // 控制顶点数量在200-800范围内
     unsigned V = rand();
     V %= 800;
     if (V < 200) V += 200;
@@ -127,7 +129,7 @@ void graph_test_helper()
 
     printf("      random init graph: "); fflush(stdout);
     auto E = V * V / 10;
-    if(E > 60000) E = 60000; // 60000
+    if(E > 60000) E = 60000; // 不超过60000条边
     g1 = randgen<G1>(V, E);
     printf("V = %d, E = %d ", static_cast<unsigned>(g1.order()), g1.size());  fflush(stdout);
     copy(g1, g2);
@@ -140,11 +142,11 @@ void graph_test_helper()
     printf("      random erase edges: ");  fflush(stdout);
     for (unsigned i = 0; i < V; i++)
         for (unsigned j = 0; j < V; j++)
-            if (g1.hasEdge(i, j) && rand_p(0.5)) { // 50%ĸɾ
+            if (g1.hasEdge(i, j) && rand_p(0.5)) { // 以50%的概率删除边
                 if constexpr (g1.isMultiEdges() && g2.isMultiEdges()) {
                     decltype(auto) r = g1.edges(i, j);
-                    if (r.size() > 1) { // 
-                        // ɾض
+                    if (r.size() > 1) { // 多边
+                        // 删除特定边
                         int pos = rand() % r.size();
                         while (pos--)
                             ++r;
@@ -192,7 +194,7 @@ void graph_test_helper()
     printf("      random add edges: "); fflush(stdout);
     for (unsigned i = 0; i < V; i++)
         for (unsigned j = 0; j < V; j++)
-            if (!g1.hasEdge(i, j) && rand_p(0.1)) { // 10%ĸӱ
+            if (!g1.hasEdge(i, j) && rand_p(0.1)) { // 以10%的概率添加边
                 int r = 0;
                 while (r == 0) r = rand();
                 using edge_type = typename G1::edge_type;
@@ -207,7 +209,7 @@ void graph_test_helper()
 
 
     printf("      random erase vertex: "); fflush(stdout);
-    for (unsigned i = 0; i < V / 10; i++) { // ɾ1/10Ķ
+    for (unsigned i = 0; i < V / 10; i++) { // 删除1/10的顶点
         unsigned v = rand() % g1.order();
         unsigned numVertex(g1.order());
         unsigned numEdge(g1.size());
@@ -215,25 +217,25 @@ void graph_test_helper()
         g1.eraseVertex(v); g2.eraseVertex(v);
         if (g1.order() != numVertex - 1) {
             printf("number of g1's vertex disagree, expected %d but got %d", 
-                numVertex - 1, g1.order());
+                static_cast<unsigned>(numVertex - 1), static_cast<unsigned>(g1.order()));
             test_failed(g1);
         }
 
-        // ͼбһԵļ⣬ͼg1.size() == numEdge - degreeԻ
+        // 仅对无向图进行边数量一致性的检测，对于有向图g1.size() == numEdge - degree不成立（考虑自环）
         if (!g1.isDigraph() && g1.size() != numEdge - degree) {
             printf("number of g1's edges disagree, expected %d but got %d", 
-                numEdge - degree, g1.size());
+                static_cast<unsigned>(numEdge - degree), static_cast<unsigned>(g1.size()));
             test_failed(g1);
         }
 
         if (g2.order() != numVertex - 1) {
             printf("number of g2's vertex disagree, expected %d but got %d", 
-                numVertex - 1, g2.order());
+                static_cast<unsigned>(numVertex - 1), static_cast<unsigned>(g2.order()));
             test_failed(g1);
         }
         if (!g2.isDigraph() && g2.size() != numEdge - degree) {
             printf("number of g2's edges disagree, expected %d but got %d", 
-                numEdge - degree, g2.size());
+                static_cast<unsigned>(numEdge - degree), static_cast<unsigned>(g2.size()));
             test_failed(g2);
         }
     }
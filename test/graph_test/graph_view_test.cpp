@@ -0,0 +1,118 @@
+#include <stdio.h>
+#include <vector>
+#include "GraphX.h"
+#include "core/KtGraphView.h"
+#include "core/KtConnected.h"
+#include "core/KtStronglyConnected.h"
+#include "util/inverse.h"
+#include "graph_test_helper.h"
+
+
+// 视图与等价的实体图上，由顶点0可达的顶点集应一致
+template<typename G1, typename G2>
+static bool same_bfs_(const G1& g1, const G2& g2)
+{
+    KtBfsIter<const G1> iter1(g1, 0);
+    KtBfsIter<const G2> iter2(g2, 0);
+    std::vector<unsigned> v1, v2;
+    for (; !iter1.isEnd(); ++iter1) v1.push_back(*iter1);
+    for (; !iter2.isEnd(); ++iter2) v2.push_back(*iter2);
+    std::sort(v1.begin(), v1.end());
+    std::sort(v2.begin(), v2.end());
+    return v1 == v2;
+}
+
+
+template<typename DIGRAPH>
+static void digraph_view_test_()
+{
+    auto dg = randgen<DIGRAPH>(300, 1500);
+    using edge_type = typename DIGRAPH::edge_type;
+
+    printf("   reverse view: "); fflush(stdout);
+    auto rv = reverse_view(dg);
+    auto rg = inverse<DIGRAPH, DigraphPx<edge_type>>(dg);
+    if (!equal_test(rv, rg) || !same_bfs_(rv, rg))
+        test_failed(dg);
+    KtStronglyConnectedTar<DIGRAPH> scc(dg);
+    KtStronglyConnectedTar<decltype(rv)> rscc(rv);
+    if (scc.count() != rscc.count())
+        test_failed(dg);
+    for (unsigned v = 0; v < dg.order(); v++)
+        for (unsigned w = 0; w < dg.order(); w++)
+            if (scc.reachable(v, w) != rscc.reachable(v, w))
+                test_failed(dg);
+    printf("passed\n");
+
+    printf("   undirected view: "); fflush(stdout);
+    auto uv = undirected_view(dg);
+    GraphPx<edge_type> ug(dg.order());
+    for (unsigned v = 0; v < dg.order(); v++)
+        for (auto iter = KtAdjIter(dg, v); !iter.isEnd(); ++iter)
+            ug.addEdge(v, *iter, iter.edge());
+    if (!equal_test(uv, ug) || !same_bfs_(uv, ug))
+        test_failed(dg);
+    KtConnected<decltype(uv)> cc(uv);
+    KtConnected<decltype(ug)> cc2(ug);
+    if (cc.count() != cc2.count())
+        test_failed(dg);
+    printf("passed\n");
+}
+
+
+template<typename GRAPH>
+static void filtered_view_test_()
+{
+    auto g = randgen<GRAPH>(300, 3000);
+    using edge_type = typename GRAPH::edge_type;
+
+    printf("   filtered view: "); fflush(stdout);
+    auto pred = [](unsigned, unsigned, const edge_type& e) { return e < 0.5; };
+    auto fv = filtered_view(g, pred);
+    GRAPH fg(g.order());
+    for (unsigned v = 0; v < g.order(); v++)
+        for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter)
+            if ((g.isDigraph() || *iter >= v) && iter.edge() < 0.5)
+                fg.addEdge(v, *iter, iter.edge());
+    if (!equal_test(fv, fg) || !same_bfs_(fv, fg))
+        test_failed(g, fg);
+    printf("passed\n");
+
+    printf("   induced view: "); fflush(stdout);
+    std::vector<unsigned> sub; // 子集取奇数顶点，并逆序编号
+    for (unsigned v = g.order() - 1; v < g.order(); v--)
+        if (v % 2 == 1) sub.push_back(v);
+    KtInducedView<GRAPH> iv(g, sub.begin(), sub.end());
+    GRAPH ig(unsigned(sub.size()));
+    for (unsigned i = 0; i < sub.size(); i++)
+        for (auto iter = KtAdjIter(g, sub[i]); !iter.isEnd(); ++iter)
+            if (iv.localOf(*iter) != GRAPH::null_vertex
+                && (g.isDigraph() || iv.localOf(*iter) >= i))
+                ig.addEdge(i, iv.localOf(*iter), iter.edge());
+    if (!equal_test(iv, ig) || !same_bfs_(iv, ig))
+        test_failed(g, ig);
+    for (unsigned i = 0; i < sub.size(); i++)
+        if (iv.globalOf(i) != sub[i] || iv.localOf(sub[i]) != i)
+            test_failed(g, ig);
+    printf("passed\n");
+}
+
+
+void graph_view_test()
+{
+    printf("graph view test...\n");
+
+    printf("  DigraphSf: \n");
+    digraph_view_test_<DigraphSf<>>();
+    filtered_view_test_<DigraphSf<>>();
+
+    printf("  DigraphCf: \n");
+    digraph_view_test_<DigraphCf<>>();
+    filtered_view_test_<DigraphCf<>>();
+
+    printf("  DigraphDf: \n");
+    digraph_view_test_<DigraphDf>();
+
+    printf("  GraphFf: \n");
+    filtered_view_test_<GraphFf<>>();
+}
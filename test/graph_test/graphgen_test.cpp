@@ -0,0 +1,156 @@
+#include <stdio.h>
+#include "GraphX.h"
+#include "util/graphgen.h"
+#include "util/loop.h"
+#include "test_util.h"
+#include "graph_test_helper.h"
+
+
+// 生成结果应只取决于seed，与线程数无关
+template<typename GRAPH, typename GEN>
+void deterministic_test_(GEN gen)
+{
+    auto g1 = gen(1u), g2 = gen(4u);
+    if (g1.order() != g2.order() || g1.size() != g2.size())
+        test_failed(g1, g2);
+
+    // equal_test需计算入度，对大图过慢，这里直接逐个比较邻接表
+    for (unsigned v = 0; v < g1.order(); v++) {
+        auto i1 = KtAdjIter(g1, v);
+        auto i2 = KtAdjIter(g2, v);
+        for (; !i1.isEnd() && !i2.isEnd(); ++i1, ++i2)
+            if (*i1 != *i2 || i1.edge() != i2.edge())
+                test_failed(g1, g2);
+        if (!i1.isEnd() || !i2.isEnd())
+            test_failed(g1, g2);
+    }
+}
+
+
+// 非多重边图不应有自环和重复边
+template<typename GRAPH>
+void simple_test_(const GRAPH& g)
+{
+    if (has_selfloop(g))
+        test_failed(g);
+
+    for (unsigned v = 0; v < g.order(); v++) {
+        std::vector<unsigned> adj;
+        for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter)
+            adj.push_back(*iter);
+        std::sort(adj.begin(), adj.end());
+        if (std::adjacent_find(adj.begin(), adj.end()) != adj.end())
+            test_failed(g);
+    }
+}
+
+
+void graphgen_test()
+{
+    printf("graph generator test...\n");
+    fflush(stdout);
+
+    printf("   gnm"); fflush(stdout);
+    {
+        auto g = gen_gnm<DigraphSd<>>(2000, 20000, 7);
+        if (g.order() != 2000 || g.size() != 20000)
+            test_failed(g);
+        simple_test_(g);
+
+        auto ug = gen_gnm<GraphSd<>>(2000, 20000, 7);
+        if (ug.size() != 20000)
+            test_failed(ug);
+        simple_test_(ug);
+
+        // 完全图
+        auto k = gen_gnm<DigraphSi<>>(30, 10000, 7);
+        if (k.size() != 30 * 29)
+            test_failed(k);
+
+        deterministic_test_<DigraphSd<>>([](unsigned n) { return gen_gnm<DigraphSd<>>(1000, 200000, 3, n); });
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   gnp"); fflush(stdout);
+    {
+        // 期望边数为p*V*(V-1) = 39980，偏差超过5倍标准差视为失败
+        auto g = gen_gnp<DigraphSd<>>(2000, 0.01, 11);
+        if (g.size() < 39000 || g.size() > 41000)
+            test_failed(g);
+        simple_test_(g);
+
+        auto ug = gen_gnp<GraphSd<>>(2000, 0.01, 11);
+        if (ug.size() < 19300 || ug.size() > 20700)
+            test_failed(ug);
+        simple_test_(ug);
+
+        if (gen_gnp<DigraphSi<>>(50, 1).size() != 50 * 49 || gen_gnp<GraphSi<>>(50, 1).size() != 50 * 49 / 2)
+            test_failed(g);
+
+        deterministic_test_<GraphSd<>>([](unsigned n) { return gen_gnp<GraphSd<>>(5000, 0.02, 5, n); });
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   rmat"); fflush(stdout);
+    {
+        auto g = gen_rmat<DigraphSd<>>(12, 40000, 0.57, 0.19, 0.19, 13);
+        if (g.order() != 4096 || g.size() > 40000 || g.size() < 20000)
+            test_failed(g);
+        simple_test_(g);
+
+        // 度分布应明显偏斜
+        unsigned maxDeg(0);
+        for (unsigned v = 0; v < g.order(); v++)
+            maxDeg = std::max<unsigned>(maxDeg, g.outdegree(v));
+        if (maxDeg < 10 * g.size() / g.order())
+            test_failed(g);
+
+        deterministic_test_<GraphSd<>>([](unsigned n) { return gen_rmat<GraphSd<>>(14, 300000, 0.57, 0.19, 0.19, 1, n); });
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   barabasi-albert"); fflush(stdout);
+    {
+        auto g = gen_ba<GraphSd<>>(5000, 3, 17);
+        if (g.order() != 5000 || g.size() > 15000 || g.size() < 14000)
+            test_failed(g);
+        simple_test_(g);
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   grid"); fflush(stdout);
+    {
+        const unsigned R = 40, C = 60;
+        auto g = gen_grid<DigraphSi<>>(R, C, 100, 0.2, 19);
+        if (g.order() != R * C || g.size() != 2 * (R * (C - 1) + C * (R - 1)))
+            test_failed(g);
+        for (unsigned v = 0; v < g.order(); v++) {
+            unsigned r = v / C, c = v % C;
+            unsigned deg = (r > 0) + (r + 1 < R) + (c > 0) + (c + 1 < C);
+            if (g.outdegree(v) != deg)
+                test_failed(g);
+            for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter)
+                if (iter.edge() < 80 || iter.edge() > 120)
+                    test_failed(g);
+        }
+
+        deterministic_test_<GraphSd<>>([](unsigned n) { return gen_grid<GraphSd<>>(500, 300, 1, 0.3, 23, n); });
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   dag"); fflush(stdout);
+    {
+        auto g = gen_dag<DigraphSd<>>(3000, 30000, true, 29);
+        if (g.size() != 30000 || has_loop(g))
+            test_failed(g);
+
+        auto sorted = gen_dag<DigraphSd<>>(3000, 30000, false, 29);
+        for (unsigned v = 0; v < sorted.order(); v++)
+            for (auto iter = KtAdjIter(sorted, v); !iter.isEnd(); ++iter)
+                if (*iter <= v)
+                    test_failed(sorted);
+
+        deterministic_test_<DigraphSd<>>([](unsigned n) { return gen_dag<DigraphSd<>>(2000, 150000, true, 31, n); });
+    }
+    printf("  > passed\n"); fflush(stdout);
+}
@@ -68,4 +68,37 @@ void layout_test()
 
     printf("   DigraphSf vs DigraphPf<sorted>...\n"); fflush(stdout);
     graph_test_helper<DigraphSf<>, DigraphPf<true>>();
+
+
+    // 非缺省的顶点/边索引宽度
+    using GraphS16 = KtGraphX<KtGraph<KtAdjGraphSparseImpl<float, void, std::uint16_t, std::uint32_t>, false, false, false>>;
+    using DigraphD16 = KtGraphX<KtGraph<KtAdjGraphDenseImpl<float, void, std::uint16_t, std::uint32_t>, true, false, false>>;
+    using GraphF64 = KtGraphX<KtGraph<KtFlatGraphVectorImpl<float, void, std::uint32_t, std::uint64_t>, false, true, true>>;
+    using DigraphF16 = KtGraphX<KtGraph<KtFlatGraphVectorImpl<float, void, std::uint16_t, std::uint64_t>, true, true, false>>;
+
+    printf("   GraphSf vs GraphSf<uint16>...\n"); fflush(stdout);
+    graph_test_helper<GraphSf<>, GraphS16>();
+
+    printf("   DigraphDf vs DigraphDf<uint16>...\n"); fflush(stdout);
+    graph_test_helper<DigraphDf, DigraphD16>();
+
+    printf("   GraphFf<sorted> vs GraphFf<uint64, sorted>...\n"); fflush(stdout);
+    graph_test_helper<GraphFf<true>, GraphF64>();
+
+    printf("   DigraphFf vs DigraphFf<uint16, uint64>...\n"); fflush(stdout);
+    graph_test_helper<DigraphFf<>, DigraphF16>();
+
+
+    // SoA边存储
+    printf("   GraphFf vs GraphCf...\n"); fflush(stdout);
+    graph_test_helper<GraphFf<>, GraphCf<>>();
+
+    printf("   GraphPf vs GraphCf<sorted>...\n"); fflush(stdout);
+    graph_test_helper<GraphPf<>, GraphCf<true>>();
+
+    printf("   DigraphFf vs DigraphCf...\n"); fflush(stdout);
+    graph_test_helper<DigraphFf<>, DigraphCf<>>();
+
+    printf("   DigraphSf<sorted> vs DigraphCf<sorted>...\n"); fflush(stdout);
+    graph_test_helper<DigraphSf<true>, DigraphCf<true>>();
 }
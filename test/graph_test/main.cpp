@@ -17,7 +17,18 @@ extern void min_span_tree_test();
 extern void shortest_path_test();
 extern void maxflow_test();
 extern void resort_test();
+extern void reorder_test();
 extern void euler_test();
+extern void graph_view_test();
+extern void graphgen_test();
+extern void pagerank_test();
+extern void betweenness_test();
+extern void clustering_test();
+extern void coloring_test();
+extern void assignment_test();
+extern void partition_test();
+extern void concurrent_graph_test();
+extern void versioned_graph_test();
 
 
 int main(int argc, char const *argv[])
@@ -38,6 +49,17 @@ int main(int argc, char const *argv[])
     shortest_path_test(); printf("\n");
     maxflow_test(); printf("\n");
     resort_test(); printf("\n");
+    reorder_test(); printf("\n");
+    graph_view_test(); printf("\n");
+    graphgen_test(); printf("\n");
+    pagerank_test(); printf("\n");
+    betweenness_test(); printf("\n");
+    clustering_test(); printf("\n");
+    coloring_test(); printf("\n");
+    assignment_test(); printf("\n");
+    partition_test(); printf("\n");
+    concurrent_graph_test(); printf("\n");
+    versioned_graph_test(); printf("\n");
     
     printf(" :) All passed! press any key to exit.\n");
     getchar();
@@ -1,6 +1,8 @@
 #include <stdio.h>
 #include "GraphX.h"
 #include "core/KtMaxFlow.h"
+#include "core/KtMinCostFlow.h"
+#include "util/graphgen.h"
 #include "util/sources.h"
 #include "util/sinks.h"
 #include "util/feasible.h"
@@ -42,6 +44,70 @@ void maxflow_test_(const G& g)
 }
 
 
+// 以整数边值e编码容量和单位费用：容量为e / 1000，费用为e % 1000 - offset
+struct mcf_cap_
+{
+    using weight_type = int;
+    int operator()(int e) const { return e / 1000; }
+};
+
+template<int offset>
+struct mcf_cost_
+{
+    using weight_type = int;
+    int operator()(int e) const { return e % 1000 - offset; }
+};
+
+using mcf_cap_wtor = KtWeightorMin<mcf_cap_, KtAdder<int>>;
+template<int offset>
+using mcf_cost_wtor = KtWeightorMin<mcf_cost_<offset>, KtAdder<int>>;
+
+
+// 流是最小费用的，当且仅当余留网中没有负费用的环，以Bellman-Ford算法检测
+template<typename G, typename MCF, typename COST>
+bool mcf_optimal_(const G& g, const MCF& mcf, COST cost)
+{
+    std::vector<std::tuple<unsigned, unsigned, long long>> arcs;
+    for (unsigned v = 0; v < g.order(); v++)
+        for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter) {
+            auto f = mcf.flow(v, *iter);
+            if (f < mcf_cap_{}(iter.edge())) arcs.emplace_back(v, *iter, cost(iter.edge()));
+            if (f > 0) arcs.emplace_back(*iter, v, -cost(iter.edge()));
+        }
+
+    std::vector<long long> dist(g.order(), 0);
+    for (unsigned i = 0; i <= g.order(); i++) {
+        bool relaxed = false;
+        for (auto& a : arcs)
+            if (dist[std::get<0>(a)] + std::get<2>(a) < dist[std::get<1>(a)]) {
+                dist[std::get<1>(a)] = dist[std::get<0>(a)] + std::get<2>(a);
+                relaxed = true;
+            }
+        if (!relaxed)
+            return true;
+    }
+
+    return false;
+}
+
+
+template<int offset, typename G>
+void mincost_flow_test_(const G& g, unsigned s, unsigned t)
+{
+    KtMinCostFlowSsp<G, mcf_cap_wtor, mcf_cost_wtor<offset>> ssp(g, s, t);
+    KtMinCostFlowScaling<G, mcf_cap_wtor, mcf_cost_wtor<offset>> cs(g, s, t);
+    if (!ssp.check() || !cs.check())
+        test_failed(g);
+
+    // 两种算法的流值（后者由Dinic算法求得）和总费用应一致
+    if (ssp.totalFlow() != cs.totalFlow() || ssp.totalCost() != cs.totalCost())
+        test_failed(g);
+
+    if (!mcf_optimal_(g, ssp, mcf_cost_<offset>{}) || !mcf_optimal_(g, cs, mcf_cost_<offset>{}))
+        test_failed(g);
+}
+
+
 // TODO: 构造测试最大流算法的随机图
 void maxflow_test()
 {
@@ -91,4 +157,39 @@ void maxflow_test()
     if (res.size() != 6)
         test_failed(gm);
     printf("  > passed\n"); fflush(stdout);
+
+
+    printf("    min cost flow test..."); fflush(stdout);
+    {
+        DigraphSi<> g(4); // 容量和费用编码为cap * 1000 + cost
+        g.addEdge(0, 1, 4001), g.addEdge(0, 2, 2005);
+        g.addEdge(1, 2, 2001), g.addEdge(1, 3, 2003);
+        g.addEdge(2, 3, 4001);
+        KtMinCostFlowSsp<DigraphSi<>, mcf_cap_wtor, mcf_cost_wtor<0>> ssp(g, 0, 3);
+        KtMinCostFlowScaling<DigraphSi<>, mcf_cap_wtor, mcf_cost_wtor<0>> cs(g, 0, 3);
+        if (ssp.totalFlow() != 6 || ssp.totalCost() != 26 || ssp.flow(1, 2) != 2 || ssp.cost(0, 2) != 10)
+            test_failed(g);
+        if (cs.totalFlow() != 6 || cs.totalCost() != 26 || cs.flow(1, 2) != 2 || cs.cost(0, 2) != 10)
+            test_failed(g);
+
+        // 流量上限：先沿0-1-2-3增广2，再沿0-1-3增广1
+        KtMinCostFlowSsp<DigraphSi<>, mcf_cap_wtor, mcf_cost_wtor<0>> half(g, 0, 3, 3);
+        if (half.totalFlow() != 3 || half.totalCost() != 2 * 3 + 4 || !half.check())
+            test_failed(g);
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("    min cost flow random digraph..."); fflush(stdout);
+    for (unsigned i = 0; i < 3; i++) {
+        auto g = gen_gnm<DigraphSi<>>(300, 3000, i);
+        mincost_flow_test_<0>(g, 0, 299);
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("    min cost flow random dag with negative cost..."); fflush(stdout);
+    for (unsigned i = 0; i < 3; i++) {
+        auto g = gen_dag<DigraphSi<>>(300, 3000, false, i);
+        mincost_flow_test_<500>(g, 0, 299);
+    }
+    printf("  > passed\n"); fflush(stdout);
 }
@@ -0,0 +1,130 @@
+#include <stdio.h>
+#include <cmath>
+#include "GraphX.h"
+#include "core/KtPageRank.h"
+#include "util/graphgen.h"
+#include "test_util.h"
+
+
+// 逐顶点沿出边推送的朴素幂迭代，作为对照
+template<typename GRAPH>
+std::vector<double> naive_pagerank_(const GRAPH& g, const std::vector<double>& tele, double d, unsigned iters)
+{
+    auto V = g.order();
+    std::vector<double> r(tele);
+    for (unsigned i = 0; i < iters; i++) {
+        std::vector<double> next(V, 0);
+        double dangling(0);
+        for (unsigned v = 0; v < V; v++) {
+            auto deg = g.outdegree(v);
+            if (deg == 0)
+                dangling += r[v];
+            for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter)
+                next[*iter] += d * r[v] / deg;
+        }
+        for (unsigned v = 0; v < V; v++)
+            next[v] += (1 - d) * tele[v] + d * dangling * tele[v];
+        r.swap(next);
+    }
+
+    return r;
+}
+
+
+template<typename GRAPH>
+double l1_(const GRAPH&, const std::vector<double>& x, const std::vector<double>& y)
+{
+    double s(0);
+    for (std::size_t i = 0; i < x.size(); i++)
+        s += std::abs(x[i] - y[i]);
+    return s;
+}
+
+
+template<typename GRAPH>
+void pagerank_test_(const GRAPH& g)
+{
+    auto V = g.order();
+    KtSpmv<GRAPH> spmv(g, 4);
+
+    // 全局PageRank
+    KtPageRank<GRAPH> pr(spmv, 0.85, 1e-12, 200);
+    if (!pr.converged())
+        test_failed(g);
+    double sum(0);
+    for (auto r : pr.ranks()) sum += r;
+    if (std::abs(sum - 1) > 1e-9)
+        test_failed(g);
+    if (l1_(g, pr.ranks(), naive_pagerank_(g, std::vector<double>(V, 1.0 / V), 0.85, 200)) > 1e-9)
+        test_failed(g);
+
+    // 结果与线程数无关
+    KtSpmv<GRAPH> spmv1(g, 1);
+    KtPageRank<GRAPH> pr1(spmv1, 0.85, 1e-12, 200);
+    if (pr1.iterations() != pr.iterations() || pr1.ranks() != pr.ranks())
+        test_failed(g);
+
+    // 个性化PageRank
+    std::vector<double> tele(V, 0);
+    tele[0] = 0.25, tele[V / 2] = 0.75;
+    KtPageRank<GRAPH> ppr(spmv, { { 0, 1 }, { V / 2, 3 } }, 0.85, 1e-12, 200);
+    if (l1_(g, ppr.ranks(), naive_pagerank_(g, tele, 0.85, 200)) > 1e-9)
+        test_failed(g);
+
+    // 单种子的前向推送近似
+    for (unsigned seed : { 0u, 7u }) {
+        KtPageRank<GRAPH> exact(spmv, { { seed, 1 } }, 0.85, 1e-12, 200);
+        KtPageRankPush<GRAPH> push(g, seed, 0.85, 1e-8);
+        std::vector<double> approx(V, 0);
+        for (auto& p : push.ranks()) approx[p.first] = p.second;
+        auto err = l1_(g, exact.ranks(), approx);
+        if (err > push.residual() + 1e-9 || push.residual() > 1e-8 * 2 * g.size() + 1e-9)
+            test_failed(g);
+    }
+}
+
+
+void pagerank_test()
+{
+    printf("pagerank test...\n");
+    fflush(stdout);
+
+    printf("   random digraph"); fflush(stdout);
+    pagerank_test_(gen_gnm<DigraphSd<>>(500, 2000, 1)); // 约有1.8%的顶点没有出边
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   random graph"); fflush(stdout);
+    pagerank_test_(gen_gnm<GraphSd<>>(500, 2000, 2));
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   power-law digraph"); fflush(stdout);
+    pagerank_test_(gen_rmat<DigraphSd<>>(10, 8000, 0.57, 0.19, 0.19, 3));
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   katz"); fflush(stdout);
+    {
+        // 有向路径0->1->...->n-1上，x[v] = beta * Σalpha^k (k = 0..v)
+        const unsigned n = 10;
+        DigraphSd<> g(n);
+        for (unsigned v = 0; v + 1 < n; v++)
+            g.addEdge(v, v + 1, 1);
+        KtSpmv<DigraphSd<>> spmv(g);
+        KtKatz<DigraphSd<>> katz(spmv, 0.5, 2);
+        if (!katz.converged() || katz.iterations() > n + 1)
+            test_failed(g);
+        for (unsigned v = 0; v < n; v++)
+            if (std::abs(katz.centrality(v) - 2 * (2 - std::pow(0.5, v))) > 1e-12)
+                test_failed(g);
+
+        // 随机图上满足不动点方程
+        auto rg = gen_gnm<DigraphSd<>>(500, 2000, 4);
+        KtSpmv<DigraphSd<>> rspmv(rg);
+        KtKatz<DigraphSd<>> rkatz(rspmv, 0.1, 1, 1e-12);
+        std::vector<double> ax(rg.order(), 0);
+        rspmv.push(rkatz.centralities().data(), ax.data());
+        for (unsigned v = 0; v < rg.order(); v++)
+            if (std::abs(rkatz.centrality(v) - (0.1 * ax[v] + 1)) > 1e-9)
+                test_failed(rg);
+    }
+    printf("  > passed\n"); fflush(stdout);
+}
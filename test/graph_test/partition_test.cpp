@@ -0,0 +1,154 @@
+#include <stdio.h>
+#include <set>
+#include "GraphX.h"
+#include "core/KtGraphView.h"
+#include "core/KtPartition.h"
+#include "util/graphgen.h"
+#include "test_util.h"
+
+
+// 朴素地计算割边权值和通信量（忽略自环，无向图的各边只计一次）
+template<typename GRAPH, typename WEIGHTOR>
+std::pair<long long, long long> naive_cut_volume_(const GRAPH& g, const std::vector<unsigned>& part)
+{
+    long long cut(0);
+    std::vector<std::set<unsigned>> nbrParts(g.order());
+    for (unsigned v = 0; v < g.order(); v++)
+        for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter) {
+            unsigned w = *iter;
+            if (part[v] == part[w]) continue;
+            if (GRAPH::isDigraph() || v < w)
+                cut += WEIGHTOR{}(iter.edge());
+            nbrParts[v].insert(part[w]);
+            nbrParts[w].insert(part[v]);
+        }
+
+    long long vol(0);
+    for (auto& s : nbrParts)
+        vol += s.size();
+    return { cut, vol };
+}
+
+
+template<typename GRAPH, typename WEIGHTOR = unit_min_wtor<GRAPH>>
+void partition_test_(const GRAPH& g, unsigned k, typename KtPartition<GRAPH, WEIGHTOR>::objective obj,
+    const std::vector<long long>& vwgt = {})
+{
+    using partition = KtPartition<GRAPH, WEIGHTOR>;
+    auto vw = vwgt.empty() ? std::vector<long long>(g.order(), 1) : vwgt;
+    partition pt(g, vw, k, 0.05, obj, 3, 11);
+    partition pt1(g, vw, k, 0.05, obj, 1, 11);
+
+    // 结果与线程数无关
+    if (pt.parts() != pt1.parts())
+        test_failed(g);
+
+    std::vector<long long> pw(k, 0);
+    for (unsigned v = 0; v < g.order(); v++) {
+        if (pt.part(v) >= k)
+            test_failed(g);
+        pw[pt.part(v)] += vw[v];
+    }
+    for (unsigned p = 0; p < k; p++)
+        if (pw[p] != pt.partWeight(p) || pw[p] > pt.maxPartWeight())
+            test_failed(g);
+
+    auto cv = naive_cut_volume_<GRAPH, WEIGHTOR>(g, pt.parts());
+    if (cv.first != pt.edgeCut() || cv.second != pt.commVolume())
+        test_failed(g);
+
+    // 导出子图与KtInducedView一致
+    for (unsigned p = 0; p < k; p++) {
+        auto vs = pt.members(p);
+        auto sub = pt.subgraph(g, p);
+        KtInducedView<GRAPH> view(g, vs.begin(), vs.end());
+        if (sub.order() != vs.size() || sub.size() != view.size())
+            test_failed(g);
+        for (unsigned i = 0; i < vs.size(); i++)
+            if (pt.part(vs[i]) != p || sub.outdegree(i) != view.outdegree(i))
+                test_failed(g);
+    }
+}
+
+
+void partition_test()
+{
+    printf("partition test...\n");
+    fflush(stdout);
+
+    printf("   two cliques"); fflush(stdout);
+    {
+        // 两个团之间只有一条边，二分时应恰好切断该边
+        using G = GraphSi<>;
+        const unsigned n = 40;
+        G g(2 * n);
+        for (unsigned v = 0; v < n; v++)
+            for (unsigned w = v + 1; w < n; w++)
+                g.addEdge(v, w, 1), g.addEdge(n + v, n + w, 1);
+        g.addEdge(3, n + 5, 1);
+        KtPartition<G> pt(g, 2);
+        if (pt.edgeCut() != 1 || pt.commVolume() != 2 || pt.partWeight(0) != n)
+            test_failed(g);
+        partition_test_(g, 2, KtPartition<G>::k_comm_volume);
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   grid"); fflush(stdout);
+    {
+        // 100x100的网格，4路划分的最优割为200
+        using G = GraphSi<>;
+        auto g = gen_grid<G>(100, 100);
+        for (unsigned k : { 2, 4, 7 })
+            partition_test_(g, k, KtPartition<G>::k_edge_cut);
+        if (KtPartition<G>(g, 4, 0.03, KtPartition<G>::k_edge_cut, 2).edgeCut() > 300)
+            test_failed(g);
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   random graph"); fflush(stdout);
+    {
+        using G = GraphSi<>;
+        auto g = gen_gnm<G>(3000, 15000, 1);
+        partition_test_(g, 8, KtPartition<G>::k_edge_cut);
+        partition_test_(g, 8, KtPartition<G>::k_comm_volume);
+        partition_test_<G, default_min_wtor<G>>(gen_gnm<G>(500, 3000, 2), 3, KtPartition<G, default_min_wtor<G>>::k_edge_cut);
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   power-law graph"); fflush(stdout);
+    {
+        using G = GraphSd<true>;
+        auto g = gen_rmat<G>(12, 30000, 0.57, 0.19, 0.19, 3);
+        partition_test_(g, 16, KtPartition<G>::k_edge_cut);
+        partition_test_(g, 5, KtPartition<G>::k_comm_volume);
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   digraph & multigraph"); fflush(stdout);
+    {
+        using D = DigraphSi<>;
+        partition_test_(gen_gnm<D>(1000, 6000, 4), 4, KtPartition<D>::k_edge_cut);
+
+        using P = GraphPi<>;
+        auto g = gen_gnm<P>(800, 4000, 5);
+        for (unsigned v = 0; v < g.order(); v += 7) {
+            g.addEdge(v, v, 1);
+            if (g.outdegree(v) > 1)
+                g.addEdge(v, *KtAdjIter(g, v), 2);
+        }
+        partition_test_(g, 6, KtPartition<P>::k_edge_cut);
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   vertex weights"); fflush(stdout);
+    {
+        using G = GraphSi<>;
+        auto g = gen_gnm<G>(2000, 10000, 6);
+        std::vector<long long> vwgt(g.order());
+        for (unsigned v = 0; v < g.order(); v++)
+            vwgt[v] = 1 + v % 10;
+        partition_test_(g, 5, KtPartition<G>::k_edge_cut, vwgt);
+        partition_test_(g, 5, KtPartition<G>::k_comm_volume, vwgt);
+    }
+    printf("  > passed\n"); fflush(stdout);
+}
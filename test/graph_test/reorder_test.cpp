@@ -0,0 +1,176 @@
+#include <stdio.h>
+#include <tuple>
+#include <vector>
+#include <algorithm>
+#include <random>
+#include "GraphX.h"
+#include "util/reorder.h"
+#include "util/resort.h"
+#include "graph_test_helper.h"
+
+
+// 以assign批量构建的图应与逐条addEdge构建的图一致
+template<typename GRAPH>
+void assign_test_()
+{
+    using vertex_index_t = typename GRAPH::vertex_index_t;
+    using edge_type = typename GRAPH::edge_type;
+
+    GRAPH g = randgen<GRAPH>(300, 3000);
+    std::vector<std::tuple<vertex_index_t, vertex_index_t, edge_type>> edges;
+    for (vertex_index_t v = 0; v < g.order(); v++) {
+        auto iter = KtAdjIter(g, v);
+        for (; !iter.isEnd(); ++iter)
+            if (g.isDigraph() || *iter >= v)
+                edges.emplace_back(v, *iter, iter.edge());
+    }
+
+    std::shuffle(edges.begin(), edges.end(), std::mt19937(7));
+    GRAPH ng;
+    ng.assign(g.order(), edges.begin(), edges.end());
+    if (!equal_test(g, ng))
+        test_failed(g, ng);
+}
+
+
+template<typename GRAPH, typename ORDER>
+void permute_test_(const GRAPH& g, const ORDER& order)
+{
+    // order必须是一个排列
+    std::vector<bool> flags(g.order(), false);
+    if (order.size() != g.order())
+        test_failed(g);
+    for (auto v : order) {
+        if (v >= g.order() || flags[v])
+            test_failed(g);
+        flags[v] = true;
+    }
+
+    auto ng = permute(g, order);
+    if (ng.order() != g.order() || ng.size() != g.size())
+        test_failed(g, ng);
+
+    // 度数与顶点值随顶点一并移动
+    for (unsigned v = 0; v < g.order(); v++) {
+        if (ng.outdegree(order[v]) != g.outdegree(v) || ng.indegree(order[v]) != g.indegree(v))
+            test_failed(g, ng);
+
+        if constexpr (GRAPH::hasVertex()) {
+            using vertex_type = typename GRAPH::vertex_type;
+            if (static_cast<const vertex_type&>(ng.vertexAt(order[v])) != static_cast<const vertex_type&>(g.vertexAt(v)))
+                test_failed(g, ng);
+        }
+    }
+
+    for (unsigned v = 0; v < g.order(); v++) {
+        auto iter = KtAdjIter(g, v);
+        for (; !iter.isEnd(); ++iter) {
+            bool found;
+            if constexpr (GRAPH::isMultiEdges())
+                found = ng.hasEdge(order[v], order[*iter], iter.edge());
+            else
+                found = ng.hasEdge(order[v], order[*iter])
+                    && ng.getEdge(order[v], order[*iter]) == iter.edge();
+            if (!found)
+                test_failed(g, ng);
+        }
+    }
+
+    // 有序图在重排后仍须保持有序
+    if constexpr (GRAPH::isAlwaysSorted()) {
+        for (unsigned v = 0; v < ng.order(); v++) {
+            auto iter = KtAdjIter(ng, v);
+            unsigned last = 0;
+            for (; !iter.isEnd(); ++iter) {
+                if (*iter < last)
+                    test_failed(ng);
+                last = *iter;
+            }
+        }
+    }
+}
+
+
+template<typename GRAPH>
+unsigned bandwidth_(const GRAPH& g)
+{
+    unsigned bw(0);
+    for (unsigned v = 0; v < g.order(); v++) {
+        auto iter = KtAdjIter(g, v);
+        for (; !iter.isEnd(); ++iter)
+            bw = std::max(bw, v > *iter ? v - *iter : *iter - v);
+    }
+    return bw;
+}
+
+
+template<typename GRAPH>
+void reorder_test_(const GRAPH& g)
+{
+    permute_test_(g, degree_order(g));
+    permute_test_(g, bfs_order(g));
+    permute_test_(g, rcm_order(g));
+    permute_test_(g, gorder_order(g));
+    printf("  > passed\n"); fflush(stdout);
+}
+
+
+void reorder_test()
+{
+    printf("reorder test...\n");
+    fflush(stdout);
+
+    printf("   assign vs. addEdge"); fflush(stdout);
+    assign_test_<GraphFf<true>>();
+    assign_test_<GraphCf<>>();
+    assign_test_<DigraphFf<>>();
+    assign_test_<DigraphCf<true>>();
+    assign_test_<GraphSf<true>>();
+    assign_test_<DigraphDf>();
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   random graph"); fflush(stdout);
+    reorder_test_(randgen<GraphFf<true>>(500, 5000));
+
+    printf("   random digraph"); fflush(stdout);
+    reorder_test_(randgen<DigraphCf<true>>(500, 5000));
+
+    printf("   random sparse graph"); fflush(stdout);
+    reorder_test_(randgen<GraphSf<>>(500, 300));
+
+    printf("   flat digraph with vertex values"); fflush(stdout);
+    {
+        // flat图的顶点对象附带边偏移，重排时只能移动顶点值
+        using G = DigraphFx<float, int>;
+        G small(4);
+        small.addEdge(0, 1, 1), small.addEdge(0, 2, 2), small.addEdge(1, 2, 3), small.addEdge(3, 0, 4);
+        for (unsigned v = 0; v < 4; v++)
+            small.vertexAt(v) = int(v * 10);
+        permute_test_(small, std::vector<unsigned>{ 3, 2, 1, 0 });
+
+        auto g = randgen<G>(500, 5000);
+        for (unsigned v = 0; v < g.order(); v++)
+            g.vertexAt(v) = int(v * 7 + 1);
+        reorder_test_(g);
+    }
+
+
+    // 打乱编号的网格图，rcm应显著降低带宽
+    const unsigned W = 30;
+    std::vector<unsigned> shuffled(W * W);
+    for (unsigned i = 0; i < W * W; i++) shuffled[i] = i;
+    std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(13));
+
+    GraphFf<true> grid(W * W);
+    for (unsigned r = 0; r < W; r++)
+        for (unsigned c = 0; c < W; c++) {
+            if (c + 1 < W) grid.addEdge(shuffled[r * W + c], shuffled[r * W + c + 1], 1);
+            if (r + 1 < W) grid.addEdge(shuffled[r * W + c], shuffled[(r + 1) * W + c], 1);
+        }
+
+    printf("   shuffled grid bandwidth"); fflush(stdout);
+    auto g = permute(grid, rcm_order(grid));
+    if (bandwidth_(g) > 2 * W || bandwidth_(g) >= bandwidth_(grid))
+        test_failed(grid, g);
+    printf("  > passed\n"); fflush(stdout);
+}
@@ -15,8 +15,8 @@ void resort_test_(const DAG& g)
     DAG d(g);
     resort(d, ts.relabels());
     KtBfsIter<const DAG, true, true> iter(d, 0);
-    while (!iter.isEnd()) { // ÿ
-        if (iter.from() > *iter) // Сָ
+    while (!iter.isEnd()) { // 迭代每条有向边
+        if (iter.from() > *iter) // 小编号指向大编号
             test_failed(d);
         ++iter;
     }
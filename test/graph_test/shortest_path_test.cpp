@@ -1,6 +1,11 @@
 #include <stdio.h>
+#include <sstream>
 #include "GraphX.h"
 #include "core/KtShortestPath.h"
+#include "core/KtAltSearch.h"
+#include "core/KtContractionHierarchy.h"
+#include "core/KtSsspDeltaStepping.h"
+#include "core/KtFsspLazy.h"
 #include "core/KtBfsIter.h"
 #include "util/randgen.h"
 #include "util/loop.h"
@@ -8,7 +13,7 @@
 #include "test_util.h"
 
 
-// жͼgǷиȨֵ
+// 判断图g是否含有负权值
 template<typename GRAPH, typename WEIGHTOR>
 bool hasNegWt(const GRAPH& g)
 {
@@ -21,7 +26,7 @@ bool hasNegWt(const GRAPH& g)
 }
 
 
-// 
+// 负环检测
 template<typename GRAPH>
 bool hasNegLoop(const GRAPH& g)
 {
@@ -76,6 +81,50 @@ void shortest_path_test_(const GRAPH& g)
         for (unsigned i = 0; i < g.order(); i++)
             equal_test(g, i, floyd, KtSsspPfs<GRAPH, WEIGHTOR>(g, i));
         printf("  > passed\n"); fflush(stdout);
+
+
+        printf("      floyd vs. delta-stepping");
+        fflush(stdout);
+        for (unsigned i = 0; i < g.order(); i++)
+            equal_test(g, i, floyd, KtSsspDeltaStepping<GRAPH, WEIGHTOR>(g, i, 4));
+        printf("  > passed\n"); fflush(stdout);
+    }
+
+
+    printf("      floyd vs. lazy");
+    fflush(stdout);
+    {
+        // 预算仅够缓存3行，以交错的次序查询，检验LRU淘汰
+        const std::size_t rowBytes = g.order() * (sizeof(typename WEIGHTOR::weight_type) + sizeof(unsigned));
+        KtFsspLazy<GRAPH, WEIGHTOR, KtSsspBellmanFord> lazy(g, rowBytes * 3);
+        lazy.precompute({ 0, 1, 2, 3, 4 });
+        if (lazy.capacity() != std::min(3u, g.order()) || (!lazy.isCached(0) && g.order() > 3))
+            test_failed(g);
+        for (unsigned w = 0; w < g.order(); w++)
+            for (unsigned i = 0; i < g.order(); i++) {
+                unsigned v = (i * 7 + w) % g.order();
+                if (!almostEqual(floyd.distance(v, w), lazy.distance(v, w))
+                    || floyd.reachable(v, w) != lazy.reachable(v, w)
+                    || (floyd.pathR(v, w).size() != lazy.pathR(v, w).size() && floyd.reachable(v, w) && v != w))
+                    test_failed(g);
+            }
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+    if (!hasNegWt) {
+        printf("      floyd vs. lazy(float/uint16)");
+        fflush(stdout);
+        KtFsspLazy<GRAPH, WEIGHTOR, KtSsspPfs, float> lazyf(g);
+        KtFsspLazy<GRAPH, WEIGHTOR, KtSsspPfs, std::uint16_t> lazyq(g, std::size_t(1) << 20, 1e-3);
+        for (unsigned v = 0; v < g.order(); v++)
+            for (unsigned w = 0; w < g.order(); w++) {
+                if (floyd.reachable(v, w) != lazyf.reachable(v, w) || floyd.reachable(v, w) != lazyq.reachable(v, w))
+                    test_failed(g);
+                if (floyd.reachable(v, w) && (!almostEqual(floyd.distance(v, w), lazyf.distance(v, w), 1e-5)
+                    || !almostEqual(floyd.distance(v, w), lazyq.distance(v, w), 1e-3)))
+                    test_failed(g);
+            }
+        printf("  > passed\n"); fflush(stdout);
     }
 
 
@@ -86,12 +135,11 @@ void shortest_path_test_(const GRAPH& g)
     printf("  > passed\n"); fflush(stdout);
 
 
-    // dfs㷨̫
-    //printf("      floyd vs. dfs");
-    //fflush(stdout);
-    //for (unsigned i = 0; i < g.order(); i++)
-    //    equal_test(g.order(), i, floyd, KtSsspDfs<GRAPH>(g, i));
-    //printf("  > passed\n"); fflush(stdout);
+    printf("      floyd vs. dfs");
+    fflush(stdout);
+    for (unsigned i = 0; i < g.order(); i++)
+        equal_test(g, i, floyd, KtSsspDfs<GRAPH, WEIGHTOR>(g, i));
+    printf("  > passed\n"); fflush(stdout);
 
 
     if (isDag) {
@@ -114,6 +162,142 @@ void shortest_path_test_(const GRAPH& g)
 }
 
 
+// 检查点对点查询结果：距离与Dijkstra一致，且路径有效、长度与距离相符
+template<typename GRAPH, typename SPT, typename P2P>
+static void p2p_check_(const GRAPH& g, unsigned s, unsigned t, const SPT& spt, const P2P& alt)
+{
+    if (!spt.reachable(t)) {
+        if (alt.distance() != default_wtor<GRAPH>{}.worst_weight || !alt.pathR().empty())
+            test_failed(g);
+        return;
+    }
+
+    if (!almostEqual(alt.distance(), spt.distance(t)))
+        test_failed(g);
+
+    auto p = alt.pathR();
+    if (p.empty() || p.front() != t || p.back() != s)
+        test_failed(g);
+    typename GRAPH::edge_type len(0);
+    for (unsigned i = 1; i < p.size(); i++) {
+        if (!g.hasEdge(p[i], p[i - 1]))
+            test_failed(g);
+        len += g.getEdge(p[i], p[i - 1]);
+    }
+    if (!almostEqual(len, alt.distance()))
+        test_failed(g);
+}
+
+
+template<typename GRAPH>
+static void alt_test_(const GRAPH& g, unsigned numLandmarks)
+{
+    using alt_type = KtAltSearch<GRAPH>;
+    alt_type alt(g, numLandmarks), plain(g, 0);
+    alt_type farthest(g, numLandmarks, alt_type::k_farthest);
+
+    // 地标数据的保存与载入
+    std::stringstream ss;
+    alt.save(ss);
+    alt_type loaded(g, 0);
+    if (!loaded.load(ss) || loaded.numLandmarks() != alt.numLandmarks())
+        test_failed(g);
+
+    // 截断或地标越界的数据载入失败，且不改变现有数据
+    auto bytes = ss.str();
+    std::stringstream truncated(bytes.substr(0, bytes.size() - 8));
+    if (loaded.load(truncated))
+        test_failed(g);
+    auto corrupt = bytes;
+    std::fill_n(corrupt.begin() + 16, sizeof(typename GRAPH::vertex_index_t), char(0xff));
+    std::stringstream cs(corrupt);
+    if (loaded.load(cs) || loaded.numLandmarks() != alt.numLandmarks() || loaded.landmarks() != alt.landmarks())
+        test_failed(g);
+
+    std::size_t settledAlt(0), settledPlain(0);
+    for (unsigned i = 0; i < 10; i++) {
+        unsigned s = rand() % g.order();
+        KtSsspPfs<GRAPH> spt(g, s);
+        for (unsigned t = 0; t < g.order(); t++) {
+            if (t == s) continue;
+
+            alt.search(s, t);
+            p2p_check_(g, s, t, spt, alt);
+            settledAlt += alt.settled();
+            alt.searchBi(s, t);
+            p2p_check_(g, s, t, spt, alt);
+
+            plain.search(s, t);
+            p2p_check_(g, s, t, spt, plain);
+            settledPlain += plain.settled();
+            plain.searchBi(s, t);
+            p2p_check_(g, s, t, spt, plain);
+
+            farthest.searchBi(s, t);
+            p2p_check_(g, s, t, spt, farthest);
+            loaded.search(s, t);
+            p2p_check_(g, s, t, spt, loaded);
+        }
+    }
+
+    if (settledAlt > settledPlain)
+        test_failed(g);
+}
+
+
+template<typename GRAPH>
+static void ch_test_(const GRAPH& g)
+{
+    using ch_type = KtContractionHierarchy<GRAPH>;
+    ch_type ch(g);
+
+    std::stringstream ss;
+    ch.save(ss);
+    ch_type loaded;
+    if (!loaded.load(ss) || loaded.size() != ch.size())
+        test_failed(g);
+
+    // 截断或端点越界的数据载入失败，且不改变现有数据；重新载入后查询状态复位
+    auto bytes = ss.str();
+    std::stringstream truncated(bytes.substr(0, bytes.size() - 8));
+    if (loaded.load(truncated))
+        test_failed(g);
+    auto firstArc = 16 + sizeof(typename GRAPH::vertex_index_t) * g.order() + 8 + 8 * (std::size_t(g.order()) + 1);
+    if (firstArc < bytes.size()) {
+        auto corrupt = bytes;
+        std::fill_n(corrupt.begin() + firstArc, sizeof(typename GRAPH::vertex_index_t), char(0xff));
+        std::stringstream cs(corrupt);
+        if (loaded.load(cs))
+            test_failed(g);
+    }
+    loaded.search(0, g.order() - 1);
+    std::stringstream again(bytes);
+    if (!loaded.load(again) || !loaded.pathR().empty() || loaded.settled() != 0)
+        test_failed(g);
+
+    std::vector<unsigned> sources, targets;
+    for (unsigned i = 0; i < 10; i++) {
+        unsigned s = rand() % g.order();
+        sources.push_back(s);
+        targets.push_back(rand() % g.order());
+        KtSsspPfs<GRAPH> spt(g, s);
+        for (unsigned t = 0; t < g.order(); t++) {
+            if (t == s) continue;
+            ch.search(s, t);
+            p2p_check_(g, s, t, spt, ch);
+            loaded.search(s, t);
+            p2p_check_(g, s, t, spt, loaded);
+        }
+    }
+
+    auto table = ch.table(sources, targets);
+    for (unsigned i = 0; i < sources.size(); i++)
+        for (unsigned j = 0; j < targets.size(); j++)
+            if (table[i][j] != ch.search(sources[i], targets[j]))
+                test_failed(g);
+}
+
+
 void shortest_path_test()
 {
     printf("shortest path test...\n");
@@ -144,24 +328,129 @@ void shortest_path_test()
     shortest_path_test_(g);
 
 
+    // 整数权值以float存储；超出float范围的有限距离不能被当作不可达
+    printf("   lazy float store, int and huge weights");
+    fflush(stdout);
+    {
+        DigraphSi<> ig(3);
+        ig.addEdge(0, 1, 5), ig.addEdge(1, 2, 7);
+        KtFsspLazy<DigraphSi<>, default_wtor<DigraphSi<>>, KtSsspPfs, float> lazyi(ig);
+        if (lazyi.distance(0, 2) != 12 || !lazyi.reachable(0, 2) || lazyi.reachable(2, 0))
+            test_failed(ig);
+
+        DigraphDd hg(2);
+        hg.addEdge(0, 1, 1e300);
+        KtFsspLazy<DigraphDd, default_wtor<DigraphDd>, KtSsspPfs, float> lazyh(hg);
+        auto d = lazyh.distance(0, 1);
+        if (!lazyh.reachable(0, 1) || !(d > 1e38 && d <= std::numeric_limits<float>::max()))
+            test_failed(hg);
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+
     DigraphDd rg = randgen<DigraphDd>(100, 1000); 
     printf("   random digraph V = %d, E = %d\n", rg.order(), rg.size());
     fflush(stdout);
     shortest_path_test_(rg);
 
 
-    // ޻ͼ
+    // 构造无环图
     erase_loop(rg);
     printf("   random dag V = %d, E = %d\n", rg.order(), rg.size());
     fflush(stdout);
     shortest_path_test_(rg);
 
-/*  DAGвò壬ӦлͼϹȨֵͼ
-    TODO: Ч޸ĴȨֵͼķ
+    auto sg = randgen<DigraphSd<>>(1000, 3000);
+    printf("   alt, random digraph V = %d, E = %d", sg.order(), sg.size());
+    fflush(stdout);
+    alt_test_(sg, 8);
+    printf("  > passed\n"); fflush(stdout);
+
+
+    // 网格状的路网，边的权值为较小的整数
+    const unsigned N = 40;
+    DigraphSi<> grid(N * N);
+    for (unsigned r = 0; r < N; r++)
+        for (unsigned c = 0; c < N; c++) {
+            unsigned v = r * N + c;
+            if (c + 1 < N) grid.addEdge(v, v + 1, rand() % 10 + 1), grid.addEdge(v + 1, v, rand() % 10 + 1);
+            if (r + 1 < N) grid.addEdge(v, v + N, rand() % 10 + 1), grid.addEdge(v + N, v, rand() % 10 + 1);
+        }
+    printf("   alt, grid V = %d, E = %d", grid.order(), grid.size());
+    fflush(stdout);
+    alt_test_(grid, 8);
+    printf("  > passed\n"); fflush(stdout);
+
+    // 无符号权值，仅单向查询：下界的计算不应回绕
+    using ugraph = DigraphSx<unsigned>;
+    ugraph ugrid(grid.order());
+    for (unsigned v = 0; v < grid.order(); v++)
+        for (auto iter = KtAdjIter(grid, v); !iter.isEnd(); ++iter)
+            ugrid.addEdge(v, *iter, unsigned(iter.edge()));
+    printf("   alt, unsigned grid V = %d, E = %d", ugrid.order(), ugrid.size());
+    fflush(stdout);
+    KtAltSearch<ugraph> ualt(ugrid, 8);
+    for (unsigned i = 0; i < 10; i++) {
+        unsigned s = rand() % ugrid.order();
+        KtSsspPfs<ugraph> spt(ugrid, s);
+        for (unsigned t = 0; t < ugrid.order(); t += 7) {
+            if (t == s) continue;
+            ualt.search(s, t);
+            p2p_check_(ugrid, s, t, spt, ualt);
+        }
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+    // 以较大的delta使桶内顶点足够多，检验并行松弛
+    auto bg = randgen<DigraphSd<>>(5000, 100000);
+    printf("   delta-stepping, random digraph V = %d, E = %d", bg.order(), bg.size());
+    fflush(stdout);
+    for (unsigned i = 0; i < 3; i++) {
+        unsigned s = rand() % bg.order();
+        KtSsspPfs<DigraphSd<>> pfs(bg, s);
+        for (double delta : { 0.0, 0.1, 1.0, 100.0 }) {
+            KtSsspDeltaStepping<DigraphSd<>> ds(bg, s, 4, delta);
+            for (unsigned w = 0; w < bg.order(); w++)
+                if (!almostEqual(pfs.distance(w), ds.distance(w)))
+                    test_failed(bg);
+        }
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+    // 较大的整数权值与delta = 1：最大距离远超桶的数量，检验循环桶及空桶的跳跃
+    DigraphSi<> hg(2000);
+    for (unsigned i = 0; i < 8000; i++)
+        hg.addEdge(rand() % hg.order(), rand() % hg.order(), rand() % 100000 + 1);
+    printf("   delta-stepping, heavy weights V = %d, E = %d", hg.order(), hg.size());
+    fflush(stdout);
+    for (unsigned i = 0; i < 3; i++) {
+        unsigned s = rand() % hg.order();
+        KtSsspPfs<DigraphSi<>> pfs(hg, s);
+        for (int delta : { 1, 1000 }) {
+            KtSsspDeltaStepping<DigraphSi<>> ds(hg, s, 4, delta);
+            for (unsigned w = 0; w < hg.order(); w++)
+                if (pfs.distance(w) != ds.distance(w) || pfs.reachable(w) != ds.reachable(w))
+                    test_failed(hg);
+        }
+    }
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   ch, random digraph V = %d, E = %d", sg.order(), sg.size());
+    fflush(stdout);
+    ch_test_(sg);
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   ch, grid V = %d, E = %d", grid.order(), grid.size());
+    fflush(stdout);
+    ch_test_(grid);
+    printf("  > passed\n"); fflush(stdout);
+
+/*  对DAG进行测试貌似无意义，还是应该在有环图基础上构建负权值图
+    TODO: 高效构建无负环的带负权值图的方法
     KtBfsIter<DigraphDd, true, true> iter(rg, 0);
     unsigned neg_wt(0);
     for (; !iter.isEnd(); ++iter)
-        if (rand_p(0.1)) { // 10%ıΪȨֵ
+        if (rand_p(0.1)) { // 将10%的边置为负权值
             rg.setEdge(iter.from(), *iter, -iter.value());
             ++neg_wt;
         }
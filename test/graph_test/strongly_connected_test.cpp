@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <cstdint>
 #include "GraphX.h"
 #include "core/KtStronglyConnected.h"
 #include "util/randgen.h"
@@ -48,4 +49,23 @@ void strongly_connected_test()
     printf("   random digraph V = %d, E = %d\n", dg.order(), dg.size());
     fflush(stdout);
     strongly_connected_test_(dg);
+
+    // 16位顶点索引，检验未归入SCC的标记与null_vertex一致
+    using Digraph16 = KtGraphX<KtGraph<KtAdjGraphSparseImpl<float, void, std::uint16_t, std::uint32_t>, true, false, false>>;
+    auto dg16 = randgen<Digraph16>(300, 1200);
+    printf("   16-bit digraph V = %d, E = %d\n", dg16.order(), unsigned(dg16.size()));
+    fflush(stdout);
+    strongly_connected_test_(dg16);
+
+    // 深度很大的环，用于检验非递归实现
+    const unsigned N = 300000;
+    DigraphSi<> cg(N);
+    for (unsigned v = 0; v < N; v++)
+        cg.addEdge(v, (v + 1) % N);
+    printf("   deep cycle V = %d, E = %d", cg.order(), cg.size());
+    fflush(stdout);
+    KtStronglyConnectedTar<DigraphSi<>> tar(cg);
+    if (tar.count() != 1)
+        test_failed(cg);
+    printf("  > passed\n"); fflush(stdout);
 }
@@ -14,7 +14,7 @@ void dump(const GRAPH& g, const char* path)
 }
 
 
-// ʧʱøúӡϢ˳
+// 测试失败时调用该函数打印信息、退出程序
 template<typename GRAPH>
 void test_failed(const GRAPH& g, bool detail = false)
 {
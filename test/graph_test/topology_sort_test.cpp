@@ -15,8 +15,8 @@ void topology_sort_test_(const DAG& g)
     fflush(stdout);
     KtTopologySort<DigraphDi> ts(g);
     KtDfsIter<const DigraphDi, true, true> iter(g, 0);
-    while (!iter.isEnd()) { // ÿ
-        if (ts.relabel(iter.from()) >= ts.relabel(*iter)) // Сָ
+    while (!iter.isEnd()) { // 迭代每条有向边
+        if (ts.relabel(iter.from()) >= ts.relabel(*iter)) // 小编号指向大编号
             test_failed(g);
         ++iter;
     }
@@ -27,12 +27,43 @@ void topology_sort_test_(const DAG& g)
     fflush(stdout);
     KtTopologySortInv<DigraphDi> tsInv(g);
     KtDfsIter<const DigraphDi, true, true> iterInv(g, 0);
-    while (!iterInv.isEnd()) { // ÿ
-        if (tsInv.relabel(iterInv.from()) <= tsInv.relabel(*iterInv)) // ָС
+    while (!iterInv.isEnd()) { // 迭代每条有向边
+        if (tsInv.relabel(iterInv.from()) <= tsInv.relabel(*iterInv)) // 大编号指向小编号
             test_failed(g);
         ++iterInv;
     }
     printf("  > passed\n"); fflush(stdout);
+
+
+    printf("      level method");
+    fflush(stdout);
+    KtTopologyLevels<DigraphDi> tsl(g, 4);
+    if (!tsl.isDag())
+        test_failed(g);
+    KtDfsIter<const DigraphDi, true, true> iterL(g, 0);
+    while (!iterL.isEnd()) { // 边总是由较低层指向较高层
+        if (tsl.relabel(iterL.from()) >= tsl.relabel(*iterL)
+            || tsl.level(iterL.from()) >= tsl.level(*iterL))
+            test_failed(g);
+        ++iterL;
+    }
+    unsigned n(0);
+    for (unsigned l = 0; l < tsl.levels(); l++) {
+        for (auto v : tsl.levelAt(l)) {
+            if (tsl.level(v) != l || tsl[n++] != v)
+                test_failed(g);
+
+            // 非源点须有前驱位于上一层
+            bool found = (l == 0);
+            for (unsigned u = 0; u < g.order() && !found; u++)
+                found = g.hasEdge(u, v) && tsl.level(u) == l - 1;
+            if (!found)
+                test_failed(g);
+        }
+    }
+    if (n != g.order())
+        test_failed(g);
+    printf("  > passed\n"); fflush(stdout);
 }
 
 
@@ -63,4 +94,32 @@ void topology_sort_test()
     printf("   random dag V = %d, E = %d\n", rg.order(), rg.size());
     fflush(stdout);
     topology_sort_test_(rg);
+
+    // 宽层DAG，用于检验层内并行
+    const unsigned W = 3000, L = 4;
+    DigraphSi<> wg(W * L);
+    for (unsigned l = 0; l + 1 < L; l++)
+        for (unsigned i = 0; i < W; i++) {
+            wg.addEdge(l * W + i, (l + 1) * W + i);
+            wg.addEdge(l * W + i, (l + 1) * W + rand() % W);
+        }
+    printf("   wide dag V = %d, E = %d", wg.order(), wg.size());
+    fflush(stdout);
+    KtTopologyLevels<DigraphSi<>> wtsl(wg, 4);
+    if (!wtsl.isDag() || wtsl.levels() != L)
+        test_failed(wg);
+    for (unsigned v = 0; v < wg.order(); v++)
+        if (wtsl.level(v) != v / W || wtsl[v] != v)
+            test_failed(wg);
+    printf("  > passed\n"); fflush(stdout);
+
+    // 有环图
+    unsigned last = rg.order() - 1;
+    if (!rg.hasEdge(last, 0)) rg.addEdge(last, 0);
+    if (!rg.hasEdge(0, last)) rg.addEdge(0, last);
+    printf("   cyclic graph");
+    fflush(stdout);
+    if (KtTopologyLevels<DigraphDi>(rg).isDag())
+        test_failed(rg);
+    printf("  > passed\n"); fflush(stdout);
 }
@@ -1,8 +1,11 @@
 #include <stdio.h>
+#include <cstdint>
 #include "GraphX.h"
 #include "core/KtTransitiveClosure.h"
+#include "core/KtReachIndex.h"
 #include "util/randgen.h"
 #include "util/loop.h"
+#include "util/reachable.h"
 #include "test_util.h"
 
 
@@ -37,6 +40,20 @@ void transitive_closure_test_(const GRAPH& g)
     equal_test(g, war, scc);
     printf("  > passed\n"); fflush(stdout);
 
+    printf("      war vs. reach index");
+    fflush(stdout);
+    KtReachIndex<GRAPH> idx(g);
+    equal_test(g, war, idx);
+    std::vector<std::pair<unsigned, unsigned>> queries;
+    for (unsigned i = 0; i < g.order(); i++)
+        for (unsigned j = 0; j < g.order(); j++)
+            queries.emplace_back(i, j);
+    auto res = idx.reachable(queries, 4);
+    for (std::size_t i = 0; i < queries.size(); i++)
+        if (bool(res[i]) != war.reachable(queries[i].first, queries[i].second))
+            test_failed(g);
+    printf("  > passed\n"); fflush(stdout);
+
     if (doDag) {
         printf("      war vs. dag");
         fflush(stdout);
@@ -90,4 +107,29 @@ void transitive_closure_test()
     printf("   random dag V = %d, E = %d\n", dg.order(), dg.size());
     fflush(stdout);
     transitive_closure_test_(dg);
+
+
+    // 大规模稀疏图，仅与bfs结果抽样比较
+    auto sg = randgen<DigraphSi<>>(3000, 4500);
+    printf("   sparse digraph V = %d, E = %d", sg.order(), sg.size());
+    fflush(stdout);
+    KtReachIndex<DigraphSi<>> idx(sg);
+    for (unsigned v = 0; v < sg.order(); v += 17)
+        for (unsigned w = 0; w < sg.order(); w += 13)
+            if (idx.reachable(v, w) != is_reachable(sg, v, w))
+                test_failed(sg);
+    printf("  > passed\n"); fflush(stdout);
+
+    // 16位顶点索引，分量编号与区间标签亦为16位
+    using Digraph16 = KtGraphX<KtGraph<KtAdjGraphSparseImpl<float, void, std::uint16_t, std::uint32_t>, true, false, false>>;
+    auto dg16 = randgen<Digraph16>(1000, 1500);
+    printf("   16-bit digraph V = %d, E = %d", dg16.order(), unsigned(dg16.size()));
+    fflush(stdout);
+    KtReachIndex<Digraph16> idx16(dg16);
+    KtReachIndex<Digraph16>::query_space space;
+    for (unsigned v = 0; v < dg16.order(); v += 7)
+        for (unsigned w = 0; w < dg16.order(); w += 11)
+            if (idx16.reachable(v, w, space) != is_reachable(dg16, v, w))
+                test_failed(dg16);
+    printf("  > passed\n"); fflush(stdout);
 }
@@ -0,0 +1,235 @@
+#include <stdio.h>
+#include <thread>
+#include <random>
+#include <atomic>
+#include <algorithm>
+#include "GraphX.h"
+#include "core/KtVersionedGraph.h"
+#include "core/KtConnected.h"
+#include "core/KtShortestPath.h"
+#include "test_util.h"
+
+
+// 各顶点的出边(to, edge)排序后的列表
+template<typename GRAPH>
+static std::vector<std::vector<std::pair<unsigned, int>>> sorted_adj_(const GRAPH& g)
+{
+    std::vector<std::vector<std::pair<unsigned, int>>> adj(g.order());
+    for (unsigned v = 0; v < g.order(); v++) {
+        for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter)
+            adj[v].emplace_back(*iter, int(iter.edge()));
+        std::sort(adj[v].begin(), adj[v].end());
+    }
+    return adj;
+}
+
+
+// 随机分批增删顶点和边，并与实体图同步修改；
+// 每批提交后保留快照及当时实体图的副本，最后逐一比较，验证快照不受后续提交的影响
+template<bool digraph>
+static void versioned_graph_test_(unsigned batches)
+{
+    using VG = KtVersionedGraph<int, digraph, unsigned, std::size_t, 16>;
+    using G = std::conditional_t<digraph, DigraphPx<int>, GraphPx<int>>;
+
+    VG vg(50);
+    G g(50);
+    std::vector<typename VG::snapshot_type> snaps;
+    std::vector<G> expects;
+    std::mt19937 rng(7);
+
+    for (unsigned b = 0; b < batches; b++) {
+        if (rng() % 4 == 0) {
+            vg.addVertices(5);
+            for (unsigned i = 0; i < 5; i++)
+                g.addVertex();
+        }
+
+        for (unsigned i = 0; i < 40; i++) {
+            unsigned from = rng() % g.order(), to = rng() % g.order();
+            if (rng() % 5 == 0) {
+                vg.eraseEdge(from, to);
+                if (g.hasEdge(from, to))
+                    g.eraseEdge(from, to);
+            }
+            else {
+                vg.addEdge(from, to, int(b * 100 + i));
+                g.addEdge(from, to, int(b * 100 + i));
+            }
+        }
+
+        if (vg.order() != g.order() || vg.size() != g.size())
+            test_failed(g);
+
+        // 丢弃一批修改
+        if (rng() % 8 == 0) {
+            vg.rollback();
+            vg.addEdge(0, 1, -1);
+            vg.rollback();
+            g = expects.empty() ? G(50) : expects.back();
+            if (vg.order() != g.order() || vg.size() != g.size())
+                test_failed(g);
+            continue;
+        }
+
+        vg.commit();
+        snaps.push_back(vg.snapshot());
+        expects.push_back(g);
+
+        if (snaps.back().version() != vg.version())
+            test_failed(g);
+    }
+
+    for (unsigned i = 0; i < snaps.size(); i++) {
+        auto& s = snaps[i];
+        if (s.order() != expects[i].order() || s.size() != expects[i].size()
+            || sorted_adj_(s) != sorted_adj_(expects[i]))
+            test_failed(expects[i]);
+        for (unsigned v = 0; v < s.order(); v++)
+            if (s.outdegree(v) != expects[i].outdegree(v) || s.degree(v) != expects[i].degree(v))
+                test_failed(expects[i]);
+    }
+
+    // 释放全部快照后，旧行均可回收
+    snaps.clear();
+    vg.reclaim();
+    if (vg.retiredRows() != 0)
+        test_failed(g);
+}
+
+
+// 现有算法直接运行于快照之上
+static void algorithm_test_()
+{
+    KtVersionedGraph<int, true> vg(200);
+    DigraphPx<int> g(200);
+    std::mt19937 rng(11);
+    for (unsigned i = 0; i < 800; i++) {
+        unsigned from = rng() % 200, to = rng() % 200;
+        int w = 1 + rng() % 100;
+        vg.addEdge(from, to, w), g.addEdge(from, to, w);
+    }
+    vg.commit();
+
+    auto s = vg.snapshot();
+    using S = decltype(s);
+
+    KtSsspDijkstra<S> sp(s, 0);
+    KtSsspDijkstra<DigraphPx<int>> sp2(g, 0);
+    for (unsigned v = 0; v < g.order(); v++)
+        if (sp.reachable(v) != sp2.reachable(v) || sp.distance(v) != sp2.distance(v))
+            test_failed(g);
+
+    // 快照固定后写者继续提交，快照上的计算结果不变
+    for (unsigned v = 0; v < 200; v++)
+        vg.eraseEdge(0, v);
+    vg.commit();
+    KtSsspDijkstra<S> sp3(s, 0);
+    for (unsigned v = 0; v < g.order(); v++)
+        if (sp3.distance(v) != sp2.distance(v))
+            test_failed(g);
+
+    KtVersionedGraph<int> ug(300);
+    GraphPx<int> g2(300);
+    for (unsigned i = 0; i < 250; i++) {
+        unsigned from = rng() % 300, to = rng() % 300;
+        ug.addEdge(from, to, 1), g2.addEdge(from, to, 1);
+    }
+    ug.commit();
+    auto us = ug.snapshot();
+    KtConnected<decltype(us)> cc(us);
+    KtConnected<GraphPx<int>> cc2(g2);
+    if (cc.count() != cc2.count())
+        test_failed(g2);
+    for (unsigned v = 0; v < g2.order(); v++)
+        if (cc[v] != cc2[v])
+            test_failed(g2);
+}
+
+
+// 写者持续提交，多个读者并发固定快照并校验其一致性
+static void concurrent_test_(unsigned readers, unsigned batches)
+{
+    KtVersionedGraph<int> vg(1000, 8);
+    std::atomic<bool> done{ false };
+    std::atomic<unsigned> failures{ 0 };
+
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < readers; t++)
+        threads.emplace_back([&]() {
+            std::uint64_t last(0);
+            while (!done.load()) {
+                auto s = vg.snapshot();
+                if (s.version() < last)
+                    ++failures;
+                last = s.version();
+
+                // 各行之和与边数一致：无向图非自环边计2次；边值不超过所在版本
+                auto sum = [&s]() {
+                    std::size_t slots(0), loops(0), hash(0);
+                    for (unsigned v = 0; v < s.order(); v++)
+                        for (auto iter = KtAdjIter(s, v); !iter.isEnd(); ++iter) {
+                            ++slots;
+                            if (*iter == v) ++loops;
+                            if (std::uint64_t(iter.edge()) > s.version()) ++hash;
+                            hash = hash * 31 + *iter + iter.edge();
+                        }
+                    return std::make_pair(slots + loops, hash);
+                };
+
+                auto r1 = sum();
+                std::this_thread::yield();
+                auto r2 = sum();
+                if (r1.first != 2 * s.size() || r1 != r2)
+                    ++failures;
+            }
+        });
+
+    std::mt19937 rng(3);
+    for (unsigned b = 1; b <= batches; b++) {
+        for (unsigned i = 0; i < 50; i++) {
+            unsigned from = rng() % vg.order(), to = rng() % vg.order();
+            if (rng() % 3 == 0)
+                vg.eraseEdge(from, to);
+            else
+                vg.addEdge(from, to, int(b));
+        }
+        if (b % 10 == 0)
+            vg.addVertices(10);
+        vg.commit();
+    }
+
+    done.store(true);
+    for (auto& th : threads)
+        th.join();
+
+    if (failures.load() != 0)
+        test_failed(GraphSi<>(1));
+
+    vg.reclaim();
+    if (vg.retiredRows() != 0)
+        test_failed(GraphSi<>(1));
+}
+
+
+void versioned_graph_test()
+{
+    printf("versioned graph test...\n");
+    fflush(stdout);
+
+    printf("   graph snapshots"); fflush(stdout);
+    versioned_graph_test_<false>(200);
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   digraph snapshots"); fflush(stdout);
+    versioned_graph_test_<true>(200);
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   algorithms on snapshot"); fflush(stdout);
+    algorithm_test_();
+    printf("  > passed\n"); fflush(stdout);
+
+    printf("   concurrent readers"); fflush(stdout);
+    concurrent_test_(4, 2000);
+    printf("  > passed\n"); fflush(stdout);
+}
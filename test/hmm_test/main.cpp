@@ -26,8 +26,8 @@ void test_hmm()
 		abort();
 	}
 
-	// ˴istreamxbin־ΪfalseΪļkeyַͷ
-	// ȡkey֮readTableݺԶistreamxbin
+	// 此处istreamx的bin标志设为false，因为文件以key字符串开头，
+	// 读取key之后，readTable将根据后续内容自动设置istreamx的bin标记
 	if (!KuKaldiIO::readTable(stdx::istreamx(ark, false), key, table)) {
 		printf("failed to read table from 'test/data/feature.39.ark'");
 		abort();
@@ -44,7 +44,7 @@ void test_hmm()
 	}
 	printf("ok\n");
 
-	// ر
+	// 加载比照数据
 	std::vector<std::vector<double>> answer;
 	std::ifstream loglikes("../test/data/loglikes.ark", std::ios_base::binary);
 	if (!loglikes) {
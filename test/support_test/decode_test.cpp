@@ -25,7 +25,7 @@ void decode_test()
 	}
 
 	auto viterbi = KtViterbiBeam(models.wfst());
-	int maxIter(5); // 5
+	int maxIter(5); // 最多重试5次
 	auto pdf = [&models](unsigned transId, const std::vector<double>& feat) {
 		return models.prob(transId, feat.data()); };
 
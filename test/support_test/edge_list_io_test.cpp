@@ -0,0 +1,153 @@
+#include "kgraph/KuEdgeListIO.h"
+#include "../graph/GraphX.h"
+#include "../graph/core/KtAdjIter.h"
+#include "../graph/util/randgen.h"
+#include "../graph/util/is_same.h"
+#include <sstream>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+// 将图g输出为边列表，外部id为v * scale + offset
+template<typename GRAPH>
+static std::string dump_edges_(const GRAPH& g, KuEdgeListIO::KeFormat fmt,
+	std::uint64_t scale = 1, std::uint64_t offset = 0)
+{
+	std::string str;
+	if (fmt == KuEdgeListIO::k_csv)
+		str += "from,to,weight\n";
+	else
+		str += "# kgraph edge list\n";
+
+	char buf[128];
+	for (unsigned v = 0; v < g.order(); v++) {
+		for (auto iter = KtAdjIter(g, v); !iter.isEnd(); ++iter) {
+			std::uint64_t from = v * scale + offset, to = *iter * scale + offset;
+			float wt = iter.edge();
+			if (fmt == KuEdgeListIO::k_csv)
+				snprintf(buf, sizeof(buf), "%llu,%llu,%.9g\n", (unsigned long long)from, (unsigned long long)to, wt);
+			else if (fmt == KuEdgeListIO::k_text)
+				snprintf(buf, sizeof(buf), " %llu\t%llu  %.9g\r\n", (unsigned long long)from, (unsigned long long)to, wt);
+			else {
+				std::uint32_t ft[2] = { std::uint32_t(from), std::uint32_t(to) };
+				str.append((const char*)ft, sizeof(ft));
+				if (fmt == KuEdgeListIO::k_binary_triple)
+					str.append((const char*)&wt, sizeof(wt));
+				continue;
+			}
+
+			str += buf;
+		}
+	}
+
+	if (fmt == KuEdgeListIO::k_binary_pair || fmt == KuEdgeListIO::k_binary_triple)
+		str.erase(0, str.find('\n') + 1); // 二进制格式没有注释行
+
+	return str;
+}
+
+
+template<typename GRAPH>
+static void edge_list_test_(const char* name, const GRAPH& g, KuEdgeListIO::KpOptions opt,
+	std::uint64_t scale = 1, std::uint64_t offset = 0)
+{
+	printf("  %s: ", name);
+
+	std::istringstream iss(dump_edges_(g, opt.format, scale, offset));
+	GRAPH g2;
+	std::vector<std::uint64_t> ids;
+	if (!KuEdgeListIO::read(iss, g2, opt, &ids)) {
+		printf("read failed\n");
+		abort();
+	}
+
+	// 测试图不含孤立顶点，因此顶点数应一致
+	if (!is_topo_same(g, g2)) {
+		printf("failed\n");
+		abort();
+	}
+
+	if (opt.remap) {
+		for (unsigned v = 0; v < g.order(); v++)
+			if (ids[v] != v * scale + offset) {
+				printf("remap failed\n");
+				abort();
+			}
+	}
+
+	printf("passed\n");
+}
+
+
+void edge_list_io_test()
+{
+	printf("test edge list io...\n");
+
+	auto g = randgen<DigraphFf<true>>(500, 8000);
+	for (unsigned v = 0; v + 1 < g.order(); v++)
+		g.addEdge(v, v + 1, 1); // 确保没有孤立顶点
+
+	KuEdgeListIO::KpOptions opt;
+	opt.threads = 4;
+	opt.chunkBytes = 1000; // 使行跨越读入块的边界
+
+	opt.format = KuEdgeListIO::k_text;
+	edge_list_test_("text", g, opt);
+
+	opt.format = KuEdgeListIO::k_csv;
+	opt.skipHeader = true;
+	edge_list_test_("csv", g, opt);
+
+	opt.skipHeader = false;
+	opt.format = KuEdgeListIO::k_binary_triple;
+	edge_list_test_("binary triple", g, opt);
+
+	opt.format = KuEdgeListIO::k_text;
+	opt.remap = true;
+	edge_list_test_("text with remap", g, opt, 1000003, 17);
+
+	opt.threads = 1;
+	opt.chunkBytes = 1 << 20;
+	edge_list_test_("text with remap (1 thread)", g, opt, 1000003, 17);
+
+	// 二进制无权边
+	auto rg = randgen<GraphFf<>>(300, 3000);
+	GraphFf<> ug(rg.order());
+	for (unsigned v = 0; v < rg.order(); v++) { // 边值取缺省值1
+		if (v + 1 < rg.order())
+			ug.addEdge(v, v + 1, 1);
+		for (auto iter = KtAdjIter(rg, v); !iter.isEnd(); ++iter)
+			if (*iter >= v)
+				ug.addEdge(v, *iter, 1);
+	}
+
+	GraphFf<> ug2;
+	std::string bin;
+	for (unsigned v = 0; v < ug.order(); v++)
+		for (auto iter = KtAdjIter(ug, v); !iter.isEnd(); ++iter)
+			if (*iter >= v) {
+				std::uint64_t ft[2] = { v, *iter };
+				bin.append((const char*)ft, sizeof(ft));
+			}
+
+	printf("  binary pair (64-bit ids): ");
+	opt = KuEdgeListIO::KpOptions{};
+	opt.format = KuEdgeListIO::k_binary_pair;
+	opt.idBytes = 8;
+	std::istringstream iss(bin);
+	if (!KuEdgeListIO::read(iss, ug2, opt) || !is_topo_same(ug, ug2)) {
+		printf("failed\n");
+		abort();
+	}
+	printf("passed\n");
+
+	// 格式错误
+	printf("  malformed input: ");
+	std::istringstream bad("0 1\n1 x\n");
+	DigraphFf<> bg;
+	if (KuEdgeListIO::read(bad, bg)) {
+		printf("failed\n");
+		abort();
+	}
+	printf("passed\n");
+}
@@ -0,0 +1,105 @@
+#include "kgraph/KuGraphIO.h"
+#include "../graph/GraphX.h"
+#include "../graph/util/randgen.h"
+#include "../graph/util/is_same.h"
+#include <sstream>
+#include <fstream>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+template<typename G1, typename G2>
+static void graph_io_test_(const char* name)
+{
+	printf("  %s: ", name);
+
+	auto g1 = randgen<G1>(300, 3000);
+	const char* path = "./graph_io_test.kg";
+	if (!KuGraphIO::write(path, g1)) {
+		printf("failed to write '%s'\n", path);
+		abort();
+	}
+
+	G2 g2;
+	if (!KuGraphIO::read(path, g2) || !is_topo_same(g1, g2)) {
+		printf("read failed\n");
+		abort();
+	}
+
+	MmapGraph<float, G1::isDigraph(), G1::isAlwaysSorted()> g3;
+	if (!KuGraphIO::map(path, g3, true) || !is_topo_same(g1, g3)) {
+		printf("map failed\n");
+		abort();
+	}
+
+	printf("passed\n");
+}
+
+
+void graph_io_test()
+{
+	printf("test kgraph binary io...\n");
+
+	graph_io_test_<DigraphDf, DigraphFf<true>>("dense digraph -> flat digraph");
+	graph_io_test_<GraphSf<true>, GraphFf<>>("sparse graph -> flat graph");
+	graph_io_test_<DigraphCf<true>, DigraphPf<>>("soa digraph -> sparse digraph");
+	graph_io_test_<GraphFf<>, GraphPf<true>>("flat graph -> sparse graph");
+
+	// 类型不匹配、数据损坏时应拒绝载入
+	auto g = randgen<DigraphFf<>>(100, 500);
+	std::stringstream ss;
+	KuGraphIO::write(ss, g);
+
+	GraphFf<> ug;
+	std::istringstream iss1(ss.str());
+	if (KuGraphIO::read(iss1, ug)) {
+		printf("  failed to reject mismatched graph type\n");
+		abort();
+	}
+
+	auto bytes = ss.str();
+	bytes[bytes.size() - 1] ^= 0x5a;
+	DigraphFf<> dg;
+	std::istringstream iss2(bytes);
+	if (KuGraphIO::read(iss2, dg)) {
+		printf("  failed to reject corrupted file\n");
+		abort();
+	}
+
+	// 截断的文件不能映射；to顶点越界的文件在校验时被拒绝
+	auto mapBytes = [](const std::string& data) {
+		const char* path = "./graph_io_test.kg";
+		{
+			std::ofstream ofs(path, std::ios_base::binary);
+			ofs.write(data.data(), data.size());
+		}
+		MmapGraph<float, true> mg;
+		return std::make_pair(KuGraphIO::map(path, mg, false), KuGraphIO::map(path, mg, true));
+	};
+
+	auto good = ss.str();
+	if (!mapBytes(good).first || !mapBytes(good).second) {
+		printf("  failed to map valid file\n");
+		abort();
+	}
+
+	auto r = mapBytes(good.substr(0, good.size() - 8));
+	if (r.first || r.second) {
+		printf("  failed to reject truncated file\n");
+		abort();
+	}
+
+	KuGraphIO::KpGraphHeader hdr;
+	std::istringstream iss3(good);
+	KuGraphIO::readHeader(iss3, hdr);
+	auto bad = good;
+	auto toPos = hdr.edgePos + hdr.edgeToOffset;
+	std::uint32_t to = 100000;
+	bad.replace(toPos, sizeof(to), reinterpret_cast<const char*>(&to), sizeof(to));
+	if (mapBytes(bad).second) {
+		printf("  failed to reject out-of-range vertex\n");
+		abort();
+	}
+
+	printf("  passed\n");
+}
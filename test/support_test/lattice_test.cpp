@@ -4,7 +4,7 @@
 #include "istreamx.h"
 
 
-// ȡkaldi-latļ
+// 读取kaldi-lat文件测试
 void lattice_test()
 {
 	printf("test kaldi lattice...\n");
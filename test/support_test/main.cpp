@@ -6,6 +6,8 @@ extern void kaldi_table_test();
 extern void transition_model_test();
 extern void lattice_test();
 extern void decode_test();
+extern void graph_io_test();
+extern void edge_list_io_test();
 
 int main(int argc, char const* argv[])
 {	
@@ -14,6 +16,8 @@ int main(int argc, char const* argv[])
 	transition_model_test();
 	lattice_test();
 	decode_test();
+	graph_io_test();
+	edge_list_io_test();
 
 	printf(" :) All passed! press any key to exit.\n");
 	getchar();
@@ -62,12 +62,12 @@ void test_with_eps_()
 	
 	KtEpsMatchFilter<fst_type, fst_type, '#'> filterM;
 	auto comM = KtComposite(fst1, fst2, filterM);
-	if (!comM.ok()) // TODO: ȫĲ
+	if (!comM.ok()) // TODO: 更全面的测试
 		test_failed(comM.wfst());
 
 	KtEpsSeqFilter<fst_type, fst_type, '#'> filterS;
 	auto comS = KtComposite(fst1, fst2, filterS);
-	if (!comS.ok()) // TODO: ȫĲ
+	if (!comS.ok()) // TODO: 更全面的测试
 		test_failed(comS.wfst());
 
 	printf("  > passed\n"); fflush(stdout);
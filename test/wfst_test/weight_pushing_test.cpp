@@ -3,7 +3,7 @@
 #include "../graph/test_util.h"
 
 
-// valnλС
+// 对val的n位小数四舍五入
 template<typename T>
 T round(const T& val, int n)
 {